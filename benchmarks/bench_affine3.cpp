@@ -0,0 +1,163 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/affine3.h"
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/vector.h"
+#include "mu/vector3d.h"
+
+/********************************* Affine3 *********************************/
+
+/* affine transformations compared to the same operations on the equivalent
+ * homogeneous 4x4 matrix. for the batched transformation, the number of points
+ * is the benchmark argument */
+
+template <typename T>
+mu::Affine3<T> make_affine() {
+  return mu::Affine3<T>{
+      mu::Quaternion<T>{mu::Vector3D<T>{T{1}, T{2}, T{-3}}, T{0.7}},
+      mu::Vector3D<T>{T{0.5}, T{-1}, T{2}}};
+}
+
+template <typename T>
+std::vector<mu::Vector3D<T>> make_affine_points(std::size_t count) {
+  std::vector<mu::Vector3D<T>> ret(count);
+  for (std::size_t i = 0; i < count; i++) {
+    ret[i] = bench::make_vector<3, T>(i);
+  }
+  return ret;
+}
+
+template <typename T>
+void BM_Affine3TransformPoint(benchmark::State& state) {  // NOLINT
+  mu::Affine3<T> a = make_affine<T>();
+  mu::Vector3D<T> v = bench::make_vector<3, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(a.transform_point(v));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3TransformPoint, float);
+BENCHMARK_TEMPLATE(BM_Affine3TransformPoint, double);
+
+/* the point is a homogeneous Vector with w = 1 */
+template <typename T>
+void BM_Affine3MatrixDotPoint(benchmark::State& state) {  // NOLINT
+  mu::Matrix<4, 4, T> m = make_affine<T>().to_matrix();
+  mu::Vector<4, T> v = bench::make_vector<4, T>();
+  v[3] = T{1};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m);
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(m.dot(v));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3MatrixDotPoint, float);
+BENCHMARK_TEMPLATE(BM_Affine3MatrixDotPoint, double);
+
+template <typename T>
+void BM_Affine3Compose(benchmark::State& state) {  // NOLINT
+  mu::Affine3<T> a = make_affine<T>();
+  mu::Affine3<T> b = a.rigid_inverse();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3Compose, float);
+BENCHMARK_TEMPLATE(BM_Affine3Compose, double);
+
+template <typename T>
+void BM_Affine3MatrixDotCompose(benchmark::State& state) {  // NOLINT
+  mu::Matrix<4, 4, T> a = make_affine<T>().to_matrix();
+  mu::Matrix<4, 4, T> b = make_affine<T>().rigid_inverse().to_matrix();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.dot(b));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3MatrixDotCompose, float);
+BENCHMARK_TEMPLATE(BM_Affine3MatrixDotCompose, double);
+
+template <typename T>
+void BM_Affine3Inverse(benchmark::State& state) {  // NOLINT
+  mu::Affine3<T> a = make_affine<T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.inverse());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3Inverse, float);
+BENCHMARK_TEMPLATE(BM_Affine3Inverse, double);
+
+template <typename T>
+void BM_Affine3RigidInverse(benchmark::State& state) {  // NOLINT
+  mu::Affine3<T> a = make_affine<T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.rigid_inverse());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3RigidInverse, float);
+BENCHMARK_TEMPLATE(BM_Affine3RigidInverse, double);
+
+template <typename T>
+void BM_Affine3MatrixInverse(benchmark::State& state) {  // NOLINT
+  mu::Matrix<4, 4, T> m = make_affine<T>().to_matrix();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m);
+    benchmark::DoNotOptimize(m.inverse());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3MatrixInverse, float);
+BENCHMARK_TEMPLATE(BM_Affine3MatrixInverse, double);
+
+template <typename T>
+void BM_Affine3TransformPointsRange(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  const std::vector<mu::Vector3D<T>> kPoints = make_affine_points<T>(kCount);
+  std::vector<mu::Vector3D<T>> res(kCount);
+  mu::Affine3<T> a = make_affine<T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    a.transform_points(kPoints.begin(), kPoints.end(), res.begin());
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3TransformPointsRange, float)
+    ->Arg(1024)
+    ->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Affine3TransformPointsRange, double)
+    ->Arg(1024)
+    ->Arg(65536);
+
+template <typename T>
+void BM_Affine3MatrixDotPointsRange(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector<4, T>> points(kCount);
+  for (std::size_t i = 0; i < kCount; i++) {
+    points[i] = bench::make_vector<4, T>(i);
+    points[i][3] = T{1};
+  }
+  std::vector<mu::Vector<4, T>> res(kCount);
+  mu::Matrix<4, 4, T> m = make_affine<T>().to_matrix();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m);
+    for (std::size_t i = 0; i < kCount; i++) {
+      res[i] = m.dot(points[i]);
+    }
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Affine3MatrixDotPointsRange, float)
+    ->Arg(1024)
+    ->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Affine3MatrixDotPointsRange, double)
+    ->Arg(1024)
+    ->Arg(65536);
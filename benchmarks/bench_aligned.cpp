@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/aligned.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/********************************* Aligned *********************************/
+
+/* elementwise operations of AlignedVector and AlignedMatrix (aligned loads,
+ * full registers) compared to Vector and Matrix with the same values */
+
+template <std::size_t N, typename T>
+void BM_VectorPlusEqual(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(b);
+    a += b;
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK_TEMPLATE(BM_VectorPlusEqual, 3, float);
+BENCHMARK_TEMPLATE(BM_VectorPlusEqual, 4, float);
+BENCHMARK_TEMPLATE(BM_VectorPlusEqual, 3, double);
+BENCHMARK_TEMPLATE(BM_VectorPlusEqual, 7, double);
+
+template <std::size_t N, typename T>
+void BM_AlignedVectorPlusEqual(benchmark::State& state) {  // NOLINT
+  mu::AlignedVector<N, T> a = bench::make_vector<N, T>(0);
+  mu::AlignedVector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(b);
+    a += b;
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK_TEMPLATE(BM_AlignedVectorPlusEqual, 3, float);
+BENCHMARK_TEMPLATE(BM_AlignedVectorPlusEqual, 4, float);
+BENCHMARK_TEMPLATE(BM_AlignedVectorPlusEqual, 3, double);
+BENCHMARK_TEMPLATE(BM_AlignedVectorPlusEqual, 7, double);
+
+/* an array of 3D points moved by the same offset. the number of points is
+ * the benchmark argument */
+template <typename TVector>
+void BM_PointsMinusEqual(benchmark::State& state) {  // NOLINT
+  using T = typename TVector::value_type;
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<TVector, mu::AlignedAllocator<TVector>> points(kCount);
+  for (std::size_t i = 0; i < kCount; i++) {
+    points[i] = bench::make_vector<3, T>(i);
+  }
+  const TVector kOffset = bench::make_vector<3, T>();
+  for (auto _ : state) {
+    for (auto& p : points) {
+      p -= kOffset;
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_PointsMinusEqual, mu::Vector<3, float>)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_PointsMinusEqual, mu::AlignedVector<3, float>)
+    ->Arg(1024);
+
+template <std::size_t N, typename T>
+void BM_MatrixMultiplyEqual(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(b);
+    a *= b;
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixMultiplyEqual, 3, float);
+BENCHMARK_TEMPLATE(BM_MatrixMultiplyEqual, 4, float);
+BENCHMARK_TEMPLATE(BM_MatrixMultiplyEqual, 3, double);
+
+template <std::size_t N, typename T>
+void BM_AlignedMatrixMultiplyEqual(benchmark::State& state) {  // NOLINT
+  mu::AlignedMatrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::AlignedMatrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(b);
+    a *= b;
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK_TEMPLATE(BM_AlignedMatrixMultiplyEqual, 3, float);
+BENCHMARK_TEMPLATE(BM_AlignedMatrixMultiplyEqual, 4, float);
+BENCHMARK_TEMPLATE(BM_AlignedMatrixMultiplyEqual, 3, double);
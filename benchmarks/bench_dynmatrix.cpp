@@ -0,0 +1,104 @@
+#include <cstddef>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/******************************** DynMatrix ********************************/
+
+/* DynMatrix and DynVector (size known at run time, heap) compared to Matrix
+ * and Vector (size known at compile time) with the same values. the fixed
+ * size objects are allocated on the heap too, so that 256x256 fits */
+
+template <std::size_t N, typename T>
+void BM_MatrixDotMatrixFixed(benchmark::State& state) {  // NOLINT
+  const auto kA =
+      std::make_unique<mu::Matrix<N, N, T>>(bench::make_matrix<N, N, T>(0));
+  const auto kB =
+      std::make_unique<mu::Matrix<N, N, T>>(bench::make_matrix<N, N, T>(1));
+  auto res = std::make_unique<mu::Matrix<N, N, T>>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.get());
+    *res = kA->dot(*kB);
+    benchmark::DoNotOptimize(res.get());
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixDotMatrixFixed, 64, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotMatrixFixed, 256, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotMatrixFixed, 64, double);
+
+template <std::size_t N, typename T>
+void BM_DynMatrixDotMatrix(benchmark::State& state) {  // NOLINT
+  const mu::DynMatrix<T> kA(bench::make_matrix<N, N, T>(0));
+  const mu::DynMatrix<T> kB(bench::make_matrix<N, N, T>(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.data());
+    mu::DynMatrix<T> res = kA.dot(kB);
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_DynMatrixDotMatrix, 64, float);
+BENCHMARK_TEMPLATE(BM_DynMatrixDotMatrix, 256, float);
+BENCHMARK_TEMPLATE(BM_DynMatrixDotMatrix, 64, double);
+
+template <std::size_t N, typename T>
+void BM_MatrixDotVectorFixed(benchmark::State& state) {  // NOLINT
+  const auto kA =
+      std::make_unique<mu::Matrix<N, N, T>>(bench::make_matrix<N, N, T>(0));
+  const mu::Vector<N, T> kB = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.get());
+    mu::Vector<N, T> res = kA->dot(kB);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixDotVectorFixed, 64, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotVectorFixed, 256, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotVectorFixed, 64, double);
+
+template <std::size_t N, typename T>
+void BM_DynMatrixDotVector(benchmark::State& state) {  // NOLINT
+  const mu::DynMatrix<T> kA(bench::make_matrix<N, N, T>(0));
+  const mu::DynVector<T> kB(bench::make_vector<N, T>(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.data());
+    mu::DynVector<T> res = kA.dot(kB);
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_DynMatrixDotVector, 64, float);
+BENCHMARK_TEMPLATE(BM_DynMatrixDotVector, 256, float);
+BENCHMARK_TEMPLATE(BM_DynMatrixDotVector, 64, double);
+
+template <std::size_t N, typename T>
+void BM_MatrixDetFixed(benchmark::State& state) {  // NOLINT
+  auto a =
+      std::make_unique<mu::Matrix<N, N, T>>(bench::make_matrix<N, N, T>(0));
+  for (std::size_t i = 0; i < N; i++) {
+    (*a)[i][i] += static_cast<T>(N);  // not singular
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.get());
+    T res = a->det();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixDetFixed, 64, double);
+
+template <std::size_t N, typename T>
+void BM_DynMatrixDet(benchmark::State& state) {  // NOLINT
+  mu::DynMatrix<T> a(bench::make_matrix<N, N, T>(0));
+  for (std::size_t i = 0; i < N; i++) {
+    a[i][i] += static_cast<T>(N);  // not singular
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    T res = a.det();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK_TEMPLATE(BM_DynMatrixDet, 64, double);
@@ -0,0 +1,100 @@
+#include <cstddef>
+#include <sstream>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "mu/format.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/********************************** Format *********************************/
+
+/* the text of a batch of Vector<3, float> and Matrix<4, 4, float> written
+ * into a std::stringstream by operator<< compared to the FormatWriter */
+
+std::vector<mu::Vector<3, float>> make_format_vectors(std::size_t size) {
+  std::vector<mu::Vector<3, float>> ret(size);
+  for (std::size_t i = 0; i < size; i++) {
+    ret[i] = {static_cast<float>(i) * 0.37F, -1.25F,
+              static_cast<float>(i % 1000) / 7.0F};
+  }
+  return ret;
+}
+
+std::vector<mu::Matrix<4, 4, float>> make_format_matrices(std::size_t size) {
+  std::vector<mu::Matrix<4, 4, float>> ret(size);
+  for (std::size_t i = 0; i < size; i++) {
+    for (std::size_t j = 0; j < 16; j++) {
+      ret[i][j / 4][j % 4] = static_cast<float>(i + j) / 3.0F;
+    }
+  }
+  return ret;
+}
+
+void BM_VectorStreamOut(benchmark::State& state) {  // NOLINT
+  const std::vector<mu::Vector<3, float>> kVectors =
+      make_format_vectors(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::stringstream ss;
+    for (const auto& v : kVectors) {
+      ss << v << '\n';
+    }
+    benchmark::DoNotOptimize(ss);
+  }
+}
+BENCHMARK(BM_VectorStreamOut)->Arg(1024)->Arg(65536);
+
+void BM_VectorFormatWriter(benchmark::State& state) {  // NOLINT
+  const std::vector<mu::Vector<3, float>> kVectors =
+      make_format_vectors(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::stringstream ss;
+    {
+      mu::FormatWriter writer(ss);
+      writer.write(kVectors.data(), kVectors.size());
+    }
+    benchmark::DoNotOptimize(ss);
+  }
+}
+BENCHMARK(BM_VectorFormatWriter)->Arg(1024)->Arg(65536);
+
+void BM_VectorFormatTo(benchmark::State& state) {  // NOLINT
+  const std::vector<mu::Vector<3, float>> kVectors =
+      make_format_vectors(static_cast<std::size_t>(state.range(0)));
+  std::vector<char> buffer(kVectors.size() *
+                           (mu::format_max_size(kVectors[0]) + 1));
+  for (auto _ : state) {
+    char* end = mu::format_to(buffer.data(), buffer.data() + buffer.size(),
+                              kVectors.data(), kVectors.size(),
+                              mu::FormatStyle::csv());
+    benchmark::DoNotOptimize(end);
+  }
+}
+BENCHMARK(BM_VectorFormatTo)->Arg(1024)->Arg(65536);
+
+void BM_MatrixStreamOut(benchmark::State& state) {  // NOLINT
+  const std::vector<mu::Matrix<4, 4, float>> kMatrices =
+      make_format_matrices(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::stringstream ss;
+    for (const auto& m : kMatrices) {
+      ss << m << '\n';
+    }
+    benchmark::DoNotOptimize(ss);
+  }
+}
+BENCHMARK(BM_MatrixStreamOut)->Arg(1024);
+
+void BM_MatrixFormatWriter(benchmark::State& state) {  // NOLINT
+  const std::vector<mu::Matrix<4, 4, float>> kMatrices =
+      make_format_matrices(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::stringstream ss;
+    {
+      mu::FormatWriter writer(ss);
+      writer.write(kMatrices.data(), kMatrices.size());
+    }
+    benchmark::DoNotOptimize(ss);
+  }
+}
+BENCHMARK(BM_MatrixFormatWriter)->Arg(1024);
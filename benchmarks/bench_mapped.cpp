@@ -0,0 +1,119 @@
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "mu/mapped.h"
+#include "mu/vector.h"
+
+/********************************** Mapped *********************************/
+
+/* loading and summing up an array of Vector<3, float> from a file. the
+ * binary array file (MappedArray) is compared to reading the same values
+ * from a binary file into a std::vector and to parsing a text file. the
+ * files are in the page cache after the first iteration */
+
+std::vector<mu::Vector<3, float>> make_points(std::size_t size) {
+  std::vector<mu::Vector<3, float>> ret(size);
+  for (std::size_t i = 0; i < size; i++) {
+    ret[i] = {static_cast<float>(i % 100), 1.5F, static_cast<float>(i % 7)};
+  }
+  return ret;
+}
+
+std::string points_file(std::size_t size) {
+  const std::string kPath =
+      "mu_bench_points_" + std::to_string(size) + ".bin";
+  mu::MappedArrayWriter<mu::Vector<3, float>> writer(kPath);
+  const std::vector<mu::Vector<3, float>> kPoints = make_points(size);
+  writer.write(kPoints.data(), kPoints.size());
+  return kPath;
+}
+
+void BM_MappedArrayOpenSum(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::string kPath = points_file(kSize);
+  for (auto _ : state) {
+    const mu::MappedArray<mu::Vector<3, float>> kPoints(kPath);
+    mu::Vector<3, float> sum{};
+    for (const auto& p : kPoints) {
+      sum += p;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(kPath.c_str());
+}
+BENCHMARK(BM_MappedArrayOpenSum)->Arg(1 << 16)->Arg(1 << 20);
+
+/* the single element that is actually needed */
+void BM_MappedArrayOpenRandomAccess(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::string kPath = points_file(kSize);
+  for (auto _ : state) {
+    const mu::MappedArray<mu::Vector<3, float>> kPoints(kPath);
+    mu::Vector<3, float> p = kPoints[kSize / 2];
+    benchmark::DoNotOptimize(p);
+  }
+  std::remove(kPath.c_str());
+}
+BENCHMARK(BM_MappedArrayOpenRandomAccess)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_IfstreamReadSum(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::string kPath = points_file(kSize);
+  for (auto _ : state) {
+    std::ifstream file(kPath, std::ios::binary);
+    file.seekg(sizeof(mu::MappedHeader));
+    std::vector<mu::Vector<3, float>> points(kSize);
+    file.read(reinterpret_cast<char*>(points.data()),
+              static_cast<std::streamsize>(kSize * sizeof(points[0])));
+    mu::Vector<3, float> sum{};
+    for (const auto& p : points) {
+      sum += p;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(kPath.c_str());
+}
+BENCHMARK(BM_IfstreamReadSum)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_TextParseSum(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::string kPath = "mu_bench_points.txt";
+  {
+    std::ofstream file(kPath);
+    for (const auto& p : make_points(kSize)) {
+      file << p[0] << ' ' << p[1] << ' ' << p[2] << '\n';
+    }
+  }
+  for (auto _ : state) {
+    std::ifstream file(kPath);
+    std::vector<mu::Vector<3, float>> points(kSize);
+    for (auto& p : points) {
+      file >> p[0] >> p[1] >> p[2];
+    }
+    mu::Vector<3, float> sum{};
+    for (const auto& p : points) {
+      sum += p;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(kPath.c_str());
+}
+BENCHMARK(BM_TextParseSum)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_MappedArrayWriter(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::vector<mu::Vector<3, float>> kPoints = make_points(kSize);
+  for (auto _ : state) {
+    mu::MappedArrayWriter<mu::Vector<3, float>> writer("mu_bench_write.bin");
+    for (const auto& p : kPoints) {
+      writer.push_back(p);
+    }
+  }
+  std::remove("mu_bench_write.bin");
+}
+BENCHMARK(BM_MappedArrayWriter)->Arg(1 << 16);
@@ -0,0 +1,231 @@
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/colmajor.h"
+#include "mu/matrix.h"
+
+/********************************* Matrix **********************************/
+
+/* all matrices are square (N x N) */
+
+template <std::size_t N, typename T>
+void BM_MatrixDot(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.dot(b));
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixDot)
+
+/* reference for BM_MatrixDot. the textbook i-j-k loop that is used for small
+ * matrices */
+template <std::size_t N, typename T>
+void BM_MatrixDotNaive(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    mu::Matrix<N, N, T> ret;
+    mu::gemm_naive<N, N, N, T>(a, b, ret);
+    benchmark::DoNotOptimize(ret);
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 16, int);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 64, int);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 256, int);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 16, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 64, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 256, float);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 16, double);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 64, double);
+BENCHMARK_TEMPLATE(BM_MatrixDotNaive, 256, double);
+
+template <std::size_t N, typename T>
+void BM_MatrixDotVector(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.dot(b));
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixDotVector)
+
+/* the same product with the values stored column by column. the columns are
+ * scaled and added up along the contiguous values */
+template <std::size_t N, typename T>
+void BM_ColMajorDotVector(benchmark::State& state) {  // NOLINT
+  mu::ColMajorMatrix<N, N, T> a(bench::make_matrix<N, N, T>());
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.dot(b));
+  }
+}
+MU_BENCHMARK_ALL(BM_ColMajorDotVector)
+
+template <std::size_t N, typename T>
+void BM_MatrixTransposed(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.transposed());
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixTransposed)
+
+template <std::size_t N, typename T>
+void BM_MatrixDet(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.det());
+  }
+}
+/* the fraction-free elimination for integral types overflows int quickly for
+ * larger sizes, which is undefined behavior */
+BENCHMARK_TEMPLATE(BM_MatrixDet, 2, int);
+BENCHMARK_TEMPLATE(BM_MatrixDet, 3, int);
+BENCHMARK_TEMPLATE(BM_MatrixDet, 4, int);
+BENCHMARK_TEMPLATE(BM_MatrixDet, 8, int);
+MU_BENCHMARK_SIZES(BM_MatrixDet, float)
+MU_BENCHMARK_SIZES(BM_MatrixDet, double)
+
+template <std::size_t N, typename T>
+void BM_MatrixSum(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.sum());
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixSum)
+
+template <std::size_t N, typename T>
+void BM_MatrixStd(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.std());
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixStd)
+
+/**************************** matrix <> matrix *****************************/
+
+/* see vector benchmarks on why binary operators are measured */
+
+template <std::size_t N, typename T>
+void BM_MatrixPlus(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a + b);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixPlus)
+
+template <std::size_t N, typename T>
+void BM_MatrixMinus(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a - b);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixMinus)
+
+template <std::size_t N, typename T>
+void BM_MatrixMultiply(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixMultiply)
+
+template <std::size_t N, typename T>
+void BM_MatrixDivide(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>(0);
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a / b);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixDivide)
+
+template <std::size_t N, typename T>
+void BM_MatrixEqual(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  mu::Matrix<N, N, T> b = bench::make_matrix<N, N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixEqual)
+
+/**************************** matrix <> scalar *****************************/
+
+template <std::size_t N, typename T>
+void BM_MatrixPlusScalar(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a + scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixPlusScalar)
+
+template <std::size_t N, typename T>
+void BM_MatrixMinusScalar(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a - scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixMinusScalar)
+
+template <std::size_t N, typename T>
+void BM_MatrixMultiplyScalar(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a * scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixMultiplyScalar)
+
+template <std::size_t N, typename T>
+void BM_MatrixDivideScalar(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = bench::make_matrix<N, N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a / scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_MatrixDivideScalar)
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+
+/******************************** parallel *********************************/
+
+/* batched operations on 65536 entities. the first benchmark argument is the
+ * number of worker threads. with zero worker threads, the calling thread does
+ * all the work, which shows the overhead compared to the serial loop */
+
+template <typename T>
+std::vector<mu::Matrix<4, 4, T>> make_matrices(std::size_t count) {
+  std::vector<mu::Matrix<4, 4, T>> ret(count);
+  for (std::size_t i = 0; i < count; i++) {
+    ret[i] = bench::make_matrix<4, 4, T>(i);
+  }
+  return ret;
+}
+
+constexpr std::size_t kParallelCount = 65536;
+
+template <typename T>
+void BM_SerialDet(benchmark::State& state) {  // NOLINT
+  std::vector<mu::Matrix<4, 4, T>> a = make_matrices<T>(kParallelCount);
+  std::vector<T> res(a.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    std::transform(a.begin(), a.end(), res.begin(),
+                   [](const mu::Matrix<4, 4, T>& m) { return m.det(); });
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SerialDet, double);
+
+template <typename T>
+void BM_ParallelDet(benchmark::State& state) {  // NOLINT
+  mu::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+  std::vector<mu::Matrix<4, 4, T>> a = make_matrices<T>(kParallelCount);
+  std::vector<T> res(a.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    mu::parallel::transform(
+        pool, a.begin(), a.end(), res.begin(),
+        [](const mu::Matrix<4, 4, T>& m) { return m.det(); });
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_ParallelDet, double)
+    ->Arg(0)->Arg(1)->Arg(3)->Arg(7)->UseRealTime();
+
+template <typename T>
+void BM_SerialTransposed(benchmark::State& state) {  // NOLINT
+  std::vector<mu::Matrix<4, 4, T>> a = make_matrices<T>(kParallelCount);
+  std::vector<mu::Matrix<4, 4, T>> res(a.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    std::transform(
+        a.begin(), a.end(), res.begin(),
+        [](const mu::Matrix<4, 4, T>& m) { return m.transposed(); });
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SerialTransposed, float);
+
+template <typename T>
+void BM_ParallelTransposed(benchmark::State& state) {  // NOLINT
+  mu::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+  std::vector<mu::Matrix<4, 4, T>> a = make_matrices<T>(kParallelCount);
+  std::vector<mu::Matrix<4, 4, T>> res(a.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    mu::parallel::transform(
+        pool, a.begin(), a.end(), res.begin(),
+        [](const mu::Matrix<4, 4, T>& m) { return m.transposed(); });
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_ParallelTransposed, float)
+    ->Arg(0)->Arg(1)->Arg(3)->Arg(7)->UseRealTime();
+
+template <typename T>
+void BM_SerialSum(benchmark::State& state) {  // NOLINT
+  std::vector<mu::Matrix<4, 4, T>> a = make_matrices<T>(kParallelCount);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    mu::Matrix<4, 4, T> res{};
+    for (const auto& m : a) {
+      res += m;
+    }
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK_TEMPLATE(BM_SerialSum, float);
+
+template <typename T>
+void BM_ParallelSum(benchmark::State& state) {  // NOLINT
+  mu::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+  std::vector<mu::Matrix<4, 4, T>> a = make_matrices<T>(kParallelCount);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    benchmark::DoNotOptimize(
+        mu::parallel::reduce(pool, a.begin(), a.end(), mu::Matrix<4, 4, T>{},
+                             std::plus<mu::Matrix<4, 4, T>>()));
+  }
+}
+BENCHMARK_TEMPLATE(BM_ParallelSum, float)
+    ->Arg(0)->Arg(1)->Arg(3)->Arg(7)->UseRealTime();
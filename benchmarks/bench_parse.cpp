@@ -0,0 +1,72 @@
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "mu/format.h"
+#include "mu/parallel.h"
+#include "mu/parse.h"
+#include "mu/vector.h"
+
+/********************************** Parse **********************************/
+
+/* a CSV text of Vector<3, float>, one per line, read by std::istringstream
+ * compared to parse_list and mu::parallel::parse_list */
+
+std::string make_parse_csv(std::size_t size) {
+  std::stringstream ss;
+  mu::FormatWriter writer(ss, mu::FormatStyle::csv());
+  for (std::size_t i = 0; i < size; i++) {
+    writer.write(mu::Vector<3, float>{static_cast<float>(i) * 0.37F, -1.25F,
+                                      static_cast<float>(i % 1000) / 7.0F});
+  }
+  writer.close();
+  return ss.str();
+}
+
+void BM_ParseIstream(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const std::string kText = make_parse_csv(kSize);
+  for (auto _ : state) {
+    std::istringstream ss(kText);
+    std::vector<mu::Vector<3, float>> res(kSize);
+    char comma = 0;
+    for (auto& v : res) {
+      ss >> v[0] >> comma >> v[1] >> comma >> v[2];
+    }
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kText.size()));
+}
+BENCHMARK(BM_ParseIstream)->Arg(65536);
+
+void BM_ParseList(benchmark::State& state) {  // NOLINT
+  const std::string kText =
+      make_parse_csv(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::vector<mu::Vector<3, float>> res = mu::parse_list<mu::Vector<3, float>>(
+        kText.data(), kText.data() + kText.size());
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kText.size()));
+}
+BENCHMARK(BM_ParseList)->Arg(65536)->Arg(1 << 20);
+
+/* the number of worker threads is the second argument */
+void BM_ParseListParallel(benchmark::State& state) {  // NOLINT
+  const std::string kText =
+      make_parse_csv(static_cast<std::size_t>(state.range(0)));
+  mu::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    std::vector<mu::Vector<3, float>> res =
+        mu::parallel::parse_list<mu::Vector<3, float>>(
+            pool, kText.data(), kText.data() + kText.size());
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kText.size()));
+}
+BENCHMARK(BM_ParseListParallel)->Args({1 << 20, 0})->Args({1 << 20, 3});
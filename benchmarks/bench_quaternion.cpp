@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/vector3d.h"
+
+/******************************* Quaternion ********************************/
+
+/* rotation of 3D Vectors by a quaternion compared to the multiplication with
+ * the equivalent rotation matrix. the number of Vectors is the benchmark
+ * argument */
+
+template <typename T>
+mu::Quaternion<T> make_rotation() {
+  return mu::Quaternion<T>{mu::Vector3D<T>{T{1}, T{2}, T{-3}}, T{0.7}};
+}
+
+template <typename T>
+std::vector<mu::Vector3D<T>> make_points(std::size_t count) {
+  std::vector<mu::Vector3D<T>> ret(count);
+  for (std::size_t i = 0; i < count; i++) {
+    ret[i] = bench::make_vector<3, T>(i);
+  }
+  return ret;
+}
+
+template <typename T>
+void BM_QuaternionRotate(benchmark::State& state) {  // NOLINT
+  mu::Quaternion<T> q = make_rotation<T>();
+  mu::Vector3D<T> v = bench::make_vector<3, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(q);
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(q.rotate(v));
+  }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionRotate, float);
+BENCHMARK_TEMPLATE(BM_QuaternionRotate, double);
+
+/* the conversion to a matrix is part of every iteration */
+template <typename T>
+void BM_QuaternionMatrixDot(benchmark::State& state) {  // NOLINT
+  mu::Quaternion<T> q = make_rotation<T>();
+  mu::Vector3D<T> v = bench::make_vector<3, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(q);
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(q.to_matrix().dot(v));
+  }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionMatrixDot, float);
+BENCHMARK_TEMPLATE(BM_QuaternionMatrixDot, double);
+
+template <typename T>
+void BM_QuaternionMultiply(benchmark::State& state) {  // NOLINT
+  mu::Quaternion<T> a = make_rotation<T>();
+  mu::Quaternion<T> b = a.conjugate();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, float);
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, double);
+
+template <typename T>
+void BM_QuaternionSlerp(benchmark::State& state) {  // NOLINT
+  mu::Quaternion<T> a = make_rotation<T>();
+  mu::Quaternion<T> b = a.conjugate();
+  T t{0.3};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(t);
+    benchmark::DoNotOptimize(mu::slerp(a, b, t));
+  }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionSlerp, float);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerp, double);
+
+template <typename T>
+void BM_QuaternionRotateRange(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  const mu::Quaternion<T> kQ = make_rotation<T>();
+  const std::vector<mu::Vector3D<T>> kPoints = make_points<T>(kCount);
+  std::vector<mu::Vector3D<T>> res(kCount);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kPoints.data());
+    kQ.rotate(kPoints.begin(), kPoints.end(), res.begin());
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_QuaternionRotateRange, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_QuaternionRotateRange, double)->Arg(1024)->Arg(65536);
+
+/* the same rotation with a matrix that is built once */
+template <typename T>
+void BM_Matrix3x3DotRange(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  const mu::Matrix<3, 3, T> kR = make_rotation<T>().to_matrix();
+  const std::vector<mu::Vector3D<T>> kPoints = make_points<T>(kCount);
+  std::vector<mu::Vector3D<T>> res(kCount);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kPoints.data());
+    for (std::size_t i = 0; i < kCount; i++) {
+      res[i] = kR.dot(kPoints[i]);
+    }
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Matrix3x3DotRange, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Matrix3x3DotRange, double)->Arg(1024)->Arg(65536);
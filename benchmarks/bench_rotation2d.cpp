@@ -0,0 +1,109 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/rotation2d.h"
+#include "mu/vector2d.h"
+
+/******************************* Rotation2D ********************************/
+
+/* rotation of 2D Vectors by the same angle with Vector2D::rotate() (sine and
+ * cosine per Vector) and with a Rotation2D (sine and cosine once). the number
+ * of Vectors is the benchmark argument */
+
+template <typename T>
+std::vector<mu::Vector2D<T>> make_points2d(std::size_t count) {
+  std::vector<mu::Vector2D<T>> ret(count);
+  for (std::size_t i = 0; i < count; i++) {
+    ret[i] = bench::make_vector<2, T>(i);
+  }
+  return ret;
+}
+
+template <typename T>
+void BM_Vector2DRotateRange(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector2D<T>> points = make_points2d<T>(kCount);
+  T angle{0.7};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(angle);
+    for (auto& p : points) {
+      p.rotate(angle);
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector2DRotateRange, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Vector2DRotateRange, double)->Arg(1024)->Arg(65536);
+
+/* SIMD kernel (pointers) */
+template <typename T>
+void BM_Rotation2DRotateRange(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector2D<T>> points = make_points2d<T>(kCount);
+  T angle{0.7};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(angle);
+    const mu::Rotation2D<T> kRot{angle};
+    kRot.rotate(points.data(), points.data() + kCount, points.data());
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Rotation2DRotateRange, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Rotation2DRotateRange, double)->Arg(1024)->Arg(65536);
+
+/* plain loop (iterators) */
+template <typename T>
+void BM_Rotation2DRotateRangeLoop(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector2D<T>> points = make_points2d<T>(kCount);
+  T angle{0.7};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(angle);
+    const mu::Rotation2D<T> kRot{angle};
+    kRot.rotate(points.begin(), points.end(), points.begin());
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Rotation2DRotateRangeLoop, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Rotation2DRotateRangeLoop, double)
+    ->Arg(1024)
+    ->Arg(65536);
+
+/* a different angle for every Vector */
+template <typename T>
+void BM_Vector2DRotateAngles(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector2D<T>> points = make_points2d<T>(kCount);
+  std::vector<T> angles(kCount);
+  for (std::size_t i = 0; i < kCount; i++) {
+    angles[i] = bench::value<T>(i) / T{8};
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(angles.data());
+    for (std::size_t i = 0; i < kCount; i++) {
+      points[i].rotate(angles[i]);
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector2DRotateAngles, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Vector2DRotateAngles, double)->Arg(1024);
+
+template <typename T>
+void BM_Rotation2DRotateAngles(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector2D<T>> points = make_points2d<T>(kCount);
+  std::vector<T> angles(kCount);
+  for (std::size_t i = 0; i < kCount; i++) {
+    angles[i] = bench::value<T>(i) / T{8};
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(angles.data());
+    mu::rotate(points.begin(), points.end(), angles.begin(), points.begin());
+    benchmark::DoNotOptimize(points.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Rotation2DRotateAngles, float)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Rotation2DRotateAngles, double)->Arg(1024);
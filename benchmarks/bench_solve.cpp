@@ -0,0 +1,92 @@
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/matrix.h"
+#include "mu/solve.h"
+#include "mu/vector.h"
+
+/* the benchmark matrices repeat their rows for larger sizes. adding a
+ * dominant diagonal makes them well conditioned and invertible */
+template <std::size_t N, typename T>
+mu::Matrix<N, N, T> make_invertible() {
+  mu::Matrix<N, N, T> ret = bench::make_matrix<N, N, T>();
+  for (std::size_t i = 0; i < N; i++) {
+    ret[i][i] += static_cast<T>(10 * N);
+  }
+  return ret;
+}
+
+/* sizes 2 to 4 are closed form, larger sizes use the LU decomposition */
+// NOLINTNEXTLINE macro is used for convenience
+#define MU_BENCHMARK_SOLVE(func)          \
+  BENCHMARK_TEMPLATE(func, 2, float);     \
+  BENCHMARK_TEMPLATE(func, 3, float);     \
+  BENCHMARK_TEMPLATE(func, 4, float);     \
+  BENCHMARK_TEMPLATE(func, 8, float);     \
+  BENCHMARK_TEMPLATE(func, 16, float);    \
+  BENCHMARK_TEMPLATE(func, 64, float);    \
+  BENCHMARK_TEMPLATE(func, 2, double);    \
+  BENCHMARK_TEMPLATE(func, 3, double);    \
+  BENCHMARK_TEMPLATE(func, 4, double);    \
+  BENCHMARK_TEMPLATE(func, 8, double);    \
+  BENCHMARK_TEMPLATE(func, 16, double);   \
+  BENCHMARK_TEMPLATE(func, 64, double);
+
+template <std::size_t N, typename T>
+void BM_MatrixInverse(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = make_invertible<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.inverse());
+  }
+}
+MU_BENCHMARK_SOLVE(BM_MatrixInverse)
+
+/* solving with the inverse, i.e. what a caller would write without solve() */
+template <std::size_t N, typename T>
+void BM_SolveWithInverse(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = make_invertible<N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.inverse().dot(b));
+  }
+}
+MU_BENCHMARK_SOLVE(BM_SolveWithInverse)
+
+template <std::size_t N, typename T>
+void BM_Solve(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = make_invertible<N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(mu::solve(a, b));
+  }
+}
+MU_BENCHMARK_SOLVE(BM_Solve)
+
+/* the decomposition is reused, only the substitution is measured */
+template <std::size_t N, typename T>
+void BM_LUSolve(benchmark::State& state) {  // NOLINT
+  const mu::LU<N, T> kLU(make_invertible<N, T>());
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(kLU.solve(b));
+  }
+}
+MU_BENCHMARK_SOLVE(BM_LUSolve)
+
+template <std::size_t N, typename T>
+void BM_CholeskySolve(benchmark::State& state) {  // NOLINT
+  mu::Matrix<N, N, T> a = make_invertible<N, T>();
+  a = a.transposed().dot(a);
+  const mu::Cholesky<N, T> kChol(a);
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(kChol.solve(b));
+  }
+}
+MU_BENCHMARK_SOLVE(BM_CholeskySolve)
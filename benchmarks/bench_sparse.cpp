@@ -0,0 +1,89 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/parallel.h"
+#include "mu/sparse.h"
+
+/********************************** Sparse *********************************/
+
+/* about 1% of the values of a square matrix are non-zero. the sparse matrix
+ * times vector product is compared to the dense product of DynMatrix */
+
+template <typename T>
+std::vector<mu::Triplet<T>> make_triplets(std::size_t size) {
+  std::vector<mu::Triplet<T>> ret;
+  for (std::size_t i = 0; i < size; i++) {
+    for (std::size_t j = (i * 37) % 97; j < size; j += 97) {
+      ret.push_back({i, j, static_cast<T>(1 + (i + j) % 9)});
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+mu::DynVector<T> make_dynvector(std::size_t size) {
+  mu::DynVector<T> ret(size);
+  for (std::size_t i = 0; i < size; i++) {
+    ret[i] = static_cast<T>(1 + i % 4);
+  }
+  return ret;
+}
+
+template <typename T>
+void BM_DynMatrixDotVectorDense(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const mu::DynMatrix<T> kA =
+      mu::CsrMatrix<T>(kSize, kSize, make_triplets<T>(kSize)).to_dense();
+  const mu::DynVector<T> kB = make_dynvector<T>(kSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.data());
+    mu::DynVector<T> res = kA.dot(kB);
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_DynMatrixDotVectorDense, float)->Arg(1024)->Arg(4096);
+
+template <typename T, mu::SparseFormat F>
+void BM_SparseDotVector(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  const mu::SparseMatrix<T, F> kA(kSize, kSize, make_triplets<T>(kSize));
+  const mu::DynVector<T> kB = make_dynvector<T>(kSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.values());
+    mu::DynVector<T> res = kA.dot(kB);
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SparseDotVector, float, mu::SparseFormat::kCSR)
+    ->Arg(1024)
+    ->Arg(4096);
+BENCHMARK_TEMPLATE(BM_SparseDotVector, float, mu::SparseFormat::kCSC)
+    ->Arg(1024)
+    ->Arg(4096);
+BENCHMARK_TEMPLATE(BM_SparseDotVector, double, mu::SparseFormat::kCSR)
+    ->Arg(4096);
+
+/* the number of worker threads is the second argument */
+template <typename T, mu::SparseFormat F>
+void BM_SparseDotVectorParallel(benchmark::State& state) {  // NOLINT
+  const auto kSize = static_cast<std::size_t>(state.range(0));
+  mu::parallel::ThreadPool pool(static_cast<std::size_t>(state.range(1)));
+  const mu::SparseMatrix<T, F> kA(kSize, kSize, make_triplets<T>(kSize));
+  const mu::DynVector<T> kB = make_dynvector<T>(kSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kA.values());
+    mu::DynVector<T> res = mu::parallel::dot(pool, kA, kB);
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SparseDotVectorParallel, float, mu::SparseFormat::kCSR)
+    ->Args({4096, 0})
+    ->Args({4096, 3})
+    ->Args({16384, 0})
+    ->Args({16384, 3});
+BENCHMARK_TEMPLATE(BM_SparseDotVectorParallel, float, mu::SparseFormat::kCSC)
+    ->Args({16384, 0})
+    ->Args({16384, 3});
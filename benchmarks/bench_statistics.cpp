@@ -0,0 +1,45 @@
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/statistics.h"
+#include "mu/vector.h"
+
+/* a stream of 1024 samples, per push */
+template <std::size_t N, typename T>
+void BM_RunningStatsPush(benchmark::State& state) {  // NOLINT
+  std::vector<mu::Vector<N, T>> samples(1024);
+  for (std::size_t i = 0; i < samples.size(); i++) {
+    samples[i] = bench::make_vector<N, T>(i);
+  }
+  for (auto _ : state) {
+    mu::RunningStats<N, T> stats;
+    for (const auto& sample : samples) {
+      stats.push(sample);
+    }
+    benchmark::DoNotOptimize(stats);
+  }
+}
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 2, float);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 3, float);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 4, float);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 8, float);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 2, double);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 3, double);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 4, double);
+BENCHMARK_TEMPLATE(BM_RunningStatsPush, 8, double);
+
+template <std::size_t N, typename T>
+void BM_RunningStatsMerge(benchmark::State& state) {  // NOLINT
+  mu::RunningStats<N, T> a;
+  mu::RunningStats<N, T> b;
+  a.push(bench::make_vector<N, T>(0));
+  b.push(bench::make_vector<N, T>(1));
+  for (auto _ : state) {
+    mu::RunningStats<N, T> res = a;
+    benchmark::DoNotOptimize(res.merge(b));
+  }
+}
+BENCHMARK_TEMPLATE(BM_RunningStatsMerge, 3, float);
+BENCHMARK_TEMPLATE(BM_RunningStatsMerge, 3, double);
@@ -0,0 +1,65 @@
+#ifndef BENCHMARKS_BENCH_VALUES_H_
+#define BENCHMARKS_BENCH_VALUES_H_
+
+#include <cstddef>
+
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/**
+ * @brief registers a benchmark template for every benchmarked size of a type
+ *
+ * sizes: 2, 3, 4, 8, 16, 64, 256
+ */
+// NOLINTNEXTLINE macro is used for convenience
+#define MU_BENCHMARK_SIZES(func, T) \
+  BENCHMARK_TEMPLATE(func, 2, T);   \
+  BENCHMARK_TEMPLATE(func, 3, T);   \
+  BENCHMARK_TEMPLATE(func, 4, T);   \
+  BENCHMARK_TEMPLATE(func, 8, T);   \
+  BENCHMARK_TEMPLATE(func, 16, T);  \
+  BENCHMARK_TEMPLATE(func, 64, T);  \
+  BENCHMARK_TEMPLATE(func, 256, T);
+
+/**
+ * @brief registers a benchmark template for every benchmarked size and type
+ *
+ * types: int, float, double
+ */
+// NOLINTNEXTLINE macro is used for convenience
+#define MU_BENCHMARK_ALL(func)    \
+  MU_BENCHMARK_SIZES(func, int)   \
+  MU_BENCHMARK_SIZES(func, float) \
+  MU_BENCHMARK_SIZES(func, double)
+
+namespace bench {
+
+/* deterministic, non-zero input values. they stay within [1, 8.5] so that
+ * divisions are always defined and integral types cannot overflow in a single
+ * operation. the seed shifts the pattern (e.g. to get different matrix rows) */
+template <typename T>
+T value(std::size_t idx, std::size_t seed = 0) {
+  return static_cast<T>(1 + ((idx * 7 + seed * 3) % 16) / 2.0);
+}
+
+template <std::size_t N, typename T>
+mu::Vector<N, T> make_vector(std::size_t seed = 0) {
+  mu::Vector<N, T> ret;
+  for (std::size_t i = 0; i < N; i++) {
+    ret[i] = value<T>(i, seed);
+  }
+  return ret;
+}
+
+template <std::size_t N, std::size_t M, typename T>
+mu::Matrix<N, M, T> make_matrix(std::size_t seed = 0) {
+  mu::Matrix<N, M, T> ret;
+  for (std::size_t i = 0; i < N; i++) {
+    ret[i] = make_vector<M, T>(seed + i);
+  }
+  return ret;
+}
+
+}  // namespace bench
+
+#endif  // BENCHMARKS_BENCH_VALUES_H_
@@ -0,0 +1,372 @@
+#include <algorithm>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/expression.h"
+#include "mu/vector.h"
+#include "mu/vector3d.h"
+
+/********************************* Vector **********************************/
+
+template <std::size_t N, typename T>
+void BM_VectorDot(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.dot(b));
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorDot)
+
+template <std::size_t N, typename T>
+void BM_VectorSum(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.sum());
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorSum)
+
+template <std::size_t N, typename T>
+void BM_VectorStd(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.std());
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorStd)
+
+template <std::size_t N, typename T>
+void BM_VectorSort(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    /* sorted() copies, so every iteration sorts the same unsorted input */
+    benchmark::DoNotOptimize(a.sorted());
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorSort)
+BENCHMARK_TEMPLATE(BM_VectorSort, 32, int);
+BENCHMARK_TEMPLATE(BM_VectorSort, 32, float);
+BENCHMARK_TEMPLATE(BM_VectorSort, 32, double);
+
+/* std::sort as a reference for the sorting network of small sizes */
+template <std::size_t N, typename T>
+void BM_VectorSortStd(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    mu::Vector<N, T> b = a;
+    std::sort(b.begin(), b.end());
+    benchmark::DoNotOptimize(b);
+  }
+}
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 8, int);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 16, int);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 32, int);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 8, float);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 16, float);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 32, float);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 8, double);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 16, double);
+BENCHMARK_TEMPLATE(BM_VectorSortStd, 32, double);
+
+template <std::size_t N, typename T>
+void BM_VectorNormalize(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.normalized());
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorNormalize)
+
+/**************************** vector <> vector *****************************/
+
+/* the compound assignment operators (+=, -=, *=, /=) are what the binary
+ * operators forward to. measuring the binary operators keeps the input
+ * unchanged across iterations (no overflow or denormals) */
+
+template <std::size_t N, typename T>
+void BM_VectorPlus(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a + b);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorPlus)
+
+template <std::size_t N, typename T>
+void BM_VectorMinus(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a - b);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorMinus)
+
+template <std::size_t N, typename T>
+void BM_VectorMultiply(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorMultiply)
+
+template <std::size_t N, typename T>
+void BM_VectorDivide(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a / b);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorDivide)
+
+template <std::size_t N, typename T>
+void BM_VectorEqual(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    /* equal inputs, i.e. the worst case where every element is compared */
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorEqual)
+
+/* the elementwise loop as a reference for the SIMD kernel of operator== */
+template <std::size_t N, typename T>
+void BM_VectorEqualLoop(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    bool equal = true;
+    for (std::size_t i = 0; i < N && equal; i++) {
+      equal = mu::TypeTraits<T>::equals(a[i], b[i]) &&
+              mu::TypeTraits<T>::equals(a[i], b[i]);
+    }
+    benchmark::DoNotOptimize(equal);
+  }
+}
+MU_BENCHMARK_SIZES(BM_VectorEqualLoop, float)
+MU_BENCHMARK_SIZES(BM_VectorEqualLoop, double)
+
+template <std::size_t N, typename T>
+void BM_VectorEqualUlp(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.equals(b, mu::Tolerance::ulp(4)));
+  }
+}
+MU_BENCHMARK_SIZES(BM_VectorEqualUlp, float)
+MU_BENCHMARK_SIZES(BM_VectorEqualUlp, double)
+
+template <std::size_t N, typename T>
+void BM_VectorEqualAbsolute(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  mu::Vector<N, T> b = bench::make_vector<N, T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.equals(b, mu::Tolerance::absolute(1e-3)));
+  }
+}
+MU_BENCHMARK_SIZES(BM_VectorEqualAbsolute, float)
+MU_BENCHMARK_SIZES(BM_VectorEqualAbsolute, double)
+
+/**************************** vector <> scalar *****************************/
+
+template <std::size_t N, typename T>
+void BM_VectorPlusScalar(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a + scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorPlusScalar)
+
+template <std::size_t N, typename T>
+void BM_VectorMinusScalar(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a - scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorMinusScalar)
+
+template <std::size_t N, typename T>
+void BM_VectorMultiplyScalar(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a * scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorMultiplyScalar)
+
+template <std::size_t N, typename T>
+void BM_VectorDivideScalar(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>();
+  T scalar = bench::value<T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(scalar);
+    benchmark::DoNotOptimize(a / scalar);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorDivideScalar)
+
+/******************************** chains ***********************************/
+
+/* "a + b * c - d" with the eager operators (one temporary per operation) and
+ * as a lazy expression (a single loop) */
+
+template <std::size_t N, typename T>
+void BM_VectorChain(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  mu::Vector<N, T> c = bench::make_vector<N, T>(2);
+  mu::Vector<N, T> d = bench::make_vector<N, T>(3);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(c);
+    benchmark::DoNotOptimize(d);
+    mu::Vector<N, T> res = a + b * c - d;
+    benchmark::DoNotOptimize(res);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorChain)
+
+template <std::size_t N, typename T>
+void BM_VectorChainLazy(benchmark::State& state) {  // NOLINT
+  mu::Vector<N, T> a = bench::make_vector<N, T>(0);
+  mu::Vector<N, T> b = bench::make_vector<N, T>(1);
+  mu::Vector<N, T> c = bench::make_vector<N, T>(2);
+  mu::Vector<N, T> d = bench::make_vector<N, T>(3);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(c);
+    benchmark::DoNotOptimize(d);
+    mu::Vector<N, T> res = mu::lazy(a) + mu::lazy(b) * c - d;
+    benchmark::DoNotOptimize(res);
+  }
+}
+MU_BENCHMARK_ALL(BM_VectorChainLazy)
+
+/******************************** Vector3D *********************************/
+
+/* the fused kernels compared to the same result from the Vector primitives,
+ * i.e. cross().normalized() and dot() / (length() * length()) */
+
+template <typename T>
+void BM_Vector3DCross(benchmark::State& state) {  // NOLINT
+  mu::Vector3D<T> a = bench::make_vector<3, T>(0);
+  mu::Vector3D<T> b = bench::make_vector<3, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.cross(b));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector3DCross, float);
+BENCHMARK_TEMPLATE(BM_Vector3DCross, double);
+
+template <typename T>
+void BM_Vector3DUnitCross(benchmark::State& state) {  // NOLINT
+  mu::Vector3D<T> a = bench::make_vector<3, T>(0);
+  mu::Vector3D<T> b = bench::make_vector<3, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.unit_cross(b));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector3DUnitCross, float);
+BENCHMARK_TEMPLATE(BM_Vector3DUnitCross, double);
+
+template <typename T>
+void BM_Vector3DCrossNormalized(benchmark::State& state) {  // NOLINT
+  mu::Vector3D<T> a = bench::make_vector<3, T>(0);
+  mu::Vector3D<T> b = bench::make_vector<3, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.cross(b).normalized());
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector3DCrossNormalized, float);
+BENCHMARK_TEMPLATE(BM_Vector3DCrossNormalized, double);
+
+template <typename T>
+void BM_Vector3DCosAngle(benchmark::State& state) {  // NOLINT
+  mu::Vector3D<T> a = bench::make_vector<3, T>(0);
+  mu::Vector3D<T> b = bench::make_vector<3, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.cos_angle(b));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector3DCosAngle, float);
+BENCHMARK_TEMPLATE(BM_Vector3DCosAngle, double);
+
+template <typename T>
+void BM_Vector3DDotLength(benchmark::State& state) {  // NOLINT
+  mu::Vector3D<T> a = bench::make_vector<3, T>(0);
+  mu::Vector3D<T> b = bench::make_vector<3, T>(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(a.dot(b) / (a.length() * b.length()));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector3DDotLength, float);
+BENCHMARK_TEMPLATE(BM_Vector3DDotLength, double);
+
+template <typename T>
+void BM_Vector3DRotate(benchmark::State& state) {  // NOLINT
+  mu::Vector3D<T> a = bench::make_vector<3, T>(0);
+  mu::Vector3D<T> axis = bench::make_vector<3, T>(1);
+  T angle{0.7};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(axis);
+    benchmark::DoNotOptimize(angle);
+    benchmark::DoNotOptimize(a.rotated(axis, angle));
+  }
+}
+BENCHMARK_TEMPLATE(BM_Vector3DRotate, float);
+BENCHMARK_TEMPLATE(BM_Vector3DRotate, double);
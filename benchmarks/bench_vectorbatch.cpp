@@ -0,0 +1,85 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "bench_values.h"
+#include "mu/vector3d.h"
+#include "mu/vectorbatch.h"
+
+/****************************** VectorBatch ********************************/
+
+/* the same operation on many 3D Vectors, stored as a std::vector of Vectors
+ * (array of structures) and as a VectorBatch (structure of arrays). the
+ * number of Vectors is the benchmark argument */
+
+template <typename T>
+std::vector<mu::Vector3D<T>> make_vectors(std::size_t count,
+                                          std::size_t seed = 0) {
+  std::vector<mu::Vector3D<T>> ret(count);
+  for (std::size_t i = 0; i < count; i++) {
+    ret[i] = bench::make_vector<3, T>(seed + i);
+  }
+  return ret;
+}
+
+template <typename T>
+void BM_VectorArrayDot(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector3D<T>> a = make_vectors<T>(kCount, 0);
+  std::vector<mu::Vector3D<T>> b = make_vectors<T>(kCount, 1);
+  std::vector<T> res(kCount);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    benchmark::DoNotOptimize(b.data());
+    for (std::size_t i = 0; i < kCount; i++) {
+      res[i] = a[i].dot(b[i]);
+    }
+    benchmark::DoNotOptimize(res.data());
+  }
+}
+BENCHMARK_TEMPLATE(BM_VectorArrayDot, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_VectorArrayDot, double)->Arg(1024)->Arg(65536);
+
+template <typename T>
+void BM_VectorBatchDot(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  const std::vector<mu::Vector3D<T>> kA = make_vectors<T>(kCount, 0);
+  const std::vector<mu::Vector3D<T>> kB = make_vectors<T>(kCount, 1);
+  mu::VectorBatch<3, T> a(kA.begin(), kA.end());
+  mu::VectorBatch<3, T> b(kB.begin(), kB.end());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.lane(0));
+    benchmark::DoNotOptimize(b.lane(0));
+    benchmark::DoNotOptimize(a.dot(b));
+  }
+}
+BENCHMARK_TEMPLATE(BM_VectorBatchDot, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_VectorBatchDot, double)->Arg(1024)->Arg(65536);
+
+template <typename T>
+void BM_VectorArrayNormalize(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  std::vector<mu::Vector3D<T>> a = make_vectors<T>(kCount);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.data());
+    for (auto& v : a) {
+      v.normalize();
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_VectorArrayNormalize, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_VectorArrayNormalize, double)->Arg(1024)->Arg(65536);
+
+template <typename T>
+void BM_VectorBatchNormalize(benchmark::State& state) {  // NOLINT
+  const auto kCount = static_cast<std::size_t>(state.range(0));
+  const std::vector<mu::Vector3D<T>> kA = make_vectors<T>(kCount);
+  mu::VectorBatch<3, T> a(kA.begin(), kA.end());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.lane(0));
+    a.normalize();
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_VectorBatchNormalize, float)->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_VectorBatchNormalize, double)->Arg(1024)->Arg(65536);
@@ -1,13 +1,264 @@
+#include "mu/affine3.h"
+#include "mu/aligned.h"
+#include "mu/colmajor.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/expression.h"
+#include "mu/format.h"
+#include "mu/gemm.h"
+#include "mu/mapped.h"
 #include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/parse.h"
+#include "mu/quaternion.h"
+#include "mu/rotation2d.h"
+#include "mu/simd.h"
+#include "mu/solve.h"
+#include "mu/sparse.h"
+#include "mu/statistics.h"
 #include "mu/vector.h"
 #include "mu/vector2d.h"
 #include "mu/vector3d.h"
+#include "mu/vectorbatch.h"
 
 /**
  * Instantiate this template class and template functions explicitly so that all
  * functions are generated and thus, the coverage report is accurate.
  */
 
+/********************************** SIMD ***********************************/
+
+/* class (portable implementation) */
+template struct mu::SimdTraits<int>;
+/* equality kernels (all tolerance modes) */
+template bool mu::simd_equals(const float *, const float *, std::size_t,
+                              const mu::Tolerance &);
+template bool mu::simd_equals(const double *, const double *, std::size_t,
+                              const mu::Tolerance &);
+
+/******************************* Type traits *******************************/
+
+/* functions (floating point and integral) */
+template bool mu::equals(float, float, const mu::Tolerance &);
+template bool mu::equals(long double, long double, const mu::Tolerance &);
+template bool mu::equals(int, int, const mu::Tolerance &);
+
+/********************************** GEMM ***********************************/
+
+/* functions (both kernels, independent of the size) */
+template void mu::gemm_naive<2, 2, 2, float>(const mu::Matrix<2, 2, float> &,
+                                             const mu::Matrix<2, 2, float> &,
+                                             mu::Matrix<2, 2, float> &);
+template void mu::gemm_blocked<2, 2, 2, float>(const mu::Matrix<2, 2, float> &,
+                                               const mu::Matrix<2, 2, float> &,
+                                               mu::Matrix<2, 2, float> &);
+
+/******************************** Parallel *********************************/
+
+/* functions (the ones that take the default pool forward to these) */
+template void mu::parallel::for_each(mu::parallel::ThreadPool &, float *,
+                                     float *, void (*)(float &));
+template float *mu::parallel::transform(mu::parallel::ThreadPool &,
+                                        const float *, const float *, float *,
+                                        float (*)(float));
+template float *mu::parallel::transform(mu::parallel::ThreadPool &,
+                                        const float *, const float *,
+                                        const float *, float *,
+                                        float (*)(float, float));
+template float mu::parallel::reduce(mu::parallel::ThreadPool &, const float *,
+                                    const float *, float,
+                                    float (*)(float, float));
+
+/********************************* Aligned *********************************/
+
+/* classes (with and without padding) */
+template class mu::AlignedVector<3, float>;
+template class mu::AlignedVector<4, int>;
+template class mu::AlignedMatrix<4, 4, float>;
+/* functions */
+template mu::AlignedVector<3, float> mu::operator+(
+    const mu::AlignedVector<3, float> &, const mu::AlignedVector<3, float> &);
+template mu::AlignedMatrix<4, 4, float> mu::operator+(
+    const mu::AlignedMatrix<4, 4, float> &,
+    const mu::AlignedMatrix<4, 4, float> &);
+
+/******************************** ColMajor *********************************/
+
+/* class */
+template class mu::ColMajorMatrix<3, 4, float>;
+/* functions */
+template mu::ColMajorMatrix<3, 2, float> mu::ColMajorMatrix<3, 4, float>::dot(
+    const mu::ColMajorMatrix<4, 2, float> &) const;
+template mu::Vector<3, float> mu::ColMajorMatrix<3, 4, float>::dot(
+    const mu::Vector<4, float> &) const;
+template mu::ColMajorMatrix<3, 4, float> mu::operator+(
+    mu::ColMajorMatrix<3, 4, float>, const mu::ColMajorMatrix<3, 4, float> &);
+
+/******************************** DynVector ********************************/
+
+/* class */
+template class mu::DynVector<float>;
+/* functions */
+template float mu::DynVector<float>::dot(const mu::DynVector<float> &) const;
+template double mu::DynVector<float>::dot<double>(
+    const mu::DynVector<int> &) const;
+template mu::DynVector<float> mu::operator+(mu::DynVector<float>,
+                                           const mu::DynVector<int> &);
+template mu::DynVector<float> mu::operator*(mu::DynVector<float>,
+                                           const float &);
+
+/******************************** DynMatrix ********************************/
+
+/* class */
+template class mu::DynMatrix<float>;
+/* functions */
+template mu::DynMatrix<float> mu::DynMatrix<float>::dot(
+    const mu::DynMatrix<float> &) const;
+template mu::DynMatrix<double> mu::DynMatrix<float>::dot<double>(
+    const mu::DynMatrix<int> &) const;
+template mu::DynVector<float> mu::DynMatrix<float>::dot(
+    const mu::DynVector<float> &) const;
+template mu::DynMatrix<float> mu::operator+(mu::DynMatrix<float>,
+                                           const mu::DynMatrix<int> &);
+template mu::DynMatrix<float> mu::operator*(mu::DynMatrix<float>,
+                                           const float &);
+
+/********************************* Affine3 *********************************/
+
+/* class */
+template class mu::Affine3<float>;
+/* functions */
+template mu::Affine3<float> mu::operator*(const mu::Affine3<float> &,
+                                          const mu::Affine3<float> &);
+template mu::Vector3D<float> *mu::Affine3<float>::transform_points(
+    const mu::Vector3D<float> *, const mu::Vector3D<float> *,
+    mu::Vector3D<float> *) const;
+
+/******************************* Quaternion ********************************/
+
+/* class */
+template class mu::Quaternion<float>;
+/* functions */
+template mu::Quaternion<float> mu::operator*(const mu::Quaternion<float> &,
+                                             const mu::Quaternion<float> &);
+template mu::Quaternion<float> mu::slerp(const mu::Quaternion<float> &,
+                                         const mu::Quaternion<float> &, float);
+template mu::Quaternion<float> mu::nlerp(const mu::Quaternion<float> &,
+                                         const mu::Quaternion<float> &, float);
+template mu::Vector3D<float> *mu::Quaternion<float>::rotate(
+    const mu::Vector3D<float> *, const mu::Vector3D<float> *,
+    mu::Vector3D<float> *) const;
+
+/******************************* Rotation2D ********************************/
+
+/* class */
+template class mu::Rotation2D<float>;
+/* functions (SIMD kernel and plain loop) */
+template mu::Vector2D<float> *mu::Rotation2D<float>::rotate(
+    const mu::Vector2D<float> *, const mu::Vector2D<float> *,
+    mu::Vector2D<float> *) const;
+template std::vector<mu::Vector2D<float>>::iterator
+mu::Rotation2D<float>::rotate(std::vector<mu::Vector2D<float>>::iterator,
+                              std::vector<mu::Vector2D<float>>::iterator,
+                              std::vector<mu::Vector2D<float>>::iterator) const;
+template mu::Rotation2D<float> mu::operator*(const mu::Rotation2D<float> &,
+                                             const mu::Rotation2D<float> &);
+template mu::Vector2D<float> *mu::rotate(const mu::Vector2D<float> *,
+                                         const mu::Vector2D<float> *,
+                                         const float *, mu::Vector2D<float> *);
+
+/********************************* Sparse **********************************/
+
+/* class */
+template class mu::SparseMatrix<float, mu::SparseFormat::kCSR>;
+template class mu::SparseMatrix<float, mu::SparseFormat::kCSC>;
+/* functions */
+template mu::DynVector<float> mu::SparseMatrix<float>::dot(
+    const mu::DynVector<float> &) const;
+template mu::DynVector<float>
+mu::SparseMatrix<float, mu::SparseFormat::kCSC>::dot(
+    const mu::DynVector<float> &) const;
+template mu::DynVector<float> mu::parallel::dot(
+    mu::parallel::ThreadPool &, const mu::SparseMatrix<float> &,
+    const mu::DynVector<float> &);
+template mu::DynVector<float> mu::parallel::dot(
+    mu::parallel::ThreadPool &,
+    const mu::SparseMatrix<float, mu::SparseFormat::kCSC> &,
+    const mu::DynVector<float> &);
+
+/********************************* Format **********************************/
+
+/* functions */
+template char *mu::format_to(char *, char *, float, const mu::FormatStyle &);
+template char *mu::format_to(char *, char *, int, const mu::FormatStyle &);
+template char *mu::format_to(char *, char *, const mu::Vector<3, float> &,
+                             const mu::FormatStyle &);
+template char *mu::format_to(char *, char *, const mu::Matrix<4, 4, float> &,
+                             const mu::FormatStyle &);
+template char *mu::format_to(char *, char *, const mu::Vector<3, float> *,
+                             std::size_t, const mu::FormatStyle &);
+template void mu::FormatWriter::write(const mu::Vector<3, float> &);
+template void mu::FormatWriter::write(const mu::Matrix<4, 4, float> *,
+                                      std::size_t);
+
+/********************************* Mapped **********************************/
+
+/* class */
+template class mu::MappedArray<mu::Vector<3, float>>;
+template class mu::MappedArray<mu::Matrix<4, 4, float>>;
+template class mu::MappedArrayWriter<mu::Vector<3, float>>;
+template class mu::MappedArrayWriter<mu::Matrix<4, 4, float>>;
+
+/********************************** Parse **********************************/
+
+/* functions */
+template const char *mu::parse_from(const char *, const char *, float &);
+template const char *mu::parse_from(const char *, const char *, int &);
+template bool mu::parse_value_strto(const char *, const char *, float *);
+template const char *mu::parse_from(const char *, const char *,
+                                    mu::Vector<3, float> &);
+template const char *mu::parse_from(const char *, const char *,
+                                    mu::Matrix<4, 4, float> &);
+template std::vector<mu::Vector<3, float>> mu::parse_list(const char *,
+                                                          const char *);
+template std::vector<mu::Vector<3, float>> mu::parse_list(
+    const mu::MappedFile &);
+template std::vector<mu::Vector<3, float>> mu::parallel::parse_list(
+    mu::parallel::ThreadPool &, const char *, const char *, std::size_t);
+template std::vector<mu::Vector<3, float>> mu::parallel::parse_list(
+    const char *, const char *);
+template std::vector<mu::Vector<3, float>> mu::parallel::parse_list(
+    mu::parallel::ThreadPool &, const mu::MappedFile &);
+
+/********************************* Solve ***********************************/
+
+/* classes */
+template class mu::LU<5, float>;
+template class mu::Cholesky<5, float>;
+/* functions (closed form and decomposition) */
+template mu::Vector<2, float> mu::solve(const mu::Matrix<2, 2, float> &,
+                                        const mu::Vector<2, float> &);
+template mu::Vector<5, float> mu::solve(const mu::Matrix<5, 5, float> &,
+                                        const mu::Vector<5, float> &);
+template mu::Matrix<5, 2, float> mu::solve(const mu::Matrix<5, 5, float> &,
+                                           const mu::Matrix<5, 2, float> &);
+
+/******************************* Statistics ********************************/
+
+/* class */
+template class mu::RunningStats<3, float>;
+
+/******************************* Expression ********************************/
+
+/* the expression classes can't be instantiated explicitly since they have
+ * element access functions for Vectors and Matrices. only one of them
+ * compiles for a given expression */
+/* functions */
+template mu::ExpressionLeaf<mu::Vector<2, float>> mu::lazy(
+    const mu::Vector<2, float> &) noexcept;
+template mu::ExpressionLeaf<mu::Matrix<2, 2, float>> mu::lazy(
+    const mu::Matrix<2, 2, float> &) noexcept;
+
 /********************************* Vector **********************************/
 
 /* class */
@@ -53,12 +304,49 @@ template mu::Vector<2, int> mu::zeros<2>();
 template class mu::Vector2D<float>;
 /* functions */
 template void mu::Vector2D<float>::rotate<float>(float);
-template mu::Vector2D<float> mu::Vector2D<float>::rotated<float>(float);
+template mu::Vector2D<float> mu::Vector2D<float>::rotated<float>(float) const;
 
 /******************************** Vector3D *********************************/
 
 /* class */
 template class mu::Vector3D<float>;
+/* functions */
+template mu::Vector3D<float> mu::Vector3D<float>::unit_cross<float>(
+    const mu::Vector<3, float> &) const;
+template float mu::Vector3D<float>::cos_angle<float>(
+    const mu::Vector<3, float> &) const;
+template void mu::Vector3D<float>::rotate<float>(const mu::Vector<3, float> &,
+                                                 float);
+template mu::Vector3D<float> mu::Vector3D<float>::rotated<float>(
+    const mu::Vector<3, float> &, float) const;
+template mu::Vector3D<float> mu::cross(const mu::Vector<3, float> &,
+                                       const mu::Vector<3, float> &);
+
+/****************************** VectorBatch ********************************/
+
+/* class */
+template class mu::VectorBatch<2, float>;
+/* functions */
+template std::vector<float> mu::VectorBatch<2, float>::dot(
+    const mu::VectorBatch<2, float> &) const;
+template std::vector<double> mu::VectorBatch<2, float>::dot<double>(
+    const mu::VectorBatch<2, int> &) const;
+template std::vector<float> mu::VectorBatch<2, float>::length() const;
+template std::vector<double> mu::VectorBatch<2, float>::length<double>() const;
+template void mu::VectorBatch<2, float>::rotate(float);
+template void mu::VectorBatch<2, float>::rotate(double);
+template mu::VectorBatch<2, float> mu::VectorBatch<2, float>::rotated(
+    float) const;
+
+/* operators */
+template mu::VectorBatch<2, float> mu::operator+
+    <2, float, int>(mu::VectorBatch<2, float>, const mu::VectorBatch<2, int> &);
+template mu::VectorBatch<2, float> mu::operator-
+    <2, float, int>(mu::VectorBatch<2, float>, const mu::VectorBatch<2, int> &);
+template mu::VectorBatch<2, float> mu::operator*
+    <2, float, int>(mu::VectorBatch<2, float>, const mu::VectorBatch<2, int> &);
+template mu::VectorBatch<2, float> mu::operator/
+    <2, float, int>(mu::VectorBatch<2, float>, const mu::VectorBatch<2, int> &);
 
 /**************************** Vector <> Scalar *****************************/
 
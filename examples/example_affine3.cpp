@@ -0,0 +1,159 @@
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/affine3.h"
+#include "mu/literals.h"
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/vector3d.h"
+
+TEST(Affine3, Constructor) {
+  //! [affine3 constructor]
+
+  mu::Affine3<float> a;  // identity
+  mu::Vector3D<float> p = a.transform_point({1.0F, 2.0F, 3.0F});
+  // [ 1, 2, 3 ]
+
+  //! [affine3 constructor]
+  EXPECT_THAT(p, ::testing::ElementsAre(1.0F, 2.0F, 3.0F));
+}
+
+TEST(Affine3, ConstructorLinearTranslation) {
+  //! [affine3 linear translation constructor]
+
+  // scale by 2, then translate by [ 1, 0, 0 ]
+  mu::Affine3<double> a{mu::Matrix<3, 3, double>{{2.0, 0.0, 0.0},
+                                                 {0.0, 2.0, 0.0},
+                                                 {0.0, 0.0, 2.0}},
+                        mu::Vector3D<double>{1.0, 0.0, 0.0}};
+
+  //! [affine3 linear translation constructor]
+  EXPECT_THAT(a.translation(), ::testing::ElementsAre(1.0, 0.0, 0.0));
+}
+
+TEST(Affine3, ConstructorQuaternion) {
+  //! [affine3 quaternion constructor]
+
+  // rotate around the z-axis by pi/2, then translate by [ 0, 0, 1 ]
+  mu::Affine3<double> a{
+      mu::Quaternion<double>{mu::Vector3D<double>{0.0, 0.0, 1.0}, mu::pi2},
+      mu::Vector3D<double>{0.0, 0.0, 1.0}};
+  mu::Vector3D<double> p = a.transform_point({1.0, 0.0, 0.0});
+  // [ 0, 1, 1 ]
+
+  //! [affine3 quaternion constructor]
+  EXPECT_NEAR(p[0], 0.0, 1e-12);
+  EXPECT_NEAR(p[1], 1.0, 1e-12);
+  EXPECT_NEAR(p[2], 1.0, 1e-12);
+}
+
+TEST(Affine3, ConstructorMatrix) {
+  //! [affine3 matrix constructor]
+
+  mu::Matrix<4, 4, double> m{{1.0, 0.0, 0.0, 5.0},
+                             {0.0, 1.0, 0.0, 6.0},
+                             {0.0, 0.0, 1.0, 7.0},
+                             {0.0, 0.0, 0.0, 1.0}};
+  mu::Affine3<double> a{m};
+  mu::Matrix<4, 4, double> m2 = a.to_matrix();  // same as m
+
+  //! [affine3 matrix constructor]
+  EXPECT_THAT(a.translation(), ::testing::ElementsAre(5.0, 6.0, 7.0));
+  EXPECT_EQ(m, m2);
+}
+
+TEST(Affine3, MemberFuncTransformPoint) {
+  //! [affine3 transform_point function]
+
+  mu::Affine3<double> a{mu::Matrix<3, 3, double>{{2.0, 0.0, 0.0},
+                                                 {0.0, 2.0, 0.0},
+                                                 {0.0, 0.0, 2.0}},
+                        mu::Vector3D<double>{1.0, 0.0, 0.0}};
+  mu::Vector3D<double> p = a.transform_point({1.0, 1.0, 1.0});
+  // [ 3, 2, 2 ]
+
+  //! [affine3 transform_point function]
+  EXPECT_THAT(p, ::testing::ElementsAre(3.0, 2.0, 2.0));
+}
+
+TEST(Affine3, MemberFuncTransformDirection) {
+  //! [affine3 transform_direction function]
+
+  mu::Affine3<double> a{mu::Matrix<3, 3, double>{{2.0, 0.0, 0.0},
+                                                 {0.0, 2.0, 0.0},
+                                                 {0.0, 0.0, 2.0}},
+                        mu::Vector3D<double>{1.0, 0.0, 0.0}};
+  // not translated
+  mu::Vector3D<double> d = a.transform_direction({1.0, 1.0, 1.0});
+  // [ 2, 2, 2 ]
+
+  //! [affine3 transform_direction function]
+  EXPECT_THAT(d, ::testing::ElementsAre(2.0, 2.0, 2.0));
+}
+
+TEST(Affine3, MemberFuncTransformPointsRange) {
+  //! [affine3 batched transform_points function]
+
+  mu::Affine3<float> a{mu::eye<3, float>(),
+                       mu::Vector3D<float>{1.0F, 2.0F, 3.0F}};
+  std::vector<mu::Vector3D<float>> points{{0.0F, 0.0F, 0.0F},
+                                          {1.0F, 1.0F, 1.0F}};
+  // in-place
+  a.transform_points(points.begin(), points.end(), points.begin());
+  // points are [ 1, 2, 3 ], [ 2, 3, 4 ]
+
+  //! [affine3 batched transform_points function]
+  EXPECT_THAT(points[0], ::testing::ElementsAre(1.0F, 2.0F, 3.0F));
+  EXPECT_THAT(points[1], ::testing::ElementsAre(2.0F, 3.0F, 4.0F));
+}
+
+TEST(Affine3, MemberFuncInverse) {
+  //! [affine3 inverse function]
+
+  mu::Affine3<double> a{mu::Matrix<3, 3, double>{{2.0, 0.0, 0.0},
+                                                 {0.0, 4.0, 0.0},
+                                                 {0.0, 0.0, 8.0}},
+                        mu::Vector3D<double>{2.0, 4.0, 8.0}};
+  mu::Affine3<double> inv = a.inverse();
+  mu::Vector3D<double> p = inv.transform_point({2.0, 4.0, 8.0});
+  // [ 0, 0, 0 ]
+
+  //! [affine3 inverse function]
+  EXPECT_THAT(p, ::testing::ElementsAre(0.0, 0.0, 0.0));
+}
+
+TEST(Affine3, MemberFuncRigidInverse) {
+  //! [affine3 rigid_inverse function]
+
+  // rotation and translation only
+  mu::Affine3<double> a{
+      mu::Quaternion<double>{mu::Vector3D<double>{0.0, 0.0, 1.0}, mu::pi2},
+      mu::Vector3D<double>{1.0, 2.0, 3.0}};
+  // a transpose instead of a matrix inverse
+  mu::Affine3<double> inv = a.rigid_inverse();
+  mu::Vector3D<double> p = inv.transform_point({1.0, 2.0, 3.0});
+  // [ 0, 0, 0 ]
+
+  //! [affine3 rigid_inverse function]
+  EXPECT_NEAR(p[0], 0.0, 1e-12);
+  EXPECT_NEAR(p[1], 0.0, 1e-12);
+  EXPECT_NEAR(p[2], 0.0, 1e-12);
+}
+
+TEST(Affine3, OperatorMultiplication) {
+  //! [affine3 multiplication operator]
+
+  mu::Affine3<double> scale{mu::Matrix<3, 3, double>{{2.0, 0.0, 0.0},
+                                                     {0.0, 2.0, 0.0},
+                                                     {0.0, 0.0, 2.0}}};
+  mu::Affine3<double> move{mu::eye<3, double>(),
+                           mu::Vector3D<double>{1.0, 0.0, 0.0}};
+  // move first, then scale
+  mu::Affine3<double> a = scale * move;
+  mu::Vector3D<double> p = a.transform_point({0.0, 0.0, 0.0});
+  // [ 2, 0, 0 ]
+
+  //! [affine3 multiplication operator]
+  EXPECT_THAT(p, ::testing::ElementsAre(2.0, 0.0, 0.0));
+}
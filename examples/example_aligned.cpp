@@ -0,0 +1,53 @@
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/aligned.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+TEST(Aligned, Vector) {
+  //! [aligned vector]
+
+  // e.g. with SSE: x, y, z and a zero, 16 byte aligned
+  mu::AlignedVector<3, float> a{1.0F, 2.0F, 3.0F};
+  mu::AlignedVector<3, float> b = mu::Vector<3, float>{1.0F, 1.0F, 1.0F};
+  // one aligned SIMD operation instead of three single values
+  a += b;  // [ 2, 3, 4 ]
+  // still a Vector
+  float sum = a.sum();  // 9
+
+  //! [aligned vector]
+  EXPECT_THAT(a, ::testing::ElementsAre(2.0F, 3.0F, 4.0F));
+  EXPECT_EQ(sum, 9.0F);
+}
+
+TEST(Aligned, Matrix) {
+  //! [aligned matrix]
+
+  // every row is aligned, e.g. 16 bytes with SSE
+  mu::AlignedMatrix<4, 4, float> a = mu::eye<4, float>();
+  mu::AlignedMatrix<4, 4, float> b{mu::Matrix<4, 4, float>{2.0F}};
+  // a single aligned loop over all 16 values
+  a *= b;  // 2 on the diagonal
+
+  //! [aligned matrix]
+  EXPECT_EQ(a, (mu::eye<4, float>() * 2.0F));
+}
+
+TEST(Aligned, Container) {
+  //! [aligned container]
+
+  // before c++17, std::allocator doesn't align over-aligned types
+  using TPoint = mu::AlignedVector<3, float>;
+  std::vector<TPoint, mu::AlignedAllocator<TPoint>> points(1025);
+  const TPoint kOffset{1.0F, 2.0F, 3.0F};
+  for (auto &p : points) {
+    p -= kOffset;  // [ -1, -2, -3 ]
+  }
+
+  //! [aligned container]
+  for (const auto &p : points) {
+    EXPECT_THAT(p, ::testing::ElementsAre(-1.0F, -2.0F, -3.0F));
+  }
+}
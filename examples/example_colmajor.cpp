@@ -0,0 +1,85 @@
+#include <array>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/colmajor.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+TEST(ColMajor, Constructor) {
+  //! [colmajor constructor]
+
+  mu::Matrix<2, 3, int> a{{1, 2, 3}, {4, 5, 6}};
+  mu::ColMajorMatrix<2, 3, int> b(a);  // the same values, column by column
+  int b12 = b(1, 2);                   // 6
+
+  //! [colmajor constructor]
+  EXPECT_EQ(b12, 6);
+}
+
+TEST(ColMajor, ConstructorColumns) {
+  //! [colmajor columns constructor]
+
+  std::array<mu::Vector<2, int>, 3> cols = {
+      mu::Vector<2, int>{1, 4}, mu::Vector<2, int>{2, 5},
+      mu::Vector<2, int>{3, 6}};
+  mu::ColMajorMatrix<2, 3, int> a(cols);  // [ [ 1, 2, 3 ], [ 4, 5, 6 ] ]
+
+  //! [colmajor columns constructor]
+  EXPECT_EQ(a.to_matrix(), (mu::Matrix<2, 3, int>{{1, 2, 3}, {4, 5, 6}}));
+}
+
+TEST(ColMajor, MemberFuncData) {
+  //! [colmajor data function]
+
+  mu::ColMajorMatrix<2, 3, int> a(mu::Matrix<2, 3, int>{{1, 2, 3}, {4, 5, 6}});
+  const int *values = a.data();  // 1, 4, 2, 5, 3, 6
+  int a12 = values[2 * 2 + 1];   // 6
+
+  //! [colmajor data function]
+  EXPECT_THAT(std::vector<int>(values, values + 6),
+              ::testing::ElementsAre(1, 4, 2, 5, 3, 6));
+  EXPECT_EQ(a12, 6);
+}
+
+TEST(ColMajor, MemberFunctions) {
+  //! [colmajor member functions]
+
+  mu::ColMajorMatrix<2, 3, int> a(mu::Matrix<2, 3, int>{{1, 2, 3}, {4, 5, 6}});
+  a(0, 0) = 7;
+  mu::Vector<2, int> &col = a.col(1);  // [ 2, 5 ], contiguous
+  mu::Vector<3, int> row = a.row(1);   // [ 4, 5, 6 ], a copy
+  mu::Matrix<2, 3, int> b = a.to_matrix();
+  const mu::Matrix<3, 2, int> &c = a.transposed();  // no copy
+
+  //! [colmajor member functions]
+  EXPECT_THAT(col, ::testing::ElementsAre(2, 5));
+  EXPECT_THAT(row, ::testing::ElementsAre(4, 5, 6));
+  EXPECT_EQ(b, (mu::Matrix<2, 3, int>{{7, 2, 3}, {4, 5, 6}}));
+  EXPECT_EQ(c, b.transposed());
+}
+
+TEST(ColMajor, MemberFuncDot) {
+  //! [colmajor dot function]
+
+  mu::ColMajorMatrix<2, 2, int> a(mu::Matrix<2, 2, int>{{1, 2}, {3, 4}});
+  mu::ColMajorMatrix<2, 2, int> b(mu::Matrix<2, 2, int>{{5, 6}, {7, 8}});
+  mu::ColMajorMatrix<2, 2, int> c = a.dot(b);  // [ [ 19, 22 ], [ 43, 50 ] ]
+  mu::Vector<2, int> d = a.dot(mu::Vector<2, int>{1, 1});  // [ 3, 7 ]
+
+  //! [colmajor dot function]
+  EXPECT_EQ(c.to_matrix(), (mu::Matrix<2, 2, int>{{19, 22}, {43, 50}}));
+  EXPECT_THAT(d, ::testing::ElementsAre(3, 7));
+}
+
+TEST(ColMajor, Operators) {
+  //! [colmajor operators]
+
+  mu::ColMajorMatrix<2, 2, int> a(mu::Matrix<2, 2, int>{{1, 2}, {3, 4}});
+  mu::ColMajorMatrix<2, 2, int> b = a + a;  // [ [ 2, 4 ], [ 6, 8 ] ]
+  b *= 2;                                   // [ [ 4, 8 ], [ 12, 16 ] ]
+
+  //! [colmajor operators]
+  EXPECT_EQ(b.to_matrix(), (mu::Matrix<2, 2, int>{{4, 8}, {12, 16}}));
+}
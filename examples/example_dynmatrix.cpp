@@ -0,0 +1,107 @@
+#include <cstddef>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/matrix.h"
+
+TEST(DynMatrix, Constructor) {
+  //! [dynmatrix constructor]
+
+  std::size_t rows = 100;  // known at run time
+  std::size_t cols = 200;  // known at run time
+  mu::DynMatrix<float> a(rows, cols);  // 100x200 zeros
+  mu::DynMatrix<int> b = {{1, 2, 3}, {4, 5, 6}};
+  int value = b[1][2];  // 6
+
+  //! [dynmatrix constructor]
+  EXPECT_EQ(a.rows(), 100);
+  EXPECT_EQ(a.cols(), 200);
+  EXPECT_EQ(value, 6);
+}
+
+TEST(DynMatrix, ConstructorMatrix) {
+  //! [dynmatrix from matrix constructor]
+
+  mu::Matrix<2, 2, float> a = {{1.0F, 2.0F}, {3.0F, 4.0F}};
+  mu::DynMatrix<float> b(a);
+
+  //! [dynmatrix from matrix constructor]
+  EXPECT_THAT(b, ::testing::ElementsAre(1.0F, 2.0F, 3.0F, 4.0F));
+}
+
+TEST(DynMatrix, MemberFuncRowColDiag) {
+  //! [dynmatrix row col diag functions]
+
+  mu::DynMatrix<int> a = {{1, 2, 3}, {4, 5, 6}};
+  mu::DynVector<int> r = a.row(1);  // { 4, 5, 6 }
+  mu::DynVector<int> c = a.col(1);  // { 2, 5 }
+  mu::DynVector<int> d = a.diag();  // { 1, 5 }
+
+  //! [dynmatrix row col diag functions]
+  EXPECT_THAT(r, ::testing::ElementsAre(4, 5, 6));
+  EXPECT_THAT(c, ::testing::ElementsAre(2, 5));
+  EXPECT_THAT(d, ::testing::ElementsAre(1, 5));
+}
+
+TEST(DynMatrix, MemberFuncStatistics) {
+  //! [dynmatrix statistics]
+
+  mu::DynMatrix<float> a = {{1.0F, 2.0F}, {3.0F, 4.0F}};
+  float sum = a.sum();  // 10.0
+  float mean = a.mean();  // 2.5
+  float std = a.std();  // 1.118034
+
+  //! [dynmatrix statistics]
+  EXPECT_FLOAT_EQ(sum, 10.0F);
+  EXPECT_FLOAT_EQ(mean, 2.5F);
+  EXPECT_FLOAT_EQ(std, 1.118034F);
+}
+
+TEST(DynMatrix, MemberFuncDet) {
+  //! [dynmatrix det function]
+
+  mu::DynMatrix<float> a = {{3.0F, 1.0F}, {2.0F, 4.0F}};
+  float det = a.det();  // 10.0
+
+  //! [dynmatrix det function]
+  EXPECT_FLOAT_EQ(det, 10.0F);
+}
+
+TEST(DynMatrix, MemberFuncTransposed) {
+  //! [dynmatrix transposed function]
+
+  mu::DynMatrix<int> a = {{1, 2, 3}, {4, 5, 6}};
+  mu::DynMatrix<int> b = a.transposed();  // {{1, 4}, {2, 5}, {3, 6}}
+
+  //! [dynmatrix transposed function]
+  EXPECT_EQ(b.rows(), 3);
+  EXPECT_EQ(b.cols(), 2);
+  EXPECT_THAT(b, ::testing::ElementsAre(1, 4, 2, 5, 3, 6));
+}
+
+TEST(DynMatrix, MemberFuncDot) {
+  //! [dynmatrix dot function]
+
+  mu::DynMatrix<float> a = {{1.0F, 2.0F}, {3.0F, 4.0F}};
+  mu::DynMatrix<float> b = {{5.0F, 6.0F}, {7.0F, 8.0F}};
+  mu::DynMatrix<float> c = a.dot(b);  // {{19.0, 22.0}, {43.0, 50.0}}
+  mu::DynVector<float> v = {1.0F, 1.0F};
+  mu::DynVector<float> d = a.dot(v);  // { 3.0, 7.0 }
+
+  //! [dynmatrix dot function]
+  EXPECT_THAT(c, ::testing::ElementsAre(19.0F, 22.0F, 43.0F, 50.0F));
+  EXPECT_THAT(d, ::testing::ElementsAre(3.0F, 7.0F));
+}
+
+TEST(DynMatrix, Operators) {
+  //! [dynmatrix operators]
+
+  mu::DynMatrix<float> a = {{1.0F, 2.0F}, {3.0F, 4.0F}};
+  mu::DynMatrix<float> b = a + a;  // {{2.0, 4.0}, {6.0, 8.0}}
+  b -= 1.0F;  // {{1.0, 3.0}, {5.0, 7.0}}
+
+  //! [dynmatrix operators]
+  EXPECT_THAT(b, ::testing::ElementsAre(1.0F, 3.0F, 5.0F, 7.0F));
+}
@@ -0,0 +1,71 @@
+#include <cstddef>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/dynvector.h"
+#include "mu/vector.h"
+
+TEST(DynVector, Constructor) {
+  //! [dynvector constructor]
+
+  std::size_t n = 1000;  // known at run time
+  mu::DynVector<float> a(n);  // 1000 zeros
+  mu::DynVector<int> b = {1, 2, 3};
+
+  //! [dynvector constructor]
+  EXPECT_EQ(a.size(), 1000);
+  EXPECT_EQ(a[999], 0.0F);
+  EXPECT_THAT(b, ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(DynVector, ConstructorVector) {
+  //! [dynvector from vector constructor]
+
+  mu::Vector<3, float> a = {1.0F, 2.0F, 3.0F};
+  mu::DynVector<float> b(a);
+
+  //! [dynvector from vector constructor]
+  EXPECT_THAT(b, ::testing::ElementsAre(1.0F, 2.0F, 3.0F));
+}
+
+TEST(DynVector, MemberFuncStatistics) {
+  //! [dynvector statistics]
+
+  mu::DynVector<float> a = {1.0F, 2.0F, 3.0F, 4.0F};
+  float sum = a.sum();  // 10.0
+  float mean = a.mean();  // 2.5
+  float std = a.std();  // 1.118034
+  int imean = mu::DynVector<int>{1, 2}.mean<int>();  // 1
+
+  //! [dynvector statistics]
+  EXPECT_FLOAT_EQ(sum, 10.0F);
+  EXPECT_FLOAT_EQ(mean, 2.5F);
+  EXPECT_FLOAT_EQ(std, 1.118034F);
+  EXPECT_EQ(imean, 1);
+}
+
+TEST(DynVector, MemberFuncDot) {
+  //! [dynvector dot function]
+
+  mu::DynVector<float> a = {1.0F, 2.0F, 3.0F};
+  mu::DynVector<float> b = {4.0F, 5.0F, 6.0F};
+  float c = a.dot(b);  // 32.0
+  mu::DynVector<int> d = {1, 1, 1};
+  double e = a.dot<double>(d);  // 6.0
+
+  //! [dynvector dot function]
+  EXPECT_FLOAT_EQ(c, 32.0F);
+  EXPECT_DOUBLE_EQ(e, 6.0);
+}
+
+TEST(DynVector, Operators) {
+  //! [dynvector operators]
+
+  mu::DynVector<float> a = {1.0F, 2.0F};
+  mu::DynVector<float> b = {3.0F, 4.0F};
+  mu::DynVector<float> c = a + b;  // { 4.0, 6.0 }
+  c *= 2.0F;  // { 8.0, 12.0 }
+
+  //! [dynvector operators]
+  EXPECT_THAT(c, ::testing::ElementsAre(8.0F, 12.0F));
+}
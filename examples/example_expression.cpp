@@ -0,0 +1,62 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/expression.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+TEST(Expression, UtilityFuncLazy) {
+  //! [expression lazy function]
+
+  mu::Vector<3, float> a = {1.0F, 2.0F, 3.0F};
+  mu::Vector<3, float> b = {4.0F, 5.0F, 6.0F};
+  mu::Vector<3, float> c = {2.0F, 2.0F, 2.0F};
+  mu::Vector<3, float> d = {1.0F, 1.0F, 1.0F};
+  // every operand that starts a new operation must be lazy. otherwise the
+  // operation is evaluated right away, e.g. "b * c" would be a temporary
+  mu::Vector<3, float> e = mu::lazy(a) + mu::lazy(b) * c - d;
+  // e is now [ 8, 11, 14 ]
+
+  //! [expression lazy function]
+  EXPECT_THAT(e, ::testing::ElementsAre(8.0F, 11.0F, 14.0F));
+}
+
+TEST(Expression, Conversion) {
+  //! [expression conversion]
+
+  mu::Matrix<2, 2, int> a = {{1, 2}, {3, 4}};
+  mu::Matrix<2, 2, int> b = {{5, 6}, {7, 8}};
+  // evaluated in a single loop, on initialization
+  mu::Matrix<2, 2, int> c = mu::lazy(a) * 2 + b;
+  // or on assignment
+  c = mu::lazy(c) - a;
+  // c is now [ [ 6, 8 ],
+  //            [ 10, 12 ] ]
+
+  //! [expression conversion]
+  EXPECT_THAT(c[0], ::testing::ElementsAre(6, 8));
+  EXPECT_THAT(c[1], ::testing::ElementsAre(10, 12));
+}
+
+TEST(Expression, MemberFuncEval) {
+  //! [expression eval function]
+
+  mu::Vector<2, int> a = {1, 2};
+  mu::Vector<2, int> b = {3, 4};
+  auto c = (mu::lazy(a) + b).eval();  // c is a mu::Vector<2, int> [ 4, 6 ]
+
+  //! [expression eval function]
+  EXPECT_THAT(c, ::testing::ElementsAre(4, 6));
+}
+
+TEST(Expression, UtilityFuncAssign) {
+  //! [expression assign function]
+
+  mu::Vector<2, int> a = {1, 2};
+  mu::Vector<2, int> b = {3, 4};
+  mu::Vector<2, float> c;
+  // evaluates into an existing object, which can be of a different type
+  mu::assign(c, mu::lazy(a) * b);  // c is now [ 3.0, 8.0 ]
+
+  //! [expression assign function]
+  EXPECT_THAT(c, ::testing::ElementsAre(3.0F, 8.0F));
+}
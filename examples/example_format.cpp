@@ -0,0 +1,80 @@
+#include <array>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "mu/format.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+TEST(Format, Vector) {
+  //! [format vector]
+
+  mu::Vector<3, float> a = {1.5F, -2.0F, 0.1F};
+  std::array<char, 64> buffer;
+  char *end = mu::format_to(buffer.data(), buffer.data() + buffer.size(), a);
+  std::string text(buffer.data(), end);  // "[ 1.5, -2, 0.1 ]"
+
+  //! [format vector]
+  EXPECT_EQ(text, "[ 1.5, -2, 0.1 ]");
+}
+
+TEST(Format, Matrix) {
+  //! [format matrix]
+
+  mu::Matrix<2, 2, int> a = {{1, 2}, {3, 4}};
+  std::array<char, 64> buffer;
+  char *end = mu::format_to(buffer.data(), buffer.data() + buffer.size(), a,
+                            mu::FormatStyle::json());
+  std::string text(buffer.data(), end);  // "[[1,2],[3,4]]"
+  char *none = mu::format_to(buffer.data(), buffer.data() + 4, a);  // nullptr
+
+  //! [format matrix]
+  EXPECT_EQ(text, "[[1,2],[3,4]]");
+  EXPECT_EQ(none, nullptr);
+}
+
+TEST(Format, Style) {
+  //! [format style]
+
+  mu::Vector<3, int> a = {1, 2, 3};
+  mu::FormatStyle tsv = {"", "\t", "", "", "\t", "", "", "\n", "\n"};
+  std::array<char, 64> buffer;
+  char *csv_end = mu::format_to(buffer.data(), buffer.data() + 64, a,
+                                mu::FormatStyle::csv());  // "1,2,3"
+  std::string csv(buffer.data(), csv_end);
+  char *tsv_end = mu::format_to(buffer.data(), buffer.data() + 64, a, tsv);
+  std::string text(buffer.data(), tsv_end);  // "1\t2\t3"
+
+  //! [format style]
+  EXPECT_EQ(csv, "1,2,3");
+  EXPECT_EQ(text, "1\t2\t3");
+}
+
+TEST(Format, List) {
+  //! [format list]
+
+  std::array<mu::Vector<2, int>, 2> a = {mu::Vector<2, int>{1, 2},
+                                         mu::Vector<2, int>{3, 4}};
+  std::array<char, 64> buffer;
+  char *end = mu::format_to(buffer.data(), buffer.data() + buffer.size(),
+                            a.data(), a.size(), mu::FormatStyle::json());
+  std::string text(buffer.data(), end);  // "[[1,2],[3,4]]"
+
+  //! [format list]
+  EXPECT_EQ(text, "[[1,2],[3,4]]");
+}
+
+TEST(Format, Writer) {
+  //! [format writer]
+
+  std::stringstream ss;  // e.g. a std::ofstream
+  {
+    mu::FormatWriter writer(ss, mu::FormatStyle::csv());
+    writer.write(mu::Vector<3, float>{1.0F, 2.0F, 3.0F});
+    writer.write(mu::Vector<3, float>{4.0F, 5.5F, 6.0F});
+  }  // "1,2,3\n4,5.5,6\n"
+
+  //! [format writer]
+  EXPECT_EQ(ss.str(), "1,2,3\n4,5.5,6\n");
+}
@@ -0,0 +1,49 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/mapped.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+TEST(Mapped, Writer) {
+  const std::string path = ::testing::TempDir() + "mu_example_points.bin";
+  //! [mapped array writer]
+
+  {
+    mu::MappedArrayWriter<mu::Vector<3, float>> writer(path);
+    writer.push_back({1.0F, 2.0F, 3.0F});
+    std::vector<mu::Vector<3, float>> more(1000, {4.0F, 5.0F, 6.0F});
+    writer.write(more.data(), more.size());
+  }  // the header is complete when the writer is closed or destroyed
+
+  //! [mapped array writer]
+  EXPECT_EQ((mu::MappedArray<mu::Vector<3, float>>(path).size()), 1001);
+  std::remove(path.c_str());
+}
+
+TEST(Mapped, Constructor) {
+  const std::string path = ::testing::TempDir() + "mu_example_poses.bin";
+  mu::MappedArrayWriter<mu::Matrix<4, 4, float>>(path).push_back(
+      mu::Matrix<4, 4, float>{{1.0F, 0.0F, 0.0F, 0.0F},
+                              {0.0F, 1.0F, 0.0F, 0.0F},
+                              {0.0F, 0.0F, 1.0F, 0.0F},
+                              {0.0F, 0.0F, 0.0F, 1.0F}});
+  //! [mapped array constructor]
+
+  mu::MappedArray<mu::Matrix<4, 4, float>> poses(path);  // nothing is copied
+  std::size_t n = poses.size();                          // 1
+  const mu::Matrix<4, 4, float> &first = poses[0];  // read from the file
+  float sum = 0.0F;
+  for (const mu::Matrix<4, 4, float> &pose : poses) {
+    sum += pose.sum();  // 4.0F
+  }
+
+  //! [mapped array constructor]
+  EXPECT_EQ(n, 1);
+  EXPECT_EQ(first[3][3], 1.0F);
+  EXPECT_EQ(sum, 4.0F);
+  std::remove(path.c_str());
+}
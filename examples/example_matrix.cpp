@@ -1,3 +1,5 @@
+#include <utility>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "mu/matrix.h"
@@ -262,6 +264,18 @@ TEST(Matrix, MemberFuncNCols) {
   EXPECT_EQ(n_cols, 3);
 }
 
+TEST(Matrix, MemberFuncData) {
+  //! [matrix data function]
+
+  mu::Matrix<2, 3, int> a{{1, 2, 4}, {2, 4, 8}};
+  const int *values = a.data();  // row by row
+  int a12 = values[1 * 3 + 2];   // 8
+
+  //! [matrix data function]
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(a12, 8);
+}
+
 TEST(Matrix, MemberFuncBegin) {
   //! [matrix begin function]
 
@@ -384,6 +398,19 @@ TEST(Matrix, MemberFuncDet) {
   EXPECT_EQ(det, -2);
 }
 
+TEST(Matrix, MemberFuncInverse) {
+  //! [matrix inverse function]
+
+  mu::Matrix<2, 2, float> a{{4.0F, 7.0F}, {2.0F, 6.0F}};
+  mu::Matrix<2, 2, float> b = a.inverse();  // {{0.6, -0.7}, {-0.2, 0.4}}
+  mu::Matrix<2, 2, int> c{{4, 7}, {2, 6}};
+  mu::Matrix<2, 2, double> d = c.inverse<double>();
+
+  //! [matrix inverse function]
+  EXPECT_FLOAT_EQ(b[0][1], -0.7F);
+  EXPECT_DOUBLE_EQ(d[1][0], -0.2);
+}
+
 TEST(Matrix, MemberFuncTranspose) {
   //! [matrix transpose function]
 
@@ -462,6 +489,30 @@ TEST(Matrix, MemberFuncStd) {
   EXPECT_FLOAT_EQ(std2, 1.92028642F);
 }
 
+TEST(Matrix, MemberFuncVariance) {
+  //! [matrix variance function]
+
+  mu::Matrix<2, 2, int> a{{2, 3}, {5, 7}};
+  int var1 = a.variance();           // 3 (because a holds type int)
+  float var2 = a.variance<float>();  // 3.6875
+
+  //! [matrix variance function]
+  EXPECT_EQ(var1, 3);
+  EXPECT_FLOAT_EQ(var2, 3.6875F);
+}
+
+TEST(Matrix, MemberFuncMeanAndStd) {
+  //! [matrix mean_and_std function]
+
+  mu::Matrix<2, 2, int> a{{2, 3}, {5, 7}};
+  std::pair<float, float> res = a.mean_and_std<float>();
+  // res.first: 4.25 (mean), res.second: 1.92028642 (std)
+
+  //! [matrix mean_and_std function]
+  EXPECT_FLOAT_EQ(res.first, 4.25F);
+  EXPECT_FLOAT_EQ(res.second, 1.92028642F);
+}
+
 TEST(Matrix, OperatorStreamOut) {
   //! [matrix operator stream out]
 
@@ -473,4 +524,16 @@ TEST(Matrix, OperatorStreamOut) {
   //! [matrix operator stream out]
   EXPECT_THAT(a[0], ::testing::ElementsAre(2, 3));
   EXPECT_THAT(a[1], ::testing::ElementsAre(5, 7));
-}
\ No newline at end of file
+}
+TEST(Matrix, ConstantExpression) {
+  //! [matrix constant expression]
+
+  // calculated at compile time and stored in read-only memory
+  constexpr mu::Matrix<2, 2, float> a{{0.0F, -1.0F}, {1.0F, 0.0F}};
+  constexpr mu::Matrix<2, 2, float> b = a.dot(a.transposed());
+  static_assert(b == mu::eye<2, float>(), "evaluated at compile time");
+  constexpr mu::Vector<2, float> c = a.dot(mu::Vector<2, float>{1.0F, 0.0F});
+
+  //! [matrix constant expression]
+  EXPECT_THAT(c, ::testing::ElementsAre(0.0F, 1.0F));
+}
@@ -0,0 +1,89 @@
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/vector.h"
+
+TEST(Parallel, ThreadPoolSubmit) {
+  //! [parallel threadpool submit function]
+
+  mu::parallel::ThreadPool pool(4);
+  std::atomic<int> done{0};
+  pool.submit([&done] { done++; });
+  // help executing tasks while waiting for them
+  while (done == 0) {
+    pool.run_pending();
+  }
+
+  //! [parallel threadpool submit function]
+  EXPECT_EQ(done, 1);
+}
+
+TEST(Parallel, ForChunks) {
+  //! [parallel for_chunks function]
+
+  std::vector<int> a(1000);
+  mu::parallel::for_chunks(a.size(), 100, [&a](std::size_t b, std::size_t e) {
+    for (std::size_t i = b; i < e; i++) {
+      a[i] = static_cast<int>(i);
+    }
+  });
+
+  //! [parallel for_chunks function]
+  EXPECT_EQ(a[999], 999);
+}
+
+TEST(Parallel, ForEach) {
+  //! [parallel for_each function]
+
+  std::vector<mu::Vector<2, float>> a(1000, {3.0F, 4.0F});
+  mu::parallel::for_each(a.begin(), a.end(),
+                         [](mu::Vector<2, float> &v) { v.normalize(); });
+
+  //! [parallel for_each function]
+  EXPECT_THAT(a[999], ::testing::ElementsAre(0.6F, 0.8F));
+}
+
+TEST(Parallel, Transform) {
+  //! [parallel transform function]
+
+  std::vector<mu::Matrix<2, 2, int>> a(1000, {{1, 2}, {3, 4}});
+  std::vector<int> b(a.size());
+  mu::parallel::transform(a.begin(), a.end(), b.begin(),
+                          [](const mu::Matrix<2, 2, int> &m) { return m.det(); });
+
+  //! [parallel transform function]
+  EXPECT_EQ(b[999], -2);
+}
+
+TEST(Parallel, TransformBinary) {
+  //! [parallel binary transform function]
+
+  std::vector<mu::Vector<2, int>> a(1000, {1, 2});
+  std::vector<mu::Vector<2, int>> b(1000, {3, 4});
+  std::vector<int> c(a.size());
+  mu::parallel::transform(
+      a.begin(), a.end(), b.begin(), c.begin(),
+      [](const mu::Vector<2, int> &l, const mu::Vector<2, int> &r) {
+        return l.dot(r);
+      });
+
+  //! [parallel binary transform function]
+  EXPECT_EQ(c[999], 11);
+}
+
+TEST(Parallel, Reduce) {
+  //! [parallel reduce function]
+
+  std::vector<mu::Vector<2, int>> a(1000, {1, 2});
+  mu::Vector<2, int> b = mu::parallel::reduce(
+      a.begin(), a.end(), mu::Vector<2, int>{0, 0},
+      std::plus<mu::Vector<2, int>>());
+
+  //! [parallel reduce function]
+  EXPECT_THAT(b, ::testing::ElementsAre(1000, 2000));
+}
@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/mapped.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/parse.h"
+#include "mu/vector.h"
+
+TEST(Parse, Vector) {
+  //! [parse vector]
+
+  std::string text = "[ 1.5, -2, 3 ] and more";
+  mu::Vector<3, float> a;
+  const char *end = mu::parse_from(text.data(), text.data() + text.size(), a);
+  // a is [ 1.5, -2, 3 ] and end points to " and more"
+
+  //! [parse vector]
+  EXPECT_THAT(a, ::testing::ElementsAre(1.5F, -2.0F, 3.0F));
+  EXPECT_EQ(std::string(end), " and more");
+}
+
+TEST(Parse, Matrix) {
+  //! [parse matrix]
+
+  std::string text = "[[1,2],[3,4]]";  // or "1 2 3 4", "1,2,3,4" etc.
+  mu::Matrix<2, 2, int> a;
+  const char *end = mu::parse_from(text.data(), text.data() + text.size(), a);
+  const char *none =
+      mu::parse_from(text.data(), text.data() + 6, a);  // nullptr
+
+  //! [parse matrix]
+  EXPECT_EQ(a, (mu::Matrix<2, 2, int>{{1, 2}, {3, 4}}));
+  EXPECT_EQ(end, text.data() + text.size());
+  EXPECT_EQ(none, nullptr);
+}
+
+TEST(Parse, List) {
+  //! [parse list]
+
+  std::string csv = "1,2,3\n4,5,6\n";
+  std::vector<mu::Vector<3, int>> a =
+      mu::parse_list<mu::Vector<3, int>>(csv.data(), csv.data() + csv.size());
+  // [ 1, 2, 3 ] and [ 4, 5, 6 ]
+
+  //! [parse list]
+  ASSERT_EQ(a.size(), 2);
+  EXPECT_THAT(a[1], ::testing::ElementsAre(4, 5, 6));
+}
+
+TEST(Parse, MappedFile) {
+  const std::string path = ::testing::TempDir() + "mu_example_points.txt";
+  std::ofstream(path) << "1.5 2 3\n4 5 6\n";
+  //! [parse mapped file]
+
+  mu::MappedFile file(path);  // the text isn't copied
+  std::vector<mu::Vector<3, float>> a =
+      mu::parse_list<mu::Vector<3, float>>(file);
+
+  //! [parse mapped file]
+  ASSERT_EQ(a.size(), 2);
+  EXPECT_THAT(a[0], ::testing::ElementsAre(1.5F, 2.0F, 3.0F));
+  std::remove(path.c_str());
+}
+
+TEST(Parse, ParallelList) {
+  //! [parse parallel list]
+
+  mu::parallel::ThreadPool pool(3);
+  std::string csv = "1,2,3\n4,5,6\n7,8,9\n";
+  std::size_t chunk_bytes = 4;  // usually much more
+  std::vector<mu::Vector<3, int>> a = mu::parallel::parse_list<
+      mu::Vector<3, int>>(pool, csv.data(), csv.data() + csv.size(),
+                          chunk_bytes);
+  // the same as mu::parse_list
+
+  //! [parse parallel list]
+  ASSERT_EQ(a.size(), 3);
+  EXPECT_THAT(a[2], ::testing::ElementsAre(7, 8, 9));
+}
@@ -0,0 +1,151 @@
+#include <cmath>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/vector3d.h"
+
+TEST(Quaternion, Constructor) {
+  //! [quaternion constructor]
+
+  mu::Quaternion<float> q;  // identity { 1, 0, 0, 0 }
+
+  //! [quaternion constructor]
+  EXPECT_EQ(q, (mu::Quaternion<float>{1.0F, 0.0F, 0.0F, 0.0F}));
+}
+
+TEST(Quaternion, ConstructorComponents) {
+  //! [quaternion components constructor]
+
+  mu::Quaternion<float> q{0.5F, 0.5F, 0.5F, 0.5F};
+  float w = q.w();  // 0.5
+  float z = q.z();  // 0.5
+
+  //! [quaternion components constructor]
+  EXPECT_EQ(w, 0.5F);
+  EXPECT_EQ(z, 0.5F);
+}
+
+TEST(Quaternion, ConstructorAxisAngle) {
+  //! [quaternion axis angle constructor]
+
+  // 90 degrees around the z axis
+  mu::Quaternion<double> q{mu::Vector3D<double>{0.0, 0.0, 1.0}, 3.14159265 / 2};
+  // q is { 0.7071, 0, 0, 0.7071 }
+
+  //! [quaternion axis angle constructor]
+  EXPECT_NEAR(q.w(), 0.70710678, 1e-8);
+  EXPECT_NEAR(q.z(), 0.70710678, 1e-8);
+}
+
+TEST(Quaternion, ConstructorMatrix) {
+  //! [quaternion matrix constructor]
+
+  mu::Matrix<3, 3, double> r{
+      {0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}};
+  mu::Quaternion<double> q{r};  // { 0.7071, 0, 0, 0.7071 }
+
+  //! [quaternion matrix constructor]
+  EXPECT_NEAR(q.w(), 0.70710678, 1e-8);
+  EXPECT_NEAR(q.z(), 0.70710678, 1e-8);
+}
+
+TEST(Quaternion, MemberFuncRotate) {
+  //! [quaternion rotate function]
+
+  mu::Quaternion<double> q{mu::Vector3D<double>{0.0, 0.0, 1.0}, 3.14159265 / 2};
+  mu::Vector3D<double> v = q.rotate({1.0, 0.0, 0.0});  // { 0, 1, 0 }
+
+  //! [quaternion rotate function]
+  EXPECT_NEAR(v[0], 0.0, 1e-8);
+  EXPECT_NEAR(v[1], 1.0, 1e-8);
+}
+
+TEST(Quaternion, MemberFuncRotateRange) {
+  //! [quaternion batched rotate function]
+
+  mu::Quaternion<double> q{mu::Vector3D<double>{0.0, 0.0, 1.0}, 3.14159265 / 2};
+  std::vector<mu::Vector3D<double>> points{
+      {1.0, 0.0, 0.0}, {0.0, 2.0, 0.0}, {0.0, 0.0, 3.0}};
+  // in-place
+  q.rotate(points.begin(), points.end(), points.begin());
+  // points are { 0, 1, 0 }, { -2, 0, 0 }, { 0, 0, 3 }
+
+  //! [quaternion batched rotate function]
+  EXPECT_NEAR(points[0][1], 1.0, 1e-8);
+  EXPECT_NEAR(points[1][0], -2.0, 1e-8);
+  EXPECT_NEAR(points[2][2], 3.0, 1e-8);
+}
+
+TEST(Quaternion, MemberFuncToMatrix) {
+  //! [quaternion to_matrix function]
+
+  mu::Quaternion<float> q{0.0F, 1.0F, 0.0F, 0.0F};  // 180 degrees around x
+  mu::Matrix<3, 3, float> r = q.to_matrix();
+  // { { 1, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 } }
+
+  //! [quaternion to_matrix function]
+  EXPECT_THAT(r[0], ::testing::ElementsAre(1.0F, 0.0F, 0.0F));
+  EXPECT_THAT(r[1], ::testing::ElementsAre(0.0F, -1.0F, 0.0F));
+  EXPECT_THAT(r[2], ::testing::ElementsAre(0.0F, 0.0F, -1.0F));
+}
+
+TEST(Quaternion, MemberFuncNormalize) {
+  //! [quaternion normalize function]
+
+  mu::Quaternion<float> q{1.0F, 2.0F, 2.0F, 4.0F};
+  float n = q.norm();  // 5
+  q.normalize();       // { 0.2, 0.4, 0.4, 0.8 }
+
+  //! [quaternion normalize function]
+  EXPECT_FLOAT_EQ(n, 5.0F);
+  EXPECT_FLOAT_EQ(q.z(), 0.8F);
+}
+
+TEST(Quaternion, MemberFuncConjugate) {
+  //! [quaternion conjugate function]
+
+  mu::Quaternion<float> q{0.5F, 0.5F, 0.5F, 0.5F};
+  mu::Quaternion<float> inv = q.conjugate();  // { 0.5, -0.5, -0.5, -0.5 }
+
+  //! [quaternion conjugate function]
+  EXPECT_EQ(inv, (mu::Quaternion<float>{0.5F, -0.5F, -0.5F, -0.5F}));
+}
+
+TEST(Quaternion, OperatorMultiplication) {
+  //! [quaternion multiplication operator]
+
+  mu::Vector3D<double> z{0.0, 0.0, 1.0};
+  mu::Quaternion<double> a{z, 0.25};
+  mu::Quaternion<double> b{z, 0.5};
+  mu::Quaternion<double> c = a * b;  // 0.75 around z. b is applied first
+
+  //! [quaternion multiplication operator]
+  EXPECT_NEAR(c.w(), std::cos(0.375), 1e-12);
+}
+
+TEST(Quaternion, FreeFuncSlerp) {
+  //! [quaternion slerp function]
+
+  mu::Vector3D<double> z{0.0, 0.0, 1.0};
+  mu::Quaternion<double> a{z, 0.0};
+  mu::Quaternion<double> b{z, 1.0};
+  mu::Quaternion<double> q = mu::slerp(a, b, 0.25);  // 0.25 around z
+
+  //! [quaternion slerp function]
+  EXPECT_NEAR(q.w(), std::cos(0.125), 1e-12);
+}
+
+TEST(Quaternion, FreeFuncNlerp) {
+  //! [quaternion nlerp function]
+
+  mu::Vector3D<double> z{0.0, 0.0, 1.0};
+  mu::Quaternion<double> a{z, 0.0};
+  mu::Quaternion<double> b{z, 1.0};
+  mu::Quaternion<double> q = mu::nlerp(a, b, 0.5);  // 0.5 around z
+
+  //! [quaternion nlerp function]
+  EXPECT_NEAR(q.w(), std::cos(0.25), 1e-12);
+}
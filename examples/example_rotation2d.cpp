@@ -0,0 +1,108 @@
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/literals.h"
+#include "mu/matrix.h"
+#include "mu/rotation2d.h"
+#include "mu/vector2d.h"
+
+TEST(Rotation2D, ConstructorAngle) {
+  //! [rotation2d angle constructor]
+
+  // sine and cosine are calculated once
+  mu::Rotation2D<float> rot{mu::pi2};
+  float c = rot.cos();    // 0
+  float s = rot.sin();    // 1
+  float a = rot.angle();  // pi/2
+
+  //! [rotation2d angle constructor]
+  EXPECT_NEAR(c, 0.0F, 1.e-6F);
+  EXPECT_FLOAT_EQ(s, 1.0F);
+  EXPECT_FLOAT_EQ(a, static_cast<float>(mu::pi2));
+}
+
+TEST(Rotation2D, ConstructorCosSin) {
+  //! [rotation2d cos sin constructor]
+
+  mu::Rotation2D<double> rot{0.6, 0.8};
+  double a = rot.angle();  // 0.9273
+
+  //! [rotation2d cos sin constructor]
+  EXPECT_NEAR(a, 0.92729521, 1e-8);
+}
+
+TEST(Rotation2D, MemberFuncRotate) {
+  //! [rotation2d rotate function]
+
+  mu::Rotation2D<double> rot{0.6, 0.8};
+  mu::Vector2D<double> a = rot.rotate(mu::Vector2D<double>{1.0, 0.0});
+  // [ 0.6, 0.8 ]
+
+  //! [rotation2d rotate function]
+  EXPECT_THAT(a, ::testing::ElementsAre(0.6, 0.8));
+}
+
+TEST(Rotation2D, MemberFuncRotateRange) {
+  //! [rotation2d batched rotate function]
+
+  mu::Rotation2D<float> rot{mu::pi2};
+  std::vector<mu::Vector2D<float>> points{{1.0F, 0.0F}, {0.0F, 2.0F}};
+  // in-place. pointers use the SIMD kernel
+  rot.rotate(points.data(), points.data() + points.size(), points.data());
+  // points are [ 0, 1 ], [ -2, 0 ]
+
+  //! [rotation2d batched rotate function]
+  EXPECT_NEAR(points[0][0], 0.0F, 1.e-6F);
+  EXPECT_NEAR(points[0][1], 1.0F, 1.e-6F);
+  EXPECT_NEAR(points[1][0], -2.0F, 1.e-6F);
+  EXPECT_NEAR(points[1][1], 0.0F, 1.e-6F);
+}
+
+TEST(Rotation2D, MemberFuncInverse) {
+  //! [rotation2d inverse function]
+
+  mu::Rotation2D<double> rot{0.6, 0.8};
+  mu::Rotation2D<double> inv = rot.inverse();  // { 0.6, -0.8 }
+
+  //! [rotation2d inverse function]
+  EXPECT_EQ(inv.sin(), -0.8);
+}
+
+TEST(Rotation2D, MemberFuncToMatrix) {
+  //! [rotation2d to_matrix function]
+
+  mu::Rotation2D<double> rot{0.6, 0.8};
+  mu::Matrix<2, 2, double> r = rot.to_matrix();
+  // { { 0.6, -0.8 }, { 0.8, 0.6 } }
+
+  //! [rotation2d to_matrix function]
+  EXPECT_THAT(r[0], ::testing::ElementsAre(0.6, -0.8));
+  EXPECT_THAT(r[1], ::testing::ElementsAre(0.8, 0.6));
+}
+
+TEST(Rotation2D, OperatorMultiplication) {
+  //! [rotation2d multiplication operator]
+
+  mu::Rotation2D<double> a{0.25};
+  mu::Rotation2D<double> b{0.5};
+  mu::Rotation2D<double> c = a * b;  // 0.75
+
+  //! [rotation2d multiplication operator]
+  EXPECT_NEAR(c.angle(), 0.75, 1e-12);
+}
+
+TEST(Rotation2D, FreeFuncRotateAngles) {
+  //! [rotation2d per vector angles]
+
+  std::vector<mu::Vector2D<float>> points{{1.0F, 0.0F}, {1.0F, 0.0F}};
+  std::vector<float> angles{mu::pi2, mu::pi};
+  mu::rotate(points.begin(), points.end(), angles.begin(), points.begin());
+  // points are [ 0, 1 ], [ -1, 0 ]
+
+  //! [rotation2d per vector angles]
+  EXPECT_NEAR(points[0][0], 0.0F, 1.e-6F);
+  EXPECT_NEAR(points[0][1], 1.0F, 1.e-6F);
+  EXPECT_NEAR(points[1][0], -1.0F, 1.e-6F);
+  EXPECT_NEAR(points[1][1], 0.0F, 1.e-6F);
+}
@@ -0,0 +1,62 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/solve.h"
+#include "mu/vector.h"
+
+TEST(Solve, FreeFuncSolve) {
+  //! [solve function]
+
+  mu::Matrix<2, 2, double> a{{2.0, 1.0}, {1.0, 3.0}};
+  mu::Vector<2, double> b{3.0, 5.0};
+  mu::Vector<2, double> x = mu::solve(a, b);  // {0.8, 1.4}
+
+  //! [solve function]
+  EXPECT_DOUBLE_EQ(x[0], 0.8);
+  EXPECT_DOUBLE_EQ(x[1], 1.4);
+}
+
+TEST(Solve, FreeFuncSolveMatrix) {
+  //! [solve matrix function]
+
+  mu::Matrix<2, 2, double> a{{2.0, 0.0}, {0.0, 4.0}};
+  mu::Matrix<2, 2, double> b{{2.0, 4.0}, {4.0, 8.0}};
+  mu::Matrix<2, 2, double> x = mu::solve(a, b);  // {{1, 2}, {1, 2}}
+
+  //! [solve matrix function]
+  EXPECT_THAT(x[0], ::testing::ElementsAre(1.0, 2.0));
+  EXPECT_THAT(x[1], ::testing::ElementsAre(1.0, 2.0));
+}
+
+TEST(Solve, LU) {
+  //! [lu decomposition]
+
+  mu::Matrix<3, 3, double> a{{0.0, 2.0, 1.0}, {1.0, 1.0, 0.0}, {2.0, 0.0, 1.0}};
+  // decompose once, solve many times
+  mu::LU<3, double> lu(a);
+  bool singular = lu.singular();                  // false
+  double det = lu.det();                          // -4
+  mu::Vector<3, double> x = lu.solve({3.0, 2.0, 3.0});  // {1, 1, 1}
+  mu::Vector<3, double> y = lu.solve({1.0, 1.0, 2.0});  // {0.75, 0.25, 0.5}
+
+  //! [lu decomposition]
+  EXPECT_FALSE(singular);
+  EXPECT_DOUBLE_EQ(det, -4.0);
+  EXPECT_THAT(x, ::testing::ElementsAre(1.0, 1.0, 1.0));
+  EXPECT_THAT(y, ::testing::ElementsAre(0.75, 0.25, 0.5));
+}
+
+TEST(Solve, Cholesky) {
+  //! [cholesky decomposition]
+
+  mu::Matrix<2, 2, double> a{{4.0, 2.0}, {2.0, 5.0}};
+  mu::Cholesky<2, double> chol(a);
+  bool spd = chol.positive_definite();  // true
+  mu::Matrix<2, 2, double> l = chol.l();  // {{2, 0}, {1, 2}}
+  mu::Vector<2, double> x = chol.solve({6.0, 7.0});  // {1, 1}
+
+  //! [cholesky decomposition]
+  EXPECT_TRUE(spd);
+  EXPECT_THAT(l[1], ::testing::ElementsAre(1.0, 2.0));
+  EXPECT_THAT(x, ::testing::ElementsAre(1.0, 1.0));
+}
@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/sparse.h"
+#include "mu/vector.h"
+
+TEST(Sparse, Constructor) {
+  //! [sparse constructor]
+
+  std::size_t rows = 1000;  // known at run time
+  std::size_t cols = 2000;  // known at run time
+  mu::CsrMatrix<float> a(rows, cols, {{0, 0, 1.0F}, {999, 5, 2.0F}});
+  float a00 = a(0, 0);  // 1.0F
+  float a10 = a(1, 0);  // 0.0F, not stored
+  mu::CscMatrix<float> b(rows, cols, {{3, 7, 4.0F}});  // column by column
+
+  //! [sparse constructor]
+  EXPECT_EQ(a.nonzeros(), 2);
+  EXPECT_EQ(a00, 1.0F);
+  EXPECT_EQ(a10, 0.0F);
+  EXPECT_EQ(b(3, 7), 4.0F);
+}
+
+TEST(Sparse, ConstructorMatrix) {
+  //! [sparse from matrix constructor]
+
+  mu::Matrix<2, 3, int> a = {{0, 1, 0}, {2, 0, 3}};
+  mu::SparseMatrix<int> b(a);  // the 3 non-zero values
+
+  //! [sparse from matrix constructor]
+  EXPECT_EQ(b.nonzeros(), 3);
+}
+
+TEST(Sparse, Storage) {
+  //! [sparse storage]
+
+  mu::CsrMatrix<int> a(mu::Matrix<2, 3, int>{{0, 1, 0}, {2, 0, 3}});
+  const std::size_t *offsets = a.outer_index();  // 0, 1, 3
+  const std::size_t *cols = a.inner_index();     // 1, 0, 2
+  const int *values = a.values();                // 1, 2, 3
+
+  //! [sparse storage]
+  EXPECT_THAT(std::vector<std::size_t>(offsets, offsets + 3),
+              ::testing::ElementsAre(0, 1, 3));
+  EXPECT_THAT(std::vector<std::size_t>(cols, cols + 3),
+              ::testing::ElementsAre(1, 0, 2));
+  EXPECT_THAT(std::vector<int>(values, values + 3),
+              ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(Sparse, MemberFunctions) {
+  //! [sparse member functions]
+
+  mu::CsrMatrix<int> a(mu::Matrix<2, 3, int>{{0, 1, 0}, {2, 0, 3}});
+  mu::CsrMatrix<int> b = a.transposed();  // 3x2
+  mu::CscMatrix<int> c = a.to_csc();      // the same values, col by col
+  mu::DynMatrix<int> d = a.to_dense();    // [ [ 0, 1, 0 ], [ 2, 0, 3 ] ]
+
+  //! [sparse member functions]
+  EXPECT_EQ(b.to_dense(), d.transposed());
+  EXPECT_EQ(c.to_dense(), d);
+}
+
+TEST(Sparse, MemberFuncDot) {
+  //! [sparse dot function]
+
+  mu::CsrMatrix<int> a(mu::Matrix<2, 3, int>{{0, 1, 0}, {2, 0, 3}});
+  mu::DynVector<int> b = {1, 2, 3};
+  mu::DynVector<int> c = a.dot(b);  // [ 2, 11 ]
+  mu::DynVector<int> d = a.dot(mu::Vector<3, int>{1, 2, 3});  // [ 2, 11 ]
+
+  //! [sparse dot function]
+  EXPECT_THAT(c, ::testing::ElementsAre(2, 11));
+  EXPECT_THAT(d, ::testing::ElementsAre(2, 11));
+}
+
+TEST(Sparse, ParallelDot) {
+  //! [sparse parallel dot function]
+
+  mu::parallel::ThreadPool pool(3);
+  mu::CsrMatrix<int> a(mu::Matrix<2, 3, int>{{0, 1, 0}, {2, 0, 3}});
+  mu::DynVector<int> b = {1, 2, 3};
+  mu::DynVector<int> c = mu::parallel::dot(pool, a, b);  // [ 2, 11 ]
+
+  //! [sparse parallel dot function]
+  EXPECT_THAT(c, ::testing::ElementsAre(2, 11));
+}
@@ -0,0 +1,52 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/statistics.h"
+#include "mu/vector.h"
+
+TEST(RunningStats, MemberFuncPush) {
+  //! [runningstats push function]
+
+  mu::RunningStats<2, float> stats;
+  stats.push({1.0F, 10.0F});
+  stats.push({2.0F, 20.0F});
+  stats.push({3.0F, 30.0F});
+  mu::Vector<2, float> mean = stats.mean();      // {2, 20}
+  mu::Vector<2, float> var = stats.variance();   // {0.6666, 66.666}
+  mu::Vector<2, float> std = stats.std();        // {0.8164, 8.1649}
+  mu::Vector<2, float> max = stats.max();        // {3, 30}
+
+  //! [runningstats push function]
+  EXPECT_THAT(mean, ::testing::ElementsAre(2.0F, 20.0F));
+  EXPECT_FLOAT_EQ(var[1], 200.0F / 3.0F);
+  EXPECT_FLOAT_EQ(std[0], 0.81649658F);
+  EXPECT_THAT(max, ::testing::ElementsAre(3.0F, 30.0F));
+}
+
+TEST(RunningStats, MemberFuncCovariance) {
+  //! [runningstats covariance function]
+
+  mu::RunningStats<2, double> stats;
+  stats.push({1.0, 2.0});
+  stats.push({3.0, 6.0});
+  mu::Matrix<2, 2, double> cov = stats.covariance();  // {{1, 2}, {2, 4}}
+
+  //! [runningstats covariance function]
+  EXPECT_THAT(cov[0], ::testing::ElementsAre(1.0, 2.0));
+  EXPECT_THAT(cov[1], ::testing::ElementsAre(2.0, 4.0));
+}
+
+TEST(RunningStats, MemberFuncMerge) {
+  //! [runningstats merge function]
+
+  // e.g. one object per thread
+  mu::RunningStats<2, double> a;
+  mu::RunningStats<2, double> b;
+  a.push({1.0, 2.0});
+  b.push({3.0, 6.0});
+  a.merge(b);  // same as pushing both samples to a
+
+  //! [runningstats merge function]
+  EXPECT_EQ(a.count(), 2);
+  EXPECT_THAT(a.mean(), ::testing::ElementsAre(2.0, 4.0));
+}
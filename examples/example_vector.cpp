@@ -1,4 +1,5 @@
 #include <array>
+#include <cmath>
 #include <functional>
 #include <iostream>
 #include <utility>
@@ -178,6 +179,28 @@ TEST(Vector, MemberFuncAtConst) {
   EXPECT_EQ(second, a[1]);
 }
 
+TEST(Vector, MemberFuncData) {
+  //! [vector data function]
+
+  mu::Vector<3, int> a{2, 3, 4};
+  int *p = a.data();
+  p[1] = 7;  // a is now [ 2, 7, 4 ]
+
+  //! [vector data function]
+  EXPECT_THAT(a, ::testing::ElementsAre(2, 7, 4));
+}
+
+TEST(Vector, MemberFuncDataConst) {
+  //! [vector const data function]
+
+  const mu::Vector<3, int> a{2, 3, 4};
+  const int *p = a.data();
+  int second = p[1];  // 3
+
+  //! [vector const data function]
+  EXPECT_EQ(second, 3);
+}
+
 TEST(Vector, MemberFuncSize) {
   //! [vector size function]
 
@@ -322,6 +345,30 @@ TEST(Vector, MemberFuncStd) {
   EXPECT_FLOAT_EQ(std2, 1.92028642F);
 }
 
+TEST(Vector, MemberFuncVariance) {
+  //! [vector variance function]
+
+  mu::Vector<4, int> a{2, 3, 5, 7};
+  int var1 = a.variance();           // 3 (because a holds type int)
+  float var2 = a.variance<float>();  // 3.6875
+
+  //! [vector variance function]
+  EXPECT_EQ(var1, 3);
+  EXPECT_FLOAT_EQ(var2, 3.6875F);
+}
+
+TEST(Vector, MemberFuncMeanAndStd) {
+  //! [vector mean_and_std function]
+
+  mu::Vector<4, int> a{2, 3, 5, 7};
+  std::pair<float, float> res = a.mean_and_std<float>();
+  // res.first: 4.25 (mean), res.second: 1.92028642 (std)
+
+  //! [vector mean_and_std function]
+  EXPECT_FLOAT_EQ(res.first, 4.25F);
+  EXPECT_FLOAT_EQ(res.second, 1.92028642F);
+}
+
 TEST(Vector, MemberFuncLength) {
   //! [vector length function]
 
@@ -427,4 +474,36 @@ TEST(Vector, OperatorStreamOut) {
 
   //! [vector operator stream out]
   EXPECT_THAT(a, ::testing::ElementsAre(2, 3, 4, 5));
-}
\ No newline at end of file
+}
+TEST(Vector, ConstantExpression) {
+  //! [vector constant expression]
+
+  // calculated at compile time and stored in read-only memory
+  constexpr mu::Vector<3, float> a{1.0F, 2.0F, 3.0F};
+  constexpr mu::Vector<3, float> b = a * 2.0F + mu::ones<3, float>();
+  constexpr float c = a.dot(b);
+  static_assert(c == 34.0F, "evaluated at compile time");
+
+  //! [vector constant expression]
+  EXPECT_THAT(b, ::testing::ElementsAre(3.0F, 5.0F, 7.0F));
+}
+
+TEST(Vector, EqualsTolerance) {
+  //! [vector equals tolerance]
+
+  mu::Vector<2, float> a = {1.0F, 100.0F};
+  mu::Vector<2, float> b = {std::nextafter(1.0F, 2.0F), 100.001F};
+
+  // relative epsilon, the same as operator==
+  bool relative = a.equals(b, mu::Tolerance::relative());
+  // at most 4 representable floats apart
+  bool ulp = a.equals(b, mu::Tolerance::ulp(4));
+  // absolute difference of at most 0.01
+  bool absolute = a.equals(b, mu::Tolerance::absolute(0.01));
+
+  //! [vector equals tolerance]
+  EXPECT_TRUE(relative);
+  EXPECT_FALSE(ulp);
+  EXPECT_TRUE(absolute);
+  EXPECT_EQ(relative, a == b);
+}
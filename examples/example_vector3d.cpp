@@ -1,6 +1,7 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "mu/literals.h"
 #include "mu/vector3d.h"
 
 TEST(Vector3D, ConstructorFromDifferentType) {
@@ -71,4 +72,110 @@ TEST(Vector3D, MemberFuncZConst) {
 
   //! [vector3d const z function]
   EXPECT_EQ(z, 9);
-}
\ No newline at end of file
+}
+TEST(Vector3D, MemberFuncCross) {
+  //! [vector3d cross function]
+
+  mu::Vector3D<int> a = {1, 0, 0};
+  mu::Vector3D<int> b = {0, 1, 0};
+  mu::Vector3D<int> c = a.cross(b);  // [ 0, 0, 1 ]
+  mu::Vector3D<int> d = mu::cross(b, a);  // [ 0, 0, -1 ]
+
+  //! [vector3d cross function]
+  EXPECT_THAT(c, ::testing::ElementsAre(0, 0, 1));
+  EXPECT_THAT(d, ::testing::ElementsAre(0, 0, -1));
+}
+
+TEST(Vector3D, MemberFuncUnitCross) {
+  //! [vector3d unit_cross function]
+
+  mu::Vector3D<float> a = {2.0F, 0.0F, 0.0F};
+  mu::Vector3D<float> b = {1.0F, 3.0F, 0.0F};
+  mu::Vector3D<float> n = a.unit_cross(b);  // [ 0, 0, 1 ]
+
+  //! [vector3d unit_cross function]
+  EXPECT_THAT(n, ::testing::ElementsAre(0.0F, 0.0F, 1.0F));
+}
+
+TEST(Vector3D, MemberFuncCosAngle) {
+  //! [vector3d cos_angle function]
+
+  mu::Vector3D<float> a = {2.0F, 0.0F, 0.0F};
+  mu::Vector3D<float> b = {1.0F, 1.0F, 0.0F};
+  float c = a.cos_angle(b);  // 0.7071, i.e. 45 degrees
+
+  //! [vector3d cos_angle function]
+  EXPECT_FLOAT_EQ(c, 0.70710678F);
+}
+
+TEST(Vector3D, MemberFuncRotate) {
+  //! [vector3d rotate function]
+
+  // rotate by pi/2 around the z axis
+  mu::Vector3D<float> a = {1.0F, 0.0F, 5.0F};
+  mu::Vector3D<float> axis = {0.0F, 0.0F, 1.0F};
+  a.rotate(axis, mu::pi2);  // [ 0, 1, 5 ]
+
+  //! [vector3d rotate function]
+  EXPECT_NEAR(a[0], 0.0F, 1.e-6F);
+  EXPECT_NEAR(a[1], 1.0F, 1.e-6F);
+  EXPECT_NEAR(a[2], 5.0F, 1.e-6F);
+}
+
+TEST(Vector3D, MemberFuncRotated) {
+  //! [vector3d rotated function]
+
+  // rotated by pi/2 around the x axis. creates new vector
+  mu::Vector3D<float> a = {0.0F, 1.0F, 0.0F};
+  mu::Vector3D<float> axis = {1.0F, 0.0F, 0.0F};
+  mu::Vector3D<float> b = a.rotated(axis, mu::pi2);  // [ 0, 0, 1 ]
+
+  //! [vector3d rotated function]
+  EXPECT_NEAR(b[1], 0.0F, 1.e-6F);
+  EXPECT_NEAR(b[2], 1.0F, 1.e-6F);
+}
+
+TEST(Vector3D, MemberFuncProject) {
+  //! [vector3d project function]
+
+  mu::Vector3D<float> a = {1.0F, 2.0F, 3.0F};
+  mu::Vector3D<float> onto = {0.0F, 2.0F, 0.0F};
+  a.project(onto);  // [ 0, 2, 0 ]
+
+  //! [vector3d project function]
+  EXPECT_THAT(a, ::testing::ElementsAre(0.0F, 2.0F, 0.0F));
+}
+
+TEST(Vector3D, MemberFuncProjected) {
+  //! [vector3d projected function]
+
+  mu::Vector3D<float> a = {1.0F, 2.0F, 3.0F};
+  mu::Vector3D<float> onto = {1.0F, 0.0F, 0.0F};
+  mu::Vector3D<float> b = a.projected(onto);  // [ 1, 0, 0 ]
+
+  //! [vector3d projected function]
+  EXPECT_THAT(b, ::testing::ElementsAre(1.0F, 0.0F, 0.0F));
+}
+
+TEST(Vector3D, MemberFuncReflect) {
+  //! [vector3d reflect function]
+
+  // a ray that hits the floor
+  mu::Vector3D<float> a = {1.0F, 2.0F, -3.0F};
+  mu::Vector3D<float> normal = {0.0F, 0.0F, 1.0F};
+  a.reflect(normal);  // [ 1, 2, 3 ]
+
+  //! [vector3d reflect function]
+  EXPECT_THAT(a, ::testing::ElementsAre(1.0F, 2.0F, 3.0F));
+}
+
+TEST(Vector3D, MemberFuncReflected) {
+  //! [vector3d reflected function]
+
+  mu::Vector3D<float> a = {1.0F, 2.0F, -3.0F};
+  mu::Vector3D<float> normal = {0.0F, 1.0F, 0.0F};
+  mu::Vector3D<float> b = a.reflected(normal);  // [ 1, -2, -3 ]
+
+  //! [vector3d reflected function]
+  EXPECT_THAT(b, ::testing::ElementsAre(1.0F, -2.0F, -3.0F));
+}
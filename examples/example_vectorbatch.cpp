@@ -0,0 +1,228 @@
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/vector2d.h"
+#include "mu/vector3d.h"
+#include "mu/vectorbatch.h"
+
+TEST(VectorBatch, ConstructorCount) {
+  //! [vectorbatch count constructor]
+
+  mu::VectorBatch<3, float> a(100);  // 100 zero Vectors
+
+  //! [vectorbatch count constructor]
+  EXPECT_EQ(a.size(), 100);
+  EXPECT_THAT(a.get(99), ::testing::ElementsAre(0.0F, 0.0F, 0.0F));
+}
+
+TEST(VectorBatch, ConstructorCountValue) {
+  //! [vectorbatch count value constructor]
+
+  mu::VectorBatch<3, float> a(100, {1.0F, 2.0F, 3.0F});
+
+  //! [vectorbatch count value constructor]
+  EXPECT_EQ(a.size(), 100);
+  EXPECT_THAT(a.get(99), ::testing::ElementsAre(1.0F, 2.0F, 3.0F));
+}
+
+TEST(VectorBatch, ConstructorRange) {
+  //! [vectorbatch range constructor]
+
+  std::vector<mu::Vector3D<float>> v = {{1.0F, 2.0F, 3.0F},
+                                        {4.0F, 5.0F, 6.0F}};
+  mu::VectorBatch<3, float> a(v.begin(), v.end());
+
+  //! [vectorbatch range constructor]
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(4.0F, 5.0F, 6.0F));
+}
+
+TEST(VectorBatch, ConstructorInitializerList) {
+  //! [vectorbatch initializer list constructor]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}, {5, 6}};
+
+  //! [vectorbatch initializer list constructor]
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_THAT(a.get(2), ::testing::ElementsAre(5, 6));
+}
+
+TEST(VectorBatch, MemberFuncPushBack) {
+  //! [vectorbatch push_back function]
+
+  mu::VectorBatch<2, int> a;
+  a.push_back({1, 2});
+  a.push_back({3, 4});
+
+  //! [vectorbatch push_back function]
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(3, 4));
+}
+
+TEST(VectorBatch, MemberFuncLane) {
+  //! [vectorbatch lane function]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}, {5, 6}};
+  int *x = a.lane(0);  // 1, 3, 5
+  x[1] = 7;
+
+  //! [vectorbatch lane function]
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(7, 4));
+}
+
+TEST(VectorBatch, MemberFuncLaneConst) {
+  //! [vectorbatch const lane function]
+
+  const mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}, {5, 6}};
+  const int *y = a.lane(1);  // 2, 4, 6
+
+  //! [vectorbatch const lane function]
+  EXPECT_EQ(y[2], 6);
+}
+
+TEST(VectorBatch, MemberFuncGet) {
+  //! [vectorbatch get function]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}, {5, 6}};
+  mu::Vector2D<int> b = a.get(1);
+
+  //! [vectorbatch get function]
+  EXPECT_THAT(b, ::testing::ElementsAre(3, 4));
+}
+
+TEST(VectorBatch, MemberFuncSet) {
+  //! [vectorbatch set function]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}, {5, 6}};
+  a.set(1, {7, 8});
+
+  //! [vectorbatch set function]
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(7, 8));
+}
+
+TEST(VectorBatch, MemberFuncGather) {
+  //! [vectorbatch gather function]
+
+  std::vector<mu::Vector3D<float>> v = {{1.0F, 2.0F, 3.0F},
+                                        {4.0F, 5.0F, 6.0F}};
+  mu::VectorBatch<3, float> a;
+  a.gather(v.begin(), v.end());
+
+  //! [vectorbatch gather function]
+  EXPECT_EQ(a.size(), 2);
+  EXPECT_THAT(a.get(0), ::testing::ElementsAre(1.0F, 2.0F, 3.0F));
+}
+
+TEST(VectorBatch, MemberFuncScatter) {
+  //! [vectorbatch scatter function]
+
+  mu::VectorBatch<3, float> a = {{1.0F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}};
+  std::vector<mu::Vector3D<float>> v(a.size());
+  a.scatter(v.begin());
+
+  //! [vectorbatch scatter function]
+  EXPECT_THAT(v[1], ::testing::ElementsAre(4.0F, 5.0F, 6.0F));
+}
+
+TEST(VectorBatch, MemberFuncDot) {
+  //! [vectorbatch dot function]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}};
+  mu::VectorBatch<2, int> b = {{5, 6}, {7, 8}};
+  std::vector<int> c = a.dot(b);  // 1*5+2*6, 3*7+4*8
+
+  //! [vectorbatch dot function]
+  EXPECT_THAT(c, ::testing::ElementsAre(17, 53));
+}
+
+TEST(VectorBatch, MemberFuncLength) {
+  //! [vectorbatch length function]
+
+  mu::VectorBatch<2, float> a = {{3.0F, 4.0F}, {6.0F, 8.0F}};
+  std::vector<float> b = a.length();
+
+  //! [vectorbatch length function]
+  EXPECT_THAT(b, ::testing::ElementsAre(5.0F, 10.0F));
+}
+
+TEST(VectorBatch, MemberFuncNormalize) {
+  //! [vectorbatch normalize function]
+
+  mu::VectorBatch<2, float> a = {{3.0F, 4.0F}, {0.0F, 2.0F}};
+  a.normalize();
+
+  //! [vectorbatch normalize function]
+  EXPECT_THAT(a.get(0), ::testing::ElementsAre(0.6F, 0.8F));
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(0.0F, 1.0F));
+}
+
+TEST(VectorBatch, MemberFuncNormalized) {
+  //! [vectorbatch normalized function]
+
+  const mu::VectorBatch<2, float> a = {{3.0F, 4.0F}, {0.0F, 2.0F}};
+  mu::VectorBatch<2, float> b = a.normalized();
+
+  //! [vectorbatch normalized function]
+  EXPECT_THAT(b.get(0), ::testing::ElementsAre(0.6F, 0.8F));
+  EXPECT_THAT(b.get(1), ::testing::ElementsAre(0.0F, 1.0F));
+}
+
+TEST(VectorBatch, MemberFuncRotate) {
+  //! [vectorbatch rotate function]
+
+  // rotate all Vectors by pi/2
+  mu::VectorBatch<2, float> a = {{1.0F, 0.0F}, {0.0F, 2.0F}};
+  a.rotate(1.57079632679F);
+
+  //! [vectorbatch rotate function]
+  EXPECT_NEAR(a.get(0)[0], 0.0F, 1e-6F);
+  EXPECT_NEAR(a.get(0)[1], 1.0F, 1e-6F);
+  EXPECT_NEAR(a.get(1)[0], -2.0F, 1e-6F);
+  EXPECT_NEAR(a.get(1)[1], 0.0F, 1e-6F);
+}
+
+TEST(VectorBatch, MemberFuncRotated) {
+  //! [vectorbatch rotated function]
+
+  const mu::VectorBatch<2, float> a = {{1.0F, 0.0F}, {0.0F, 2.0F}};
+  mu::VectorBatch<2, float> b = a.rotated(3.14159265359F);
+
+  //! [vectorbatch rotated function]
+  EXPECT_NEAR(b.get(0)[0], -1.0F, 1e-6F);
+  EXPECT_NEAR(b.get(1)[1], -2.0F, 1e-6F);
+}
+
+TEST(VectorBatch, OperatorPlusEqual) {
+  //! [vectorbatch plus equal operator]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}};
+  mu::VectorBatch<2, int> b = {{5, 6}, {7, 8}};
+  a += b;
+
+  //! [vectorbatch plus equal operator]
+  EXPECT_THAT(a.get(0), ::testing::ElementsAre(6, 8));
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(10, 12));
+}
+
+TEST(VectorBatch, OperatorPlusEqualVector) {
+  //! [vectorbatch plus equal vector operator]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}};
+  a += mu::Vector2D<int>{10, 20};
+
+  //! [vectorbatch plus equal vector operator]
+  EXPECT_THAT(a.get(0), ::testing::ElementsAre(11, 22));
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(13, 24));
+}
+
+TEST(VectorBatch, OperatorPlusEqualScalar) {
+  //! [vectorbatch plus equal scalar operator]
+
+  mu::VectorBatch<2, int> a = {{1, 2}, {3, 4}};
+  a += 1;
+
+  //! [vectorbatch plus equal scalar operator]
+  EXPECT_THAT(a.get(0), ::testing::ElementsAre(2, 3));
+  EXPECT_THAT(a.get(1), ::testing::ElementsAre(4, 5));
+}
@@ -0,0 +1,346 @@
+/**
+ * @file affine3.h
+ *
+ * Affine3 class
+ */
+#ifndef MU_AFFINE3_H_
+#define MU_AFFINE3_H_
+
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/typetraits.h"
+#include "mu/vector.h"
+#include "mu/vector3d.h"
+
+namespace mu {
+
+/**
+ * @brief An affine transformation in three dimensional space
+ *
+ * a 3x3 linear part (e.g. rotation and scale) and a translation. it's the same
+ * as a homogeneous 4x4 matrix whose last row is [ 0, 0, 0, 1 ], but that row
+ * is neither stored nor multiplied:
+ * - transforming a point needs 9 multiplications instead of 16
+ * - a composition needs 36 multiplications instead of 64
+ * - the inverse of a rigid transformation (rotation and translation only) is
+ *   a transpose
+ *
+ * @tparam T floating point type
+ */
+template <typename T>
+class Affine3 {
+  static_assert(std::is_floating_point<T>::value,
+                "Affine3 type T must be a floating point type");
+
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Construct a new Affine3 object. the identity
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 constructor
+   */
+  constexpr Affine3() : linear_{mu::eye<3, T>()}, translation_{T{0}} {}
+
+  /**
+   * @brief Construct a new Affine3 object from the linear part and a
+   * translation
+   *
+   * a point is transformed by the linear part first, then it's translated
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 linear translation constructor
+   * @param linear
+   * @param translation
+   */
+  constexpr Affine3(const Matrix<3, 3, T> &linear,
+                    const Vector<3, T> &translation = Vector<3, T>{T{0}})
+      : linear_{linear}, translation_{translation} {}
+
+  /**
+   * @brief Construct a new Affine3 object from a rotation and a translation
+   *
+   * the quaternion must be normalized
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 quaternion constructor
+   * @param rotation
+   * @param translation
+   */
+  constexpr Affine3(const Quaternion<T> &rotation,
+                    const Vector<3, T> &translation = Vector<3, T>{T{0}})
+      : linear_{rotation.to_matrix()}, translation_{translation} {}
+
+  /**
+   * @brief Construct a new Affine3 object from a homogeneous 4x4 matrix
+   *
+   * the last row of the matrix is ignored, it must be [ 0, 0, 0, 1 ]
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 matrix constructor
+   * @param m
+   */
+  constexpr explicit Affine3(const Matrix<4, 4, T> &m) : Affine3() {
+    for (std::size_t i = 0; i < 3; i++) {
+      for (std::size_t j = 0; j < 3; j++) {
+        linear_[i][j] = m[i][j];
+      }
+      translation_[i] = m[i][3];
+    }
+  }
+
+  /**
+   * @brief linear part, e.g. rotation and scale
+   *
+   * @return Matrix<3, 3, T>&
+   */
+  constexpr Matrix<3, 3, T> &linear() noexcept { return linear_; }
+
+  /**
+   * @brief const linear part, e.g. rotation and scale
+   *
+   * @return const Matrix<3, 3, T>&
+   */
+  constexpr const Matrix<3, 3, T> &linear() const noexcept { return linear_; }
+
+  /**
+   * @brief translation
+   *
+   * @return Vector3D<T>&
+   */
+  constexpr Vector3D<T> &translation() noexcept { return translation_; }
+
+  /**
+   * @brief const translation
+   *
+   * @return const Vector3D<T>&
+   */
+  constexpr const Vector3D<T> &translation() const noexcept {
+    return translation_;
+  }
+
+  /**
+   * @brief transforms a point, i.e. linear part and translation
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 transform_point function
+   * @param p
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> transform_point(const Vector<3, T> &p) const {
+    return Vector3D<T>{row_dot(0, p) + translation_[0],
+                       row_dot(1, p) + translation_[1],
+                       row_dot(2, p) + translation_[2]};
+  }
+
+  /**
+   * @brief transforms a direction, i.e. the linear part only
+   *
+   * a direction is not translated. the w component of a homogeneous direction
+   * is 0
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 transform_direction function
+   * @param d
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> transform_direction(const Vector<3, T> &d) const {
+    return Vector3D<T>{row_dot(0, d), row_dot(1, d), row_dot(2, d)};
+  }
+
+  /**
+   * @brief transforms a range of points and writes them to an output iterator
+   *
+   * out may be equal to first, i.e. the points can be transformed in-place
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 batched transform_points function
+   * @tparam TIt iterator to Vector3D<T> (or Vector<3, T>)
+   * @tparam TOut
+   * @param first
+   * @param last
+   * @param out
+   * @return TOut iterator to the element after the last written one
+   */
+  template <class TIt, class TOut>
+  TOut transform_points(TIt first, TIt last, TOut out) const {
+    const T kL00 = linear_[0][0];
+    const T kL01 = linear_[0][1];
+    const T kL02 = linear_[0][2];
+    const T kL10 = linear_[1][0];
+    const T kL11 = linear_[1][1];
+    const T kL12 = linear_[1][2];
+    const T kL20 = linear_[2][0];
+    const T kL21 = linear_[2][1];
+    const T kL22 = linear_[2][2];
+    const T kTx = translation_[0];
+    const T kTy = translation_[1];
+    const T kTz = translation_[2];
+    for (; first != last; ++first, ++out) {
+      const T kX = (*first)[0];
+      const T kY = (*first)[1];
+      const T kZ = (*first)[2];
+      (*out)[0] = kL00 * kX + kL01 * kY + kL02 * kZ + kTx;
+      (*out)[1] = kL10 * kX + kL11 * kY + kL12 * kZ + kTy;
+      (*out)[2] = kL20 * kX + kL21 * kY + kL22 * kZ + kTz;
+    }
+    return out;
+  }
+
+  /**
+   * @brief inverse of any invertible affine transformation
+   *
+   * \f$ A^{-1} = (L^{-1}, -L^{-1} t) \f$
+   *
+   * the linear part is inverted in closed form. for rigid transformations,
+   * rigid_inverse() is cheaper
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 inverse function
+   * @return Affine3
+   */
+  Affine3 inverse() const {
+    const Matrix<3, 3, T> kInv = linear_.inverse();
+    return Affine3{kInv, T{-1} * Affine3{kInv}.transform_direction(
+                                     translation_)};
+  }
+
+  /**
+   * @brief inverse of a rigid transformation, i.e. the linear part is a
+   * rotation without any scale or shear
+   *
+   * \f$ A^{-1} = (L^T, -L^T t) \f$
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 rigid_inverse function
+   * @return Affine3
+   */
+  constexpr Affine3 rigid_inverse() const {
+    const Matrix<3, 3, T> kInv = linear_.transposed();
+    return Affine3{kInv, T{-1} * Affine3{kInv}.transform_direction(
+                                     translation_)};
+  }
+
+  /**
+   * @brief homogeneous 4x4 matrix of this transformation
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 matrix constructor
+   * @return Matrix<4, 4, T>
+   */
+  constexpr Matrix<4, 4, T> to_matrix() const {
+    Matrix<4, 4, T> ret{T{0}};
+    for (std::size_t i = 0; i < 3; i++) {
+      for (std::size_t j = 0; j < 3; j++) {
+        ret[i][j] = linear_[i][j];
+      }
+      ret[i][3] = translation_[i];
+    }
+    ret[3][3] = T{1};
+    return ret;
+  }
+
+  /********************************* I/O ***********************************/
+
+  /**
+   * @brief print the homogeneous 4x4 matrix
+   *
+   * @tparam U
+   * @param os
+   * @param a
+   * @return std::ostream&
+   */
+  template <class U>
+  friend std::ostream &operator<<(std::ostream &os, const Affine3<U> &a);
+
+  /******************************* operators *******************************/
+
+  /**
+   * @brief equality operator
+   *
+   * @param rhs
+   * @return bool
+   */
+  constexpr bool operator==(const Affine3 &rhs) const {
+    return linear_ == rhs.linear_ && translation_ == rhs.translation_;
+  }
+
+  /**
+   * @brief unequality operator
+   *
+   * @param rhs
+   * @return bool
+   */
+  constexpr bool operator!=(const Affine3 &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief composition
+   *
+   * transforming by the result is the same as transforming by rhs first and
+   * then by this transformation
+   *
+   * \f$ (L_1, t_1) (L_2, t_2) = (L_1 L_2, L_1 t_2 + t_1) \f$
+   *
+   * @par Example
+   * @snippet example_affine3.cpp affine3 multiplication operator
+   * @param rhs
+   * @return Affine3&
+   */
+  constexpr Affine3 &operator*=(const Affine3 &rhs) {
+    translation_ = transform_point(rhs.translation_);
+    Matrix<3, 3, T> linear{T{0}};
+    for (std::size_t i = 0; i < 3; i++) {
+      for (std::size_t j = 0; j < 3; j++) {
+        linear[i][j] = linear_[i][0] * rhs.linear_[0][j] +
+                       linear_[i][1] * rhs.linear_[1][j] +
+                       linear_[i][2] * rhs.linear_[2][j];
+      }
+    }
+    linear_ = linear;
+    return *this;
+  }
+
+ private:
+  Matrix<3, 3, T> linear_;
+  Vector3D<T> translation_;
+
+  /* row i of the linear part times v */
+  constexpr T row_dot(std::size_t i, const Vector<3, T> &v) const {
+    return linear_[i][0] * v[0] + linear_[i][1] * v[1] + linear_[i][2] * v[2];
+  }
+};
+
+/********************************** I/O ************************************/
+
+template <class U>
+std::ostream &operator<<(std::ostream &os, const Affine3<U> &a) {
+  os << a.to_matrix();
+  return os;
+}
+
+/******************************* operators *********************************/
+
+/**
+ * @brief composition
+ *
+ * see Affine3::operator*=()
+ *
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return Affine3<T>
+ */
+template <typename T>
+constexpr Affine3<T> operator*(const Affine3<T> &lhs, const Affine3<T> &rhs) {
+  return Affine3<T>(lhs) *= rhs;
+}
+
+}  // namespace mu
+#endif  // MU_AFFINE3_H_
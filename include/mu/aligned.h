@@ -0,0 +1,647 @@
+/**
+ * @file aligned.h
+ *
+ * AlignedVector and AlignedMatrix classes and free functions
+ */
+#ifndef MU_ALIGNED_H_
+#define MU_ALIGNED_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/simd.h"
+#include "mu/typetraits.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief number of values when N values of type T are padded to a multiple of
+ * the SIMD register size (see mu::SimdTraits)
+ *
+ * e.g. 3 floats are padded to 4 values with SSE and to 8 values with AVX. a
+ * type without a SIMD register is never padded
+ *
+ * @tparam N
+ * @tparam T
+ * @return std::size_t
+ */
+template <std::size_t N, class T>
+constexpr std::size_t simd_padded_size() {
+  return (N + SimdTraits<T>::size - 1) / SimdTraits<T>::size *
+         SimdTraits<T>::size;
+}
+
+/**
+ * @brief the padding values behind the values of an AlignedVector
+ *
+ * a base class, so that an AlignedVector without padding doesn't take any
+ * additional space (empty base optimization)
+ *
+ * @tparam T
+ * @tparam P number of padding values
+ */
+template <class T, std::size_t P>
+class AlignedVectorPadding {
+ private:
+  std::array<T, P> padding_{};
+};
+
+/**
+ * @brief no padding
+ *
+ * @tparam T
+ */
+template <class T>
+class AlignedVectorPadding<T, 0> {};
+
+/**
+ * @brief A Vector that is aligned and padded for the SIMD registers
+ *
+ * the values start at an address that is a multiple of
+ * SimdTraits<T>::alignment and they are followed by padding up to the next
+ * multiple of the register size, i.e. data() points to simd_padded_size()
+ * values. e.g. AlignedVector<3, float> is 16 bytes with SSE: x, y, z and one
+ * padding value. the padding is zero initialized. the operators calculate it
+ * like every other value, so its value is unspecified afterwards (e.g. 0 / 0)
+ * but it's never read as part of the Vector. only floating point types are
+ * padded, so there is no integral division by zero
+ *
+ * the elementwise operators with an AlignedVector or a scalar of the same
+ * type use aligned loads and full registers only, without any remaining
+ * values. everything else is inherited from Vector, so an AlignedVector can
+ * be passed wherever a Vector is expected.
+ *
+ * the padding costs memory, which is a trade-off for large arrays. with AVX
+ * an AlignedVector<3, float> is 32 bytes instead of 12. a loop over a large
+ * array of Vectors is usually vectorized by the compiler anyway, see
+ * mu::VectorBatch. dynamic allocations (e.g. std::vector) are only aligned
+ * since c++17 (aligned new). before, operator new only guarantees the
+ * alignment of std::max_align_t, so a container needs mu::AlignedAllocator
+ *
+ * @par Example
+ * @snippet example_aligned.cpp aligned vector
+ * @tparam N size
+ * @tparam T the type of the values inside the vector
+ */
+template <std::size_t N, typename T>
+class alignas(SimdTraits<T>::alignment) AlignedVector
+    : public Vector<N, T>,
+      private AlignedVectorPadding<T, simd_padded_size<N, T>() - N> {
+ public:
+  /* inherit base class constructors. the padding is zero initialized */
+  using Vector<N, T>::Vector;
+
+  /**
+   * @brief Construct a new AlignedVector object from a Vector object
+   *
+   * @par Example
+   * @snippet example_aligned.cpp aligned vector
+   * @tparam U
+   * @param other
+   */
+  template <class U = T>
+  // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
+  constexpr AlignedVector(const Vector<N, U> &other) : Vector<N, T>(other) {}
+
+  /**
+   * @brief number of values including the padding
+   *
+   * @return std::size_t
+   */
+  static constexpr std::size_t padded_size() noexcept {
+    return simd_padded_size<N, T>();
+  }
+
+  /******************************* operators *******************************/
+
+  /* the operators of the base class for other types */
+  using Vector<N, T>::operator+=;
+  using Vector<N, T>::operator-=;
+  using Vector<N, T>::operator*=;
+  using Vector<N, T>::operator/=;
+
+  /**
+   * @brief plus equal operator. aligned and full registers only
+   *
+   * @param rhs
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator+=(const AlignedVector &rhs) {
+    apply<mu::SimdAdd>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief minus equal operator. aligned and full registers only
+   *
+   * @param rhs
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator-=(const AlignedVector &rhs) {
+    apply<mu::SimdSub>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief multiplication equal operator. aligned and full registers only
+   *
+   * @param rhs
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator*=(const AlignedVector &rhs) {
+    apply<mu::SimdMul>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief division equal operator. aligned and full registers only
+   *
+   * @param rhs
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator/=(const AlignedVector &rhs) {
+    apply<mu::SimdDiv>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief plus equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator+=(const T &scalar) {
+    apply_scalar<mu::SimdAdd>(scalar);
+    return *this;
+  }
+
+  /**
+   * @brief minus equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator-=(const T &scalar) {
+    apply_scalar<mu::SimdSub>(scalar);
+    return *this;
+  }
+
+  /**
+   * @brief multiplication equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator*=(const T &scalar) {
+    apply_scalar<mu::SimdMul>(scalar);
+    return *this;
+  }
+
+  /**
+   * @brief division equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedVector&
+   */
+  constexpr AlignedVector &operator/=(const T &scalar) {
+    apply_scalar<mu::SimdDiv>(scalar);
+    return *this;
+  }
+
+ private:
+  /* lhs[i] op= rhs[i] for all values including the padding, without clearing
+   * it afterwards. a separate store to the padding would stall the next
+   * aligned load of the whole register (store forwarding). constant
+   * expressions use the portable loop, see Vector */
+  template <class TOp>
+  constexpr void apply(const AlignedVector &rhs) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        TOp::scalar((*this)[i], rhs[i]);
+      }
+    } else {
+      static_assert(sizeof(AlignedVector) == padded_size() * sizeof(T),
+                    "AlignedVector values and padding must be contiguous");
+      mu::simd_apply_aligned<TOp>(this->data(), rhs.data(), padded_size());
+    }
+  }
+
+  /* lhs[i] op= scalar. see apply() */
+  template <class TOp>
+  constexpr void apply_scalar(const T &scalar) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        TOp::scalar((*this)[i], scalar);
+      }
+    } else {
+      mu::simd_apply_scalar_aligned<TOp>(this->data(), scalar, padded_size());
+    }
+  }
+};
+
+/**
+ * @brief A Matrix that is aligned for the SIMD registers
+ *
+ * the first value starts at an address that is a multiple of
+ * SimdTraits<T>::alignment. every row is aligned as well if the size of a row
+ * is a multiple of the alignment, e.g. AlignedMatrix<4, 4, float> with SSE.
+ *
+ * the elementwise operators with an AlignedMatrix or a scalar of the same type
+ * run the single loop over all N * M values of Matrix with aligned loads.
+ * everything else is inherited from Matrix. a container needs
+ * mu::AlignedAllocator before c++17, see AlignedVector
+ *
+ * @par Example
+ * @snippet example_aligned.cpp aligned matrix
+ * @tparam N number of rows
+ * @tparam M number of columns
+ * @tparam T the type of the values inside the matrix
+ */
+template <std::size_t N, std::size_t M, typename T>
+class alignas(SimdTraits<T>::alignment) AlignedMatrix
+    : public Matrix<N, M, T> {
+ public:
+  /* inherit base class constructors */
+  using Matrix<N, M, T>::Matrix;
+
+  /**
+   * @brief Construct a new AlignedMatrix object from a Matrix object
+   *
+   * @par Example
+   * @snippet example_aligned.cpp aligned matrix
+   * @tparam U
+   * @param other
+   */
+  template <class U = T>
+  // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
+  constexpr AlignedMatrix(const Matrix<N, M, U> &other)
+      : Matrix<N, M, T>(other) {}
+
+  /******************************* operators *******************************/
+
+  /* the operators of the base class for other types */
+  using Matrix<N, M, T>::operator+=;
+  using Matrix<N, M, T>::operator-=;
+  using Matrix<N, M, T>::operator*=;
+  using Matrix<N, M, T>::operator/=;
+
+  /**
+   * @brief plus equal operator. a single aligned loop over all values
+   *
+   * @param rhs
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator+=(const AlignedMatrix &rhs) {
+    apply<mu::SimdAdd>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief minus equal operator. a single aligned loop over all values
+   *
+   * @param rhs
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator-=(const AlignedMatrix &rhs) {
+    apply<mu::SimdSub>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief multiplication equal operator. a single aligned loop over all
+   * values
+   *
+   * @param rhs
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator*=(const AlignedMatrix &rhs) {
+    apply<mu::SimdMul>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief division equal operator. a single aligned loop over all values
+   *
+   * @param rhs
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator/=(const AlignedMatrix &rhs) {
+    apply<mu::SimdDiv>(rhs);
+    return *this;
+  }
+
+  /**
+   * @brief plus equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator+=(const T &scalar) {
+    apply_scalar<mu::SimdAdd>(scalar);
+    return *this;
+  }
+
+  /**
+   * @brief minus equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator-=(const T &scalar) {
+    apply_scalar<mu::SimdSub>(scalar);
+    return *this;
+  }
+
+  /**
+   * @brief multiplication equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator*=(const T &scalar) {
+    apply_scalar<mu::SimdMul>(scalar);
+    return *this;
+  }
+
+  /**
+   * @brief division equal operator with a scalar of the same type
+   *
+   * @param scalar
+   * @return AlignedMatrix&
+   */
+  constexpr AlignedMatrix &operator/=(const T &scalar) {
+    apply_scalar<mu::SimdDiv>(scalar);
+    return *this;
+  }
+
+ private:
+  /* lhs[i][j] op= rhs[i][j]. constant expressions use the portable loop */
+  template <class TOp>
+  constexpr void apply(const AlignedMatrix &rhs) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        for (std::size_t j = 0; j < M; j++) {
+          TOp::scalar((*this)[i][j], rhs[i][j]);
+        }
+      }
+    } else {
+      mu::simd_apply_aligned<TOp>(this->data(), rhs.data(), N * M);
+    }
+  }
+
+  /* lhs[i][j] op= scalar. see apply() */
+  template <class TOp>
+  constexpr void apply_scalar(const T &scalar) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        for (std::size_t j = 0; j < M; j++) {
+          TOp::scalar((*this)[i][j], scalar);
+        }
+      }
+    } else {
+      mu::simd_apply_scalar_aligned<TOp>(this->data(), scalar, N * M);
+    }
+  }
+};
+
+/**************************** vector <> vector *****************************/
+
+/**
+ * @brief plus operator
+ *
+ * @tparam N
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedVector<N, T>
+ */
+template <std::size_t N, class T>
+constexpr AlignedVector<N, T> operator+(const AlignedVector<N, T> &lhs,
+                                        const AlignedVector<N, T> &rhs) {
+  return AlignedVector<N, T>(lhs) += rhs;
+}
+
+/**
+ * @brief minus operator
+ *
+ * @tparam N
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedVector<N, T>
+ */
+template <std::size_t N, class T>
+constexpr AlignedVector<N, T> operator-(const AlignedVector<N, T> &lhs,
+                                        const AlignedVector<N, T> &rhs) {
+  return AlignedVector<N, T>(lhs) -= rhs;
+}
+
+/**
+ * @brief multiplication operator
+ *
+ * @tparam N
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedVector<N, T>
+ */
+template <std::size_t N, class T>
+constexpr AlignedVector<N, T> operator*(const AlignedVector<N, T> &lhs,
+                                        const AlignedVector<N, T> &rhs) {
+  return AlignedVector<N, T>(lhs) *= rhs;
+}
+
+/**
+ * @brief division operator
+ *
+ * @tparam N
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedVector<N, T>
+ */
+template <std::size_t N, class T>
+constexpr AlignedVector<N, T> operator/(const AlignedVector<N, T> &lhs,
+                                        const AlignedVector<N, T> &rhs) {
+  return AlignedVector<N, T>(lhs) /= rhs;
+}
+
+/**************************** matrix <> matrix *****************************/
+
+/**
+ * @brief plus operator
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T>
+constexpr AlignedMatrix<N, M, T> operator+(const AlignedMatrix<N, M, T> &lhs,
+                                           const AlignedMatrix<N, M, T> &rhs) {
+  return AlignedMatrix<N, M, T>(lhs) += rhs;
+}
+
+/**
+ * @brief minus operator
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T>
+constexpr AlignedMatrix<N, M, T> operator-(const AlignedMatrix<N, M, T> &lhs,
+                                           const AlignedMatrix<N, M, T> &rhs) {
+  return AlignedMatrix<N, M, T>(lhs) -= rhs;
+}
+
+/**
+ * @brief multiplication operator (elementwise)
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T>
+constexpr AlignedMatrix<N, M, T> operator*(const AlignedMatrix<N, M, T> &lhs,
+                                           const AlignedMatrix<N, M, T> &rhs) {
+  return AlignedMatrix<N, M, T>(lhs) *= rhs;
+}
+
+/**
+ * @brief division operator (elementwise)
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return AlignedMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T>
+constexpr AlignedMatrix<N, M, T> operator/(const AlignedMatrix<N, M, T> &lhs,
+                                           const AlignedMatrix<N, M, T> &rhs) {
+  return AlignedMatrix<N, M, T>(lhs) /= rhs;
+}
+
+/**
+ * @brief An allocator that aligns the values to Alignment
+ *
+ * operator new only aligns to std::max_align_t before c++17 (no aligned new),
+ * so a std::vector of an over-aligned type such as AlignedVector or
+ * AlignedMatrix is misaligned. the compiler uses aligned loads and stores for
+ * these types anyway, even for a copy, so the container needs this allocator.
+ * the block is allocated with Alignment additional bytes and the address
+ * returned by operator new is stored right in front of the aligned values
+ *
+ * @par Example
+ * @snippet example_aligned.cpp aligned container
+ * @tparam T
+ * @tparam Alignment a power of two, alignof(T) by default
+ */
+template <class T, std::size_t Alignment = alignof(T)>
+class AlignedAllocator {
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "the alignment must be a power of two");
+
+ public:
+  using value_type = T;
+
+  template <class U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  constexpr AlignedAllocator() noexcept = default;
+
+  /**
+   * @brief Construct a new AlignedAllocator object from an allocator of
+   * another type
+   *
+   * @tparam U
+   */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/explicit) containers rebind implicitly
+  constexpr AlignedAllocator(
+      const AlignedAllocator<U, Alignment> & /*other*/) noexcept {}
+
+  /**
+   * @brief allocates n values, aligned to Alignment
+   *
+   * @param n
+   * @return T*
+   */
+  T *allocate(std::size_t n) {
+    if (n > (std::numeric_limits<std::size_t>::max() - kHeader) / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    void *raw = ::operator new(n * sizeof(T) + kHeader);
+    const std::uintptr_t kAddress =
+        (reinterpret_cast<std::uintptr_t>(raw) + kHeader) & ~(kAlignment - 1);
+    void *aligned = reinterpret_cast<void *>(kAddress);
+    static_cast<void **>(aligned)[-1] = raw;
+    return static_cast<T *>(aligned);
+  }
+
+  /**
+   * @brief deallocates values that were allocated by allocate
+   *
+   * @param p
+   */
+  void deallocate(T *p, std::size_t /*n*/) noexcept {
+    ::operator delete(reinterpret_cast<void **>(p)[-1]);
+  }
+
+ private:
+  /* at least the alignment of the stored address */
+  static constexpr std::size_t kAlignment =
+      Alignment < alignof(void *) ? alignof(void *) : Alignment;
+  /* the aligned address is at least one pointer behind the allocated one */
+  static constexpr std::size_t kHeader = kAlignment + sizeof(void *) - 1;
+};
+
+/**
+ * @brief all AlignedAllocators are equal, memory of one can be deallocated
+ * by any other
+ *
+ * @tparam T
+ * @tparam U
+ * @tparam Alignment
+ * @return true
+ */
+template <class T, class U, std::size_t Alignment>
+constexpr bool operator==(const AlignedAllocator<T, Alignment> & /*lhs*/,
+                          const AlignedAllocator<U, Alignment> & /*rhs*/) {
+  return true;
+}
+
+/**
+ * @brief all AlignedAllocators are equal
+ *
+ * @tparam T
+ * @tparam U
+ * @tparam Alignment
+ * @return false
+ */
+template <class T, class U, std::size_t Alignment>
+constexpr bool operator!=(const AlignedAllocator<T, Alignment> & /*lhs*/,
+                          const AlignedAllocator<U, Alignment> & /*rhs*/) {
+  return false;
+}
+
+}  // namespace mu
+#endif  // MU_ALIGNED_H_
@@ -0,0 +1,640 @@
+/**
+ * @file colmajor.h
+ *
+ * ColMajorMatrix class and free functions
+ */
+#ifndef MU_COLMAJOR_H_
+#define MU_COLMAJOR_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief A matrix whose values are stored column by column (column-major)
+ *
+ * the N * M values are contiguous, the value (i, j) is at data()[j * N + i].
+ * that's the layout of Fortran and most BLAS and LAPACK style kernels, so the
+ * values can be handed to them without copying.
+ *
+ * the memory of a column-major NxM matrix is the same as the memory of the
+ * row-major MxN matrix that is its transpose. so the columns are stored as
+ * the rows of a Matrix<M, N, T>:
+ * - col() is a reference to a contiguous Vector, row() is a copy
+ * - transposed() is a reference to the stored Matrix, i.e. free
+ * - the elementwise operators and the reductions are the ones of Matrix
+ *
+ * @par Example
+ * @snippet example_colmajor.cpp colmajor constructor
+ * @tparam N first matrix dimension (rows)
+ * @tparam M second matrix dimension (columns)
+ * @tparam T the type of the values inside the matrix
+ */
+template <std::size_t N, std::size_t M, typename T>
+class ColMajorMatrix {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Construct a new ColMajorMatrix object
+   */
+  constexpr ColMajorMatrix() = default;
+
+  /**
+   * @brief Construct a new ColMajorMatrix object from a (row-major) Matrix
+   * possibly of a different type
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor constructor
+   * @tparam U
+   * @param m
+   */
+  template <class U = T>
+  constexpr explicit ColMajorMatrix(const Matrix<N, M, U> &m)
+      : cols_{Matrix<N, M, T>(m).transposed()} {}
+
+  /**
+   * @brief Construct a new ColMajorMatrix object from its columns
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor columns constructor
+   * @param cols
+   */
+  constexpr explicit ColMajorMatrix(const std::array<Vector<N, T>, M> &cols)
+      : cols_{cols} {}
+
+  /**
+   * @brief access a value
+   *
+   * does not check the range of \p i and \p j
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor member functions
+   * @param i row
+   * @param j column
+   * @return T&
+   */
+  constexpr T &operator()(size_type i, size_type j) noexcept {
+    return cols_[j][i];
+  }
+
+  /**
+   * @brief const access a value
+   *
+   * does not check the range of \p i and \p j
+   *
+   * @param i row
+   * @param j column
+   * @return const T&
+   */
+  constexpr const T &operator()(size_type i, size_type j) const noexcept {
+    return cols_[j][i];
+  }
+
+  /**
+   * @brief returns the matrix dimensions as an array of size 2
+   *
+   * [0] rows \n
+   * [1] columns
+   *
+   * @return constexpr std::array<size_type, 2>
+   */
+  constexpr std::array<size_type, 2> size() const noexcept {
+    return std::array<size_type, 2>{N, M};
+  }
+
+  /**
+   * @brief returns the number of rows
+   *
+   * @return constexpr size_type
+   */
+  constexpr size_type n_rows() const noexcept { return N; }
+
+  /**
+   * @brief returns the number of columns
+   *
+   * @return constexpr size_type
+   */
+  constexpr size_type n_cols() const noexcept { return M; }
+
+  /**
+   * @brief direct access to the values
+   *
+   * the N * M values are stored contiguously, column by column, i.e. the value
+   * (i, j) is at data()[j * N + i]
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor data function
+   * @return T*
+   */
+  T *data() noexcept { return cols_.data(); }
+
+  /**
+   * @brief const direct access to the values
+   *
+   * see data()
+   *
+   * @return const T*
+   */
+  const T *data() const noexcept { return cols_.data(); }
+
+  /**
+   * @brief access a matrix column. it's contiguous
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor member functions
+   * @param idx
+   * @return Vector<N, T>&
+   */
+  constexpr Vector<N, T> &col(size_type idx) noexcept {
+    assert(idx < M);
+    return cols_[idx];
+  }
+
+  /**
+   * @brief const access a matrix column. it's contiguous
+   *
+   * @param idx
+   * @return const Vector<N, T>&
+   */
+  constexpr const Vector<N, T> &col(size_type idx) const noexcept {
+    assert(idx < M);
+    return cols_[idx];
+  }
+
+  /**
+   * @brief get a matrix row as a vector
+   *
+   * the values of a row are not contiguous, so it's a copy
+   *
+   * @param idx
+   * @return Vector<M, T>
+   */
+  constexpr Vector<M, T> row(size_type idx) const { return cols_.col(idx); }
+
+  /**
+   * @brief the same matrix stored row by row
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor member functions
+   * @return Matrix<N, M, T>
+   */
+  constexpr Matrix<N, M, T> to_matrix() const { return cols_.transposed(); }
+
+  /**
+   * @brief the transposed matrix, stored row by row
+   *
+   * it has the same memory as this matrix, so no values are copied
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor member functions
+   * @return const Matrix<M, N, T>&
+   */
+  constexpr const Matrix<M, N, T> &transposed() const noexcept {
+    return cols_;
+  }
+
+  /**
+   * @brief get the min value of the matrix
+   *
+   * @return T
+   */
+  constexpr T min() const { return cols_.min(); }
+
+  /**
+   * @brief get the max value of the matrix
+   *
+   * @return T
+   */
+  constexpr T max() const { return cols_.max(); }
+
+  /**
+   * @brief sum up all the elements of the matrix
+   *
+   * @return T
+   */
+  constexpr T sum() const { return cols_.sum(); }
+
+  /**
+   * @brief mean of all the elements of the matrix
+   *
+   * see Matrix::mean()
+   *
+   * @tparam U
+   * @return U
+   */
+  template <typename U = T>
+  constexpr U mean() const {
+    return cols_.template mean<U>();
+  }
+
+  /**
+   * @brief calculates the (population) variance
+   *
+   * see Matrix::variance()
+   *
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U variance() const {
+    return cols_.template variance<U>();
+  }
+
+  /**
+   * @brief calculates the standard deviation
+   *
+   * see Matrix::std()
+   *
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U std() const {
+    return cols_.template std<U>();
+  }
+
+  /**
+   * @brief dot product of two column-major matrices
+   *
+   * the columns of the result are the rows of rhs^T * this^T, which are the
+   * stored matrices. so it's the blocked kernel of Matrix::dot() without any
+   * copies
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor dot function
+   * @tparam U
+   * @tparam M2
+   * @tparam T2
+   * @param rhs
+   * @return ColMajorMatrix<N, M2, T> or ColMajorMatrix<N, M2, U>
+   */
+  template <typename U = void, std::size_t M2, typename T2>
+  ColMajorMatrix<N, M2, std::conditional_t<std::is_same<U, void>::value, T, U>>
+  dot(const ColMajorMatrix<M, M2, T2> &rhs) const {
+    using U_ = std::conditional_t<std::is_same<U, void>::value, T, U>;
+    ColMajorMatrix<N, M2, U_> ret;
+    ret.cols_ = rhs.cols_.template dot<U>(cols_);
+    return ret;
+  }
+
+  /**
+   * @brief dot product of a column-major matrix and a vector
+   *
+   * the columns are scaled and added up, i.e. the inner loop runs along the
+   * contiguous columns
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor dot function
+   * @tparam U
+   * @tparam T2
+   * @param rhs
+   * @return Vector<N, T> or Vector<N, U>
+   */
+  template <typename U = void, typename T2>
+  constexpr Vector<N, std::conditional_t<std::is_same<U, void>::value, T, U>>
+  dot(const Vector<M, T2> &rhs) const {
+    using U_ = std::conditional_t<!std::is_same<T, T2>::value, U, T>;
+    static_assert(
+        !std::is_same<U_, void>::value,
+        "Matrix and Vector types are different. please specify the return "
+        "type. e.g. \"mat.dot<float>(vec);\"");
+    Vector<N, U_> ret{U_{0}};
+    for (std::size_t j = 0; j < M; j++) {
+      const U_ kScale = rhs[j];
+      for (std::size_t i = 0; i < N; i++) {
+        ret[i] += cols_[j][i] * kScale;
+      }
+    }
+    return ret;
+  }
+
+  /********************************* I/O ***********************************/
+
+  /**
+   * @brief print matrix values, row by row like a Matrix
+   *
+   * @tparam Nn
+   * @tparam Mm
+   * @tparam U
+   * @param os
+   * @param m
+   * @return std::ostream&
+   */
+  template <std::size_t Nn, std::size_t Mm, class U>
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const ColMajorMatrix<Nn, Mm, U> &m);
+
+  /*************************** matrix <> matrix ****************************/
+
+  /**
+   * @brief equality operator. see Matrix operator==
+   *
+   * @tparam U
+   * @param rhs
+   * @return bool
+   */
+  template <typename U = T>
+  constexpr bool operator==(const ColMajorMatrix<N, M, U> &rhs) const {
+    return cols_ == rhs.cols_;
+  }
+
+  /**
+   * @brief unequality operator
+   *
+   * @tparam U
+   * @param rhs
+   * @return bool
+   */
+  template <typename U = T>
+  constexpr bool operator!=(const ColMajorMatrix<N, M, U> &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief plus equal operator
+   *
+   * @par Example
+   * @snippet example_colmajor.cpp colmajor operators
+   * @tparam U
+   * @param rhs
+   * @return ColMajorMatrix&
+   */
+  template <typename U = T>
+  constexpr ColMajorMatrix &operator+=(const ColMajorMatrix<N, M, U> &rhs) {
+    cols_ += rhs.cols_;
+    return *this;
+  }
+
+  /**
+   * @brief minus equal operator
+   *
+   * @tparam U
+   * @param rhs
+   * @return ColMajorMatrix&
+   */
+  template <typename U = T>
+  constexpr ColMajorMatrix &operator-=(const ColMajorMatrix<N, M, U> &rhs) {
+    cols_ -= rhs.cols_;
+    return *this;
+  }
+
+  /**
+   * @brief multiplication equal operator (elementwise)
+   *
+   * @tparam U
+   * @param rhs
+   * @return ColMajorMatrix&
+   */
+  template <typename U = T>
+  constexpr ColMajorMatrix &operator*=(const ColMajorMatrix<N, M, U> &rhs) {
+    cols_ *= rhs.cols_;
+    return *this;
+  }
+
+  /**
+   * @brief division equal operator (elementwise)
+   *
+   * @tparam U
+   * @param rhs
+   * @return ColMajorMatrix&
+   */
+  template <typename U = T>
+  constexpr ColMajorMatrix &operator/=(const ColMajorMatrix<N, M, U> &rhs) {
+    cols_ /= rhs.cols_;
+    return *this;
+  }
+
+  /*************************** matrix <> scalar ****************************/
+
+  /**
+   * @brief add a scalar to every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * ColMajorMatrix &>
+   */
+  template <class TScalar>
+  constexpr std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                             ColMajorMatrix &>
+  operator+=(const TScalar &scalar) {
+    cols_ += scalar;
+    return *this;
+  }
+
+  /**
+   * @brief subtract a scalar from every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * ColMajorMatrix &>
+   */
+  template <class TScalar>
+  constexpr std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                             ColMajorMatrix &>
+  operator-=(const TScalar &scalar) {
+    cols_ -= scalar;
+    return *this;
+  }
+
+  /**
+   * @brief multiply every value with a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * ColMajorMatrix &>
+   */
+  template <class TScalar>
+  constexpr std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                             ColMajorMatrix &>
+  operator*=(const TScalar &scalar) {
+    cols_ *= scalar;
+    return *this;
+  }
+
+  /**
+   * @brief divide every value by a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * ColMajorMatrix &>
+   */
+  template <class TScalar>
+  constexpr std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                             ColMajorMatrix &>
+  operator/=(const TScalar &scalar) {
+    cols_ /= scalar;
+    return *this;
+  }
+
+ private:
+  /* the columns. i.e. the transposed matrix, stored row by row */
+  Matrix<M, N, T> cols_;
+
+  template <std::size_t, std::size_t, typename>
+  friend class ColMajorMatrix;
+};
+
+/********************************** I/O ************************************/
+
+template <std::size_t Nn, std::size_t Mm, class U>
+std::ostream &operator<<(std::ostream &os,
+                         const ColMajorMatrix<Nn, Mm, U> &m) {
+  return os << m.to_matrix();
+}
+
+/**************************** matrix <> matrix *****************************/
+
+/**
+ * @brief plus operator
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return ColMajorMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T, class U = T>
+constexpr ColMajorMatrix<N, M, T> operator+(
+    ColMajorMatrix<N, M, T> lhs, const ColMajorMatrix<N, M, U> &rhs) {
+  return lhs += rhs;
+}
+
+/**
+ * @brief minus operator
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return ColMajorMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T, class U = T>
+constexpr ColMajorMatrix<N, M, T> operator-(
+    ColMajorMatrix<N, M, T> lhs, const ColMajorMatrix<N, M, U> &rhs) {
+  return lhs -= rhs;
+}
+
+/**
+ * @brief multiplication operator (elementwise)
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return ColMajorMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T, class U = T>
+constexpr ColMajorMatrix<N, M, T> operator*(
+    ColMajorMatrix<N, M, T> lhs, const ColMajorMatrix<N, M, U> &rhs) {
+  return lhs *= rhs;
+}
+
+/**
+ * @brief division operator (elementwise)
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return ColMajorMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T, class U = T>
+constexpr ColMajorMatrix<N, M, T> operator/(
+    ColMajorMatrix<N, M, T> lhs, const ColMajorMatrix<N, M, U> &rhs) {
+  return lhs /= rhs;
+}
+
+/**************************** matrix <> scalar *****************************/
+
+/**
+ * @brief matrix and scalar multiplication
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * ColMajorMatrix<N, M, T>>
+ */
+template <std::size_t N, std::size_t M, class T, class TScalar>
+constexpr std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                           ColMajorMatrix<N, M, T>>
+operator*(ColMajorMatrix<N, M, T> lhs, const TScalar &scalar) {
+  return lhs *= scalar;
+}
+
+/**
+ * @brief scalar and matrix multiplication
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam TScalar
+ * @param scalar
+ * @param rhs
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * ColMajorMatrix<N, M, T>>
+ */
+template <std::size_t N, std::size_t M, class T, class TScalar>
+constexpr std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                           ColMajorMatrix<N, M, T>>
+operator*(const TScalar &scalar, ColMajorMatrix<N, M, T> rhs) {
+  return rhs *= scalar;
+}
+
+/************************* convenience functions ***************************/
+
+/**
+ * @brief makes a column-major copy of a Matrix
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param m
+ * @return ColMajorMatrix<N, M, T>
+ */
+template <std::size_t N, std::size_t M, class T>
+constexpr ColMajorMatrix<N, M, T> to_col_major(const Matrix<N, M, T> &m) {
+  return ColMajorMatrix<N, M, T>(m);
+}
+
+template <typename U = void, std::size_t N, std::size_t M, typename T,
+          std::size_t M2, typename T2>
+ColMajorMatrix<N, M2, std::conditional_t<std::is_same<U, void>::value, T, U>>
+dot(const ColMajorMatrix<N, M, T> &lhs, const ColMajorMatrix<M, M2, T2> &rhs) {
+  return lhs.template dot<U>(rhs);
+}
+
+template <typename U = void, std::size_t N, std::size_t M, typename T,
+          typename T2>
+constexpr Vector<N, std::conditional_t<std::is_same<U, void>::value, T, U>>
+dot(const ColMajorMatrix<N, M, T> &lhs, const Vector<M, T2> &rhs) {
+  return lhs.template dot<U>(rhs);
+}
+
+}  // namespace mu
+#endif  // MU_COLMAJOR_H_
@@ -0,0 +1,927 @@
+/**
+ * @file dynmatrix.h
+ *
+ * DynMatrix class and free functions
+ */
+#ifndef MU_DYNMATRIX_H_
+#define MU_DYNMATRIX_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mu/dynvector.h"
+#include "mu/gemm.h"
+#include "mu/matrix.h"
+#include "mu/simd.h"
+#include "mu/typetraits.h"
+#include "mu/utility.h"
+
+namespace mu {
+
+/**
+ * @brief A matrix whose size is known at run time
+ *
+ * the values are stored contiguously row by row (row-major) on the heap,
+ * allocated with the given allocator. m[i] is a pointer to the first value of
+ * row i, so m[i][j] works like it does for a Matrix. the functions and
+ * operators behave like the ones of a Matrix of the same size, see
+ * mu::Matrix. the sizes of two DynMatrices in an operation must fit (debug
+ * mode only).
+ *
+ * @par Example
+ * @snippet example_dynmatrix.cpp dynmatrix constructor
+ * @tparam T the type of the values inside the matrix
+ * @tparam Allocator
+ */
+template <typename T, class Allocator = std::allocator<T>>
+class DynMatrix {
+  static_assert(std::is_arithmetic<T>::value,
+                "DynMatrix type T must be an arithmetic type");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  /* iterators over all values, row by row */
+  using iterator = typename std::vector<T, Allocator>::iterator;
+  using const_iterator = typename std::vector<T, Allocator>::const_iterator;
+
+  /**
+   * @brief Construct a new empty DynMatrix object
+   */
+  DynMatrix() = default;
+
+  /**
+   * @brief Construct a new empty DynMatrix object with an allocator
+   *
+   * @param alloc
+   */
+  explicit DynMatrix(const Allocator &alloc) : data_(alloc) {}
+
+  /**
+   * @brief Construct a new DynMatrix object of rows x cols zeros
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix constructor
+   * @param rows
+   * @param cols
+   * @param alloc
+   */
+  DynMatrix(size_type rows, size_type cols,
+            const Allocator &alloc = Allocator())
+      : rows_{rows}, cols_{cols}, data_(rows * cols, T{0}, alloc) {}
+
+  /**
+   * @brief Construct a new DynMatrix object of rows x cols copies of a value
+   *
+   * @param rows
+   * @param cols
+   * @param value
+   * @param alloc
+   */
+  DynMatrix(size_type rows, size_type cols, const T &value,
+            const Allocator &alloc = Allocator())
+      : rows_{rows}, cols_{cols}, data_(rows * cols, value, alloc) {}
+
+  /**
+   * @brief Construct a new DynMatrix object from a list of rows
+   *
+   * all rows must have the same number of values
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix constructor
+   * @param list
+   * @param alloc
+   */
+  DynMatrix(std::initializer_list<std::initializer_list<T>> list,
+            const Allocator &alloc = Allocator())
+      : rows_{list.size()},
+        cols_{list.size() == 0 ? 0 : list.begin()->size()},
+        data_(alloc) {
+    data_.reserve(rows_ * cols_);
+    for (const auto &row : list) {
+      assert(row.size() == cols_);
+      data_.insert(data_.end(), row.begin(), row.end());
+    }
+  }
+
+  /**
+   * @brief Construct a new DynMatrix object from a Matrix of fixed size
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix from matrix constructor
+   * @tparam N
+   * @tparam M
+   * @tparam U
+   * @param m
+   * @param alloc
+   */
+  template <std::size_t N, std::size_t M, class U>
+  explicit DynMatrix(const Matrix<N, M, U> &m,
+                     const Allocator &alloc = Allocator())
+      : rows_{N}, cols_{M}, data_(alloc) {
+    data_.reserve(N * M);
+    for (const auto &row : m) {
+      data_.insert(data_.end(), row.begin(), row.end());
+    }
+  }
+
+  /**
+   * @brief the allocator
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const { return data_.get_allocator(); }
+
+  /**
+   * @brief number of rows
+   *
+   * @return size_type
+   */
+  size_type rows() const noexcept { return rows_; }
+
+  /**
+   * @brief number of columns
+   *
+   * @return size_type
+   */
+  size_type cols() const noexcept { return cols_; }
+
+  /**
+   * @brief matrix size, i.e. number of rows and columns
+   *
+   * @return std::array<size_type, 2>
+   */
+  std::array<size_type, 2> size() const noexcept { return {rows_, cols_}; }
+
+  /**
+   * @brief true if there are no values
+   *
+   * @return bool
+   */
+  bool empty() const noexcept { return data_.empty(); }
+
+  /**
+   * @brief pointer to the first value of a row
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix constructor
+   * @param idx
+   * @return T*
+   */
+  T *operator[](size_type idx) noexcept {
+    assert(idx < rows_);
+    return data_.data() + idx * cols_;
+  }
+
+  /**
+   * @brief const pointer to the first value of a row
+   *
+   * @param idx
+   * @return const T*
+   */
+  const T *operator[](size_type idx) const noexcept {
+    assert(idx < rows_);
+    return data_.data() + idx * cols_;
+  }
+
+  /**
+   * @brief access specified element with bounds checking
+   *
+   * @param i row
+   * @param j column
+   * @return T&
+   */
+  T &at(size_type i, size_type j) {
+    check_range(i, j);
+    return data_[i * cols_ + j];
+  }
+
+  /**
+   * @brief access specified element with bounds checking
+   *
+   * @param i row
+   * @param j column
+   * @return const T&
+   */
+  const T &at(size_type i, size_type j) const {
+    check_range(i, j);
+    return data_[i * cols_ + j];
+  }
+
+  /**
+   * @brief direct access to the contiguous values, row by row
+   *
+   * @return T*
+   */
+  T *data() noexcept { return data_.data(); }
+
+  /**
+   * @brief direct access to the contiguous values, row by row
+   *
+   * @return const T*
+   */
+  const T *data() const noexcept { return data_.data(); }
+
+  /* iterators over all values, row by row */
+  iterator begin() noexcept { return data_.begin(); }
+  const_iterator begin() const noexcept { return data_.begin(); }
+  iterator end() noexcept { return data_.end(); }
+  const_iterator end() const noexcept { return data_.end(); }
+
+  /**
+   * @brief copy of a row
+   *
+   * @param idx
+   * @return DynVector<T, Allocator>
+   */
+  DynVector<T, Allocator> row(size_type idx) const {
+    assert(idx < rows_);
+    return DynVector<T, Allocator>(operator[](idx), operator[](idx) + cols_,
+                                   get_allocator());
+  }
+
+  /**
+   * @brief copy of a column
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix row col diag functions
+   * @param idx
+   * @return DynVector<T, Allocator>
+   */
+  DynVector<T, Allocator> col(size_type idx) const {
+    assert(idx < cols_);
+    DynVector<T, Allocator> ret(rows_, get_allocator());
+    for (std::size_t i = 0; i < rows_; i++) {
+      ret[i] = data_[i * cols_ + idx];
+    }
+    return ret;
+  }
+
+  /**
+   * @brief copy of the diagonal
+   *
+   * @return DynVector<T, Allocator>
+   */
+  DynVector<T, Allocator> diag() const {
+    const std::size_t kSize = mu::min(rows_, cols_);
+    DynVector<T, Allocator> ret(kSize, get_allocator());
+    for (std::size_t i = 0; i < kSize; i++) {
+      ret[i] = data_[i * cols_ + i];
+    }
+    return ret;
+  }
+
+  /**
+   * @brief get the min value of the matrix. must not be empty
+   *
+   * @return T
+   */
+  T min() const {
+    assert(!empty());
+    T ret(data_[0]);
+    for (const auto &item : data_) {
+      ret = mu::min(ret, item);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief get the max value of the matrix. must not be empty
+   *
+   * @return T
+   */
+  T max() const {
+    assert(!empty());
+    T ret(data_[0]);
+    for (const auto &item : data_) {
+      ret = mu::max(ret, item);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief sum up all the elements of the matrix
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix statistics
+   * @return T
+   */
+  T sum() const {
+    T ret{};
+    for (const auto &item : data_) {
+      ret += item;
+    }
+    return ret;
+  }
+
+  /**
+   * @brief mean of all the elements of the matrix. must not be empty
+   *
+   * see Matrix::mean()
+   *
+   * @tparam U
+   * @return U
+   */
+  template <typename U = T>
+  U mean() const {
+    assert(!empty());
+    return U(sum()) / static_cast<U>(data_.size());
+  }
+
+  /**
+   * @brief calculates the (population) variance. must not be empty
+   *
+   * the values are contiguous, so a floating point variance is a single pass
+   * over all of them. see Matrix::variance()
+   *
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U variance() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return m2 / static_cast<U>(data_.size());
+  }
+
+  /**
+   * @brief calculates the standard deviation. must not be empty
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix statistics
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U std() const {
+    return U(mu::sqrt(variance<U>()));
+  }
+
+  /**
+   * @brief calculates the mean and the standard deviation in a single pass.
+   * must not be empty
+   *
+   * @tparam U
+   * @return std::pair<U, U> mean (first) and standard deviation (second)
+   */
+  template <class U = T>
+  std::pair<U, U> mean_and_std() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return {m, U(mu::sqrt(m2 / static_cast<U>(data_.size())))};
+  }
+
+  /**
+   * @brief calculates the determinant of the matrix
+   *
+   * matrix must be square. see Matrix::det()
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix det function
+   * @return T
+   */
+  T det() const {
+    assert(rows_ == cols_);
+    std::vector<std::vector<T>> m(rows_);
+    for (std::size_t i = 0; i < rows_; i++) {
+      m[i].assign(operator[](i), operator[](i) + cols_);
+    }
+    return mu::calc_det(std::move(m));
+  }
+
+  /**
+   * @brief transposes this matrix
+   *
+   * matrix must be square. a non-square matrix can be transposed with
+   * transposed()
+   */
+  void transpose() {
+    assert(rows_ == cols_);
+    for (std::size_t i = 0; i < rows_; i++) {
+      for (std::size_t j = i + 1; j < cols_; j++) {
+        std::swap(data_[i * cols_ + j], data_[j * cols_ + i]);
+      }
+    }
+  }
+
+  /**
+   * @brief creates and returns a transposed matrix
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix transposed function
+   * @return DynMatrix
+   */
+  DynMatrix transposed() const {
+    DynMatrix ret(cols_, rows_, get_allocator());
+    for (std::size_t i = 0; i < rows_; i++) {
+      for (std::size_t j = 0; j < cols_; j++) {
+        ret.data_[j * rows_ + i] = data_[i * cols_ + j];
+      }
+    }
+    return ret;
+  }
+
+  /**
+   * @brief dot product of two matrices
+   *
+   * the number of columns of this matrix must be equal to the number of rows
+   * of rhs. the type rules are the ones of Matrix::dot(). the sizes are only
+   * known at run time, so the blocked kernel is used for every size (see
+   * mu::gemm_blocked())
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix dot function
+   * @tparam U
+   * @tparam T2
+   * @tparam A2
+   * @param rhs
+   * @return DynMatrix<R, mu::rebind_alloc_t<Allocator, R>> with R the type
+   * of the result
+   */
+  template <typename U = void, typename T2, class A2,
+            class R = std::conditional_t<std::is_same<U, void>::value, T, U>>
+  DynMatrix<R, mu::rebind_alloc_t<Allocator, R>> dot(
+      const DynMatrix<T2, A2> &rhs) const {
+    static_assert(std::is_same<T, T2>::value || !std::is_same<U, void>::value,
+                  "DynMatrix types are different. please specify the return "
+                  "type. e.g. \"mat1.dot<float>(mat2);\"");
+    assert(cols_ == rhs.rows());
+    DynMatrix<R, mu::rebind_alloc_t<Allocator, R>> ret(
+        rows_, rhs.cols(), mu::rebind_alloc_t<Allocator, R>(get_allocator()));
+    mu::gemm_blocked<R>(*this, rhs, ret, rows_, cols_, rhs.cols());
+    return ret;
+  }
+
+  /**
+   * @brief dot product of a matrix and a vector
+   *
+   * the size of the vector must be equal to the number of columns. every
+   * value of the result is the dot product of a row and the vector, see
+   * DynVector::dot()
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix dot function
+   * @tparam U
+   * @tparam T2
+   * @tparam A2
+   * @param rhs
+   * @return DynVector<R, mu::rebind_alloc_t<A2, R>> with R the type of the
+   * result
+   */
+  template <typename U = void, typename T2, class A2,
+            class R = std::conditional_t<std::is_same<U, void>::value, T, U>>
+  DynVector<R, mu::rebind_alloc_t<A2, R>> dot(
+      const DynVector<T2, A2> &rhs) const {
+    static_assert(std::is_same<T, T2>::value || !std::is_same<U, void>::value,
+                  "DynMatrix and DynVector types are different. please "
+                  "specify the return type. e.g. \"mat.dot<float>(vec);\"");
+    assert(cols_ == rhs.size());
+    DynVector<R, mu::rebind_alloc_t<A2, R>> ret(
+        rows_, mu::rebind_alloc_t<A2, R>(rhs.get_allocator()));
+    for (std::size_t i = 0; i < rows_; i++) {
+      ret[i] = row_dot<R>(i, rhs.data(), std::is_same<T, T2>{});
+    }
+    return ret;
+  }
+
+  /********************************* I/O ***********************************/
+
+  /**
+   * @brief print matrix values, like a Matrix
+   *
+   * @tparam U
+   * @tparam A
+   * @param os
+   * @param m
+   * @return std::ostream&
+   */
+  template <class U, class A>
+  friend std::ostream &operator<<(std::ostream &os, const DynMatrix<U, A> &m);
+
+  /*************************** matrix <> matrix ****************************/
+
+  /**
+   * @brief equality operator. the sizes and all values must be equal
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return bool
+   */
+  template <typename U, class A2>
+  bool operator==(const DynMatrix<U, A2> &rhs) const {
+    if (rows_ != rhs.rows() || cols_ != rhs.cols()) {
+      return false;
+    }
+    const U *kRhs = rhs.data();
+    for (std::size_t i = 0; i < data_.size(); i++) {
+      if (!mu::TypeTraits<T>::equals(data_[i], kRhs[i]) ||
+          !mu::TypeTraits<U>::equals(data_[i], kRhs[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief unequality operator
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return bool
+   */
+  template <typename U, class A2>
+  bool operator!=(const DynMatrix<U, A2> &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief plus equal operator
+   *
+   * @par Example
+   * @snippet example_dynmatrix.cpp dynmatrix operators
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynMatrix&
+   */
+  template <typename U, class A2>
+  DynMatrix &operator+=(const DynMatrix<U, A2> &rhs) {
+    return apply<mu::SimdAdd>(rhs);
+  }
+
+  /**
+   * @brief minus equal operator
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynMatrix&
+   */
+  template <typename U, class A2>
+  DynMatrix &operator-=(const DynMatrix<U, A2> &rhs) {
+    return apply<mu::SimdSub>(rhs);
+  }
+
+  /**
+   * @brief multiplication equal operator (elementwise)
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynMatrix&
+   */
+  template <typename U, class A2>
+  DynMatrix &operator*=(const DynMatrix<U, A2> &rhs) {
+    return apply<mu::SimdMul>(rhs);
+  }
+
+  /**
+   * @brief division equal operator (elementwise)
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynMatrix&
+   */
+  template <typename U, class A2>
+  DynMatrix &operator/=(const DynMatrix<U, A2> &rhs) {
+    return apply<mu::SimdDiv>(rhs);
+  }
+
+  /*************************** matrix <> scalar ****************************/
+
+  /**
+   * @brief adds a scalar to every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+  operator+=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdAdd>(scalar);
+  }
+
+  /**
+   * @brief subtracts a scalar from every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+  operator-=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdSub>(scalar);
+  }
+
+  /**
+   * @brief multiplies every value with a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+  operator*=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdMul>(scalar);
+  }
+
+  /**
+   * @brief divides every value by a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix &>
+  operator/=(const TScalar &scalar) {
+    if (std::is_integral<TScalar>::value) {
+      assert(scalar != static_cast<TScalar>(0));
+    }
+    return apply_scalar<mu::SimdDiv>(scalar);
+  }
+
+ private:
+  size_type rows_{0};
+  size_type cols_{0};
+  std::vector<T, Allocator> data_;
+
+  void check_range(size_type i, size_type j) const {
+    if (i >= rows_ || j >= cols_) {
+      throw std::out_of_range("DynMatrix index out of range");
+    }
+  }
+
+  /* row i times a vector of the same type (SIMD) */
+  template <class U>
+  U row_dot(std::size_t i, const T *v, std::true_type /*same*/) const {
+    return mu::simd_dot(operator[](i), v, cols_);
+  }
+
+  template <class U, class T2>
+  U row_dot(std::size_t i, const T2 *v, std::false_type /*same*/) const {
+    const T *kRow = operator[](i);
+    U ret{};
+    for (std::size_t j = 0; j < cols_; j++) {
+      ret += kRow[j] * v[j];
+    }
+    return ret;
+  }
+
+  template <class TOp, class U, class A2>
+  DynMatrix &apply(const DynMatrix<U, A2> &rhs) {
+    assert(rows_ == rhs.rows() && cols_ == rhs.cols());
+    mu::simd_apply<TOp>(data(), rhs.data(), data_.size());
+    return *this;
+  }
+
+  template <class TOp, class TScalar>
+  DynMatrix &apply_scalar(const TScalar &scalar) {
+    mu::simd_apply_scalar<TOp>(data(), scalar, data_.size());
+    return *this;
+  }
+
+  /* see Vector::calc_mean_m2() */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::true_type /*floating point*/) const {
+    assert(!empty());
+    mu::simd_mean_m2(data(), data_.size(), m, m2);
+  }
+
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::false_type /*floating point*/) const {
+    m = mean<U>();
+    m2 = U{0};
+    for (const auto &item : data_) {
+      m2 += mu::pow(item - m, 2);
+    }
+  }
+};
+
+/********************************** I/O ************************************/
+
+template <class U, class A>
+std::ostream &operator<<(std::ostream &os, const DynMatrix<U, A> &m) {
+  os << "[ ";
+  for (std::size_t i = 0; i < m.rows_; i++) {
+    os << "[ ";
+    for (std::size_t j = 0; j < m.cols_; j++) {
+      os << m[i][j];
+      if (j < (m.cols_ - 1)) {
+        os << ", ";
+      } else {
+        os << " ";
+      }
+    }
+    os << "]";
+    if (i < (m.rows_ - 1)) {
+      os << ",\n  ";
+    } else {
+      os << " ";
+    }
+  }
+  os << "]";
+  return os;
+}
+
+/**************************** matrix <> matrix *****************************/
+
+/**
+ * @brief plus operator
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynMatrix<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynMatrix<T, A> operator+(DynMatrix<T, A> lhs, const DynMatrix<U, A2> &rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+/**
+ * @brief minus operator
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynMatrix<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynMatrix<T, A> operator-(DynMatrix<T, A> lhs, const DynMatrix<U, A2> &rhs) {
+  lhs -= rhs;
+  return lhs;
+}
+
+/**
+ * @brief multiplication operator (elementwise)
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynMatrix<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynMatrix<T, A> operator*(DynMatrix<T, A> lhs, const DynMatrix<U, A2> &rhs) {
+  lhs *= rhs;
+  return lhs;
+}
+
+/**
+ * @brief division operator (elementwise)
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynMatrix<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynMatrix<T, A> operator/(DynMatrix<T, A> lhs, const DynMatrix<U, A2> &rhs) {
+  lhs /= rhs;
+  return lhs;
+}
+
+/**************************** matrix <> scalar *****************************/
+
+/**
+ * @brief matrix and scalar addition
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynMatrix<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix<T, A>>
+operator+(DynMatrix<T, A> lhs, const TScalar &scalar) {
+  lhs += scalar;
+  return lhs;
+}
+
+/**
+ * @brief matrix and scalar subtraction
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynMatrix<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix<T, A>>
+operator-(DynMatrix<T, A> lhs, const TScalar &scalar) {
+  lhs -= scalar;
+  return lhs;
+}
+
+/**
+ * @brief matrix and scalar multiplication
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynMatrix<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix<T, A>>
+operator*(DynMatrix<T, A> lhs, const TScalar &scalar) {
+  lhs *= scalar;
+  return lhs;
+}
+
+/**
+ * @brief matrix and scalar division
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynMatrix<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynMatrix<T, A>>
+operator/(DynMatrix<T, A> lhs, const TScalar &scalar) {
+  lhs /= scalar;
+  return lhs;
+}
+
+/************************* convenience functions ***************************/
+
+template <class T, class A>
+T min(const DynMatrix<T, A> &m) {
+  return m.min();
+}
+
+template <class T, class A>
+T max(const DynMatrix<T, A> &m) {
+  return m.max();
+}
+
+template <class T, class A>
+T sum(const DynMatrix<T, A> &m) {
+  return m.sum();
+}
+
+template <class U = void, class T, class A>
+std::conditional_t<std::is_same<U, void>::value, T, U> mean(
+    const DynMatrix<T, A> &m) {
+  return m
+      .template mean<std::conditional_t<std::is_same<U, void>::value, T, U>>();
+}
+
+template <class U = void, class T1, class A1, class T2, class A2>
+auto dot(const DynMatrix<T1, A1> &lhs, const DynMatrix<T2, A2> &rhs)
+    -> decltype(lhs.template dot<U>(rhs)) {
+  return lhs.template dot<U>(rhs);
+}
+
+template <class U = void, class T1, class A1, class T2, class A2>
+auto dot(const DynMatrix<T1, A1> &lhs, const DynVector<T2, A2> &rhs)
+    -> decltype(lhs.template dot<U>(rhs)) {
+  return lhs.template dot<U>(rhs);
+}
+
+}  // namespace mu
+#endif  // MU_DYNMATRIX_H_
@@ -0,0 +1,841 @@
+/**
+ * @file dynvector.h
+ *
+ * DynVector class and free functions
+ */
+#ifndef MU_DYNVECTOR_H_
+#define MU_DYNVECTOR_H_
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mu/simd.h"
+#include "mu/typetraits.h"
+#include "mu/utility.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief the allocator A rebound to the value type U
+ *
+ * e.g. the allocator of a dot product result whose type differs
+ *
+ * @tparam A
+ * @tparam U
+ */
+template <class A, class U>
+using rebind_alloc_t =
+    typename std::allocator_traits<A>::template rebind_alloc<U>;
+
+/**
+ * @brief A vector whose size is known at run time
+ *
+ * the values are stored contiguously on the heap, allocated with the given
+ * allocator. the functions and operators behave like the ones of a Vector of
+ * the same size, see mu::Vector. the sizes of two DynVectors in an operation
+ * must be equal (debug mode only).
+ *
+ * @par Example
+ * @snippet example_dynvector.cpp dynvector constructor
+ * @tparam T the type of the values inside the vector
+ * @tparam Allocator
+ */
+template <typename T, class Allocator = std::allocator<T>>
+class DynVector {
+  static_assert(std::is_arithmetic<T>::value,
+                "DynVector type T must be an arithmetic type");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  /* use iterators from the underlying container */
+  using iterator = typename std::vector<T, Allocator>::iterator;
+  using const_iterator = typename std::vector<T, Allocator>::const_iterator;
+
+  /**
+   * @brief Construct a new empty DynVector object
+   */
+  DynVector() = default;
+
+  /**
+   * @brief Construct a new empty DynVector object with an allocator
+   *
+   * @param alloc
+   */
+  explicit DynVector(const Allocator &alloc) : data_(alloc) {}
+
+  /**
+   * @brief Construct a new DynVector object of size zeros
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector constructor
+   * @param size
+   * @param alloc
+   */
+  explicit DynVector(size_type size, const Allocator &alloc = Allocator())
+      : data_(size, T{0}, alloc) {}
+
+  /**
+   * @brief Construct a new DynVector object of size copies of a value
+   *
+   * @param size
+   * @param value
+   * @param alloc
+   */
+  DynVector(size_type size, const T &value,
+            const Allocator &alloc = Allocator())
+      : data_(size, value, alloc) {}
+
+  /**
+   * @brief Construct a new DynVector object from a list of values
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector constructor
+   * @param list
+   * @param alloc
+   */
+  DynVector(std::initializer_list<T> list,
+            const Allocator &alloc = Allocator())
+      : data_(list, alloc) {}
+
+  /**
+   * @brief Construct a new DynVector object from a range of values
+   *
+   * @tparam TIt input iterator, i.e. not an integral type
+   * @param first
+   * @param last
+   * @param alloc
+   */
+  template <class TIt, class = std::enable_if_t<!std::is_integral<TIt>::value>>
+  DynVector(TIt first, TIt last, const Allocator &alloc = Allocator())
+      : data_(first, last, alloc) {}
+
+  /**
+   * @brief Construct a new DynVector object from a Vector of fixed size
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector from vector constructor
+   * @tparam N
+   * @tparam U
+   * @param v
+   * @param alloc
+   */
+  template <std::size_t N, class U>
+  explicit DynVector(const Vector<N, U> &v,
+                     const Allocator &alloc = Allocator())
+      : data_(v.begin(), v.end(), alloc) {}
+
+  /**
+   * @brief the allocator
+   *
+   * @return Allocator
+   */
+  Allocator get_allocator() const { return data_.get_allocator(); }
+
+  /**
+   * @brief number of values
+   *
+   * @return size_type
+   */
+  size_type size() const noexcept { return data_.size(); }
+
+  /**
+   * @brief true if there are no values
+   *
+   * @return bool
+   */
+  bool empty() const noexcept { return data_.empty(); }
+
+  /**
+   * @brief changes the number of values. new values are zero
+   *
+   * @param size
+   */
+  void resize(size_type size) { data_.resize(size, T{0}); }
+
+  /**
+   * @brief access specified element
+   *
+   * @param idx
+   * @return T&
+   */
+  T &operator[](size_type idx) noexcept {
+    assert(idx < size());
+    return data_[idx];
+  }
+
+  /**
+   * @brief access specified element
+   *
+   * @param idx
+   * @return const T&
+   */
+  const T &operator[](size_type idx) const noexcept {
+    assert(idx < size());
+    return data_[idx];
+  }
+
+  /**
+   * @brief access specified element with bounds checking
+   *
+   * @param idx
+   * @return T&
+   */
+  T &at(size_type idx) { return data_.at(idx); }
+
+  /**
+   * @brief access specified element with bounds checking
+   *
+   * @param idx
+   * @return const T&
+   */
+  const T &at(size_type idx) const { return data_.at(idx); }
+
+  /**
+   * @brief direct access to the contiguous values
+   *
+   * @return T*
+   */
+  T *data() noexcept { return data_.data(); }
+
+  /**
+   * @brief direct access to the contiguous values
+   *
+   * @return const T*
+   */
+  const T *data() const noexcept { return data_.data(); }
+
+  /* iterators */
+  iterator begin() noexcept { return data_.begin(); }
+  const_iterator begin() const noexcept { return data_.begin(); }
+  iterator end() noexcept { return data_.end(); }
+  const_iterator end() const noexcept { return data_.end(); }
+
+  /**
+   * @brief get the min value of the vector. must not be empty
+   *
+   * @return T
+   */
+  T min() const {
+    assert(!empty());
+    T ret(data_[0]);
+    for (const auto &item : data_) {
+      ret = mu::min(ret, item);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief get the max value of the vector. must not be empty
+   *
+   * @return T
+   */
+  T max() const {
+    assert(!empty());
+    T ret(data_[0]);
+    for (const auto &item : data_) {
+      ret = mu::max(ret, item);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief sum up all the elements of the vector
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector statistics
+   * @return T
+   */
+  T sum() const {
+    T ret{};
+    for (const auto &item : data_) {
+      ret += item;
+    }
+    return ret;
+  }
+
+  /**
+   * @brief mean of all the elements of the vector. must not be empty
+   *
+   * see Vector::mean()
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector statistics
+   * @tparam U
+   * @return U
+   */
+  template <typename U = T>
+  U mean() const {
+    assert(!empty());
+    return U(sum()) / static_cast<U>(size());
+  }
+
+  /**
+   * @brief calculates the variance. must not be empty
+   *
+   * see Vector::variance()
+   *
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U variance() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return m2 / static_cast<U>(size());
+  }
+
+  /**
+   * @brief calculates the standard deviation. must not be empty
+   *
+   * see Vector::std()
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector statistics
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U std() const {
+    return U(mu::sqrt(variance<U>()));
+  }
+
+  /**
+   * @brief calculates the mean and the standard deviation in a single pass.
+   * must not be empty
+   *
+   * see Vector::mean_and_std()
+   *
+   * @tparam U
+   * @return std::pair<U, U> mean (first) and standard deviation (second)
+   */
+  template <class U = T>
+  std::pair<U, U> mean_and_std() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return {m, U(mu::sqrt(m2 / static_cast<U>(size())))};
+  }
+
+  /**
+   * @brief dot product of two vectors
+   *
+   * see Vector::dot(). the products of two vectors of the same type are added
+   * up in SIMD registers (see mu::simd_dot)
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector dot function
+   * @tparam U
+   * @tparam T2
+   * @tparam A2
+   * @param rhs
+   * @return std::conditional_t<std::is_same<U, void>::value, T, U>
+   */
+  template <typename U = void, typename T2, class A2>
+  std::conditional_t<std::is_same<U, void>::value, T, U> dot(
+      const DynVector<T2, A2> &rhs) const {
+    using U_ = std::conditional_t<!std::is_same<T, T2>::value, U, T>;
+    static_assert(!std::is_same<U_, void>::value,
+                  "DynVector types are different. please specify the return "
+                  "type. e.g. \"vec1.dot<float>(vec2);\"");
+    assert(size() == rhs.size());
+    return calc_dot<U_>(rhs, std::is_same<T, T2>{});
+  }
+
+  /**
+   * @brief euclidean vector length
+   *
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U length() const {
+    return U(mu::sqrt(dot(*this)));
+  }
+
+  /**
+   * @brief normalizes this vector
+   *
+   * see Vector::normalize()
+   */
+  void normalize() { *this /= length(); }
+
+  /**
+   * @brief returns a normalized vector
+   *
+   * @see @ref normalize()
+   * @return DynVector
+   */
+  DynVector normalized() const {
+    DynVector ret(*this);
+    ret.normalize();
+    return ret;
+  }
+
+  /********************************* I/O ***********************************/
+
+  /**
+   * @brief print vector values, like a Vector
+   *
+   * @tparam U
+   * @tparam A
+   * @param os
+   * @param v
+   * @return std::ostream&
+   */
+  template <class U, class A>
+  friend std::ostream &operator<<(std::ostream &os, const DynVector<U, A> &v);
+
+  /*************************** vector <> vector ****************************/
+
+  /**
+   * @brief equality operator. the sizes and all values must be equal
+   *
+   * see mu::Vector operator==
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return bool
+   */
+  template <typename U, class A2>
+  bool operator==(const DynVector<U, A2> &rhs) const {
+    if (size() != rhs.size()) {
+      return false;
+    }
+    return calc_equals(
+        rhs, std::integral_constant<bool, std::is_same<T, U>::value &&
+                                              std::is_floating_point<
+                                                  T>::value>{});
+  }
+
+  /**
+   * @brief unequality operator
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return bool
+   */
+  template <typename U, class A2>
+  bool operator!=(const DynVector<U, A2> &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief equality check with a tolerance. the sizes must be equal
+   *
+   * see mu::Vector equals
+   *
+   * @tparam A2
+   * @param rhs
+   * @param tolerance
+   * @return bool
+   */
+  template <class A2>
+  bool equals(const DynVector<T, A2> &rhs,
+              const mu::Tolerance &tolerance) const {
+    if (size() != rhs.size()) {
+      return false;
+    }
+    return calc_equals(rhs, tolerance, std::is_floating_point<T>{});
+  }
+
+  /**
+   * @brief plus equal operator
+   *
+   * @par Example
+   * @snippet example_dynvector.cpp dynvector operators
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynVector&
+   */
+  template <typename U, class A2>
+  DynVector &operator+=(const DynVector<U, A2> &rhs) {
+    return apply<mu::SimdAdd>(rhs);
+  }
+
+  /**
+   * @brief minus equal operator
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynVector&
+   */
+  template <typename U, class A2>
+  DynVector &operator-=(const DynVector<U, A2> &rhs) {
+    return apply<mu::SimdSub>(rhs);
+  }
+
+  /**
+   * @brief multiplication equal operator (elementwise)
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynVector&
+   */
+  template <typename U, class A2>
+  DynVector &operator*=(const DynVector<U, A2> &rhs) {
+    return apply<mu::SimdMul>(rhs);
+  }
+
+  /**
+   * @brief division equal operator (elementwise)
+   *
+   * @tparam U
+   * @tparam A2
+   * @param rhs
+   * @return DynVector&
+   */
+  template <typename U, class A2>
+  DynVector &operator/=(const DynVector<U, A2> &rhs) {
+    return apply<mu::SimdDiv>(rhs);
+  }
+
+  /*************************** vector <> scalar ****************************/
+
+  /**
+   * @brief adds a scalar to every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+  operator+=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdAdd>(scalar);
+  }
+
+  /**
+   * @brief subtracts a scalar from every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+  operator-=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdSub>(scalar);
+  }
+
+  /**
+   * @brief multiplies every value with a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+  operator*=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdMul>(scalar);
+  }
+
+  /**
+   * @brief divides every value by a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector &>
+  operator/=(const TScalar &scalar) {
+    if (std::is_integral<TScalar>::value) {
+      assert(scalar != static_cast<TScalar>(0));
+    }
+    return apply_scalar<mu::SimdDiv>(scalar);
+  }
+
+ private:
+  std::vector<T, Allocator> data_;
+
+  /* floating point values of the same type (SIMD) */
+  template <class A2>
+  bool calc_equals(const DynVector<T, A2> &rhs, std::true_type /*simd*/) const {
+    return mu::simd_equals(data(), rhs.data(), size());
+  }
+
+  template <class U, class A2>
+  bool calc_equals(const DynVector<U, A2> &rhs,
+                   std::false_type /*simd*/) const {
+    for (std::size_t i = 0; i < size(); i++) {
+      if (!mu::TypeTraits<T>::equals(data_[i], rhs[i]) ||
+          !mu::TypeTraits<U>::equals(data_[i], rhs[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <class A2>
+  bool calc_equals(const DynVector<T, A2> &rhs, const mu::Tolerance &tolerance,
+                   std::true_type /*floating point*/) const {
+    return mu::simd_equals(data(), rhs.data(), size(), tolerance);
+  }
+
+  template <class A2>
+  bool calc_equals(const DynVector<T, A2> &rhs, const mu::Tolerance &tolerance,
+                   std::false_type /*floating point*/) const {
+    for (std::size_t i = 0; i < size(); i++) {
+      if (!mu::equals(data_[i], rhs[i], tolerance)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /* dot product of the same type (SIMD) */
+  template <class U, class A2>
+  U calc_dot(const DynVector<T, A2> &rhs, std::true_type /*same*/) const {
+    return mu::simd_dot(data(), rhs.data(), size());
+  }
+
+  template <class U, class T2, class A2>
+  U calc_dot(const DynVector<T2, A2> &rhs, std::false_type /*same*/) const {
+    U ret{};
+    for (std::size_t i = 0; i < size(); i++) {
+      ret += data_[i] * rhs[i];
+    }
+    return ret;
+  }
+
+  template <class TOp, class U, class A2>
+  DynVector &apply(const DynVector<U, A2> &rhs) {
+    assert(size() == rhs.size());
+    mu::simd_apply<TOp>(data(), rhs.data(), size());
+    return *this;
+  }
+
+  template <class TOp, class TScalar>
+  DynVector &apply_scalar(const TScalar &scalar) {
+    mu::simd_apply_scalar<TOp>(data(), scalar, size());
+    return *this;
+  }
+
+  /* see Vector::calc_mean_m2() */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::true_type /*floating point*/) const {
+    assert(!empty());
+    mu::simd_mean_m2(data(), size(), m, m2);
+  }
+
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::false_type /*floating point*/) const {
+    m = mean<U>();
+    m2 = U{0};
+    for (const auto &item : data_) {
+      m2 += mu::pow(item - m, 2);
+    }
+  }
+};
+
+/********************************** I/O ************************************/
+
+template <class U, class A>
+std::ostream &operator<<(std::ostream &os, const DynVector<U, A> &v) {
+  os << "[ ";
+  for (std::size_t i = 0; i < v.size(); i++) {
+    os << v.data_[i];
+    if (i < (v.size() - 1)) {
+      os << ", ";
+    } else {
+      os << " ";
+    }
+  }
+  os << "]";
+  return os;
+}
+
+/**************************** vector <> vector *****************************/
+
+/**
+ * @brief plus operator
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynVector<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynVector<T, A> operator+(DynVector<T, A> lhs, const DynVector<U, A2> &rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+/**
+ * @brief minus operator
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynVector<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynVector<T, A> operator-(DynVector<T, A> lhs, const DynVector<U, A2> &rhs) {
+  lhs -= rhs;
+  return lhs;
+}
+
+/**
+ * @brief multiplication operator (elementwise)
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynVector<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynVector<T, A> operator*(DynVector<T, A> lhs, const DynVector<U, A2> &rhs) {
+  lhs *= rhs;
+  return lhs;
+}
+
+/**
+ * @brief division operator (elementwise)
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam U
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynVector<T, A>
+ */
+template <class T, class A, class U, class A2>
+DynVector<T, A> operator/(DynVector<T, A> lhs, const DynVector<U, A2> &rhs) {
+  lhs /= rhs;
+  return lhs;
+}
+
+/**************************** vector <> scalar *****************************/
+
+/**
+ * @brief vector and scalar addition
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynVector<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector<T, A>>
+operator+(DynVector<T, A> lhs, const TScalar &scalar) {
+  lhs += scalar;
+  return lhs;
+}
+
+/**
+ * @brief vector and scalar subtraction
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynVector<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector<T, A>>
+operator-(DynVector<T, A> lhs, const TScalar &scalar) {
+  lhs -= scalar;
+  return lhs;
+}
+
+/**
+ * @brief vector and scalar multiplication
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynVector<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector<T, A>>
+operator*(DynVector<T, A> lhs, const TScalar &scalar) {
+  lhs *= scalar;
+  return lhs;
+}
+
+/**
+ * @brief vector and scalar division
+ *
+ * @tparam T
+ * @tparam A
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * DynVector<T, A>>
+ */
+template <class T, class A, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, DynVector<T, A>>
+operator/(DynVector<T, A> lhs, const TScalar &scalar) {
+  lhs /= scalar;
+  return lhs;
+}
+
+/************************* convenience functions ***************************/
+
+template <class T, class A>
+T min(const DynVector<T, A> &v) {
+  return v.min();
+}
+
+template <class T, class A>
+T max(const DynVector<T, A> &v) {
+  return v.max();
+}
+
+template <class T, class A>
+T sum(const DynVector<T, A> &v) {
+  return v.sum();
+}
+
+template <class U = void, class T, class A>
+std::conditional_t<std::is_same<U, void>::value, T, U> mean(
+    const DynVector<T, A> &v) {
+  return v
+      .template mean<std::conditional_t<std::is_same<U, void>::value, T, U>>();
+}
+
+template <class U = void, class T1, class A1, class T2, class A2>
+std::conditional_t<std::is_same<U, void>::value, T1, U> dot(
+    const DynVector<T1, A1> &lhs, const DynVector<T2, A2> &rhs) {
+  return lhs.template dot<U>(rhs);
+}
+
+}  // namespace mu
+#endif  // MU_DYNVECTOR_H_
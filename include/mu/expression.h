@@ -0,0 +1,489 @@
+/**
+ * @file expression.h
+ *
+ * lazy evaluation of elementwise Vector and Matrix arithmetic
+ */
+#ifndef MU_EXPRESSION_H_
+#define MU_EXPRESSION_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/simd.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/* the free operators of Vector and Matrix return a new object, so a chain like
+ * "a + b * c - d" creates a temporary for every operation and loops over the
+ * data once per operation.
+ *
+ * the expressions in this file are opt-in. mu::lazy() marks an operand, after
+ * that the operators build an expression that is evaluated in a single loop
+ * once it is assigned to a Vector or Matrix. every single operation behaves
+ * exactly like the corresponding operator of the Vector or Matrix class, i.e.
+ * the result has the type of the left hand side operand.
+ *
+ * operands are referenced, not copied. an expression must not outlive the
+ * Vectors and Matrices it was built from. */
+
+/**************************** expression traits ****************************/
+
+/**
+ * @brief type trait that describes the objects an expression evaluates to
+ *
+ * value_type is the type of a single element. rebind is the same object type
+ * with a different element type
+ *
+ * @tparam T Vector or Matrix type
+ */
+template <class T>
+struct ExpressionTraits;
+
+template <std::size_t N, class T>
+struct ExpressionTraits<Vector<N, T>> {
+  ExpressionTraits() = delete;
+  using value_type = T;
+  template <class U>
+  using rebind = Vector<N, U>;
+};
+
+template <std::size_t N, std::size_t M, class T>
+struct ExpressionTraits<Matrix<N, M, T>> {
+  ExpressionTraits() = delete;
+  using value_type = T;
+  template <class U>
+  using rebind = Matrix<N, M, U>;
+};
+
+/* common (non-template) base class to detect expressions */
+struct ExpressionBase {};
+
+template <class T>
+using is_expression = std::is_base_of<ExpressionBase, T>;
+
+/****************************** expressions ********************************/
+
+/**
+ * @brief base class of all expressions
+ *
+ * an expression can be evaluated element by element through get(i) for
+ * Vectors or get(i, j) for Matrices
+ *
+ * @tparam E the derived expression type (CRTP)
+ * @tparam TResult the Vector or Matrix type this expression evaluates to
+ */
+template <class E, class TResult>
+class Expression : public ExpressionBase {
+ public:
+  using result_type = TResult;
+  using value_type = typename ExpressionTraits<TResult>::value_type;
+
+  /**
+   * @brief the derived expression
+   *
+   * @return const E&
+   */
+  const E &self() const noexcept { return static_cast<const E &>(*this); }
+
+  /**
+   * @brief evaluates this expression in a single loop
+   *
+   * @par Example
+   * @snippet example_expression.cpp expression eval function
+   * @return TResult
+   */
+  TResult eval() const;
+
+  /**
+   * @brief evaluates this expression on assignment to a Vector or Matrix
+   *
+   * @par Example
+   * @snippet example_expression.cpp expression conversion
+   * @return TResult
+   */
+  // NOLINTNEXTLINE(runtime/explicit) implicit conversion is intentional
+  operator TResult() const { return eval(); }
+};
+
+/**
+ * @brief an expression that references a Vector or a Matrix
+ *
+ * @tparam TObj
+ */
+template <class TObj>
+class ExpressionLeaf : public Expression<ExpressionLeaf<TObj>, TObj> {
+ public:
+  using value_type = typename ExpressionTraits<TObj>::value_type;
+
+  explicit ExpressionLeaf(const TObj &obj) noexcept : obj_(obj) {}
+
+  value_type get(std::size_t i) const { return obj_[i]; }
+  value_type get(std::size_t i, std::size_t j) const { return obj_[i][j]; }
+
+ private:
+  const TObj &obj_;
+};
+
+/**
+ * @brief an elementwise operation of two expressions
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam L
+ * @tparam R
+ */
+template <class TOp, class L, class R>
+class ExpressionBinary
+    : public Expression<ExpressionBinary<TOp, L, R>, typename L::result_type> {
+  static_assert(std::is_same<typename ExpressionTraits<typename L::result_type>::
+                                 template rebind<typename R::value_type>,
+                             typename R::result_type>::value,
+                "Expression dimension mismatch");
+
+ public:
+  using value_type = typename L::value_type;
+
+  ExpressionBinary(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  value_type get(std::size_t i) const {
+    value_type ret = lhs_.get(i);
+    TOp::scalar(ret, rhs_.get(i));
+    return ret;
+  }
+  value_type get(std::size_t i, std::size_t j) const {
+    value_type ret = lhs_.get(i, j);
+    TOp::scalar(ret, rhs_.get(i, j));
+    return ret;
+  }
+
+ private:
+  L lhs_;
+  R rhs_;
+};
+
+/**
+ * @brief an elementwise operation of an expression and a scalar
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam L
+ * @tparam TScalar
+ */
+template <class TOp, class L, class TScalar>
+class ExpressionScalar
+    : public Expression<ExpressionScalar<TOp, L, TScalar>,
+                        typename L::result_type> {
+ public:
+  using value_type = typename L::value_type;
+
+  ExpressionScalar(const L &lhs, const TScalar &scalar)
+      : lhs_(lhs), scalar_(scalar) {}
+
+  value_type get(std::size_t i) const {
+    value_type ret = lhs_.get(i);
+    TOp::scalar(ret, scalar_);
+    return ret;
+  }
+  value_type get(std::size_t i, std::size_t j) const {
+    value_type ret = lhs_.get(i, j);
+    TOp::scalar(ret, scalar_);
+    return ret;
+  }
+
+ private:
+  L lhs_;
+  TScalar scalar_;
+};
+
+/******************************* evaluation ********************************/
+
+/**
+ * @brief evaluates an expression into an existing Vector
+ *
+ * the Vector can be of a different type than the expression. implicit
+ * conversions apply. the Vector may also be an operand of the expression
+ * since every element only depends on the elements at the same index
+ *
+ * @par Example
+ * @snippet example_expression.cpp expression assign function
+ * @tparam N
+ * @tparam T
+ * @tparam E
+ * @tparam TResult
+ * @param dst
+ * @param e
+ */
+template <std::size_t N, class T, class E, class TResult>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void assign(Vector<N, T> &dst, const Expression<E, TResult> &e) {
+  static_assert(
+      std::is_same<typename ExpressionTraits<TResult>::template rebind<T>,
+                   Vector<N, T>>::value,
+      "Expression dimension mismatch");
+  for (std::size_t i = 0; i < N; i++) {
+    dst[i] = e.self().get(i);
+  }
+}
+
+/**
+ * @brief evaluates an expression into an existing Matrix
+ *
+ * see assign() for Vectors
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @tparam E
+ * @tparam TResult
+ * @param dst
+ * @param e
+ */
+template <std::size_t N, std::size_t M, class T, class E, class TResult>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void assign(Matrix<N, M, T> &dst, const Expression<E, TResult> &e) {
+  static_assert(
+      std::is_same<typename ExpressionTraits<TResult>::template rebind<T>,
+                   Matrix<N, M, T>>::value,
+      "Expression dimension mismatch");
+  for (std::size_t i = 0; i < N; i++) {
+    for (std::size_t j = 0; j < M; j++) {
+      dst[i][j] = e.self().get(i, j);
+    }
+  }
+}
+
+template <class E, class TResult>
+TResult Expression<E, TResult>::eval() const {
+  TResult ret;
+  mu::assign(ret, *this);
+  return ret;
+}
+
+/********************************* lazy ************************************/
+
+/**
+ * @brief marks a Vector as the operand of a lazy expression
+ *
+ * @par Example
+ * @snippet example_expression.cpp expression lazy function
+ * @tparam N
+ * @tparam T
+ * @param v
+ * @return ExpressionLeaf<Vector<N, T>>
+ */
+template <std::size_t N, class T>
+inline ExpressionLeaf<Vector<N, T>> lazy(const Vector<N, T> &v) noexcept {
+  return ExpressionLeaf<Vector<N, T>>(v);
+}
+
+/**
+ * @brief marks a Matrix as the operand of a lazy expression
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param m
+ * @return ExpressionLeaf<Matrix<N, M, T>>
+ */
+template <std::size_t N, std::size_t M, class T>
+inline ExpressionLeaf<Matrix<N, M, T>> lazy(const Matrix<N, M, T> &m) noexcept {
+  return ExpressionLeaf<Matrix<N, M, T>>(m);
+}
+
+/* an expression is passed on as it is */
+template <class E>
+inline std::enable_if_t<is_expression<E>::value, const E &> lazy(
+    const E &e) noexcept {
+  return e;
+}
+
+/******************************* operators *********************************/
+
+/* operands of an expression operator. at least one of the two operands must
+ * be an expression, the other one can also be a Vector or a Matrix. the
+ * enable_if's make sure that the eager Vector and Matrix operators are used
+ * for everything else */
+
+/* helper. true for Vector and Matrix types as well as types derived from
+ * them (e.g. Vector2D) */
+template <std::size_t N, class T>
+std::true_type is_lazy_operand_impl(const Vector<N, T> *);
+template <std::size_t N, std::size_t M, class T>
+std::true_type is_lazy_operand_impl(const Matrix<N, M, T> *);
+std::false_type is_lazy_operand_impl(...);
+
+template <class T>
+using is_lazy_operand =
+    std::integral_constant<bool, is_expression<T>::value ||
+                                     decltype(is_lazy_operand_impl(
+                                         std::declval<const T *>()))::value>;
+
+template <class L, class R>
+using enable_if_expression_t = std::enable_if_t<
+    (is_expression<L>::value || is_expression<R>::value) &&
+        is_lazy_operand<L>::value && is_lazy_operand<R>::value,
+    int>;
+
+template <class L, class TScalar>
+using enable_if_expression_scalar_t =
+    std::enable_if_t<is_expression<L>::value &&
+                         std::is_arithmetic<TScalar>::value,
+                     int>;
+
+template <class TOp, class L, class R>
+using ExpressionBinaryOf =
+    ExpressionBinary<TOp, std::decay_t<decltype(mu::lazy(std::declval<L>()))>,
+                     std::decay_t<decltype(mu::lazy(std::declval<R>()))>>;
+
+/**
+ * @brief lazy plus operator
+ *
+ * @tparam L
+ * @tparam R
+ * @param lhs
+ * @param rhs
+ * @return ExpressionBinary
+ */
+template <class L, class R, enable_if_expression_t<L, R> = 0>
+inline ExpressionBinaryOf<SimdAdd, L, R> operator+(const L &lhs,
+                                                   const R &rhs) {
+  return {mu::lazy(lhs), mu::lazy(rhs)};
+}
+
+/**
+ * @brief lazy minus operator
+ *
+ * @tparam L
+ * @tparam R
+ * @param lhs
+ * @param rhs
+ * @return ExpressionBinary
+ */
+template <class L, class R, enable_if_expression_t<L, R> = 0>
+inline ExpressionBinaryOf<SimdSub, L, R> operator-(const L &lhs,
+                                                   const R &rhs) {
+  return {mu::lazy(lhs), mu::lazy(rhs)};
+}
+
+/**
+ * @brief lazy multiplication operator
+ *
+ * @tparam L
+ * @tparam R
+ * @param lhs
+ * @param rhs
+ * @return ExpressionBinary
+ */
+template <class L, class R, enable_if_expression_t<L, R> = 0>
+inline ExpressionBinaryOf<SimdMul, L, R> operator*(const L &lhs,
+                                                   const R &rhs) {
+  return {mu::lazy(lhs), mu::lazy(rhs)};
+}
+
+/**
+ * @brief lazy division operator
+ *
+ * @tparam L
+ * @tparam R
+ * @param lhs
+ * @param rhs
+ * @return ExpressionBinary
+ */
+template <class L, class R, enable_if_expression_t<L, R> = 0>
+inline ExpressionBinaryOf<SimdDiv, L, R> operator/(const L &lhs,
+                                                   const R &rhs) {
+  return {mu::lazy(lhs), mu::lazy(rhs)};
+}
+
+/**
+ * @brief lazy expression and scalar addition
+ *
+ * @tparam L
+ * @tparam TScalar
+ * @param lhs
+ * @param rhs
+ * @return ExpressionScalar<SimdAdd, L, TScalar>
+ */
+template <class L, class TScalar, enable_if_expression_scalar_t<L, TScalar> = 0>
+inline ExpressionScalar<SimdAdd, L, TScalar> operator+(const L &lhs,
+                                                       const TScalar &rhs) {
+  return {lhs, rhs};
+}
+
+/**
+ * @brief lazy expression and scalar addition
+ *
+ * @tparam R
+ * @tparam TScalar
+ * @param lhs
+ * @param rhs
+ * @return ExpressionScalar<SimdAdd, R, TScalar>
+ */
+template <class R, class TScalar, enable_if_expression_scalar_t<R, TScalar> = 0>
+inline ExpressionScalar<SimdAdd, R, TScalar> operator+(const TScalar &lhs,
+                                                       const R &rhs) {
+  return {rhs, lhs};
+}
+
+/**
+ * @brief subtract a scalar from a lazy expression
+ *
+ * @tparam L
+ * @tparam TScalar
+ * @param lhs
+ * @param rhs
+ * @return ExpressionScalar<SimdSub, L, TScalar>
+ */
+template <class L, class TScalar, enable_if_expression_scalar_t<L, TScalar> = 0>
+inline ExpressionScalar<SimdSub, L, TScalar> operator-(const L &lhs,
+                                                       const TScalar &rhs) {
+  return {lhs, rhs};
+}
+
+/**
+ * @brief lazy expression and scalar multiplication
+ *
+ * @tparam L
+ * @tparam TScalar
+ * @param lhs
+ * @param rhs
+ * @return ExpressionScalar<SimdMul, L, TScalar>
+ */
+template <class L, class TScalar, enable_if_expression_scalar_t<L, TScalar> = 0>
+inline ExpressionScalar<SimdMul, L, TScalar> operator*(const L &lhs,
+                                                       const TScalar &rhs) {
+  return {lhs, rhs};
+}
+
+/**
+ * @brief lazy expression and scalar multiplication
+ *
+ * @tparam R
+ * @tparam TScalar
+ * @param lhs
+ * @param rhs
+ * @return ExpressionScalar<SimdMul, R, TScalar>
+ */
+template <class R, class TScalar, enable_if_expression_scalar_t<R, TScalar> = 0>
+inline ExpressionScalar<SimdMul, R, TScalar> operator*(const TScalar &lhs,
+                                                       const R &rhs) {
+  return {rhs, lhs};
+}
+
+/**
+ * @brief lazy expression and scalar division
+ *
+ * @tparam L
+ * @tparam TScalar
+ * @param lhs
+ * @param rhs
+ * @return ExpressionScalar<SimdDiv, L, TScalar>
+ */
+template <class L, class TScalar, enable_if_expression_scalar_t<L, TScalar> = 0>
+inline ExpressionScalar<SimdDiv, L, TScalar> operator/(const L &lhs,
+                                                       const TScalar &rhs) {
+  return {lhs, rhs};
+}
+
+}  // namespace mu
+#endif  // MU_EXPRESSION_H_
@@ -0,0 +1,474 @@
+/**
+ * @file format.h
+ *
+ * text formatting of Vector and Matrix objects into character buffers.
+ * FormatStyle and FormatWriter classes and free functions
+ */
+#ifndef MU_FORMAT_H_
+#define MU_FORMAT_H_
+
+#include <clocale>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief the text around and between the values of a formatted Vector or
+ * Matrix
+ *
+ * a Vector is written as open, the values separated by separator and close.
+ * a Matrix is written as matrix_open, the rows (each like a Vector)
+ * separated by row_separator and matrix_close. a list of elements (see
+ * FormatWriter) is written as list_open, the elements separated by
+ * list_separator and list_close
+ *
+ * @par Example
+ * @snippet example_format.cpp format style
+ */
+struct FormatStyle {
+  const char *open;
+  const char *separator;
+  const char *close;
+  const char *matrix_open;
+  const char *row_separator;
+  const char *matrix_close;
+  const char *list_open;
+  const char *list_separator;
+  const char *list_close;
+
+  /**
+   * @brief the same text as operator<<. one element per line
+   *
+   * @return FormatStyle
+   */
+  static constexpr FormatStyle plain() {
+    return {"[ ", ", ", " ]", "[ ", ",\n  ", " ]", "", "\n", "\n"};
+  }
+
+  /**
+   * @brief all values of an element in one comma separated line
+   *
+   * @return FormatStyle
+   */
+  static constexpr FormatStyle csv() {
+    return {"", ",", "", "", ",", "", "", "\n", "\n"};
+  }
+
+  /**
+   * @brief JSON arrays. a Matrix is an array of rows, a list is an array of
+   * elements
+   *
+   * @return FormatStyle
+   */
+  static constexpr FormatStyle json() {
+    return {"[", ",", "]", "[", ",", "]", "[", ",", "]"};
+  }
+};
+
+/**
+ * @brief the maximum number of characters of a formatted value of type T
+ *
+ * @tparam T arithmetic type
+ * @return constexpr std::size_t
+ */
+template <typename T>
+constexpr std::size_t format_max_chars() {
+  static_assert(std::is_arithmetic<T>::value,
+                "format_max_chars type T must be an arithmetic type");
+  /* sign, digits, point and exponent "e-308" for floating point types */
+  return std::is_floating_point<T>::value
+             ? 1 + std::numeric_limits<T>::max_digits10 + 1 + 6
+             : 1 + std::numeric_limits<T>::digits10 + 1;
+}
+
+/* the implementation of format_to for text and single values */
+
+/**
+ * @brief writes text without the terminating null character
+ *
+ * @param first begin of the buffer, may be nullptr
+ * @param last end of the buffer
+ * @param text
+ * @return char* behind the last written character, nullptr if the buffer
+ * is too small or first is nullptr
+ */
+inline char *format_text(char *first, char *last, const char *text) {
+  if (first == nullptr) {
+    return nullptr;
+  }
+  const std::size_t kLength = std::strlen(text);
+  if (static_cast<std::size_t>(last - first) < kLength) {
+    return nullptr;
+  }
+  std::memcpy(first, text, kLength);
+  return first + kLength;
+}
+
+#if defined(__cpp_lib_to_chars)
+
+template <typename T>
+char *format_value(char *first, char *last, T value, std::true_type /*fp*/) {
+  const std::to_chars_result kRes = std::to_chars(first, last, value);
+  return kRes.ec == std::errc() ? kRes.ptr : nullptr;
+}
+
+#else
+
+template <typename T>
+char *format_value(char *first, char *last, T value, std::true_type /*fp*/) {
+  /* sign, max_digits10 digits, point and exponent of long double */
+  char text[format_max_chars<T>() + 8];
+  int length = std::snprintf(text, sizeof(text), "%.*Lg",
+                             std::numeric_limits<T>::digits10,
+                             static_cast<long double>(value));
+  /* NaN never compares equal */
+  if (value == value &&
+      static_cast<T>(std::strtold(text, nullptr)) != value) {
+    length = std::snprintf(text, sizeof(text), "%.*Lg",
+                           std::numeric_limits<T>::max_digits10,
+                           static_cast<long double>(value));
+  }
+  const char kPoint = *std::localeconv()->decimal_point;
+  for (int i = 0; i < length; i++) {
+    if (text[i] == kPoint) {
+      text[i] = '.';
+    }
+  }
+  if (length < 0 || last - first < length) {
+    return nullptr;
+  }
+  std::memcpy(first, text, static_cast<std::size_t>(length));
+  return first + length;
+}
+
+#endif
+
+template <typename T>
+char *format_value(char *first, char *last, T value, std::false_type /*fp*/) {
+  /* the digits are written backwards. the magnitude is taken as unsigned,
+   * since -min() can't be represented by T */
+  using U = std::make_unsigned_t<std::conditional_t<
+      std::is_same<T, bool>::value, unsigned char, T>>;
+  char text[format_max_chars<T>()];
+  char *end = text + sizeof(text);
+  char *begin = end;
+  U magnitude = value < T{} ? static_cast<U>(U{} - static_cast<U>(value))
+                            : static_cast<U>(value);
+  do {
+    *--begin = static_cast<char>('0' + magnitude % 10);
+    magnitude = static_cast<U>(magnitude / 10);
+  } while (magnitude != 0);
+  if (value < T{}) {
+    *--begin = '-';
+  }
+  if (last - first < end - begin) {
+    return nullptr;
+  }
+  std::memcpy(first, begin, static_cast<std::size_t>(end - begin));
+  return first + (end - begin);
+}
+
+/**
+ * @brief writes a value
+ *
+ * floating point values are written with the shortest number of digits that
+ * read back as the same value (std::to_chars, since C++17). before C++17 they
+ * are written by std::snprintf with 6 (float) or 15 (double) significant
+ * digits if those read back as the same value, with all digits otherwise.
+ * std::snprintf and std::strtold depend on the locale, so its decimal point
+ * (std::localeconv) is replaced afterwards. the decimal point is always '.',
+ * no matter the locale
+ *
+ * @tparam T arithmetic type
+ * @param first begin of the buffer, may be nullptr
+ * @param last end of the buffer
+ * @param value
+ * @param style not used, a single value is never decorated
+ * @return char* behind the last written character, nullptr if the buffer
+ * is too small
+ */
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, char *> format_to(
+    char *first, char *last, T value,
+    const FormatStyle & /*style*/ = FormatStyle::plain()) {
+  if (first == nullptr) {
+    return nullptr;
+  }
+  return format_value(first, last, value, std::is_floating_point<T>{});
+}
+
+/**
+ * @brief writes a Vector
+ *
+ * nothing is allocated and no stream is involved. with std::to_chars (C++17,
+ * __cpp_lib_to_chars) the locale isn't involved either. before, the floating
+ * point values are written with std::snprintf, std::strtold and
+ * std::localeconv, see format_to() of a single value
+ *
+ * @par Example
+ * @snippet example_format.cpp format vector
+ * @tparam N
+ * @tparam T
+ * @param first begin of the buffer
+ * @param last end of the buffer
+ * @param v
+ * @param style
+ * @return char* behind the last written character, nullptr if the buffer
+ * is too small
+ */
+template <std::size_t N, typename T>
+char *format_to(char *first, char *last, const Vector<N, T> &v,
+                const FormatStyle &style = FormatStyle::plain()) {
+  first = format_text(first, last, style.open);
+  for (std::size_t i = 0; i < N && first != nullptr; i++) {
+    if (i > 0) {
+      first = format_text(first, last, style.separator);
+    }
+    first = format_to(first, last, v[i]);
+  }
+  return format_text(first, last, style.close);
+}
+
+/**
+ * @brief writes a Matrix
+ *
+ * the rows are written like a Vector, so the locale is only involved before
+ * C++17 as well
+ *
+ * @par Example
+ * @snippet example_format.cpp format matrix
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param first begin of the buffer
+ * @param last end of the buffer
+ * @param m
+ * @param style
+ * @return char* behind the last written character, nullptr if the buffer
+ * is too small
+ */
+template <std::size_t N, std::size_t M, typename T>
+char *format_to(char *first, char *last, const Matrix<N, M, T> &m,
+                const FormatStyle &style = FormatStyle::plain()) {
+  first = format_text(first, last, style.matrix_open);
+  for (std::size_t i = 0; i < N && first != nullptr; i++) {
+    if (i > 0) {
+      first = format_text(first, last, style.row_separator);
+    }
+    first = format_to(first, last, m[i], style);
+  }
+  return format_text(first, last, style.matrix_close);
+}
+
+/**
+ * @brief writes n elements as a list
+ *
+ * @par Example
+ * @snippet example_format.cpp format list
+ * @tparam E Vector or Matrix
+ * @param first begin of the buffer
+ * @param last end of the buffer
+ * @param elements pointer to n elements
+ * @param n
+ * @param style
+ * @return char* behind the last written character, nullptr if the buffer
+ * is too small
+ */
+template <class E>
+char *format_to(char *first, char *last, const E *elements, std::size_t n,
+                const FormatStyle &style = FormatStyle::plain()) {
+  first = format_text(first, last, style.list_open);
+  for (std::size_t i = 0; i < n && first != nullptr; i++) {
+    if (i > 0) {
+      first = format_text(first, last, style.list_separator);
+    }
+    first = format_to(first, last, elements[i], style);
+  }
+  return format_text(first, last, style.list_close);
+}
+
+/**
+ * @brief the maximum number of characters of a formatted Vector
+ *
+ * @tparam N
+ * @tparam T
+ * @param style
+ * @return std::size_t
+ */
+template <std::size_t N, typename T>
+std::size_t format_max_size(const Vector<N, T> & /*v*/,
+                            const FormatStyle &style = FormatStyle::plain()) {
+  return std::strlen(style.open) +
+         (N > 0 ? N - 1 : 0) * std::strlen(style.separator) +
+         N * format_max_chars<T>() + std::strlen(style.close);
+}
+
+/**
+ * @brief the maximum number of characters of a formatted Matrix
+ *
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param style
+ * @return std::size_t
+ */
+template <std::size_t N, std::size_t M, typename T>
+std::size_t format_max_size(const Matrix<N, M, T> &m,
+                            const FormatStyle &style = FormatStyle::plain()) {
+  return std::strlen(style.matrix_open) +
+         (N > 0 ? N - 1 : 0) * std::strlen(style.row_separator) +
+         N * format_max_size(m[0], style) + std::strlen(style.matrix_close);
+}
+
+/**
+ * @brief Writes lists of Vector or Matrix objects to a stream in bulk
+ *
+ * the elements are formatted into a buffer that is handed to the stream
+ * once it's full. so there is one call to the stream per buffer instead of
+ * several per value. the list is closed (e.g. the closing bracket of a JSON
+ * array) and the buffer is written to the stream by close(), which is also
+ * called by the destructor
+ *
+ * @par Example
+ * @snippet example_format.cpp format writer
+ */
+class FormatWriter {
+ public:
+  /**
+   * @brief Construct a new FormatWriter object
+   *
+   * @param os the stream to write to
+   * @param style
+   * @param buffer_size size of the buffer in characters
+   */
+  explicit FormatWriter(std::ostream &os,
+                        const FormatStyle &style = FormatStyle::plain(),
+                        std::size_t buffer_size = 1 << 16)
+      : os_(&os), style_(style), buffer_(buffer_size) {
+    put_text(style_.list_open);
+  }
+
+  FormatWriter(const FormatWriter &other) = delete;
+  FormatWriter &operator=(const FormatWriter &other) = delete;
+
+  /**
+   * @brief Destroy the FormatWriter object. closes the list, errors of the
+   * stream are ignored. call close() to see them
+   */
+  ~FormatWriter() {
+    try {
+      close();
+    } catch (...) {
+    }
+  }
+
+  /**
+   * @brief appends an element to the list
+   *
+   * @tparam E Vector or Matrix
+   * @param e
+   */
+  template <class E>
+  void write(const E &e) {
+    if (count_ > 0) {
+      put_text(style_.list_separator);
+    }
+    char *end = format_to(pos(), buffer_.data() + buffer_.size(), e, style_);
+    if (end == nullptr) {
+      /* try again in an empty buffer, which is large enough by now */
+      flush();
+      reserve(format_max_size(e, style_));
+      end = format_to(pos(), buffer_.data() + buffer_.size(), e, style_);
+    }
+    size_ = static_cast<std::size_t>(end - buffer_.data());
+    count_++;
+  }
+
+  /**
+   * @brief appends n elements to the list
+   *
+   * @tparam E Vector or Matrix
+   * @param elements pointer to n elements
+   * @param n
+   */
+  template <class E>
+  void write(const E *elements, std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) {
+      write(elements[i]);
+    }
+  }
+
+  /**
+   * @brief number of elements that were written
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const noexcept { return count_; }
+
+  /**
+   * @brief writes the buffered text to the stream
+   */
+  void flush() {
+    os_->write(buffer_.data(), static_cast<std::streamsize>(size_));
+    size_ = 0;
+  }
+
+  /**
+   * @brief closes the list and writes the buffered text to the stream. does
+   * nothing if it's already closed. throws if the stream throws, e.g. with
+   * exceptions enabled for the badbit
+   */
+  void close() {
+    if (os_ == nullptr) {
+      return;
+    }
+    put_text(style_.list_close);
+    flush();
+    os_ = nullptr;
+  }
+
+ private:
+  std::ostream *os_;
+  FormatStyle style_;
+  std::vector<char> buffer_;
+  std::size_t size_{0};
+  std::size_t count_{0};
+
+  char *pos() { return buffer_.data() + size_; }
+
+  void reserve(std::size_t size) {
+    if (buffer_.size() < size) {
+      buffer_.resize(size);
+    }
+  }
+
+  void put_text(const char *text) {
+    const std::size_t kLength = std::strlen(text);
+    if (size_ + kLength > buffer_.size()) {
+      flush();
+      reserve(kLength);
+    }
+    std::memcpy(pos(), text, kLength);
+    size_ += kLength;
+  }
+};
+
+}  // namespace mu
+
+#endif  // MU_FORMAT_H_
@@ -0,0 +1,293 @@
+/**
+ * @file gemm.h
+ *
+ * matrix multiplication kernels
+ */
+#ifndef MU_GEMM_H_
+#define MU_GEMM_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "mu/simd.h"
+
+namespace mu {
+
+/* the kernels work on "matrices" that can be indexed twice, i.e. m[i][j],
+ * where every row is contiguous, see gemm_row(). e.g. a mu::Matrix or a
+ * mu::DynMatrix.
+ *
+ * ret[i][j] = sum_k lhs[i][k] * rhs[k][j] for an NxK and a KxP matrix.
+ *
+ * every kernel adds the products up in the same order (k = 0, 1, ... K-1) and
+ * with the same types as the naive loop, so only the memory access pattern is
+ * different. the results are the same, unless the compiler is allowed to
+ * contract a multiplication and an addition to a fused multiply-add */
+
+/* pointer to the contiguous elements of a row, i.e. m[i] of a "matrix". the
+ * rows of a mu::Matrix have a data() function, the rows of a mu::DynMatrix
+ * already are pointers */
+template <class TRow>
+inline auto gemm_row(TRow &&row) -> decltype(row.data()) {
+  return row.data();
+}
+
+template <class T>
+inline T *gemm_row(T *row) {
+  return row;
+}
+
+/* tile sizes of the blocked kernel. a kGemmBlockK x kGemmBlockP block of the
+ * right hand side (at most 64 * 256 doubles = 128 KiB) is reused for all rows
+ * of the left hand side while it is in the cache. kGemmRows rows are
+ * calculated at once so that every element that is loaded from the right hand
+ * side is used kGemmRows times */
+constexpr std::size_t kGemmBlockK = 64;
+constexpr std::size_t kGemmBlockP = 256;
+constexpr std::size_t kGemmRows = 4;
+
+/* matrices with at least this many multiplications (N * K * P) use the blocked
+ * kernel. for smaller matrices, everything fits into the L1 cache and the naive
+ * loop, which the compiler unrolls completely, is as fast or faster */
+constexpr std::size_t kGemmBlockedMin = 32 * 32 * 32;
+
+/**
+ * @brief naive matrix multiplication (i-j-k)
+ *
+ * strides down the columns of the right hand side. constexpr, so that it can
+ * be used in constant expressions
+ *
+ * @tparam N
+ * @tparam K
+ * @tparam P
+ * @tparam U
+ * @tparam TLhs
+ * @tparam TRhs
+ * @tparam TRet
+ * @param lhs
+ * @param rhs
+ * @param ret
+ */
+template <std::size_t N, std::size_t K, std::size_t P, class U, class TLhs,
+          class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+constexpr void gemm_naive(const TLhs &lhs, const TRhs &rhs, TRet &ret) {
+  for (std::size_t i = 0; i < N; i++) {
+    for (std::size_t j = 0; j < P; j++) {
+      U sum{0};
+      for (std::size_t k = 0; k < K; k++) {
+        sum += (lhs[i][k] * rhs[k][j]);
+      }
+      ret[i][j] = sum;
+    }
+  }
+}
+
+/**
+ * @brief micro kernel. portable implementation
+ *
+ * ret[i..i+R][j0..j1] += lhs[i..i+R][k0..k1] * rhs[k0..k1][j0..j1]
+ *
+ * the inner loop runs along a row of the right hand side and the result, which
+ * the compiler can vectorize
+ */
+template <std::size_t R, class U, class TLhs, class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm_micro(const TLhs &lhs, const TRhs &rhs, TRet &ret,
+                       std::size_t i, std::size_t k0, std::size_t k1,
+                       std::size_t j0, std::size_t j1,
+                       std::false_type /*simd*/) {
+  for (std::size_t r = 0; r < R; r++) {
+    U *out = gemm_row(ret[i + r]);
+    for (std::size_t k = k0; k < k1; k++) {
+      const auto kA = lhs[i + r][k];
+      const auto *b = gemm_row(rhs[k]);
+      for (std::size_t j = j0; j < j1; j++) {
+        out[j] += (kA * b[j]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief micro kernel. SIMD implementation for a single type
+ *
+ * keeps R x SimdTraits<U>::size results in registers while k runs from k0 to
+ * k1. the remaining columns that don't fill a register are calculated by the
+ * portable implementation
+ */
+template <std::size_t R, class U, class TLhs, class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm_micro(const TLhs &lhs, const TRhs &rhs, TRet &ret,
+                       std::size_t i, std::size_t k0, std::size_t k1,
+                       std::size_t j0, std::size_t j1,
+                       std::true_type /*simd*/) {
+  using Traits = SimdTraits<U>;
+  const std::size_t kFull = j0 + ((j1 - j0) / Traits::size) * Traits::size;
+  for (std::size_t j = j0; j < kFull; j += Traits::size) {
+    typename Traits::type acc[R];
+    for (std::size_t r = 0; r < R; r++) {
+      acc[r] = Traits::load(gemm_row(ret[i + r]) + j);
+    }
+    for (std::size_t k = k0; k < k1; k++) {
+      const typename Traits::type kB = Traits::load(gemm_row(rhs[k]) + j);
+      for (std::size_t r = 0; r < R; r++) {
+        acc[r] =
+            Traits::add(acc[r], Traits::mul(Traits::set1(lhs[i + r][k]), kB));
+      }
+    }
+    for (std::size_t r = 0; r < R; r++) {
+      Traits::store(gemm_row(ret[i + r]) + j, acc[r]);
+    }
+  }
+  gemm_micro<R, U>(lhs, rhs, ret, i, k0, k1, kFull, j1, std::false_type{});
+}
+
+/**
+ * @brief blocked matrix multiplication (i-k-j)
+ *
+ * the result is accumulated in-place, block by block. it is set to zero
+ * first. the sizes are either std::size_t or, if they are known at compile
+ * time, std::integral_constant<std::size_t, ...>. with constant sizes the
+ * compiler can bound and unroll the loops, e.g. it knows that there are no
+ * remaining rows if the number of rows is a multiple of kGemmRows
+ *
+ * @tparam U
+ * @tparam TLhs
+ * @tparam TRhs
+ * @tparam TRet
+ * @tparam TN
+ * @tparam TK
+ * @tparam TP
+ * @param lhs
+ * @param rhs
+ * @param ret
+ * @param n rows of the left hand side
+ * @param k columns of the left hand side, rows of the right hand side
+ * @param p columns of the right hand side
+ */
+template <class U, class TLhs, class TRhs, class TRet, class TN, class TK,
+          class TP>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm_blocked_sized(const TLhs &lhs, const TRhs &rhs, TRet &ret,
+                               TN n, TK k, TP p) {
+  using TA = std::decay_t<decltype(lhs[0][0])>;
+  using TB = std::decay_t<decltype(rhs[0][0])>;
+  using Simd = std::integral_constant<bool, std::is_same<TA, U>::value &&
+                                                std::is_same<TB, U>::value &&
+                                                (SimdTraits<U>::size > 1)>;
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t j = 0; j < p; j++) {
+      ret[i][j] = U{0};
+    }
+  }
+  for (std::size_t k0 = 0; k0 < k; k0 += kGemmBlockK) {
+    const std::size_t kK1 =
+        (k0 + kGemmBlockK < k) ? k0 + kGemmBlockK : std::size_t{k};
+    for (std::size_t j0 = 0; j0 < p; j0 += kGemmBlockP) {
+      const std::size_t kJ1 =
+          (j0 + kGemmBlockP < p) ? j0 + kGemmBlockP : std::size_t{p};
+      std::size_t i = 0;
+      for (; i + kGemmRows <= n; i += kGemmRows) {
+        gemm_micro<kGemmRows, U>(lhs, rhs, ret, i, k0, kK1, j0, kJ1, Simd{});
+      }
+      for (; i < n; i++) {
+        gemm_micro<1, U>(lhs, rhs, ret, i, k0, kK1, j0, kJ1, Simd{});
+      }
+    }
+  }
+}
+
+/**
+ * @brief blocked matrix multiplication (i-k-j). the sizes are known at run
+ * time, e.g. for a mu::DynMatrix
+ *
+ * see gemm_blocked_sized()
+ *
+ * @tparam U
+ * @tparam TLhs
+ * @tparam TRhs
+ * @tparam TRet
+ * @param lhs
+ * @param rhs
+ * @param ret
+ * @param n rows of the left hand side
+ * @param k columns of the left hand side, rows of the right hand side
+ * @param p columns of the right hand side
+ */
+template <class U, class TLhs, class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm_blocked(const TLhs &lhs, const TRhs &rhs, TRet &ret,
+                         std::size_t n, std::size_t k, std::size_t p) {
+  gemm_blocked_sized<U>(lhs, rhs, ret, n, k, p);
+}
+
+/**
+ * @brief blocked matrix multiplication (i-k-j). the sizes are known at
+ * compile time, e.g. for a mu::Matrix
+ *
+ * see gemm_blocked_sized()
+ *
+ * @tparam N
+ * @tparam K
+ * @tparam P
+ * @tparam U
+ * @tparam TLhs
+ * @tparam TRhs
+ * @tparam TRet
+ * @param lhs
+ * @param rhs
+ * @param ret
+ */
+template <std::size_t N, std::size_t K, std::size_t P, class U, class TLhs,
+          class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm_blocked(const TLhs &lhs, const TRhs &rhs, TRet &ret) {
+  gemm_blocked_sized<U>(lhs, rhs, ret, std::integral_constant<std::size_t, N>{},
+                        std::integral_constant<std::size_t, K>{},
+                        std::integral_constant<std::size_t, P>{});
+}
+
+/* compile time selection of the kernel */
+
+template <std::size_t N, std::size_t K, std::size_t P, class U, class TLhs,
+          class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm(const TLhs &lhs, const TRhs &rhs, TRet &ret,
+                 std::false_type /*blocked*/) {
+  gemm_naive<N, K, P, U>(lhs, rhs, ret);
+}
+
+template <std::size_t N, std::size_t K, std::size_t P, class U, class TLhs,
+          class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm(const TLhs &lhs, const TRhs &rhs, TRet &ret,
+                 std::true_type /*blocked*/) {
+  gemm_blocked<N, K, P, U>(lhs, rhs, ret);
+}
+
+/**
+ * @brief matrix multiplication. the kernel is chosen by size at compile time
+ *
+ * @tparam N rows of the left hand side
+ * @tparam K columns of the left hand side, rows of the right hand side
+ * @tparam P columns of the right hand side
+ * @tparam U result type
+ * @tparam TLhs
+ * @tparam TRhs
+ * @tparam TRet
+ * @param lhs
+ * @param rhs
+ * @param ret
+ */
+template <std::size_t N, std::size_t K, std::size_t P, class U, class TLhs,
+          class TRhs, class TRet>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void gemm(const TLhs &lhs, const TRhs &rhs, TRet &ret) {
+  gemm<N, K, P, U>(
+      lhs, rhs, ret,
+      std::integral_constant<bool, (N * K * P >= kGemmBlockedMin)>{});
+}
+
+}  // namespace mu
+#endif  // MU_GEMM_H_
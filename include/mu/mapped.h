@@ -0,0 +1,577 @@
+/**
+ * @file mapped.h
+ *
+ * binary file format for arrays of Vector and Matrix objects. MappedFile,
+ * MappedArray and MappedArrayWriter classes
+ */
+#ifndef MU_MAPPED_H_
+#define MU_MAPPED_H_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MU_MAPPED_MMAP 1
+#else
+#include <vector>
+#define MU_MAPPED_MMAP 0
+#endif
+
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief type of the values inside the elements of a binary array file
+ */
+enum class ScalarTag : std::uint8_t {
+  kInt8 = 1,
+  kUInt8,
+  kInt16,
+  kUInt16,
+  kInt32,
+  kUInt32,
+  kInt64,
+  kUInt64,
+  kFloat,
+  kDouble
+};
+
+/**
+ * @brief the ScalarTag of an arithmetic type
+ *
+ * integral types are tagged by their size and sign, so that e.g. int and
+ * std::int32_t are the same
+ *
+ * @tparam T
+ * @return constexpr ScalarTag
+ */
+template <typename T>
+constexpr ScalarTag scalar_tag() {
+  static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                "scalar_tag type T must be an arithmetic type");
+  static_assert(!std::is_floating_point<T>::value || sizeof(T) <= 8,
+                "scalar_tag type T must be float or double");
+  if (std::is_floating_point<T>::value) {
+    return sizeof(T) == 4 ? ScalarTag::kFloat : ScalarTag::kDouble;
+  }
+  /* kInt8, kUInt8, kInt16 ... */
+  std::uint8_t ret = std::is_signed<T>::value ? 1 : 2;
+  for (std::size_t size = 1; size < sizeof(T); size *= 2) {
+    ret += 2;
+  }
+  return static_cast<ScalarTag>(ret);
+}
+
+/**
+ * @brief the shape of an element of a binary array file
+ *
+ * specialized for Vector (rows = N, cols = 1) and Matrix (rows = N,
+ * cols = M). an element is stored as its N * M values, row by row
+ *
+ * @tparam E element type
+ */
+template <class E>
+struct MappedElement;
+
+template <std::size_t N, typename T>
+struct MappedElement<Vector<N, T>> {
+  using value_type = T;
+  static constexpr std::size_t rows = N;
+  static constexpr std::size_t cols = 1;
+};
+
+template <std::size_t N, std::size_t M, typename T>
+struct MappedElement<Matrix<N, M, T>> {
+  using value_type = T;
+  static constexpr std::size_t rows = N;
+  static constexpr std::size_t cols = M;
+};
+
+/**
+ * @brief version of the binary array file format that is written and read
+ */
+constexpr std::uint16_t kMappedVersion = 1;
+
+/**
+ * @brief the first 64 bytes of a binary array file
+ *
+ * the elements follow directly after the header, so that they start at a 64
+ * byte boundary of the file. the values are stored in the byte order of the
+ * machine that wrote them. the byte order is part of the header and a file
+ * of the other byte order is rejected instead of being converted, since that
+ * would need a copy
+ */
+struct MappedHeader {
+  char magic[4];          /**< "MUAR" */
+  std::uint16_t version;  /**< version of the format, kMappedVersion */
+  std::uint8_t tag;       /**< ScalarTag of the values */
+  std::uint8_t endian;    /**< 1 little endian, 2 big endian */
+  std::uint32_t rows;     /**< N */
+  std::uint32_t cols;     /**< M, 1 for a Vector */
+  std::uint64_t count;    /**< number of elements */
+  std::uint8_t reserved[40];
+
+  /**
+   * @brief the header of a file with count elements of type E
+   *
+   * @tparam E
+   * @param count
+   * @return MappedHeader
+   */
+  template <class E>
+  static MappedHeader of(std::uint64_t count) {
+    using Shape = MappedElement<E>;
+    MappedHeader ret{};
+    std::memcpy(ret.magic, "MUAR", 4);
+    ret.version = kMappedVersion;
+    ret.tag = static_cast<std::uint8_t>(
+        scalar_tag<typename Shape::value_type>());
+    ret.endian = native_endian();
+    ret.rows = static_cast<std::uint32_t>(Shape::rows);
+    ret.cols = static_cast<std::uint32_t>(Shape::cols);
+    ret.count = count;
+    return ret;
+  }
+
+  /**
+   * @brief byte order of this machine
+   *
+   * @return std::uint8_t 1 little endian, 2 big endian
+   */
+  static std::uint8_t native_endian() {
+    const std::uint16_t kOne = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &kOne, 1);
+    return first == 1 ? 1 : 2;
+  }
+};
+static_assert(sizeof(MappedHeader) == 64, "MappedHeader must be 64 bytes");
+
+/**
+ * @brief A read-only memory mapping of a whole file
+ *
+ * the operating system reads the pages of the file when they are accessed.
+ * without mmap (not a POSIX system) the file is read into memory once
+ *
+ * @par Example
+ * @snippet example_parse.cpp parse mapped file
+ */
+class MappedFile {
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * @brief Construct a new empty MappedFile object
+   */
+  MappedFile() = default;
+
+  /**
+   * @brief Construct a new MappedFile object
+   *
+   * @param path
+   * @exception std::system_error if the file can not be opened or mapped
+   */
+  explicit MappedFile(const std::string &path) { map(path); }
+
+  MappedFile(const MappedFile &other) = delete;
+  MappedFile &operator=(const MappedFile &other) = delete;
+
+  MappedFile(MappedFile &&other) noexcept { swap(other); }
+
+  MappedFile &operator=(MappedFile &&other) noexcept {
+    MappedFile tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  ~MappedFile() { unmap(); }
+
+  /**
+   * @brief the first byte of the file. nullptr if the file is empty
+   *
+   * @return const char*
+   */
+  const char *data() const noexcept { return base_; }
+
+  /**
+   * @brief size of the file in bytes
+   *
+   * @return size_type
+   */
+  size_type size() const noexcept { return bytes_; }
+
+  void swap(MappedFile &other) noexcept {
+    std::swap(base_, other.base_);
+    std::swap(bytes_, other.bytes_);
+#if !MU_MAPPED_MMAP
+    buffer_.swap(other.buffer_);
+#endif
+  }
+
+ private:
+  const char *base_{nullptr};
+  size_type bytes_{0};
+#if !MU_MAPPED_MMAP
+  std::vector<char> buffer_;
+#endif
+
+#if MU_MAPPED_MMAP
+  void map(const std::string &path) {
+    const int kFd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (kFd < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "MappedFile can not open " + path);
+    }
+    struct stat st {};
+    if (::fstat(kFd, &st) != 0) {
+      const int kErr = errno;
+      ::close(kFd);
+      throw std::system_error(kErr, std::generic_category(),
+                              "MappedFile can not open " + path);
+    }
+    const auto kBytes = static_cast<size_type>(st.st_size);
+    if (kBytes == 0) {
+      /* mmap of length 0 is invalid. an empty file is an empty MappedFile */
+      ::close(kFd);
+      return;
+    }
+    void *addr = ::mmap(nullptr, kBytes, PROT_READ, MAP_PRIVATE, kFd, 0);
+    const int kErr = errno;
+    /* the mapping stays valid without the file descriptor */
+    ::close(kFd);
+    if (addr == MAP_FAILED) {
+      throw std::system_error(kErr, std::generic_category(),
+                              "MappedFile can not map " + path);
+    }
+    base_ = static_cast<const char *>(addr);
+    bytes_ = kBytes;
+  }
+
+  void unmap() noexcept {
+    if (base_ != nullptr) {
+      ::munmap(const_cast<char *>(base_), bytes_);
+    }
+    base_ = nullptr;
+    bytes_ = 0;
+  }
+#else
+  void map(const std::string &path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+      throw std::system_error(std::make_error_code(std::errc::io_error),
+                              "MappedFile can not open " + path);
+    }
+    buffer_.resize(static_cast<size_type>(file.tellg()));
+    file.seekg(0);
+    file.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    base_ = buffer_.empty() ? nullptr : buffer_.data();
+    bytes_ = buffer_.size();
+  }
+
+  void unmap() noexcept {
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    base_ = nullptr;
+    bytes_ = 0;
+  }
+#endif
+};
+
+/**
+ * @brief A read-only view of the elements of a binary array file
+ *
+ * the file is memory mapped (see MappedFile), the elements are neither parsed
+ * nor copied. opening a file with millions of elements is as fast as opening
+ * an empty one. the file is checked against the header of E (version, value
+ * type, shape, byte order and size) when it is opened
+ *
+ * @par Example
+ * @snippet example_mapped.cpp mapped array constructor
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ */
+template <class E>
+class MappedArray {
+  static_assert(std::is_trivially_copyable<E>::value,
+                "MappedArray type E must be trivially copyable");
+  static_assert(sizeof(E) == MappedElement<E>::rows * MappedElement<E>::cols *
+                                 sizeof(typename MappedElement<E>::value_type),
+                "MappedArray type E must only consist of its values");
+
+ public:
+  using value_type = E;
+  using size_type = std::size_t;
+  using const_reference = const E &;
+  using const_pointer = const E *;
+  using const_iterator = const E *;
+
+  /**
+   * @brief Construct a new empty MappedArray object
+   */
+  MappedArray() = default;
+
+  /**
+   * @brief Construct a new MappedArray object from a file
+   *
+   * @param path
+   * @exception std::system_error if the file can not be opened or mapped
+   * @exception std::runtime_error if the file doesn't have elements of type E
+   */
+  explicit MappedArray(const std::string &path) : file_(path) {
+    size_ = check(path);
+    data_ = reinterpret_cast<const E *>(file_.data() + sizeof(MappedHeader));
+  }
+
+  MappedArray(const MappedArray &other) = delete;
+  MappedArray &operator=(const MappedArray &other) = delete;
+
+  MappedArray(MappedArray &&other) noexcept { swap(other); }
+
+  MappedArray &operator=(MappedArray &&other) noexcept {
+    MappedArray tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  /**
+   * @brief number of elements
+   *
+   * @return size_type
+   */
+  size_type size() const noexcept { return size_; }
+
+  /**
+   * @brief true if there are no elements
+   *
+   * @return bool
+   */
+  bool empty() const noexcept { return size_ == 0; }
+
+  /**
+   * @brief pointer to the first element
+   *
+   * @return const E*
+   */
+  const E *data() const noexcept { return data_; }
+
+  /**
+   * @brief element at position idx, without bounds checking
+   *
+   * @param idx
+   * @return const E&
+   */
+  const E &operator[](size_type idx) const noexcept { return data_[idx]; }
+
+  /**
+   * @brief element at position idx
+   *
+   * @param idx
+   * @return const E&
+   * @exception std::out_of_range if idx is not less than size()
+   */
+  const E &at(size_type idx) const {
+    if (idx >= size_) {
+      throw std::out_of_range("MappedArray index out of range");
+    }
+    return data_[idx];
+  }
+
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+
+  /**
+   * @brief the header of the file
+   *
+   * @return MappedHeader
+   */
+  MappedHeader header() const {
+    MappedHeader ret{};
+    if (file_.size() >= sizeof(MappedHeader)) {
+      std::memcpy(&ret, file_.data(), sizeof(MappedHeader));
+    }
+    return ret;
+  }
+
+  void swap(MappedArray &other) noexcept {
+    file_.swap(other.file_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  MappedFile file_;
+  const E *data_{nullptr};
+  size_type size_{0};
+
+  /* number of elements in the file. throws if it has another format */
+  size_type check(const std::string &path) const {
+    if (file_.size() < sizeof(MappedHeader)) {
+      throw std::runtime_error("MappedArray " + path +
+                               " is not a mu array file");
+    }
+    const MappedHeader kFile = header();
+    const MappedHeader kExpected = MappedHeader::of<E>(kFile.count);
+    if (std::memcmp(kFile.magic, kExpected.magic, 4) != 0) {
+      throw std::runtime_error("MappedArray " + path +
+                               " is not a mu array file");
+    }
+    if (kFile.endian != kExpected.endian) {
+      throw std::runtime_error("MappedArray " + path +
+                               " has a different byte order");
+    }
+    if (kFile.version != kExpected.version) {
+      throw std::runtime_error("MappedArray " + path +
+                               " has an unsupported version");
+    }
+    if (kFile.tag != kExpected.tag || kFile.rows != kExpected.rows ||
+        kFile.cols != kExpected.cols) {
+      throw std::runtime_error("MappedArray " + path +
+                               " has a different element type");
+    }
+    if (kFile.count > (file_.size() - sizeof(MappedHeader)) / sizeof(E)) {
+      throw std::runtime_error("MappedArray " + path + " is truncated");
+    }
+    return static_cast<size_type>(kFile.count);
+  }
+};
+
+/**
+ * @brief Writes elements to a binary array file one after the other
+ *
+ * the elements are buffered by the file stream, so that neither the whole
+ * array nor a text representation of it is kept in memory. the number of
+ * elements in the header is written by close(), which is also called by the
+ * destructor. the file can be opened by a MappedArray afterwards
+ *
+ * @par Example
+ * @snippet example_mapped.cpp mapped array writer
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ */
+template <class E>
+class MappedArrayWriter {
+  static_assert(std::is_trivially_copyable<E>::value,
+                "MappedArrayWriter type E must be trivially copyable");
+  static_assert(sizeof(E) == MappedElement<E>::rows * MappedElement<E>::cols *
+                                 sizeof(typename MappedElement<E>::value_type),
+                "MappedArrayWriter type E must only consist of its values");
+
+ public:
+  using value_type = E;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Construct a new MappedArrayWriter object. an existing file is
+   * overwritten
+   *
+   * @param path
+   * @exception std::runtime_error if the file can not be opened
+   */
+  explicit MappedArrayWriter(const std::string &path)
+      : file_(path, std::ios::binary | std::ios::trunc) {
+    if (!file_) {
+      throw std::runtime_error("MappedArrayWriter can not open " + path);
+    }
+    write_header();
+  }
+
+  MappedArrayWriter(const MappedArrayWriter &other) = delete;
+  MappedArrayWriter &operator=(const MappedArrayWriter &other) = delete;
+  MappedArrayWriter(MappedArrayWriter &&other) = default;
+
+  MappedArrayWriter &operator=(MappedArrayWriter &&other) {
+    /* the header of the current file must be complete */
+    close();
+    file_ = std::move(other.file_);
+    count_ = other.count_;
+    return *this;
+  }
+
+  /**
+   * @brief Destroy the MappedArrayWriter object. closes the file, errors are
+   * ignored. call close() to see them
+   */
+  ~MappedArrayWriter() {
+    try {
+      close();
+    } catch (...) {
+    }
+  }
+
+  /**
+   * @brief appends an element
+   *
+   * @param e
+   */
+  void push_back(const E &e) { write(&e, 1); }
+
+  /**
+   * @brief appends n elements
+   *
+   * @param first pointer to n elements
+   * @param n
+   * @exception std::runtime_error if the file can not be written
+   */
+  void write(const E *first, size_type n) {
+    file_.write(reinterpret_cast<const char *>(first),
+                static_cast<std::streamsize>(n * sizeof(E)));
+    if (!file_) {
+      throw std::runtime_error("MappedArrayWriter can not write");
+    }
+    count_ += n;
+  }
+
+  /**
+   * @brief number of elements that were written
+   *
+   * @return size_type
+   */
+  size_type size() const noexcept { return count_; }
+
+  /**
+   * @brief writes the number of elements into the header and closes the
+   * file. does nothing if it's already closed
+   *
+   * @exception std::runtime_error if the file can not be written
+   */
+  void close() {
+    if (!file_.is_open()) {
+      return;
+    }
+    file_.seekp(0);
+    write_header();
+    file_.close();
+    if (!file_) {
+      throw std::runtime_error("MappedArrayWriter can not write");
+    }
+  }
+
+ private:
+  std::ofstream file_;
+  size_type count_{0};
+
+  void write_header() {
+    const MappedHeader kHeader = MappedHeader::of<E>(count_);
+    file_.write(reinterpret_cast<const char *>(&kHeader), sizeof(kHeader));
+    if (!file_) {
+      throw std::runtime_error("MappedArrayWriter can not write");
+    }
+  }
+};
+
+}  // namespace mu
+
+#endif  // MU_MAPPED_H_
@@ -10,8 +10,9 @@
 #include <array>
 #include <cassert>
 #include <type_traits>
-#include <vector>
+#include <utility>
 
+#include "mu/gemm.h"
 #include "mu/typetraits.h"
 #include "mu/utility.h"
 #include "vector.h"
@@ -28,6 +29,16 @@ namespace mu {
  * - implementation-defined extended floating-point types including any
  *   cv-qualified variants. (float, double, long double)
  *
+ * like Vector, the constructors, element access, arithmetic operators, dot(),
+ * transposed(), mu::eye, mu::ones and mu::zeros etc. are constexpr, e.g. to
+ * calculate projection or lookup matrices at compile time
+ *
+ * the N * M values are stored contiguously, row by row (row-major). the
+ * elementwise operators and the reductions (min, max, sum, std ...) run a
+ * single loop over all values, see data()
+ *
+ * @par Example
+ * @snippet example_matrix.cpp matrix constant expression
  * @tparam N first matrix dimension (rows)
  * @tparam M second matrix dimension (columns)
  * @tparam T the type of the values inside the matrix
@@ -38,6 +49,8 @@ class Matrix {
   static_assert(M != 0, "second matrix dimension (columns) cannot be zero");
   static_assert(std::is_arithmetic<T>::value,
                 "Matrix type T must be an arithmetic type");
+  static_assert(sizeof(std::array<Vector<M, T>, N>) == N * M * sizeof(T),
+                "Matrix rows must be contiguous");
 
  public:
   /* value and size type from the underlying container */
@@ -55,6 +68,14 @@ class Matrix {
    */
   constexpr Matrix() = default;
 
+  /**
+   * @brief Construct a new Matrix object whose values are not initialized,
+   * not even in constant expressions
+   *
+   * for results that are overwritten completely at run time
+   */
+  explicit Matrix(mu::Uninitialized /*unused*/) {}
+
   /**
    * @brief Construct a new Matrix object from a number of NxM values
    *
@@ -73,7 +94,8 @@ class Matrix {
                          T, std::remove_reference_t<TArgs>>::value...>::value),
                 int> = 0>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Matrix(TArgs const(&&... rows)[M]) : data_{mu::to_array(rows)...} {}
+  constexpr Matrix(TArgs const(&&... rows)[M])
+      : data_{mu::to_array(rows)...} {}
 
   /**
    * @brief Construct a new Matrix from an existing Matrix of a different type
@@ -91,11 +113,12 @@ class Matrix {
    */
   template <std::size_t Nn, std::size_t Mm, class U>
   // NOLINTNEXTLINE(runtime/explicit) implicit conversion is intentional
-  Matrix(const Matrix<Nn, Mm, U> &m) {
+  constexpr Matrix(const Matrix<Nn, Mm, U> &m) : data_{} {
     static_assert(N == Nn, "Matrix dimension mismatch (rows)");
     static_assert(M == Mm, "Matrix dimension mismatch (columns)");
-    std::transform(m.begin(), m.end(), begin(),
-                   [](Vector<M, U> data) { return data; });
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = Vector<M, T>(m[i]);
+    }
   }
 
   /**
@@ -106,7 +129,7 @@ class Matrix {
    * @param a
    */
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Matrix(const std::array<Vector<M, T>, N> &a) : data_{a} {}
+  constexpr Matrix(const std::array<Vector<M, T>, N> &a) : data_{a} {}
 
   /**
    * @brief Construct a new Matrix object from an std::array of Vectors of a
@@ -122,9 +145,10 @@ class Matrix {
    */
   template <typename U = T>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Matrix(const std::array<Vector<M, U>, N> &a) {
-    std::transform(a.begin(), a.end(), begin(),
-                   [](Vector<M, U> data) { return data; });
+  constexpr Matrix(const std::array<Vector<M, U>, N> &a) : data_{} {
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = Vector<M, T>(a[i]);
+    }
   }
 
   /**
@@ -142,9 +166,10 @@ class Matrix {
   template <typename U = T,
             std::enable_if_t<std::is_arithmetic<U>::value, int> = 0>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Matrix(const std::array<std::array<U, M>, N> &a) {
-    std::transform(a.begin(), a.end(), begin(),
-                   [](Vector<M, U> data) { return data; });
+  constexpr Matrix(const std::array<std::array<U, M>, N> &a) : data_{} {
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = Vector<M, T>(a[i]);
+    }
   }
 
   /**
@@ -163,8 +188,10 @@ class Matrix {
   template <typename U = T,
             std::enable_if_t<std::is_arithmetic<U>::value, int> = 0>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Matrix(const U &value) {
-    data_.fill(value);
+  constexpr Matrix(const U &value) : data_{} {
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = Vector<M, T>(value);
+    }
   }
 
   /**
@@ -221,7 +248,11 @@ class Matrix {
    * @param idx
    * @return T&
    */
-  Vector<M, T> &operator[](size_type idx) noexcept { return data_[idx]; }
+  constexpr Vector<M, T> &operator[](size_type idx) noexcept {
+    /* see Vector::operator[] */
+    return const_cast<Vector<M, T> &>(
+        static_cast<const std::array<Vector<M, T>, N> &>(data_)[idx]);
+  }
 
   /**
    * @brief const access a row within the matrix
@@ -233,7 +264,7 @@ class Matrix {
    * @param idx
    * @return const T&
    */
-  const Vector<M, T> &operator[](size_type idx) const noexcept {
+  constexpr const Vector<M, T> &operator[](size_type idx) const noexcept {
     return data_[idx];
   }
 
@@ -291,6 +322,30 @@ class Matrix {
    */
   constexpr size_type n_cols() const noexcept { return M; }
 
+  /**
+   * @brief direct access to the values
+   *
+   * the N * M values are stored contiguously, row by row (row-major), i.e. the
+   * value [i][j] is at data()[i * M + j]. e.g. to hand the matrix to a kernel
+   * that takes a pointer and the dimensions without copying it
+   *
+   * @par Example
+   * @snippet example_matrix.cpp matrix data function
+   * @return T*
+   */
+  T *data() noexcept { return data_[0].data(); }
+
+  /**
+   * @brief const direct access to the values
+   *
+   * see data()
+   *
+   * @par Example
+   * @snippet example_matrix.cpp matrix data function
+   * @return const T*
+   */
+  const T *data() const noexcept { return data_[0].data(); }
+
   /**
    * @brief returns an iterator starting at the first row
    *
@@ -337,7 +392,7 @@ class Matrix {
    * @param idx
    * @return Vector<M, T>
    */
-  Vector<M, T> row(const size_type &idx) const {
+  constexpr Vector<M, T> row(const size_type &idx) const {
     /* runtime check for out-of-range. only in debug mode */
     assert(idx >= 0 && idx < N);
     return data_[idx];
@@ -353,10 +408,12 @@ class Matrix {
    * @param idx
    * @return Vector<N, T>
    */
-  Vector<N, T> col(const size_type &idx) const {
+  constexpr Vector<N, T> col(const size_type &idx) const {
     /* runtime check for out-of-range. only in debug mode */
     assert(idx >= 0 && idx < M);
-    Vector<N, T> ret;
+    Vector<N, T> ret = mu::is_constant_evaluated()
+                       ? Vector<N, T>{}
+                       : Vector<N, T>(mu::uninitialized);
     for (std::size_t i = 0; i < N; i++) {
       ret[i] = data_[i][idx];
     }
@@ -370,10 +427,18 @@ class Matrix {
    * @snippet example_matrix.cpp matrix min function
    * @return T
    */
-  T min() const {
-    T ret(data_[0][0]);
-    for (const auto &row : data_) {
-      ret = mu::min(ret, mu::min(row));
+  constexpr T min() const {
+    if (mu::is_constant_evaluated()) {
+      T ret(data_[0][0]);
+      for (std::size_t i = 0; i < N; i++) {
+        ret = mu::min(ret, mu::min(data_[i]));
+      }
+      return ret;
+    }
+    const T *values = data();
+    T ret(values[0]);
+    for (std::size_t i = 1; i < N * M; i++) {
+      ret = mu::min(ret, values[i]);
     }
     return ret;
   }
@@ -385,10 +450,18 @@ class Matrix {
    * @snippet example_matrix.cpp matrix max function
    * @return T
    */
-  T max() const {
-    T ret(data_[0][0]);
-    for (const auto &row : data_) {
-      ret = mu::max(ret, mu::max(row));
+  constexpr T max() const {
+    if (mu::is_constant_evaluated()) {
+      T ret(data_[0][0]);
+      for (std::size_t i = 0; i < N; i++) {
+        ret = mu::max(ret, mu::max(data_[i]));
+      }
+      return ret;
+    }
+    const T *values = data();
+    T ret(values[0]);
+    for (std::size_t i = 1; i < N * M; i++) {
+      ret = mu::max(ret, values[i]);
     }
     return ret;
   }
@@ -400,10 +473,17 @@ class Matrix {
    * @snippet example_matrix.cpp matrix sum function
    * @return T
    */
-  T sum() const {
+  constexpr T sum() const {
     T ret{};
-    for (const auto &row : data_) {
-      ret += mu::sum(row);
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        ret += mu::sum(data_[i]);
+      }
+      return ret;
+    }
+    const T *values = data();
+    for (std::size_t i = 0; i < N * M; i++) {
+      ret += values[i];
     }
     return ret;
   }
@@ -420,7 +500,7 @@ class Matrix {
    * @return U
    */
   template <typename U = T>
-  U mean() const {
+  constexpr U mean() const {
     return U(sum()) / (N * M);
   }
 
@@ -439,9 +519,11 @@ class Matrix {
    * @snippet example_matrix.cpp matrix diag function
    * @return Vector<N,T> or Vector<M,T>
    */
-  auto diag() const {
+  constexpr auto diag() const {
     constexpr std::size_t s = N < M ? N : M;
-    Vector<s, T> ret;
+    Vector<s, T> ret = mu::is_constant_evaluated()
+                       ? Vector<s, T>{}
+                       : Vector<s, T>(mu::uninitialized);
     for (std::size_t i = 0; i < s; i++) {
       ret[i] = data_[i][i];
     }
@@ -453,6 +535,10 @@ class Matrix {
    *
    * matrix must be symmetrical with N == M
    *
+   * sizes up to 4x4 are calculated in closed form, larger sizes by LU
+   * decomposition (floating point types) or fraction-free gaussian elimination
+   * (integral types) in O(N^3). no memory is allocated
+   *
    * @par Example
    * @snippet example_matrix.cpp matrix det function
    * @return T
@@ -460,14 +546,39 @@ class Matrix {
   T det() const {
     static_assert(N == M,
                   "Matrix dimensions must match to calculate the determinant");
-    std::vector<std::vector<T>> vv;
-    for (std::size_t i = 0; i < N; i++) {
-      vv.push_back(std::vector<T>());
-      for (const auto &item : data_[i]) {
-        vv[i].push_back(item);
-      }
-    }
-    return calc_det(vv);
+    return mu::calc_det(data_);
+  }
+
+  /**
+   * @brief calculates the inverse of the matrix
+   *
+   * matrix must be symmetrical with N == M
+   *
+   * sizes up to 4x4 are calculated in closed form, larger sizes by LU
+   * decomposition with partial pivoting in O(N^3). the result of a singular
+   * matrix contains infinite or NaN values. see mu::LU in solve.h to check
+   * for singularity and to reuse the decomposition
+   *
+   * the return type must be a floating point type. it's the type of this
+   * matrix by default
+   *
+   * @par Example
+   * @snippet example_matrix.cpp matrix inverse function
+   * @tparam U
+   * @return Matrix<N, N, U>
+   */
+  template <typename U = T>
+  Matrix<N, N, U> inverse() const {
+    static_assert(N == M,
+                  "Matrix dimensions must match to calculate the inverse");
+    static_assert(std::is_floating_point<U>::value,
+                  "the inverse can only be calculated for floating point "
+                  "types. please specify the return type. e.g. "
+                  "\"mat.inverse<float>();\"");
+    const Matrix<N, N, U> kCopy(*this);
+    Matrix<N, N, U> ret;
+    mu::calc_inverse<U, N>(kCopy, ret);
+    return ret;
   }
 
   /**
@@ -478,7 +589,7 @@ class Matrix {
    * @par Example
    * @snippet example_matrix.cpp matrix transpose function
    */
-  void transpose() {
+  constexpr void transpose() {
     static_assert(
         N == M,
         "Matrix dimensions must match to transpose this object. For Matrices "
@@ -487,7 +598,7 @@ class Matrix {
     Matrix<N, M, T> copy = data_;
     for (std::size_t i = 0; i < N; i++) {
       for (std::size_t j = 0; j < M; j++) {
-        data_[j][i] = copy[i][j];
+        (*this)[j][i] = copy[i][j];
       }
     }
   }
@@ -499,8 +610,10 @@ class Matrix {
    * @snippet example_matrix.cpp matrix transposed function
    * @return Matrix<M, N, T>
    */
-  Matrix<M, N, T> transposed() const {
-    Matrix<M, N, T> ret;
+  constexpr Matrix<M, N, T> transposed() const {
+    Matrix<M, N, T> ret = mu::is_constant_evaluated()
+                          ? Matrix<M, N, T>{}
+                          : Matrix<M, N, T>(mu::uninitialized);
     for (std::size_t i = 0; i < N; i++) {
       for (std::size_t j = 0; j < M; j++) {
         ret[j][i] = data_[i][j];
@@ -533,6 +646,10 @@ class Matrix {
    * (M) and the second Matrix's second dimension (P) containing the type of the
    * two objects or else of the explicitly stated type
    *
+   * Larger matrices are multiplied block by block, so that the blocks stay in
+   * the cache, with the inner loop running along the rows of both matrices
+   * (see mu::gemm). The result is the same as the one of the textbook loop
+   *
    * @ref https://en.wikipedia.org/wiki/Matrix_multiplication#Definition
    * @par Example
    * @snippet example_matrix.cpp matrix matrix dot function
@@ -545,8 +662,8 @@ class Matrix {
    * Matrix<N, M2, U>>
    */
   template <typename U = void, std::size_t N2, std::size_t M2, typename T2>
-  std::conditional_t<std::is_same<U, void>::value, Matrix<N, M2, T>,
-                     Matrix<N, M2, U>>
+  constexpr std::conditional_t<std::is_same<U, void>::value, Matrix<N, M2, T>,
+                               Matrix<N, M2, U>>
   dot(const Matrix<N2, M2, T2> &rhs) const {
     static_assert(
         M == N2,
@@ -556,15 +673,14 @@ class Matrix {
     static_assert(!std::is_same<U_, void>::value,
                   "Matrix types are different. please specify the return "
                   "type. e.g. \"mat1.dot<float>(mat2);\"");
-    Matrix<N, M2, U_> ret;
-    for (std::size_t i = 0; i < N; i++) {
-      for (std::size_t j = 0; j < M2; j++) {
-        U_ sum{0};
-        for (std::size_t k = 0; k < M; k++) {
-          sum += (data_[i][k] * rhs[k][j]);
-        }
-        ret[i][j] = sum;
-      }
+    Matrix<N, M2, U_> ret = mu::is_constant_evaluated()
+                            ? Matrix<N, M2, U_>{}
+                            : Matrix<N, M2, U_>(mu::uninitialized);
+    /* the blocked kernel can't be evaluated at compile time */
+    if (mu::is_constant_evaluated()) {
+      mu::gemm_naive<N, M, M2, U_>(data_, rhs, ret);
+    } else {
+      mu::gemm<N, M, M2, U_>(data_, rhs, ret);
     }
     return ret;
   }
@@ -601,7 +717,8 @@ class Matrix {
    * Vector<N, U>>
    */
   template <typename U = void, std::size_t N2, typename T2>
-  std::conditional_t<std::is_same<U, void>::value, Vector<N, T>, Vector<N, U>>
+  constexpr std::conditional_t<std::is_same<U, void>::value, Vector<N, T>,
+                               Vector<N, U>>
   dot(const Vector<N2, T2> &rhs) const {
     static_assert(
         M == N2,
@@ -612,7 +729,9 @@ class Matrix {
         !std::is_same<U_, void>::value,
         "Matrix and Vector types are different. please specify the return "
         "type. e.g. \"mat.dot<float>(vec);\"");
-    Vector<N, U_> ret;
+    Vector<N, U_> ret = mu::is_constant_evaluated()
+                        ? Vector<N, U_>{}
+                        : Vector<N, U_>(mu::uninitialized);
     for (std::size_t i = 0; i < N; i++) {
       U_ sum{0};
       for (std::size_t k = 0; k < M; k++) {
@@ -623,10 +742,34 @@ class Matrix {
     return ret;
   }
 
+  /**
+   * @brief calculates the (population) variance
+   *
+   * \f$ \sigma^2 = \frac{\sum(x_ij - \mu)^2}{N M} \f$
+   *
+   * for a floating point return type, the mean and the variance are
+   * calculated together in a single, numerically stable pass (Welford).
+   * integral return types use the integral mean
+   *
+   * @par Example
+   * @snippet example_matrix.cpp matrix variance function
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U variance() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return m2 / (N * M);
+  }
+
   /**
    * @brief calculates the standard deviation
    *
-   * \f$ \sigma = \sqrt{\frac{\sum(x_ij - \mu)^2}{N}} \f$
+   * \f$ \sigma = \sqrt{\frac{\sum(x_ij - \mu)^2}{N M}} \f$
+   *
+   * see variance()
    *
    * @par Example
    * @snippet example_matrix.cpp matrix std function
@@ -635,14 +778,25 @@ class Matrix {
    */
   template <class U = T>
   U std() const {
-    U sum{0};
-    U m = mean<U>();
-    for (const auto &row : data_) {
-      for (const auto &item : row) {
-        sum += mu::pow(item - m, 2);
-      }
-    }
-    return U(mu::sqrt(sum / (N * M)));
+    return U(mu::sqrt(variance<U>()));
+  }
+
+  /**
+   * @brief calculates the mean and the standard deviation
+   *
+   * both from the same single pass over the elements. see variance()
+   *
+   * @par Example
+   * @snippet example_matrix.cpp matrix mean_and_std function
+   * @tparam U
+   * @return std::pair<U, U> mean (first) and standard deviation (second)
+   */
+  template <class U = T>
+  std::pair<U, U> mean_and_std() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return {m, U(mu::sqrt(m2 / (N * M)))};
   }
 
   /********************************* I/O ***********************************/
@@ -674,7 +828,7 @@ class Matrix {
    * @return bool true if equal, false if unequal
    */
   template <typename U = T>
-  bool operator==(const Matrix<N, M, U> &rhs) const {
+  constexpr bool operator==(const Matrix<N, M, U> &rhs) const {
     for (std::size_t i = 0; i < N; i++) {
       /* forward comparison to Vector class */
       if (data_[i] != rhs[i]) {
@@ -691,7 +845,7 @@ class Matrix {
    * @return bool true if unequal, false if equal
    */
   template <typename U = T>
-  bool operator!=(const Matrix<N, M, U> &rhs) const {
+  constexpr bool operator!=(const Matrix<N, M, U> &rhs) const {
     return !operator==(rhs);
   }
 
@@ -705,10 +859,8 @@ class Matrix {
    * @return Matrix<N, M, T>&
    */
   template <typename U = T>
-  Matrix<N, M, T> &operator+=(const Matrix<N, M, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] += rhs[i];
-    }
+  constexpr Matrix<N, M, T> &operator+=(const Matrix<N, M, U> &rhs) {
+    apply<mu::SimdAdd>(rhs);
     return *this;
   }
 
@@ -722,10 +874,8 @@ class Matrix {
    * @return Matrix<N, M, T>&
    */
   template <typename U = T>
-  Matrix<N, M, T> &operator-=(const Matrix<N, M, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] -= rhs[i];
-    }
+  constexpr Matrix<N, M, T> &operator-=(const Matrix<N, M, U> &rhs) {
+    apply<mu::SimdSub>(rhs);
     return *this;
   }
 
@@ -739,10 +889,8 @@ class Matrix {
    * @return Matrix<N, M, T>&
    */
   template <typename U = T>
-  Matrix<N, M, T> &operator*=(const Matrix<N, M, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] *= rhs[i];
-    }
+  constexpr Matrix<N, M, T> &operator*=(const Matrix<N, M, U> &rhs) {
+    apply<mu::SimdMul>(rhs);
     return *this;
   }
 
@@ -756,10 +904,8 @@ class Matrix {
    * @return Matrix<N, M, T>&
    */
   template <typename U = T>
-  Matrix<N, M, T> &operator/=(const Matrix<N, M, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] /= rhs[i];
-    }
+  constexpr Matrix<N, M, T> &operator/=(const Matrix<N, M, U> &rhs) {
+    apply<mu::SimdDiv>(rhs);
     return *this;
   }
 
@@ -778,12 +924,10 @@ class Matrix {
    * &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                            Matrix<N, M, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Matrix<N, M, T> &>
   operator+=(const TScalar &scalar) {
-    for (auto &row : data_) {
-      row += scalar;
-    }
+    apply_scalar<mu::SimdAdd>(scalar);
     return *this;
   }
 
@@ -796,12 +940,10 @@ class Matrix {
    * T> &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                            Matrix<N, M, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Matrix<N, M, T> &>
   operator-=(const TScalar &scalar) {
-    for (auto &row : data_) {
-      row -= scalar;
-    }
+    apply_scalar<mu::SimdSub>(scalar);
     return *this;
   }
 
@@ -814,12 +956,10 @@ class Matrix {
    * &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                            Matrix<N, M, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Matrix<N, M, T> &>
   operator*=(const TScalar &scalar) {
-    for (auto &row : data_) {
-      row *= scalar;
-    }
+    apply_scalar<mu::SimdMul>(scalar);
     return *this;
   }
 
@@ -834,13 +974,14 @@ class Matrix {
    * T> &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                            Matrix<N, M, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Matrix<N, M, T> &>
   operator/=(const TScalar &scalar) {
-    /* a division by zero is forwarded to and handled by the Vector class */
-    for (auto &row : data_) {
-      row /= scalar;
+    /* a division by zero is seen as harmful, see Vector. debug mode only */
+    if (std::is_integral<TScalar>::value) {
+      assert(scalar != static_cast<TScalar>(0));
     }
+    apply_scalar<mu::SimdDiv>(scalar);
     return *this;
   }
 
@@ -848,6 +989,57 @@ class Matrix {
 
  protected:
   std::array<Vector<M, T>, N> data_;
+
+ private:
+  /* lhs[i][j] op= rhs[i][j] as a single loop over all N * M values. the SIMD
+   * kernels can't be evaluated at compile time, so constant expressions use
+   * the portable loop */
+  template <class TOp, class U>
+  constexpr void apply(const Matrix<N, M, U> &rhs) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        for (std::size_t j = 0; j < M; j++) {
+          TOp::scalar((*this)[i][j], rhs[i][j]);
+        }
+      }
+    } else {
+      mu::simd_apply<TOp, N * M>(data(), rhs.data());
+    }
+  }
+
+  /* lhs[i][j] op= scalar. see apply() */
+  template <class TOp, class TScalar>
+  constexpr void apply_scalar(const TScalar &scalar) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        for (std::size_t j = 0; j < M; j++) {
+          TOp::scalar((*this)[i][j], scalar);
+        }
+      }
+    } else {
+      mu::simd_apply_scalar<TOp, N * M>(data(), scalar);
+    }
+  }
+
+  /* mean and sum of squared differences from the mean in a single pass over
+   * all N * M values */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::true_type /*floating point*/) const {
+    mu::simd_mean_m2(data(), N * M, m, m2);
+  }
+
+  /* the integral mean is truncated, so the differences need a second pass */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::false_type /*floating point*/) const {
+    m = mean<U>();
+    m2 = U{0};
+    const T *values = data();
+    for (std::size_t i = 0; i < N * M; i++) {
+      m2 += mu::pow(values[i] - m, 2);
+    }
+  }
 };
 
 /********************************** I/O ************************************/
@@ -881,8 +1073,8 @@ std::ostream &operator<<(std::ostream &os, const Matrix<Nn, Mm, U> &m) {
  * @return Matrix<N, M, T>
  */
 template <std::size_t N, std::size_t M, class T, class U = T>
-inline Matrix<N, M, T> operator+(const Matrix<N, M, T> &lhs,
-                                 const Matrix<N, M, U> &rhs) {
+constexpr Matrix<N, M, T> operator+(const Matrix<N, M, T> &lhs,
+                                    const Matrix<N, M, U> &rhs) {
   return Matrix<N, M, T>(lhs) += rhs;
 }
 
@@ -898,8 +1090,8 @@ inline Matrix<N, M, T> operator+(const Matrix<N, M, T> &lhs,
  * @return Matrix<N, M, T>
  */
 template <std::size_t N, std::size_t M, class T, class U = T>
-inline Matrix<N, M, T> operator-(const Matrix<N, M, T> &lhs,
-                                 const Matrix<N, M, U> &rhs) {
+constexpr Matrix<N, M, T> operator-(const Matrix<N, M, T> &lhs,
+                                    const Matrix<N, M, U> &rhs) {
   return Matrix<N, M, T>(lhs) -= rhs;
 }
 
@@ -915,8 +1107,8 @@ inline Matrix<N, M, T> operator-(const Matrix<N, M, T> &lhs,
  * @return Matrix<N, M, T>
  */
 template <std::size_t N, std::size_t M, class T, class U = T>
-inline Matrix<N, M, T> operator*(const Matrix<N, M, T> &lhs,
-                                 const Matrix<N, M, U> &rhs) {
+constexpr Matrix<N, M, T> operator*(const Matrix<N, M, T> &lhs,
+                                    const Matrix<N, M, U> &rhs) {
   return Matrix<N, M, T>(lhs) *= rhs;
 }
 
@@ -932,8 +1124,8 @@ inline Matrix<N, M, T> operator*(const Matrix<N, M, T> &lhs,
  * @return Matrix<N, M, T>
  */
 template <std::size_t N, std::size_t M, class T, class U = T>
-inline Matrix<N, M, T> operator/(const Matrix<N, M, T> &lhs,
-                                 const Matrix<N, M, U> &rhs) {
+constexpr Matrix<N, M, T> operator/(const Matrix<N, M, T> &lhs,
+                                    const Matrix<N, M, U> &rhs) {
   return Matrix<N, M, T>(lhs) /= rhs;
 }
 
@@ -953,7 +1145,7 @@ inline Matrix<N, M, T> operator/(const Matrix<N, M, T> &lhs,
  */
 template <std::size_t N, std::size_t M, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Matrix<N, M, T>> inline
+                          Matrix<N, M, T>> constexpr
 operator+(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
   return Matrix<N, M, T>(lhs) += rhs;
 }
@@ -972,7 +1164,7 @@ operator+(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
  */
 template <std::size_t N, std::size_t M, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Matrix<N, M, T>> inline
+                          Matrix<N, M, T>> constexpr
 operator+(const TScalar &lhs, const Matrix<N, M, T> &rhs) {
   return Matrix<N, M, T>(rhs) += lhs;
 }
@@ -989,7 +1181,7 @@ operator+(const TScalar &lhs, const Matrix<N, M, T> &rhs) {
  */
 template <std::size_t N, std::size_t M, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Matrix<N, M, T>> inline
+                          Matrix<N, M, T>> constexpr
 operator-(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
   return Matrix<N, M, T>(lhs) -= rhs;
 }
@@ -1008,7 +1200,7 @@ operator-(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
  */
 template <std::size_t N, std::size_t M, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Matrix<N, M, T>> inline
+                          Matrix<N, M, T>> constexpr
 operator*(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
   return Matrix<N, M, T>(lhs) *= rhs;
 }
@@ -1027,7 +1219,7 @@ operator*(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
  */
 template <std::size_t N, std::size_t M, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Matrix<N, M, T>> inline
+                          Matrix<N, M, T>> constexpr
 operator*(const TScalar &lhs, const Matrix<N, M, T> &rhs) {
   return Matrix<N, M, T>(rhs) *= lhs;
 }
@@ -1044,7 +1236,7 @@ operator*(const TScalar &lhs, const Matrix<N, M, T> &rhs) {
  */
 template <std::size_t N, std::size_t M, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Matrix<N, M, T>> inline
+                          Matrix<N, M, T>> constexpr
 operator/(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
   return Matrix<N, M, T>(lhs) /= rhs;
 }
@@ -1052,30 +1244,30 @@ operator/(const Matrix<N, M, T> &lhs, const TScalar &rhs) {
 /************************* convenience functions ***************************/
 
 template <std::size_t N, std::size_t M, class T>
-inline T min(const Matrix<N, M, T> &m) {
+constexpr T min(const Matrix<N, M, T> &m) {
   return m.min();
 }
 
 template <std::size_t N, std::size_t M, class T>
-inline T max(const Matrix<N, M, T> &m) {
+constexpr T max(const Matrix<N, M, T> &m) {
   return m.max();
 }
 
 template <std::size_t N, std::size_t M, class T>
-inline T sum(const Matrix<N, M, T> &m) {
+constexpr T sum(const Matrix<N, M, T> &m) {
   return m.sum();
 }
 
 template <class U = void, std::size_t N, std::size_t M, typename T>
-inline std::conditional_t<std::is_same<U, void>::value, T, U> mean(
+constexpr std::conditional_t<std::is_same<U, void>::value, T, U> mean(
     const Matrix<N, M, T> &m) {
   return m
       .template mean<std::conditional_t<std::is_same<U, void>::value, T, U>>();
 }
 
 template <std::size_t N, std::size_t M, typename T>
-    std::conditional_t <
-    N<M, Vector<N, T>, Vector<M, T>> diag(const Matrix<N, M, T> &m) {
+constexpr std::conditional_t<(N < M), Vector<N, T>, Vector<M, T>> diag(
+    const Matrix<N, M, T> &m) {
   return m.diag();
 }
 
@@ -1090,7 +1282,7 @@ template <std::size_t N, std::size_t M, typename T>
  * @return Matrix<N, N, T>
  */
 template <std::size_t N, typename T>
-inline Matrix<N, N, T> diag(const Vector<N, T> &v) {
+constexpr Matrix<N, N, T> diag(const Vector<N, T> &v) {
   Matrix<N, N, T> ret{};
   for (std::size_t i = 0; i < N; i++) {
     ret[i][i] = v[i];
@@ -1103,34 +1295,42 @@ T det(const Matrix<N, M, T> &m) {
   return m.det();
 }
 
+template <typename U = void, std::size_t N, std::size_t M, typename T>
+Matrix<N, N, std::conditional_t<std::is_same<U, void>::value, T, U>> inverse(
+    const Matrix<N, M, T> &m) {
+  return m.template inverse<
+      std::conditional_t<std::is_same<U, void>::value, T, U>>();
+}
+
 template <std::size_t N, std::size_t M, typename T>
 // NOLINTNEXTLINE(runtime/references) intentional non-const reference
-inline void transpose(Matrix<N, M, T> &m) {
+constexpr void transpose(Matrix<N, M, T> &m) {
   m.transpose();
 }
 
 template <std::size_t N, std::size_t M, typename T>
-Matrix<M, N, T> transposed(const Matrix<N, M, T> &m) {
+constexpr Matrix<M, N, T> transposed(const Matrix<N, M, T> &m) {
   return m.transposed();
 }
 
 template <typename U = void, std::size_t N1, std::size_t M1, typename T1,
           std::size_t N2, std::size_t M2, typename T2>
-std::conditional_t<std::is_same<U, void>::value, Matrix<N1, M2, T1>,
-                   Matrix<N1, M2, U>>
+constexpr std::conditional_t<std::is_same<U, void>::value, Matrix<N1, M2, T1>,
+                             Matrix<N1, M2, U>>
 dot(const Matrix<N1, M1, T1> &lhs, const Matrix<N2, M2, T2> &rhs) {
   return lhs.template dot<U>(rhs);
 }
 
 template <typename U = void, std::size_t N, std::size_t M, typename T,
           std::size_t N2, typename T2>
-std::conditional_t<std::is_same<U, void>::value, Vector<N, T>, Vector<N, U>>
+constexpr std::conditional_t<std::is_same<U, void>::value, Vector<N, T>,
+                             Vector<N, U>>
 dot(const Matrix<N, M, T> &lhs, const Vector<N2, T2> &rhs) {
   return lhs.template dot<U>(rhs);
 }
 
 template <std::size_t S, typename T = int>
-inline Matrix<S, S, T> eye() {
+constexpr Matrix<S, S, T> eye() {
   Matrix<S, S, T> ret{};
   for (std::size_t i = 0; i < S; i++) {
     ret[i][i] = T{1};
@@ -1139,12 +1339,12 @@ inline Matrix<S, S, T> eye() {
 }
 
 template <std::size_t N, std::size_t M, typename T = int>
-inline Matrix<N, M, T> ones() {
+constexpr Matrix<N, M, T> ones() {
   return Matrix<N, M, T>{T{1}};
 }
 
 template <std::size_t N, std::size_t M, typename T = int>
-inline Matrix<N, M, T> zeros() {
+constexpr Matrix<N, M, T> zeros() {
   return Matrix<N, M, T>{T{0}};
 }
 
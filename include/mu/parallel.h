@@ -0,0 +1,524 @@
+/**
+ * @file parallel.h
+ *
+ * thread pool and parallel algorithms
+ */
+#ifndef MU_PARALLEL_H_
+#define MU_PARALLEL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mu {
+namespace parallel {
+
+/**
+ * @brief work stealing thread pool
+ *
+ * every worker thread has its own queue of tasks. a worker takes the newest
+ * task from its own queue (it's most likely still in the cache) and, if that
+ * is empty, steals the oldest task from the queue of another worker.
+ *
+ * tasks that are submitted by a worker go to its own queue, other tasks are
+ * distributed round robin.
+ *
+ * a thread that waits for tasks to finish should help executing the queued
+ * tasks (see run_pending()) instead of blocking. this way the pool can be used
+ * from within its own tasks (nested) without a deadlock.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Construct a new ThreadPool object
+   *
+   * with zero threads, every task is run by the thread that waits for it
+   *
+   * @param threads number of worker threads
+   */
+  explicit ThreadPool(std::size_t threads = default_threads())
+      : queues_(threads) {
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; i++) {
+      workers_.emplace_back([this, i] { work(i); });
+    }
+  }
+
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool &operator=(const ThreadPool &other) = delete;
+
+  /**
+   * @brief Destroy the ThreadPool object
+   *
+   * the remaining tasks are executed before the worker threads are joined
+   */
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /**
+   * @brief number of worker threads
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const noexcept { return workers_.size(); }
+
+  /**
+   * @brief queues a task
+   *
+   * @par Example
+   * @snippet example_parallel.cpp parallel threadpool submit function
+   * @tparam F
+   * @param f callable without arguments
+   */
+  template <class F>
+  void submit(F &&f) {
+    if (queues_.empty()) {
+      /* nobody else would run it */
+      f();
+      return;
+    }
+    std::size_t idx = worker_index();
+    if (idx >= queues_.size()) {
+      idx = next_queue_++ % queues_.size();
+    }
+    {
+      /* same lock order as pop() */
+      std::lock_guard<std::mutex> lock(queues_[idx].mutex);
+      queues_[idx].tasks.emplace_back(std::forward<F>(f));
+      std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+      queued_++;
+    }
+    wake_.notify_one();
+  }
+
+  /**
+   * @brief executes one queued task on the calling thread
+   *
+   * @return true if a task was executed
+   * @return false if there was no task
+   */
+  bool run_pending() {
+    std::function<void()> task;
+    if (!pop(worker_index(), &task)) {
+      return false;
+    }
+    task();
+    return true;
+  }
+
+  /**
+   * @brief default number of worker threads
+   *
+   * one less than the number of hardware threads, since the calling thread
+   * helps executing the tasks
+   *
+   * @return std::size_t
+   */
+  static std::size_t default_threads() {
+    const std::size_t kHardware = std::thread::hardware_concurrency();
+    return kHardware > 1 ? kHardware - 1 : 0;
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<Queue> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> next_queue_{0};
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+  std::size_t queued_ = 0;
+  bool stop_ = false;
+
+  /* index of the worker thread of this pool that calls this function. any
+   * other thread gets an index that is out of range */
+  std::size_t worker_index() const {
+    const std::pair<const ThreadPool *, std::size_t> &kCurrent = current();
+    return kCurrent.first == this ? kCurrent.second : queues_.size();
+  }
+
+  static std::pair<const ThreadPool *, std::size_t> &current() {
+    static thread_local std::pair<const ThreadPool *, std::size_t> current{
+        nullptr, 0};
+    return current;
+  }
+
+  /* newest task of the own queue or the oldest task of any other queue */
+  bool pop(std::size_t idx, std::function<void()> *task) {
+    for (std::size_t i = 0; i < queues_.size(); i++) {
+      const bool kOwn = (i == 0 && idx < queues_.size());
+      Queue &queue = queues_[(idx + i) % queues_.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) {
+        continue;
+      }
+      if (kOwn) {
+        *task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        *task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+      queued_--;
+      return true;
+    }
+    return false;
+  }
+
+  void work(std::size_t idx) {
+    current() = {this, idx};
+    std::function<void()> task;
+    while (true) {
+      if (pop(idx, &task)) {
+        task();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      wake_.wait(lock, [this] { return stop_ || queued_ > 0; });
+      if (stop_ && queued_ == 0) {
+        return;
+      }
+    }
+  }
+};
+
+/**
+ * @brief the thread pool that is used if none is given explicitly
+ *
+ * created on first use with ThreadPool::default_threads() threads
+ *
+ * @return ThreadPool&
+ */
+inline ThreadPool &default_pool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+/**
+ * @brief number of bytes of the input that one task works on
+ *
+ * the data of a task fits into the L1 data cache of common processors (32 KiB
+ * and more). smaller chunks only add scheduling overhead, larger chunks
+ * balance the work worse between the threads
+ */
+constexpr std::size_t kChunkBytes = 32 * 1024;
+
+/**
+ * @brief number of elements of a type that one task works on
+ *
+ * @tparam T element type
+ * @return std::size_t at least 1
+ */
+template <class T>
+constexpr std::size_t chunk_size() {
+  return sizeof(T) < kChunkBytes ? kChunkBytes / sizeof(T) : 1;
+}
+
+/**
+ * @brief calls f(begin, end) for consecutive chunks of [0, count) in parallel
+ *
+ * the calling thread works on the chunks too and returns when all chunks are
+ * done. the first exception that is thrown by f is rethrown
+ *
+ * @par Example
+ * @snippet example_parallel.cpp parallel for_chunks function
+ * @tparam F
+ * @param pool
+ * @param count
+ * @param chunk number of elements per chunk
+ * @param f callable with the arguments (std::size_t begin, std::size_t end)
+ */
+template <class F>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+void for_chunks(ThreadPool &pool, std::size_t count, std::size_t chunk, F f) {
+  chunk = std::max<std::size_t>(chunk, 1);
+  const std::size_t kChunks = (count + chunk - 1) / chunk;
+  if (kChunks == 0) {
+    return;
+  }
+  /* the state is shared by the calling thread and the helpers. every helper
+   * takes the next chunk until there are none left */
+  struct State {
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> running{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  } state;
+  auto run = [&state, &f, count, chunk, kChunks] {
+    for (std::size_t c = state.next++; c < kChunks; c = state.next++) {
+      try {
+        f(c * chunk, std::min(count, (c + 1) * chunk));
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(state.error_mutex);
+        if (!state.error) {
+          state.error = std::current_exception();
+        }
+      }
+    }
+  };
+  const std::size_t kHelpers = std::min(pool.size(), kChunks - 1);
+  state.running = kHelpers;
+  for (std::size_t i = 0; i < kHelpers; i++) {
+    pool.submit([&state, &run] {
+      run();
+      state.running--;
+    });
+  }
+  run();
+  /* a helper that didn't start yet might be queued behind other tasks */
+  while (state.running > 0) {
+    if (!pool.run_pending()) {
+      std::this_thread::yield();
+    }
+  }
+  if (state.error) {
+    std::rethrow_exception(state.error);
+  }
+}
+
+/**
+ * @brief calls f(begin, end) for consecutive chunks of [0, count) in parallel
+ *
+ * uses the default pool
+ *
+ * @tparam F
+ * @param count
+ * @param chunk number of elements per chunk
+ * @param f callable with the arguments (std::size_t begin, std::size_t end)
+ */
+template <class F>
+void for_chunks(std::size_t count, std::size_t chunk, F f) {
+  for_chunks(default_pool(), count, chunk, std::move(f));
+}
+
+/**
+ * @brief applies a function to every element of a range in parallel
+ *
+ * e.g. to update a std::vector of Vectors in-place
+ *
+ * @par Example
+ * @snippet example_parallel.cpp parallel for_each function
+ * @tparam TIt random access iterator
+ * @tparam F
+ * @param pool
+ * @param first
+ * @param last
+ * @param f callable with a single element as argument
+ */
+template <class TIt, class F>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+void for_each(ThreadPool &pool, TIt first, TIt last, F f) {
+  using T = typename std::iterator_traits<TIt>::value_type;
+  const auto kCount = static_cast<std::size_t>(std::distance(first, last));
+  for_chunks(pool, kCount, chunk_size<T>(),
+             [first, &f](std::size_t begin, std::size_t end) {
+               std::for_each(first + begin, first + end, f);
+             });
+}
+
+/**
+ * @brief applies a function to every element of a range in parallel
+ *
+ * uses the default pool
+ *
+ * @tparam TIt random access iterator
+ * @tparam F
+ * @param first
+ * @param last
+ * @param f callable with a single element as argument
+ */
+template <class TIt, class F>
+void for_each(TIt first, TIt last, F f) {
+  for_each(default_pool(), first, last, std::move(f));
+}
+
+/**
+ * @brief applies a function to every element of a range and writes the
+ * results to another range in parallel
+ *
+ * e.g. batched transposed() or det()
+ *
+ * @par Example
+ * @snippet example_parallel.cpp parallel transform function
+ * @tparam TIt random access iterator
+ * @tparam TOutIt random access iterator
+ * @tparam F
+ * @param pool
+ * @param first
+ * @param last
+ * @param out
+ * @param f callable with a single element as argument
+ * @return TOutIt iterator past the last written element
+ */
+template <class TIt, class TOutIt, class F>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+TOutIt transform(ThreadPool &pool, TIt first, TIt last, TOutIt out, F f) {
+  using T = typename std::iterator_traits<TIt>::value_type;
+  const auto kCount = static_cast<std::size_t>(std::distance(first, last));
+  for_chunks(pool, kCount, chunk_size<T>(),
+             [first, out, &f](std::size_t begin, std::size_t end) {
+               std::transform(first + begin, first + end, out + begin, f);
+             });
+  return out + kCount;
+}
+
+/**
+ * @brief applies a function to every element of a range and writes the
+ * results to another range in parallel
+ *
+ * uses the default pool
+ *
+ * @tparam TIt random access iterator
+ * @tparam TOutIt random access iterator
+ * @tparam F
+ * @param first
+ * @param last
+ * @param out
+ * @param f callable with a single element as argument
+ * @return TOutIt iterator past the last written element
+ */
+template <class TIt, class TOutIt, class F>
+TOutIt transform(TIt first, TIt last, TOutIt out, F f) {
+  return transform(default_pool(), first, last, out, std::move(f));
+}
+
+/**
+ * @brief applies a function to every pair of elements of two ranges and writes
+ * the results to another range in parallel
+ *
+ * e.g. batched dot()
+ *
+ * @par Example
+ * @snippet example_parallel.cpp parallel binary transform function
+ * @tparam TIt1 random access iterator
+ * @tparam TIt2 random access iterator
+ * @tparam TOutIt random access iterator
+ * @tparam F
+ * @param pool
+ * @param first1
+ * @param last1
+ * @param first2
+ * @param out
+ * @param f callable with two elements as arguments
+ * @return TOutIt iterator past the last written element
+ */
+template <class TIt1, class TIt2, class TOutIt, class F>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+TOutIt transform(ThreadPool &pool, TIt1 first1, TIt1 last1, TIt2 first2,
+                 TOutIt out, F f) {
+  using T = typename std::iterator_traits<TIt1>::value_type;
+  const auto kCount = static_cast<std::size_t>(std::distance(first1, last1));
+  for_chunks(pool, kCount, chunk_size<T>(),
+             [first1, first2, out, &f](std::size_t begin, std::size_t end) {
+               std::transform(first1 + begin, first1 + end, first2 + begin,
+                              out + begin, f);
+             });
+  return out + kCount;
+}
+
+/**
+ * @brief applies a function to every pair of elements of two ranges and writes
+ * the results to another range in parallel
+ *
+ * uses the default pool
+ *
+ * @tparam TIt1 random access iterator
+ * @tparam TIt2 random access iterator
+ * @tparam TOutIt random access iterator
+ * @tparam F
+ * @param first1
+ * @param last1
+ * @param first2
+ * @param out
+ * @param f callable with two elements as arguments
+ * @return TOutIt iterator past the last written element
+ */
+template <class TIt1, class TIt2, class TOutIt, class F>
+TOutIt transform(TIt1 first1, TIt1 last1, TIt2 first2, TOutIt out, F f) {
+  return transform(default_pool(), first1, last1, first2, out, std::move(f));
+}
+
+/**
+ * @brief combines all elements of a range with a binary operation in parallel
+ *
+ * every chunk is reduced separately. the results of the chunks are combined in
+ * order, starting with init. since the chunk size only depends on the element
+ * type, the result is the same for any number of threads
+ *
+ * @par Example
+ * @snippet example_parallel.cpp parallel reduce function
+ * @tparam TIt random access iterator
+ * @tparam T
+ * @tparam TOp
+ * @param pool
+ * @param first
+ * @param last
+ * @param init
+ * @param op associative binary operation
+ * @return T
+ */
+template <class TIt, class T, class TOp>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+T reduce(ThreadPool &pool, TIt first, TIt last, T init, TOp op) {
+  using TValue = typename std::iterator_traits<TIt>::value_type;
+  const auto kCount = static_cast<std::size_t>(std::distance(first, last));
+  constexpr std::size_t kChunk = chunk_size<TValue>();
+  std::vector<T> partial((kCount + kChunk - 1) / kChunk);
+  for_chunks(pool, kCount, kChunk,
+             [first, &partial, &op, kChunk](std::size_t begin,
+                                            std::size_t end) {
+               T ret = *(first + begin);
+               for (std::size_t i = begin + 1; i < end; i++) {
+                 ret = op(ret, *(first + i));
+               }
+               partial[begin / kChunk] = ret;
+             });
+  for (const auto &item : partial) {
+    init = op(init, item);
+  }
+  return init;
+}
+
+/**
+ * @brief combines all elements of a range with a binary operation in parallel
+ *
+ * uses the default pool
+ *
+ * @tparam TIt random access iterator
+ * @tparam T
+ * @tparam TOp
+ * @param first
+ * @param last
+ * @param init
+ * @param op associative binary operation
+ * @return T
+ */
+template <class TIt, class T, class TOp>
+T reduce(TIt first, TIt last, T init, TOp op) {
+  return reduce(default_pool(), first, last, std::move(init), std::move(op));
+}
+
+}  // namespace parallel
+}  // namespace mu
+#endif  // MU_PARALLEL_H_
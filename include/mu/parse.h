@@ -0,0 +1,462 @@
+/**
+ * @file parse.h
+ *
+ * parsing of Vector and Matrix objects from text. free functions
+ */
+#ifndef MU_PARSE_H_
+#define MU_PARSE_H_
+
+#include <algorithm>
+#include <cerrno>
+#include <clocale>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include "mu/mapped.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief true for the characters around and between the values of a Vector
+ * or Matrix
+ *
+ * whitespace, ',' and ';' separate the values. '[' and ']' enclose a Vector,
+ * a row or a Matrix (see FormatStyle). so the text of operator<<, CSV, JSON
+ * arrays and whitespace separated values can be parsed the same way
+ *
+ * @param c
+ * @return bool
+ */
+constexpr bool is_parse_separator(char c) {
+  return c == ' ' || c == ',' || c == '\n' || c == '\t' || c == '\r' ||
+         c == ';' || c == '[' || c == ']' || c == '\v' || c == '\f';
+}
+
+/* the implementation of parse_from for single values. the value is the text
+ * in [first, last), which doesn't contain separators */
+
+/* std::strtof, std::strtod or std::strtold, by the type of the value */
+
+inline float parse_strto(const char *text, char **end, float * /*type*/) {
+  return std::strtof(text, end);
+}
+
+inline double parse_strto(const char *text, char **end, double * /*type*/) {
+  return std::strtod(text, end);
+}
+
+inline long double parse_strto(const char *text, char **end,
+                               long double * /*type*/) {
+  return std::strtold(text, end);
+}
+
+/**
+ * @brief parses a floating point value with std::strtof, std::strtod or
+ * std::strtold
+ *
+ * the implementation before C++17. it accepts the same text as
+ * std::from_chars: subnormal values, inf and nan are valid. a leading '+',
+ * hexadecimal values and values that overflow or underflow to zero are not
+ *
+ * @tparam T floating point type
+ * @param first begin of the value
+ * @param last end of the value
+ * @param value
+ * @return bool
+ */
+template <typename T>
+bool parse_value_strto(const char *first, const char *last, T *value) {
+  /* std::strtod needs a null terminated text with the decimal point of the
+   * locale. no value with more characters than this is meaningful */
+  char text[64];
+  const auto kLength = static_cast<std::size_t>(last - first);
+  if (kLength == 0 || kLength >= sizeof(text)) {
+    return false;
+  }
+  std::memcpy(text, first, kLength);
+  text[kLength] = '\0';
+  const char *digits = text + (text[0] == '-' ? 1 : 0);
+  if (digits[0] == '+' ||
+      (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))) {
+    return false;
+  }
+  const char kPoint = *std::localeconv()->decimal_point;
+  std::replace(text, text + kLength, '.', kPoint);
+  char *end = nullptr;
+  errno = 0;
+  const T kValue = parse_strto(text, &end, value);
+  /* ERANGE is an overflow to inf or an underflow. a subnormal value is
+   * valid, a value that underflows to zero is not */
+  if (end != text + kLength ||
+      (errno == ERANGE &&
+       (kValue == T{0} || kValue > std::numeric_limits<T>::max() ||
+        kValue < std::numeric_limits<T>::lowest()))) {
+    return false;
+  }
+  *value = kValue;
+  return true;
+}
+
+#if defined(__cpp_lib_to_chars)
+
+template <typename T>
+bool parse_value(const char *first, const char *last, T *value,
+                 std::true_type /*fp*/) {
+  const std::from_chars_result kRes = std::from_chars(first, last, *value);
+  return kRes.ec == std::errc() && kRes.ptr == last;
+}
+
+#else
+
+template <typename T>
+bool parse_value(const char *first, const char *last, T *value,
+                 std::true_type /*fp*/) {
+  return parse_value_strto(first, last, value);
+}
+
+#endif
+
+template <typename T>
+bool parse_value(const char *first, const char *last, T *value,
+                 std::false_type /*fp*/) {
+  /* the magnitude is accumulated as unsigned, since -min() can't be
+   * represented by T */
+  using U = std::make_unsigned_t<std::conditional_t<
+      std::is_same<T, bool>::value, unsigned char, T>>;
+  const bool kNegative = first != last && *first == '-';
+  if (kNegative && !std::is_signed<T>::value) {
+    return false;
+  }
+  first += kNegative ? 1 : 0;
+  if (first == last) {
+    return false;
+  }
+  const U kMax = kNegative ? static_cast<U>(static_cast<U>(
+                                 std::numeric_limits<T>::max()) + 1)
+                           : static_cast<U>(std::numeric_limits<T>::max());
+  U magnitude = 0;
+  for (; first != last; first++) {
+    const auto kDigit = static_cast<unsigned>(*first - '0');
+    if (kDigit > 9 || kDigit > kMax ||
+        magnitude > static_cast<U>((kMax - kDigit) / 10)) {
+      return false;
+    }
+    magnitude = static_cast<U>(magnitude * 10 + kDigit);
+  }
+  *value = kNegative ? static_cast<T>(U{} - magnitude)
+                     : static_cast<T>(magnitude);
+  return true;
+}
+
+/**
+ * @brief parses n values that are separated by any of is_parse_separator()
+ *
+ * leading separators are skipped. the '[' that are skipped are closed by as
+ * many ']' behind the last value (only spaces may be between them)
+ *
+ * @tparam T
+ * @param first begin of the text, may be nullptr
+ * @param last end of the text
+ * @param values pointer to n values
+ * @param n
+ * @return const char* behind the last value (and its ']'), nullptr if the
+ * text doesn't start with n values
+ */
+template <typename T>
+const char *parse_values(const char *first, const char *last, T *values,
+                         std::size_t n) {
+  if (first == nullptr) {
+    return nullptr;
+  }
+  int depth = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    for (; first != last && is_parse_separator(*first); first++) {
+      depth += *first == '[' ? 1 : (*first == ']' ? -1 : 0);
+    }
+    const char *end = first;
+    while (end != last && !is_parse_separator(*end)) {
+      end++;
+    }
+    if (!parse_value(first, end, values + i, std::is_floating_point<T>{})) {
+      return nullptr;
+    }
+    first = end;
+  }
+  while (depth > 0 && first != last && (*first == ' ' || *first == ']')) {
+    depth -= *first == ']' ? 1 : 0;
+    first++;
+  }
+  return first;
+}
+
+/**
+ * @brief parses a value
+ *
+ * floating point values are parsed by std::from_chars (since C++17) or
+ * parse_value_strto(), which accepts the same text. the decimal point is
+ * always '.', no matter the locale
+ *
+ * @tparam T arithmetic type
+ * @param first begin of the text, may be nullptr
+ * @param last end of the text
+ * @param value
+ * @return const char* behind the value, nullptr if the text doesn't start
+ * with a value
+ */
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, const char *> parse_from(
+    const char *first, const char *last, T &value) {
+  return parse_values(first, last, &value, 1);
+}
+
+/**
+ * @brief parses a Vector
+ *
+ * reads the text of format_to() and operator<< in every FormatStyle, e.g.
+ * "[ 1, 2, 3 ]", "1,2,3", "[1,2,3]" or "1 2 3"
+ *
+ * @par Example
+ * @snippet example_parse.cpp parse vector
+ * @tparam N
+ * @tparam T
+ * @param first begin of the text, may be nullptr
+ * @param last end of the text
+ * @param v
+ * @return const char* behind the Vector, nullptr if the text doesn't start
+ * with N values. v is unspecified then
+ */
+template <std::size_t N, typename T>
+const char *parse_from(const char *first, const char *last, Vector<N, T> &v) {
+  return parse_values(first, last, v.data(), N);
+}
+
+/**
+ * @brief parses a Matrix
+ *
+ * the N * M values are read row by row, e.g. from "[ [ 1, 2 ],\n  [ 3, 4 ]
+ * ]", "1,2,3,4" or "[[1,2],[3,4]]"
+ *
+ * @par Example
+ * @snippet example_parse.cpp parse matrix
+ * @tparam N
+ * @tparam M
+ * @tparam T
+ * @param first begin of the text, may be nullptr
+ * @param last end of the text
+ * @param m
+ * @return const char* behind the Matrix, nullptr if the text doesn't start
+ * with N * M values. m is unspecified then
+ */
+template <std::size_t N, std::size_t M, typename T>
+const char *parse_from(const char *first, const char *last,
+                       Matrix<N, M, T> &m) {
+  return parse_values(first, last, m.data(), N * M);
+}
+
+/* the number of values in [first, last) */
+inline std::size_t count_parse_values(const char *first, const char *last) {
+  std::size_t ret = 0;
+  bool in_value = false;
+  for (; first != last; first++) {
+    const bool kSeparator = is_parse_separator(*first);
+    ret += !kSeparator && !in_value ? 1 : 0;
+    in_value = !kSeparator;
+  }
+  return ret;
+}
+
+/* parses all values of [first, last) into values. throws with the offset of
+ * the first invalid value relative to begin */
+template <typename T>
+void parse_all_values(const char *begin, const char *first, const char *last,
+                      T *values, std::size_t n) {
+  const char *end = parse_values(first, last, values, n);
+  if (end == nullptr) {
+    /* the same again, value by value, to find the invalid one */
+    for (std::size_t i = 0; i < n; i++) {
+      const char *next = parse_values(first, last, values + i, 1);
+      if (next == nullptr) {
+        while (first != last && is_parse_separator(*first)) {
+          first++;
+        }
+        throw std::invalid_argument("invalid value at offset " +
+                                    std::to_string(first - begin));
+      }
+      first = next;
+    }
+  }
+}
+
+/**
+ * @brief parses a list of Vector or Matrix objects
+ *
+ * the text is read as values separated by is_parse_separator(). every N * M
+ * consecutive values are an element. so one element per line (CSV or
+ * whitespace separated), a JSON array of arrays and the text of FormatWriter
+ * can be parsed the same way. see mu::parallel::parse_list() for the
+ * multi-threaded version
+ *
+ * @par Example
+ * @snippet example_parse.cpp parse list
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ * @param first begin of the text, may be nullptr if last is nullptr too
+ * @param last end of the text
+ * @return std::vector<E>
+ * @exception std::invalid_argument if a value can't be parsed or the number
+ * of values is not a multiple of N * M
+ */
+template <class E>
+std::vector<E> parse_list(const char *first, const char *last) {
+  using T = typename MappedElement<E>::value_type;
+  constexpr std::size_t kValues =
+      MappedElement<E>::rows * MappedElement<E>::cols;
+  static_assert(sizeof(E) == kValues * sizeof(T),
+                "parse_list type E must only consist of its values");
+  const std::size_t kCount = count_parse_values(first, last);
+  if (kCount % kValues != 0) {
+    throw std::invalid_argument(std::to_string(kCount) +
+                                " values are no multiple of the element size");
+  }
+  std::vector<E> ret(kCount / kValues);
+  if (kCount > 0) {
+    parse_all_values(first, first, last, ret.front().data(), kCount);
+  }
+  return ret;
+}
+
+/**
+ * @brief parses a list of Vector or Matrix objects from a file
+ *
+ * @par Example
+ * @snippet example_parse.cpp parse mapped file
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ * @param file
+ * @return std::vector<E>
+ */
+template <class E>
+std::vector<E> parse_list(const MappedFile &file) {
+  return parse_list<E>(file.data(), file.data() + file.size());
+}
+
+namespace parallel {
+
+/**
+ * @brief parses a list of Vector or Matrix objects in parallel
+ *
+ * the text is split into chunks of at least chunk_bytes characters that end
+ * at line boundaries. the values of every chunk are counted in parallel,
+ * which gives the position of its values in the result. then the chunks are
+ * parsed in parallel. an element may start in one chunk and end in the next.
+ * the result is the same as the one of mu::parse_list()
+ *
+ * @par Example
+ * @snippet example_parse.cpp parse parallel list
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ * @param pool
+ * @param first begin of the text, may be nullptr if last is nullptr too
+ * @param last end of the text
+ * @param chunk_bytes minimum size of a chunk
+ * @return std::vector<E>
+ * @exception std::invalid_argument if a value can't be parsed or the number
+ * of values is not a multiple of N * M
+ */
+template <class E>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+std::vector<E> parse_list(ThreadPool &pool, const char *first,
+                          const char *last,
+                          std::size_t chunk_bytes = 1 << 20) {
+  using T = typename MappedElement<E>::value_type;
+  constexpr std::size_t kValues =
+      MappedElement<E>::rows * MappedElement<E>::cols;
+  static_assert(sizeof(E) == kValues * sizeof(T),
+                "parse_list type E must only consist of its values");
+  /* the chunks end behind a '\n' or at the end of the text */
+  std::vector<const char *> bounds = {first};
+  while (static_cast<std::size_t>(last - bounds.back()) > chunk_bytes) {
+    const char *bound = std::find(bounds.back() + chunk_bytes, last, '\n');
+    bounds.push_back(bound == last ? last : bound + 1);
+  }
+  if (bounds.back() != last) {
+    bounds.push_back(last);
+  }
+  const std::size_t kChunks = bounds.size() - 1;
+  /* offsets[i] is the index of the first value of chunk i */
+  std::vector<std::size_t> offsets(kChunks + 1, 0);
+  for_chunks(pool, kChunks, 1,
+             [&bounds, &offsets](std::size_t begin, std::size_t end) {
+               for (std::size_t i = begin; i < end; i++) {
+                 offsets[i + 1] = count_parse_values(bounds[i], bounds[i + 1]);
+               }
+             });
+  for (std::size_t i = 0; i < kChunks; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+  const std::size_t kCount = offsets.back();
+  if (kCount % kValues != 0) {
+    throw std::invalid_argument(std::to_string(kCount) +
+                                " values are no multiple of the element size");
+  }
+  std::vector<E> ret(kCount / kValues);
+  if (kCount > 0) {
+    T *values = ret.front().data();
+    for_chunks(pool, kChunks, 1,
+               [&bounds, &offsets, first, values](std::size_t begin,
+                                                  std::size_t end) {
+                 for (std::size_t i = begin; i < end; i++) {
+                   parse_all_values(first, bounds[i], bounds[i + 1],
+                                    values + offsets[i],
+                                    offsets[i + 1] - offsets[i]);
+                 }
+               });
+  }
+  return ret;
+}
+
+/**
+ * @brief parses a list of Vector or Matrix objects in parallel with the
+ * default_pool()
+ *
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ * @param first begin of the text
+ * @param last end of the text
+ * @return std::vector<E>
+ */
+template <class E>
+std::vector<E> parse_list(const char *first, const char *last) {
+  return parse_list<E>(default_pool(), first, last);
+}
+
+/**
+ * @brief parses a list of Vector or Matrix objects from a file in parallel
+ *
+ * @tparam E Vector<N, T> or Matrix<N, M, T>
+ * @param pool
+ * @param file
+ * @return std::vector<E>
+ */
+template <class E>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+std::vector<E> parse_list(ThreadPool &pool, const MappedFile &file) {
+  return parse_list<E>(pool, file.data(), file.data() + file.size());
+}
+
+}  // namespace parallel
+
+}  // namespace mu
+
+#endif  // MU_PARSE_H_
@@ -0,0 +1,538 @@
+/**
+ * @file quaternion.h
+ *
+ * Quaternion class and free functions
+ */
+#ifndef MU_QUATERNION_H_
+#define MU_QUATERNION_H_
+
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/typetraits.h"
+#include "mu/utility.h"
+#include "mu/vector.h"
+#include "mu/vector3d.h"
+
+namespace mu {
+
+/**
+ * @brief A quaternion w + xi + yj + zk
+ *
+ * unit quaternions represent rotations in three dimensional space. they can
+ * be composed (multiplied), interpolated (slerp, nlerp) and converted to and
+ * from a rotation matrix.
+ *
+ * rotating a single Vector3D with rotate() needs fewer operations than
+ * building the rotation matrix first. for many Vectors, the batched rotate()
+ * converts the quaternion to a matrix once and applies it to all of them.
+ *
+ * q and -q represent the same rotation, but they're not equal
+ *
+ * @tparam T floating point type
+ */
+template <typename T>
+class Quaternion {
+  static_assert(std::is_floating_point<T>::value,
+                "Quaternion type T must be a floating point type");
+
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Construct a new Quaternion object. the identity, i.e. no rotation
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion constructor
+   */
+  constexpr Quaternion() = default;
+
+  /**
+   * @brief Construct a new Quaternion object from its four components
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion components constructor
+   * @param w real part
+   * @param x
+   * @param y
+   * @param z
+   */
+  constexpr Quaternion(T w, T x, T y, T z) : w_{w}, x_{x}, y_{y}, z_{z} {}
+
+  /**
+   * @brief Construct a new Quaternion object from a rotation around an axis
+   *
+   * the axis does not have to be normalized. it must not be zero
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion axis angle constructor
+   * @param axis
+   * @param angle [rad]
+   */
+  Quaternion(const Vector3D<T> &axis, T angle) {
+    const T kScale = mu::sin(angle / T{2}) / axis.length();
+    w_ = mu::cos(angle / T{2});
+    x_ = axis[0] * kScale;
+    y_ = axis[1] * kScale;
+    z_ = axis[2] * kScale;
+  }
+
+  /**
+   * @brief Construct a new Quaternion object from a rotation matrix
+   *
+   * the matrix must be orthonormal with a determinant of 1. the result is a
+   * unit quaternion with w >= 0 (Shepperd's method)
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion matrix constructor
+   * @param m
+   */
+  explicit Quaternion(const Matrix<3, 3, T> &m) {
+    /* the largest of the four diagonal combinations is used for the square
+     * root, so that the divisions are numerically stable */
+    const T kTrace = m[0][0] + m[1][1] + m[2][2];
+    if (kTrace > T{0}) {
+      const T kS = mu::sqrt(kTrace + T{1}) * T{2};
+      w_ = kS / T{4};
+      x_ = (m[2][1] - m[1][2]) / kS;
+      y_ = (m[0][2] - m[2][0]) / kS;
+      z_ = (m[1][0] - m[0][1]) / kS;
+    } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+      const T kS = mu::sqrt(T{1} + m[0][0] - m[1][1] - m[2][2]) * T{2};
+      w_ = (m[2][1] - m[1][2]) / kS;
+      x_ = kS / T{4};
+      y_ = (m[0][1] + m[1][0]) / kS;
+      z_ = (m[0][2] + m[2][0]) / kS;
+    } else if (m[1][1] > m[2][2]) {
+      const T kS = mu::sqrt(T{1} + m[1][1] - m[0][0] - m[2][2]) * T{2};
+      w_ = (m[0][2] - m[2][0]) / kS;
+      x_ = (m[0][1] + m[1][0]) / kS;
+      y_ = kS / T{4};
+      z_ = (m[1][2] + m[2][1]) / kS;
+    } else {
+      const T kS = mu::sqrt(T{1} + m[2][2] - m[0][0] - m[1][1]) * T{2};
+      w_ = (m[1][0] - m[0][1]) / kS;
+      x_ = (m[0][2] + m[2][0]) / kS;
+      y_ = (m[1][2] + m[2][1]) / kS;
+      z_ = kS / T{4};
+    }
+    if (w_ < T{0}) {
+      *this = -*this;
+    }
+  }
+
+  /**
+   * @brief real part
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion components constructor
+   * @return T&
+   */
+  constexpr T &w() noexcept { return w_; }
+
+  /**
+   * @brief const real part
+   *
+   * @return const T&
+   */
+  constexpr const T &w() const noexcept { return w_; }
+
+  /**
+   * @brief x component of the imaginary part
+   *
+   * @return T&
+   */
+  constexpr T &x() noexcept { return x_; }
+
+  /**
+   * @brief const x component of the imaginary part
+   *
+   * @return const T&
+   */
+  constexpr const T &x() const noexcept { return x_; }
+
+  /**
+   * @brief y component of the imaginary part
+   *
+   * @return T&
+   */
+  constexpr T &y() noexcept { return y_; }
+
+  /**
+   * @brief const y component of the imaginary part
+   *
+   * @return const T&
+   */
+  constexpr const T &y() const noexcept { return y_; }
+
+  /**
+   * @brief z component of the imaginary part
+   *
+   * @return T&
+   */
+  constexpr T &z() noexcept { return z_; }
+
+  /**
+   * @brief const z component of the imaginary part
+   *
+   * @return const T&
+   */
+  constexpr const T &z() const noexcept { return z_; }
+
+  /**
+   * @brief imaginary part as a vector
+   *
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> vec() const {
+    return Vector3D<T>{T{x_}, T{y_}, T{z_}};
+  }
+
+  /**
+   * @brief dot product of the four components
+   *
+   * @param rhs
+   * @return T
+   */
+  constexpr T dot(const Quaternion &rhs) const {
+    return w_ * rhs.w_ + x_ * rhs.x_ + y_ * rhs.y_ + z_ * rhs.z_;
+  }
+
+  /**
+   * @brief length of the quaternion. 1 for a rotation
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion normalize function
+   * @return T
+   */
+  T norm() const { return mu::sqrt(dot(*this)); }
+
+  /**
+   * @brief normalizes this quaternion to a length of 1
+   *
+   * rounding errors accumulate when rotations are composed many times.
+   * normalizing removes them
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion normalize function
+   */
+  void normalize() {
+    const T kInv = T{1} / norm();
+    w_ *= kInv;
+    x_ *= kInv;
+    y_ *= kInv;
+    z_ *= kInv;
+  }
+
+  /**
+   * @brief returns a normalized quaternion
+   *
+   * @see @ref normalize()
+   * @return Quaternion
+   */
+  Quaternion normalized() const {
+    Quaternion ret(*this);
+    ret.normalize();
+    return ret;
+  }
+
+  /**
+   * @brief conjugate, i.e. the negated imaginary part
+   *
+   * it's the inverse rotation of a unit quaternion
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion conjugate function
+   * @return Quaternion
+   */
+  constexpr Quaternion conjugate() const {
+    return Quaternion{w_, -x_, -y_, -z_};
+  }
+
+  /**
+   * @brief inverse, i.e. q * q.inverse() is the identity
+   *
+   * same as the conjugate for a unit quaternion
+   *
+   * @return Quaternion
+   */
+  constexpr Quaternion inverse() const {
+    const T kInv = T{1} / dot(*this);
+    return Quaternion{w_ * kInv, -x_ * kInv, -y_ * kInv, -z_ * kInv};
+  }
+
+  /**
+   * @brief rotates a vector
+   *
+   * this quaternion must be normalized. needs 15 multiplications and 15
+   * additions, fewer than building the rotation matrix (see to_matrix())
+   *
+   * \f$ t = 2 (q_{xyz} \times v) \f$ \n
+   * \f$ v' = v + w t + q_{xyz} \times t \f$
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion rotate function
+   * @param v
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> rotate(const Vector3D<T> &v) const {
+    const T kTx = T{2} * (y_ * v[2] - z_ * v[1]);
+    const T kTy = T{2} * (z_ * v[0] - x_ * v[2]);
+    const T kTz = T{2} * (x_ * v[1] - y_ * v[0]);
+    return Vector3D<T>{v[0] + w_ * kTx + (y_ * kTz - z_ * kTy),
+                       v[1] + w_ * kTy + (z_ * kTx - x_ * kTz),
+                       v[2] + w_ * kTz + (x_ * kTy - y_ * kTx)};
+  }
+
+  /**
+   * @brief rotates a range of vectors and writes them to an output iterator
+   *
+   * this quaternion must be normalized. it's converted to a rotation matrix
+   * once, so that every vector needs only 9 multiplications and 6 additions.
+   * out may be equal to first, i.e. the vectors can be rotated in-place
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion batched rotate function
+   * @tparam TIt iterator to Vector3D<T> (or Vector<3, T>)
+   * @tparam TOut
+   * @param first
+   * @param last
+   * @param out
+   * @return TOut iterator to the element after the last written one
+   */
+  template <class TIt, class TOut>
+  TOut rotate(TIt first, TIt last, TOut out) const {
+    const Matrix<3, 3, T> kR = to_matrix();
+    const T kR00 = kR[0][0];
+    const T kR01 = kR[0][1];
+    const T kR02 = kR[0][2];
+    const T kR10 = kR[1][0];
+    const T kR11 = kR[1][1];
+    const T kR12 = kR[1][2];
+    const T kR20 = kR[2][0];
+    const T kR21 = kR[2][1];
+    const T kR22 = kR[2][2];
+    for (; first != last; ++first, ++out) {
+      const T kX = (*first)[0];
+      const T kY = (*first)[1];
+      const T kZ = (*first)[2];
+      (*out)[0] = kR00 * kX + kR01 * kY + kR02 * kZ;
+      (*out)[1] = kR10 * kX + kR11 * kY + kR12 * kZ;
+      (*out)[2] = kR20 * kX + kR21 * kY + kR22 * kZ;
+    }
+    return out;
+  }
+
+  /**
+   * @brief rotation matrix of this quaternion
+   *
+   * this quaternion must be normalized. R.dot(v) is the same as rotate(v)
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion to_matrix function
+   * @return Matrix<3, 3, T>
+   */
+  constexpr Matrix<3, 3, T> to_matrix() const {
+    const T kXX = x_ * x_;
+    const T kYY = y_ * y_;
+    const T kZZ = z_ * z_;
+    const T kXY = x_ * y_;
+    const T kXZ = x_ * z_;
+    const T kYZ = y_ * z_;
+    const T kWX = w_ * x_;
+    const T kWY = w_ * y_;
+    const T kWZ = w_ * z_;
+    return Matrix<3, 3, T>{
+        {T{1} - T{2} * (kYY + kZZ), T{2} * (kXY - kWZ), T{2} * (kXZ + kWY)},
+        {T{2} * (kXY + kWZ), T{1} - T{2} * (kXX + kZZ), T{2} * (kYZ - kWX)},
+        {T{2} * (kXZ - kWY), T{2} * (kYZ + kWX), T{1} - T{2} * (kXX + kYY)}};
+  }
+
+  /********************************* I/O ***********************************/
+
+  /**
+   * @brief print the quaternion components [ w, x, y, z ]
+   *
+   * @tparam U
+   * @param os
+   * @param q
+   * @return std::ostream&
+   */
+  template <class U>
+  friend std::ostream &operator<<(std::ostream &os, const Quaternion<U> &q);
+
+  /******************************* operators *******************************/
+
+  /**
+   * @brief equality operator
+   *
+   * every component is compared. see mu::Vector operator==
+   *
+   * @param rhs
+   * @return bool
+   */
+  constexpr bool operator==(const Quaternion &rhs) const {
+    return mu::TypeTraits<T>::equals(w_, rhs.w_) &&
+           mu::TypeTraits<T>::equals(x_, rhs.x_) &&
+           mu::TypeTraits<T>::equals(y_, rhs.y_) &&
+           mu::TypeTraits<T>::equals(z_, rhs.z_);
+  }
+
+  /**
+   * @brief unequality operator
+   *
+   * @param rhs
+   * @return bool
+   */
+  constexpr bool operator!=(const Quaternion &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief negates every component. the same rotation
+   *
+   * @return Quaternion
+   */
+  constexpr Quaternion operator-() const {
+    return Quaternion{-w_, -x_, -y_, -z_};
+  }
+
+  /**
+   * @brief composition (Hamilton product)
+   *
+   * rotating by the result is the same as rotating by rhs first and then by
+   * this quaternion
+   *
+   * @par Example
+   * @snippet example_quaternion.cpp quaternion multiplication operator
+   * @param rhs
+   * @return Quaternion&
+   */
+  constexpr Quaternion &operator*=(const Quaternion &rhs) {
+    const Quaternion kLhs(*this);
+    w_ = kLhs.w_ * rhs.w_ - kLhs.x_ * rhs.x_ - kLhs.y_ * rhs.y_ -
+         kLhs.z_ * rhs.z_;
+    x_ = kLhs.w_ * rhs.x_ + kLhs.x_ * rhs.w_ + kLhs.y_ * rhs.z_ -
+         kLhs.z_ * rhs.y_;
+    y_ = kLhs.w_ * rhs.y_ - kLhs.x_ * rhs.z_ + kLhs.y_ * rhs.w_ +
+         kLhs.z_ * rhs.x_;
+    z_ = kLhs.w_ * rhs.z_ + kLhs.x_ * rhs.y_ - kLhs.y_ * rhs.x_ +
+         kLhs.z_ * rhs.w_;
+    return *this;
+  }
+
+ private:
+  T w_ = T{1};
+  T x_ = T{0};
+  T y_ = T{0};
+  T z_ = T{0};
+};
+
+/********************************** I/O ************************************/
+
+template <class U>
+std::ostream &operator<<(std::ostream &os, const Quaternion<U> &q) {
+  os << "[ " << q.w_ << ", " << q.x_ << ", " << q.y_ << ", " << q.z_ << " ]";
+  return os;
+}
+
+/******************************* operators *********************************/
+
+/**
+ * @brief composition (Hamilton product)
+ *
+ * see Quaternion::operator*=()
+ *
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return Quaternion<T>
+ */
+template <typename T>
+constexpr Quaternion<T> operator*(const Quaternion<T> &lhs,
+                                  const Quaternion<T> &rhs) {
+  return Quaternion<T>(lhs) *= rhs;
+}
+
+/************************* interpolation functions *************************/
+
+/**
+ * @brief normalized linear interpolation between two rotations
+ *
+ * interpolates along the shorter path and normalizes the result. cheaper than
+ * slerp, but the angular velocity is not constant
+ *
+ * @par Example
+ * @snippet example_quaternion.cpp quaternion nlerp function
+ * @tparam T
+ * @param a rotation at t = 0
+ * @param b rotation at t = 1
+ * @param t
+ * @return Quaternion<T>
+ */
+template <typename T>
+Quaternion<T> nlerp(const Quaternion<T> &a, const Quaternion<T> &b, T t) {
+  const T kA = T{1} - t;
+  const T kB = a.dot(b) < T{0} ? -t : t;
+  Quaternion<T> ret{kA * a.w() + kB * b.w(), kA * a.x() + kB * b.x(),
+                    kA * a.y() + kB * b.y(), kA * a.z() + kB * b.z()};
+  ret.normalize();
+  return ret;
+}
+
+/**
+ * @brief spherical linear interpolation between two rotations
+ *
+ * interpolates along the shorter path with a constant angular velocity. both
+ * quaternions must be normalized. for nearly equal rotations, nlerp is used
+ * since the sine of the angle between them is too close to zero
+ *
+ * @par Example
+ * @snippet example_quaternion.cpp quaternion slerp function
+ * @tparam T
+ * @param a rotation at t = 0
+ * @param b rotation at t = 1
+ * @param t
+ * @return Quaternion<T>
+ */
+template <typename T>
+Quaternion<T> slerp(const Quaternion<T> &a, const Quaternion<T> &b, T t) {
+  T cos = a.dot(b);
+  const T kSign = cos < T{0} ? T{-1} : T{1};
+  cos *= kSign;
+  if (cos > T{1} - T{1e-4}) {
+    return nlerp(a, b, t);
+  }
+  const T kAngle = mu::acos(cos);
+  const T kInvSin = T{1} / mu::sin(kAngle);
+  const T kA = mu::sin((T{1} - t) * kAngle) * kInvSin;
+  const T kB = mu::sin(t * kAngle) * kInvSin * kSign;
+  return Quaternion<T>{kA * a.w() + kB * b.w(), kA * a.x() + kB * b.x(),
+                       kA * a.y() + kB * b.y(), kA * a.z() + kB * b.z()};
+}
+
+/************************* convenience functions ***************************/
+
+/**
+ * @brief rotates a range of vectors by a quaternion
+ *
+ * see Quaternion::rotate(first, last, out)
+ *
+ * @tparam T
+ * @tparam TIt
+ * @tparam TOut
+ * @param q
+ * @param first
+ * @param last
+ * @param out
+ * @return TOut
+ */
+template <typename T, class TIt, class TOut>
+inline TOut rotate(const Quaternion<T> &q, TIt first, TIt last, TOut out) {
+  return q.rotate(first, last, out);
+}
+
+}  // namespace mu
+#endif  // MU_QUATERNION_H_
@@ -0,0 +1,278 @@
+/**
+ * @file rotation2d.h
+ *
+ * Rotation2D class and free functions
+ */
+#ifndef MU_ROTATION2D_H_
+#define MU_ROTATION2D_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/simd.h"
+#include "mu/typetraits.h"
+#include "mu/utility.h"
+#include "mu/vector.h"
+#include "mu/vector2d.h"
+
+namespace mu {
+
+/**
+ * @brief A rotation in two dimensional space
+ *
+ * stores the cosine and the sine of the angle, which are calculated only once
+ * when the rotation is constructed. rotating a Vector2D needs four
+ * multiplications and two additions, without any calls to mu::sin or mu::cos.
+ *
+ * to rotate every vector by a different angle, see mu::rotate(first, last,
+ * angles, out)
+ *
+ * @tparam T floating point type
+ */
+template <typename T>
+class Rotation2D {
+  static_assert(std::is_floating_point<T>::value,
+                "Rotation2D type T must be a floating point type");
+
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Construct a new Rotation2D object. the identity, i.e. no rotation
+   */
+  constexpr Rotation2D() = default;
+
+  /**
+   * @brief Construct a new Rotation2D object from an angle [rad]
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d angle constructor
+   * @param angle
+   */
+  explicit Rotation2D(T angle) { mu::sincos(angle, sin_, cos_); }
+
+  /**
+   * @brief Construct a new Rotation2D object from the cosine and the sine of
+   * an angle
+   *
+   * cos^2 + sin^2 must be 1
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d cos sin constructor
+   * @param cos
+   * @param sin
+   */
+  constexpr Rotation2D(T cos, T sin) : cos_{cos}, sin_{sin} {}
+
+  /**
+   * @brief cosine of the angle
+   *
+   * @return T
+   */
+  constexpr T cos() const noexcept { return cos_; }
+
+  /**
+   * @brief sine of the angle
+   *
+   * @return T
+   */
+  constexpr T sin() const noexcept { return sin_; }
+
+  /**
+   * @brief the angle [rad] in the range [-pi, pi]
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d angle constructor
+   * @return T
+   */
+  T angle() const { return mu::atan2(sin_, cos_); }
+
+  /**
+   * @brief inverse, i.e. the rotation by the negative angle
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d inverse function
+   * @return Rotation2D
+   */
+  constexpr Rotation2D inverse() const { return Rotation2D{cos_, -sin_}; }
+
+  /**
+   * @brief rotation matrix of this rotation
+   *
+   * R.dot(v) is the same as rotate(v)
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d to_matrix function
+   * @return Matrix<2, 2, T>
+   */
+  constexpr Matrix<2, 2, T> to_matrix() const {
+    return Matrix<2, 2, T>{{T{cos_}, T{-sin_}}, {T{sin_}, T{cos_}}};
+  }
+
+  /**
+   * @brief rotates a vector
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d rotate function
+   * @param v
+   * @return Vector2D<T>
+   */
+  constexpr Vector2D<T> rotate(const Vector<2, T> &v) const {
+    return Vector2D<T>{T(v[0] * cos_ - v[1] * sin_),
+                       T(v[0] * sin_ + v[1] * cos_)};
+  }
+
+  /**
+   * @brief rotates a range of vectors and writes them to an output iterator
+   *
+   * pointers to Vector2D<T> (or Vector<2, T>), e.g. std::vector::data(), are
+   * rotated by a SIMD kernel that rotates several vectors at once. other
+   * iterators use a plain loop. out may be equal to first, i.e. the vectors
+   * can be rotated in-place. otherwise, the ranges must not overlap
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d batched rotate function
+   * @tparam TIt iterator to Vector2D<T> (or Vector<2, T>)
+   * @tparam TOut
+   * @param first
+   * @param last
+   * @param out
+   * @return TOut iterator to the element after the last written one
+   */
+  template <class TIt, class TOut>
+  TOut rotate(TIt first, TIt last, TOut out) const {
+    return rotate(first, last, out, is_contiguous<TIt, TOut>{});
+  }
+
+  /******************************* operators *******************************/
+
+  /**
+   * @brief equality operator
+   *
+   * the cosines and the sines are compared. see mu::Vector operator==
+   *
+   * @param rhs
+   * @return bool
+   */
+  constexpr bool operator==(const Rotation2D &rhs) const {
+    return mu::TypeTraits<T>::equals(cos_, rhs.cos_) &&
+           mu::TypeTraits<T>::equals(sin_, rhs.sin_);
+  }
+
+  /**
+   * @brief unequality operator
+   *
+   * @param rhs
+   * @return bool
+   */
+  constexpr bool operator!=(const Rotation2D &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief composition, i.e. the sum of both angles
+   *
+   * @par Example
+   * @snippet example_rotation2d.cpp rotation2d multiplication operator
+   * @param rhs
+   * @return Rotation2D&
+   */
+  constexpr Rotation2D &operator*=(const Rotation2D &rhs) {
+    const T kCos = cos_ * rhs.cos_ - sin_ * rhs.sin_;
+    sin_ = sin_ * rhs.cos_ + cos_ * rhs.sin_;
+    cos_ = kCos;
+    return *this;
+  }
+
+ private:
+  T cos_ = T{1};
+  T sin_ = T{0};
+
+  /* pointers to Vectors that are two T's in memory, without any padding */
+  template <class TIt, class TOut>
+  using is_contiguous = std::integral_constant<
+      bool,
+      std::is_pointer<TIt>::value && std::is_pointer<TOut>::value &&
+          std::is_base_of<Vector<2, T>, std::remove_cv_t<std::remove_pointer_t<
+                                            TIt>>>::value &&
+          std::is_base_of<Vector<2, T>, std::remove_pointer_t<TOut>>::value &&
+          sizeof(std::remove_pointer_t<TIt>) == 2 * sizeof(T) &&
+          sizeof(std::remove_pointer_t<TOut>) == 2 * sizeof(T)>;
+
+  template <class TIt, class TOut>
+  TOut rotate(TIt first, TIt last, TOut out, std::true_type /*simd*/) const {
+    const auto kCount = static_cast<std::size_t>(last - first);
+    if (kCount != 0) {
+      mu::simd_rotate_pairs(&(*out)[0], &(*first)[0], kCount, cos_, sin_);
+    }
+    return out + kCount;
+  }
+
+  template <class TIt, class TOut>
+  TOut rotate(TIt first, TIt last, TOut out, std::false_type /*simd*/) const {
+    for (; first != last; ++first, ++out) {
+      const T kX = (*first)[0];
+      const T kY = (*first)[1];
+      (*out)[0] = kX * cos_ - kY * sin_;
+      (*out)[1] = kX * sin_ + kY * cos_;
+    }
+    return out;
+  }
+};
+
+/******************************* operators *********************************/
+
+/**
+ * @brief composition, i.e. the sum of both angles
+ *
+ * see Rotation2D::operator*=()
+ *
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return Rotation2D<T>
+ */
+template <typename T>
+constexpr Rotation2D<T> operator*(const Rotation2D<T> &lhs,
+                                  const Rotation2D<T> &rhs) {
+  return Rotation2D<T>(lhs) *= rhs;
+}
+
+/************************* convenience functions ***************************/
+
+/**
+ * @brief rotates every vector of a range by its own angle [rad]
+ *
+ * the sine and the cosine of every angle are calculated together with
+ * mu::sincos(). out may be equal to first, i.e. the vectors can be rotated
+ * in-place
+ *
+ * @par Example
+ * @snippet example_rotation2d.cpp rotation2d per vector angles
+ * @tparam TIt iterator to Vector2D (or Vector<2, T>)
+ * @tparam TAngleIt iterator to the angles
+ * @tparam TOut
+ * @param first
+ * @param last
+ * @param angles one angle per vector
+ * @param out
+ * @return TOut iterator to the element after the last written one
+ */
+template <class TIt, class TAngleIt, class TOut>
+TOut rotate(TIt first, TIt last, TAngleIt angles, TOut out) {
+  using T = std::remove_cv_t<std::remove_reference_t<decltype((*first)[0])>>;
+  for (; first != last; ++first, ++angles, ++out) {
+    T sin;
+    T cos;
+    mu::sincos(static_cast<T>(*angles), sin, cos);
+    const T kX = (*first)[0];
+    const T kY = (*first)[1];
+    (*out)[0] = kX * cos - kY * sin;
+    (*out)[1] = kX * sin + kY * cos;
+  }
+  return out;
+}
+
+}  // namespace mu
+#endif  // MU_ROTATION2D_H_
@@ -0,0 +1,1001 @@
+/**
+ * @file simd.h
+ *
+ * SIMD type traits and elementwise kernels
+ */
+#ifndef MU_SIMD_H_
+#define MU_SIMD_H_
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "mu/typetraits.h"
+
+/* the instruction set is selected at compile time through the macros that
+ * the compiler defines for the target architecture (e.g. -mavx2, -march=...).
+ * define MU_DISABLE_SIMD to always use the portable implementation */
+#if !defined(MU_DISABLE_SIMD)
+#if defined(__AVX512F__)
+#define MU_SIMD_AVX512
+#elif defined(__AVX__)
+#define MU_SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MU_SIMD_SSE
+#endif
+#endif
+
+#if defined(MU_SIMD_AVX512) || defined(MU_SIMD_AVX) || defined(MU_SIMD_SSE)
+#include <immintrin.h>
+#endif
+
+namespace mu {
+
+/****************************** SIMD traits ********************************/
+
+/**
+ * @brief Basic SIMD type trait class
+ *
+ * portable implementation for every type that has no SIMD register. it
+ * treats a single value as a register of size 1, so that the same kernel can
+ * be used for all types.
+ *
+ * every specialization provides
+ * - the register type and the number of values it holds (size)
+ * - the alignment of a register in memory (alignment)
+ * - unaligned load and store
+ * - aligned load and store. the address must be a multiple of alignment
+ * - broadcast of a single value (set1)
+ * - elementwise add, sub, mul and div
+ * - elementwise square root
+ * - swap of every two neighboring values (swap_pairs), e.g. x and y of
+ *   interleaved 2D vectors. there are no pairs in a register of size 1
+ * - elementwise absolute value
+ * - elementwise comparisons eq, lt and le. they return a mask of the lanes
+ *   for which the comparison is true and are false for NaN
+ * - and, or and and-not (a and not b) of masks, and whether all lanes of a
+ *   mask are set (all)
+ *
+ * @tparam T type
+ */
+template <class T>
+struct SimdTraits {
+  SimdTraits() = delete;
+  using type = T;
+  static constexpr std::size_t size = 1;
+  static constexpr std::size_t alignment = alignof(T);
+  static type load(const T *p) { return *p; }
+  static void store(T *p, type a) { *p = a; }
+  static type load_aligned(const T *p) { return *p; }
+  static void store_aligned(T *p, type a) { *p = a; }
+  static type set1(T a) { return a; }
+  static type add(type a, type b) { return a + b; }
+  static type sub(type a, type b) { return a - b; }
+  static type mul(type a, type b) { return a * b; }
+  static type div(type a, type b) { return a / b; }
+  static type sqrt(type a) { return static_cast<T>(std::sqrt(a)); }
+  static type swap_pairs(type a) { return a; }
+  using mask = bool;
+  static type abs(type a) { return a < T{0} ? -a : a; }
+  static mask eq(type a, type b) { return a == b; }
+  static mask lt(type a, type b) { return a < b; }
+  static mask le(type a, type b) { return a <= b; }
+  static mask mask_and(mask a, mask b) { return a && b; }
+  static mask mask_or(mask a, mask b) { return a || b; }
+  static mask mask_andnot(mask a, mask b) { return a && !b; }
+  static bool all(mask a) { return a; }
+};
+
+#if defined(MU_SIMD_AVX512)
+
+template <>
+struct SimdTraits<float> {
+  SimdTraits() = delete;
+  using type = __m512;
+  static constexpr std::size_t size = 16;
+  static constexpr std::size_t alignment = 64;
+  static type load(const float *p) { return _mm512_loadu_ps(p); }
+  static void store(float *p, type a) { _mm512_storeu_ps(p, a); }
+  static type load_aligned(const float *p) { return _mm512_load_ps(p); }
+  static void store_aligned(float *p, type a) { _mm512_store_ps(p, a); }
+  static type set1(float a) { return _mm512_set1_ps(a); }
+  static type add(type a, type b) { return _mm512_add_ps(a, b); }
+  static type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+  static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+  static type div(type a, type b) { return _mm512_div_ps(a, b); }
+  static type sqrt(type a) { return _mm512_sqrt_ps(a); }
+  static type swap_pairs(type a) { return _mm512_permute_ps(a, 0xB1); }
+  using mask = __mmask16;
+  static type abs(type a) { return _mm512_abs_ps(a); }
+  static mask eq(type a, type b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+  }
+  static mask lt(type a, type b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+  }
+  static mask le(type a, type b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ);
+  }
+  static mask mask_and(mask a, mask b) { return static_cast<mask>(a & b); }
+  static mask mask_or(mask a, mask b) { return static_cast<mask>(a | b); }
+  static mask mask_andnot(mask a, mask b) { return static_cast<mask>(a & ~b); }
+  static bool all(mask a) { return a == 0xFFFF; }
+};
+
+template <>
+struct SimdTraits<double> {
+  SimdTraits() = delete;
+  using type = __m512d;
+  static constexpr std::size_t size = 8;
+  static constexpr std::size_t alignment = 64;
+  static type load(const double *p) { return _mm512_loadu_pd(p); }
+  static void store(double *p, type a) { _mm512_storeu_pd(p, a); }
+  static type load_aligned(const double *p) { return _mm512_load_pd(p); }
+  static void store_aligned(double *p, type a) { _mm512_store_pd(p, a); }
+  static type set1(double a) { return _mm512_set1_pd(a); }
+  static type add(type a, type b) { return _mm512_add_pd(a, b); }
+  static type sub(type a, type b) { return _mm512_sub_pd(a, b); }
+  static type mul(type a, type b) { return _mm512_mul_pd(a, b); }
+  static type div(type a, type b) { return _mm512_div_pd(a, b); }
+  static type sqrt(type a) { return _mm512_sqrt_pd(a); }
+  static type swap_pairs(type a) { return _mm512_permute_pd(a, 0x55); }
+  using mask = __mmask8;
+  static type abs(type a) { return _mm512_abs_pd(a); }
+  static mask eq(type a, type b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+  }
+  static mask lt(type a, type b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+  }
+  static mask le(type a, type b) {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ);
+  }
+  static mask mask_and(mask a, mask b) { return static_cast<mask>(a & b); }
+  static mask mask_or(mask a, mask b) { return static_cast<mask>(a | b); }
+  static mask mask_andnot(mask a, mask b) { return static_cast<mask>(a & ~b); }
+  static bool all(mask a) { return a == 0xFF; }
+};
+
+#elif defined(MU_SIMD_AVX)
+
+template <>
+struct SimdTraits<float> {
+  SimdTraits() = delete;
+  using type = __m256;
+  static constexpr std::size_t size = 8;
+  static constexpr std::size_t alignment = 32;
+  static type load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, type a) { _mm256_storeu_ps(p, a); }
+  static type load_aligned(const float *p) { return _mm256_load_ps(p); }
+  static void store_aligned(float *p, type a) { _mm256_store_ps(p, a); }
+  static type set1(float a) { return _mm256_set1_ps(a); }
+  static type add(type a, type b) { return _mm256_add_ps(a, b); }
+  static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+  static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+  static type div(type a, type b) { return _mm256_div_ps(a, b); }
+  static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+  static type swap_pairs(type a) { return _mm256_permute_ps(a, 0xB1); }
+  using mask = type;
+  static type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0F), a); }
+  static mask eq(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+  static mask lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static mask le(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+  static mask mask_and(mask a, mask b) { return _mm256_and_ps(a, b); }
+  static mask mask_or(mask a, mask b) { return _mm256_or_ps(a, b); }
+  static mask mask_andnot(mask a, mask b) { return _mm256_andnot_ps(b, a); }
+  static bool all(mask a) { return _mm256_movemask_ps(a) == 0xFF; }
+};
+
+template <>
+struct SimdTraits<double> {
+  SimdTraits() = delete;
+  using type = __m256d;
+  static constexpr std::size_t size = 4;
+  static constexpr std::size_t alignment = 32;
+  static type load(const double *p) { return _mm256_loadu_pd(p); }
+  static void store(double *p, type a) { _mm256_storeu_pd(p, a); }
+  static type load_aligned(const double *p) { return _mm256_load_pd(p); }
+  static void store_aligned(double *p, type a) { _mm256_store_pd(p, a); }
+  static type set1(double a) { return _mm256_set1_pd(a); }
+  static type add(type a, type b) { return _mm256_add_pd(a, b); }
+  static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+  static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+  static type div(type a, type b) { return _mm256_div_pd(a, b); }
+  static type sqrt(type a) { return _mm256_sqrt_pd(a); }
+  static type swap_pairs(type a) { return _mm256_permute_pd(a, 0x5); }
+  using mask = type;
+  static type abs(type a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+  static mask eq(type a, type b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+  static mask lt(type a, type b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+  static mask le(type a, type b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+  static mask mask_and(mask a, mask b) { return _mm256_and_pd(a, b); }
+  static mask mask_or(mask a, mask b) { return _mm256_or_pd(a, b); }
+  static mask mask_andnot(mask a, mask b) { return _mm256_andnot_pd(b, a); }
+  static bool all(mask a) { return _mm256_movemask_pd(a) == 0xF; }
+};
+
+#elif defined(MU_SIMD_SSE)
+
+template <>
+struct SimdTraits<float> {
+  SimdTraits() = delete;
+  using type = __m128;
+  static constexpr std::size_t size = 4;
+  static constexpr std::size_t alignment = 16;
+  static type load(const float *p) { return _mm_loadu_ps(p); }
+  static void store(float *p, type a) { _mm_storeu_ps(p, a); }
+  static type load_aligned(const float *p) { return _mm_load_ps(p); }
+  static void store_aligned(float *p, type a) { _mm_store_ps(p, a); }
+  static type set1(float a) { return _mm_set1_ps(a); }
+  static type add(type a, type b) { return _mm_add_ps(a, b); }
+  static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+  static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+  static type div(type a, type b) { return _mm_div_ps(a, b); }
+  static type sqrt(type a) { return _mm_sqrt_ps(a); }
+  static type swap_pairs(type a) {
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+  }
+  using mask = type;
+  static type abs(type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0F), a); }
+  static mask eq(type a, type b) { return _mm_cmpeq_ps(a, b); }
+  static mask lt(type a, type b) { return _mm_cmplt_ps(a, b); }
+  static mask le(type a, type b) { return _mm_cmple_ps(a, b); }
+  static mask mask_and(mask a, mask b) { return _mm_and_ps(a, b); }
+  static mask mask_or(mask a, mask b) { return _mm_or_ps(a, b); }
+  static mask mask_andnot(mask a, mask b) { return _mm_andnot_ps(b, a); }
+  static bool all(mask a) { return _mm_movemask_ps(a) == 0xF; }
+};
+
+template <>
+struct SimdTraits<double> {
+  SimdTraits() = delete;
+  using type = __m128d;
+  static constexpr std::size_t size = 2;
+  static constexpr std::size_t alignment = 16;
+  static type load(const double *p) { return _mm_loadu_pd(p); }
+  static void store(double *p, type a) { _mm_storeu_pd(p, a); }
+  static type load_aligned(const double *p) { return _mm_load_pd(p); }
+  static void store_aligned(double *p, type a) { _mm_store_pd(p, a); }
+  static type set1(double a) { return _mm_set1_pd(a); }
+  static type add(type a, type b) { return _mm_add_pd(a, b); }
+  static type sub(type a, type b) { return _mm_sub_pd(a, b); }
+  static type mul(type a, type b) { return _mm_mul_pd(a, b); }
+  static type div(type a, type b) { return _mm_div_pd(a, b); }
+  static type sqrt(type a) { return _mm_sqrt_pd(a); }
+  static type swap_pairs(type a) { return _mm_shuffle_pd(a, a, 1); }
+  using mask = type;
+  static type abs(type a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+  static mask eq(type a, type b) { return _mm_cmpeq_pd(a, b); }
+  static mask lt(type a, type b) { return _mm_cmplt_pd(a, b); }
+  static mask le(type a, type b) { return _mm_cmple_pd(a, b); }
+  static mask mask_and(mask a, mask b) { return _mm_and_pd(a, b); }
+  static mask mask_or(mask a, mask b) { return _mm_or_pd(a, b); }
+  static mask mask_andnot(mask a, mask b) { return _mm_andnot_pd(b, a); }
+  static bool all(mask a) { return _mm_movemask_pd(a) == 0x3; }
+};
+
+#endif
+
+/************************** elementwise operations *************************/
+
+/* every operation works on single values (possibly of different types) and
+ * on the registers of a SimdTraits class. the operation on single values is
+ * constexpr, so that it can be used in constant expressions */
+
+struct SimdAdd {
+  template <class T, class U>
+  static constexpr void scalar(T &lhs,  // NOLINT(runtime/references)
+                               const U &rhs) {
+    lhs += rhs;
+  }
+  template <class Traits>
+  static typename Traits::type simd(typename Traits::type lhs,
+                                    typename Traits::type rhs) {
+    return Traits::add(lhs, rhs);
+  }
+};
+
+struct SimdSub {
+  template <class T, class U>
+  static constexpr void scalar(T &lhs,  // NOLINT(runtime/references)
+                               const U &rhs) {
+    lhs -= rhs;
+  }
+  template <class Traits>
+  static typename Traits::type simd(typename Traits::type lhs,
+                                    typename Traits::type rhs) {
+    return Traits::sub(lhs, rhs);
+  }
+};
+
+struct SimdMul {
+  template <class T, class U>
+  static constexpr void scalar(T &lhs,  // NOLINT(runtime/references)
+                               const U &rhs) {
+    lhs *= rhs;
+  }
+  template <class Traits>
+  static typename Traits::type simd(typename Traits::type lhs,
+                                    typename Traits::type rhs) {
+    return Traits::mul(lhs, rhs);
+  }
+};
+
+struct SimdDiv {
+  template <class T, class U>
+  static constexpr void scalar(T &lhs,  // NOLINT(runtime/references)
+                               const U &rhs) {
+    lhs /= rhs;
+  }
+  template <class Traits>
+  static typename Traits::type simd(typename Traits::type lhs,
+                                    typename Traits::type rhs) {
+    return Traits::div(lhs, rhs);
+  }
+};
+
+/******************************** kernels **********************************/
+
+/**
+ * @brief applies an elementwise operation to n values of two different types
+ *
+ * lhs[i] op= rhs[i]. the c++ usual arithmetic conversions apply, so there is
+ * no SIMD implementation
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @param n
+ */
+template <class TOp, class T, class U>
+inline void simd_apply(T *lhs, const U *rhs, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    TOp::scalar(lhs[i], rhs[i]);
+  }
+}
+
+/**
+ * @brief applies an elementwise operation to n values of the same type
+ *
+ * lhs[i] op= rhs[i]. full registers first, the remaining values one by one
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @param n
+ */
+template <class TOp, class T>
+inline void simd_apply(T *lhs, const T *rhs, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  const std::size_t kFull = n - (n % Traits::size);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    Traits::store(lhs + i, TOp::template simd<Traits>(Traits::load(lhs + i),
+                                                      Traits::load(rhs + i)));
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    TOp::scalar(lhs[i], rhs[i]);
+  }
+}
+
+/**
+ * @brief applies an elementwise operation to N values
+ *
+ * the size is known at compile time. see simd_apply(lhs, rhs, n)
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam N
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ */
+template <class TOp, std::size_t N, class T, class U>
+inline void simd_apply(T *lhs, const U *rhs) {
+  simd_apply<TOp>(lhs, rhs, N);
+}
+
+/**
+ * @brief applies an elementwise operation with a scalar of a different type
+ *
+ * lhs[i] op= scalar. the c++ usual arithmetic conversions apply, so there is
+ * no SIMD implementation
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @param n
+ */
+template <class TOp, class T, class TScalar>
+inline void simd_apply_scalar(T *lhs, const TScalar &scalar, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    TOp::scalar(lhs[i], scalar);
+  }
+}
+
+/**
+ * @brief applies an elementwise operation with a scalar of the same type
+ *
+ * lhs[i] op= scalar. the scalar is broadcast to a register once
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam T
+ * @param lhs
+ * @param scalar
+ * @param n
+ */
+template <class TOp, class T>
+inline void simd_apply_scalar(T *lhs, const T &scalar, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  const std::size_t kFull = n - (n % Traits::size);
+  const typename Traits::type kScalar = Traits::set1(scalar);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    Traits::store(lhs + i,
+                  TOp::template simd<Traits>(Traits::load(lhs + i), kScalar));
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    TOp::scalar(lhs[i], scalar);
+  }
+}
+
+/**
+ * @brief applies an elementwise operation with a scalar to N values
+ *
+ * the size is known at compile time. see simd_apply_scalar(lhs, scalar, n)
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam N
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ */
+template <class TOp, std::size_t N, class T, class TScalar>
+inline void simd_apply_scalar(T *lhs, const TScalar &scalar) {
+  simd_apply_scalar<TOp>(lhs, scalar, N);
+}
+
+/**
+ * @brief applies an elementwise operation to n values of the same type at
+ * aligned addresses
+ *
+ * same as simd_apply(lhs, rhs, n) with aligned loads and stores. lhs and rhs
+ * must be aligned to SimdTraits<T>::alignment (checked by an assert), e.g.
+ * with mu::AlignedAllocator in a container before c++17. if n is a multiple of the
+ * register size, there are no remaining values
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @param n
+ */
+template <class TOp, class T>
+inline void simd_apply_aligned(T *lhs, const T *rhs, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  assert(reinterpret_cast<std::uintptr_t>(lhs) % Traits::alignment == 0);
+  assert(reinterpret_cast<std::uintptr_t>(rhs) % Traits::alignment == 0);
+  const std::size_t kFull = n - (n % Traits::size);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    Traits::store_aligned(
+        lhs + i, TOp::template simd<Traits>(Traits::load_aligned(lhs + i),
+                                            Traits::load_aligned(rhs + i)));
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    TOp::scalar(lhs[i], rhs[i]);
+  }
+}
+
+/**
+ * @brief applies an elementwise operation with a scalar to n values at an
+ * aligned address
+ *
+ * same as simd_apply_scalar(lhs, scalar, n) with aligned loads and stores.
+ * lhs must be aligned to SimdTraits<T>::alignment (checked by an assert)
+ *
+ * @tparam TOp SimdAdd, SimdSub, SimdMul or SimdDiv
+ * @tparam T
+ * @param lhs
+ * @param scalar
+ * @param n
+ */
+template <class TOp, class T>
+inline void simd_apply_scalar_aligned(T *lhs, const T &scalar, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  assert(reinterpret_cast<std::uintptr_t>(lhs) % Traits::alignment == 0);
+  const std::size_t kFull = n - (n % Traits::size);
+  const typename Traits::type kScalar = Traits::set1(scalar);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    Traits::store_aligned(lhs + i, TOp::template simd<Traits>(
+                                       Traits::load_aligned(lhs + i), kScalar));
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    TOp::scalar(lhs[i], scalar);
+  }
+}
+
+/**
+ * @brief multiplies n values of two different types and adds the products
+ *
+ * acc[i] += a[i] * b[i]. the c++ usual arithmetic conversions apply, so there
+ * is no SIMD implementation
+ *
+ * @tparam U
+ * @tparam T
+ * @tparam T2
+ * @param acc
+ * @param a
+ * @param b
+ * @param n
+ */
+template <class U, class T, class T2>
+inline void simd_mul_add(U *acc, const T *a, const T2 *b, std::size_t n) {
+  for (std::size_t i = 0; i < n; i++) {
+    acc[i] += a[i] * b[i];
+  }
+}
+
+/**
+ * @brief multiplies n values of the same type and adds the products
+ *
+ * acc[i] += a[i] * b[i]. the multiplication and the addition are rounded
+ * separately, like the scalar expression
+ *
+ * @tparam T
+ * @param acc
+ * @param a
+ * @param b
+ * @param n
+ */
+template <class T>
+inline void simd_mul_add(T *acc, const T *a, const T *b, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  const std::size_t kFull = n - (n % Traits::size);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    Traits::store(acc + i,
+                  Traits::add(Traits::load(acc + i),
+                              Traits::mul(Traits::load(a + i),
+                                          Traits::load(b + i))));
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    acc[i] += a[i] * b[i];
+  }
+}
+
+/**
+ * @brief dot product of n values of the same type
+ *
+ * sum of a[i] * b[i]. the products are added up in several registers that
+ * are independent of each other, so the result can differ from the scalar
+ * loop by the rounding of the additions. the registers and the remaining
+ * values are added up at the end
+ *
+ * @tparam T
+ * @param a
+ * @param b
+ * @param n
+ * @return T
+ */
+template <class T>
+inline T simd_dot(const T *a, const T *b, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  constexpr std::size_t kRegs = 4;
+  constexpr std::size_t kLanes = kRegs * Traits::size;
+  const std::size_t kFull = n - (n % kLanes);
+  typename Traits::type acc[kRegs];
+  for (std::size_t r = 0; r < kRegs; r++) {
+    acc[r] = Traits::set1(T{0});
+  }
+  for (std::size_t i = 0; i < kFull; i += kLanes) {
+    for (std::size_t r = 0; r < kRegs; r++) {
+      const std::size_t kIdx = i + r * Traits::size;
+      acc[r] = Traits::add(
+          acc[r], Traits::mul(Traits::load(a + kIdx), Traits::load(b + kIdx)));
+    }
+  }
+  T lanes[kLanes];
+  for (std::size_t r = 0; r < kRegs; r++) {
+    Traits::store(lanes + r * Traits::size, acc[r]);
+  }
+  T ret{0};
+  for (std::size_t l = 0; l < kLanes; l++) {
+    ret += lanes[l];
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    ret += a[i] * b[i];
+  }
+  return ret;
+}
+
+/**
+ * @brief square root of n values
+ *
+ * p[i] = sqrt(p[i])
+ *
+ * @tparam T
+ * @param p
+ * @param n
+ */
+template <class T>
+inline void simd_sqrt(T *p, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  const std::size_t kFull = n - (n % Traits::size);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    Traits::store(p + i, Traits::sqrt(Traits::load(p + i)));
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    p[i] = static_cast<T>(std::sqrt(p[i]));
+  }
+}
+
+/**
+ * @brief rotates n interleaved pairs of values (x, y) by an angle, given by
+ * its cosine and sine
+ *
+ * out[2i] = x cos - y sin, out[2i + 1] = x sin + y cos. a register holds
+ * several pairs, which are rotated at once by multiplying it and its pair
+ * swapped copy with constant registers. out may be equal to in
+ *
+ * @tparam T
+ * @param out 2n values
+ * @param in 2n values
+ * @param n number of pairs
+ * @param cos
+ * @param sin
+ */
+template <class T>
+inline void simd_rotate_pairs(T *out, const T *in, std::size_t n, T cos,
+                              T sin) {
+  using Traits = SimdTraits<T>;
+  /* the portable implementation has no pairs in a register */
+  const std::size_t kFull =
+      Traits::size > 1 ? 2 * n - ((2 * n) % Traits::size) : 0;
+  T cos_pattern[Traits::size];
+  T sin_pattern[Traits::size];
+  for (std::size_t i = 0; i < Traits::size; i++) {
+    cos_pattern[i] = cos;
+    sin_pattern[i] = (i % 2 == 0) ? -sin : sin;
+  }
+  const typename Traits::type kCos = Traits::load(cos_pattern);
+  const typename Traits::type kSin = Traits::load(sin_pattern);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    const typename Traits::type kXY = Traits::load(in + i);
+    Traits::store(out + i,
+                  Traits::add(Traits::mul(kXY, kCos),
+                              Traits::mul(Traits::swap_pairs(kXY), kSin)));
+  }
+  for (std::size_t i = kFull; i < 2 * n; i += 2) {
+    const T kX = in[i];
+    const T kY = in[i + 1];
+    out[i] = kX * cos - kY * sin;
+    out[i + 1] = kX * sin + kY * cos;
+  }
+}
+
+/**
+ * @brief true if n values are equal to n other values, according to
+ * TypeTraits<T>::equals
+ *
+ * the relative epsilon check without branches: all of its cases are computed
+ * for every lane and the results are combined with masks. the values are
+ * compared one register at a time, so that the first unequal register ends
+ * the comparison and a register of exactly equal values skips the rest
+ *
+ * @tparam T floating point type
+ * @param a
+ * @param b
+ * @param n
+ * @return bool
+ */
+template <class T>
+inline bool simd_equals(const T *a, const T *b, std::size_t n) {
+  using Traits = SimdTraits<T>;
+  using Reg = typename Traits::type;
+  const std::size_t kFull = n - (n % Traits::size);
+  const Reg kZero = Traits::set1(T{0});
+  const Reg kMin = Traits::set1(mu::numeric_limits<T>::min());
+  const Reg kEps = Traits::set1(TypeTraits<T>::epsilon());
+  const Reg kEpsMin =
+      Traits::set1(TypeTraits<T>::epsilon() * mu::numeric_limits<T>::min());
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    const Reg kA = Traits::load(a + i);
+    const Reg kB = Traits::load(b + i);
+    const typename Traits::mask kExact = Traits::eq(kA, kB);
+    /* shortcut. equal values are common and the division is slow */
+    if (Traits::all(kExact)) {
+      continue;
+    }
+    const Reg kAbsDiff = Traits::abs(Traits::sub(kA, kB));
+    /* either value is zero or the difference is extremely small */
+    const typename Traits::mask kNearZero = Traits::mask_or(
+        Traits::mask_or(Traits::eq(kA, kZero), Traits::eq(kB, kZero)),
+        Traits::lt(kAbsDiff, kMin));
+    /* the division of two zeros is NaN, but then the lane is near zero */
+    const typename Traits::mask kRelative = Traits::lt(
+        Traits::div(kAbsDiff, Traits::add(Traits::abs(kA), Traits::abs(kB))),
+        kEps);
+    const typename Traits::mask kEqual = Traits::mask_or(
+        kExact,
+        Traits::mask_or(
+            Traits::mask_and(kNearZero, Traits::lt(kAbsDiff, kEpsMin)),
+            Traits::mask_andnot(kRelative, kNearZero)));
+    if (!Traits::all(kEqual)) {
+      return false;
+    }
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    if (!TypeTraits<T>::equals(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief true if n values are at most ulps apart from n other values
+ *
+ * see mu::equals_ulp. the values are compared in blocks without branches, so
+ * that the compiler can vectorize the integer arithmetic of a block. a block
+ * of exactly equal values skips the integer arithmetic
+ *
+ * @tparam T floating point type
+ * @param a
+ * @param b
+ * @param n
+ * @param ulps
+ * @return bool
+ */
+template <class T>
+inline bool simd_equals_ulp(const T *a, const T *b, std::size_t n,
+                            std::uint64_t ulps) {
+  constexpr std::size_t kBlock = 16;
+  const std::size_t kFull = n - (n % kBlock);
+  for (std::size_t i = 0; i < kFull; i += kBlock) {
+    bool equal = true;
+    for (std::size_t k = i; k < i + kBlock; k++) {
+      equal &= a[k] == b[k];
+    }
+    if (equal) {
+      continue;
+    }
+    equal = true;
+    for (std::size_t k = i; k < i + kBlock; k++) {
+      equal &= mu::equals_ulp(a[k], b[k], ulps);
+    }
+    if (!equal) {
+      return false;
+    }
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    if (a[i] != b[i] && !mu::equals_ulp(a[i], b[i], ulps)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief true if the absolute differences of n values and n other values are
+ * at most max_diff
+ *
+ * see mu::equals_absolute
+ *
+ * @tparam T floating point type
+ * @param a
+ * @param b
+ * @param n
+ * @param max_diff
+ * @return bool
+ */
+template <class T>
+inline bool simd_equals_absolute(const T *a, const T *b, std::size_t n,
+                                 T max_diff) {
+  using Traits = SimdTraits<T>;
+  const std::size_t kFull = n - (n % Traits::size);
+  const typename Traits::type kMaxDiff = Traits::set1(max_diff);
+  for (std::size_t i = 0; i < kFull; i += Traits::size) {
+    const typename Traits::type kA = Traits::load(a + i);
+    const typename Traits::type kB = Traits::load(b + i);
+    if (!Traits::all(Traits::mask_or(
+            Traits::eq(kA, kB),
+            Traits::le(Traits::abs(Traits::sub(kA, kB)), kMaxDiff)))) {
+      return false;
+    }
+  }
+  for (std::size_t i = kFull; i < n; i++) {
+    if (!mu::equals_absolute(a[i], b[i], max_diff)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief true if n values are equal to n other values with a tolerance
+ *
+ * @tparam T floating point type
+ * @param a
+ * @param b
+ * @param n
+ * @param tolerance
+ * @return bool
+ */
+template <class T>
+inline bool simd_equals(const T *a, const T *b, std::size_t n,
+                        const Tolerance &tolerance) {
+  switch (tolerance.mode) {
+    case ToleranceMode::kUlp:
+      return simd_equals_ulp(a, b, n, tolerance.ulps);
+    case ToleranceMode::kAbsolute:
+      return simd_equals_absolute(a, b, n, static_cast<T>(tolerance.max_diff));
+    case ToleranceMode::kRelative:
+    default:
+      return simd_equals(a, b, n);
+  }
+}
+
+/**
+ * @brief merges the mean and the sum of squared differences from the mean
+ * (m2) of two sets of values
+ *
+ * Chan et al. the result is the same as if the values of b were added to a
+ * one at a time, up to rounding
+ *
+ * @tparam U
+ * @param na number of values of a
+ * @param mean mean of a. the merged mean afterwards
+ * @param m2 m2 of a. the merged m2 afterwards
+ * @param nb number of values of b
+ * @param mean_b
+ * @param m2_b
+ */
+template <class U>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void merge_mean_m2(std::size_t na, U &mean, U &m2, std::size_t nb,
+                          U mean_b, U m2_b) {
+  if (nb == 0) {
+    return;
+  }
+  const U kN = static_cast<U>(na + nb);
+  const U kDelta = mean_b - mean;
+  mean += kDelta * static_cast<U>(nb) / kN;
+  m2 += m2_b + kDelta * kDelta * static_cast<U>(na) * static_cast<U>(nb) / kN;
+}
+
+/**
+ * @brief merges the means and the sums of squared differences from the mean
+ * (m2) of k sets of values that have the same size
+ *
+ * the mean is the mean of the means. m2 is the sum of the m2s plus the
+ * squared differences of the means from it, weighted by the size
+ *
+ * @tparam U
+ * @param mean
+ * @param m2
+ * @param means
+ * @param m2s
+ * @param k number of sets
+ * @param size number of values of every set
+ */
+template <class U>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void merge_mean_m2(U &mean, U &m2, const U *means, const U *m2s,
+                          std::size_t k, std::size_t size) {
+  mean = U{0};
+  m2 = U{0};
+  for (std::size_t i = 0; i < k; i++) {
+    mean += means[i];
+    m2 += m2s[i];
+  }
+  mean /= static_cast<U>(k);
+  U spread{0};
+  for (std::size_t i = 0; i < k; i++) {
+    spread += (means[i] - mean) * (means[i] - mean);
+  }
+  m2 += spread * static_cast<U>(size);
+}
+
+/**
+ * @brief mean and sum of squared differences from the mean (m2) of n values
+ * of a different type, in one pass
+ *
+ * Welford's algorithm. the variance is m2 / n. the values are converted to U
+ * first, so there is no SIMD implementation
+ *
+ * @tparam U floating point type
+ * @tparam T
+ * @param p
+ * @param n
+ * @param mean
+ * @param m2
+ */
+template <class U, class T>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void simd_mean_m2(const T *p, std::size_t n, U &mean, U &m2) {
+  mean = U{0};
+  m2 = U{0};
+  for (std::size_t i = 0; i < n; i++) {
+    const U kX = static_cast<U>(p[i]);
+    const U kDelta = kX - mean;
+    mean += kDelta / static_cast<U>(i + 1);
+    m2 += kDelta * (kX - mean);
+  }
+}
+
+/**
+ * @brief mean and sum of squared differences from the mean (m2) of n values,
+ * in one pass
+ *
+ * every SIMD lane runs Welford's algorithm on its own values. the values are
+ * spread over several registers that are updated independently, so that the
+ * updates don't wait for each other. all lanes have seen the same number of
+ * values and share the reciprocal of that count. the lanes and the remaining
+ * values are merged at the end. the variance is m2 / n
+ *
+ * @tparam T floating point type
+ * @param p
+ * @param n
+ * @param mean
+ * @param m2
+ */
+template <class T>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void simd_mean_m2(const T *p, std::size_t n, T &mean, T &m2) {
+  using Traits = SimdTraits<T>;
+  constexpr std::size_t kRegs = 4;
+  constexpr std::size_t kLanes = kRegs * Traits::size;
+  const std::size_t kCount = n / kLanes;
+  const std::size_t kFull = kCount * kLanes;
+  if (kCount < 2) {
+    /* a few values are in the cache anyway. two passes are faster than a
+     * division per value and just as stable */
+    mean = T{0};
+    m2 = T{0};
+    for (std::size_t i = 0; i < n; i++) {
+      mean += p[i];
+    }
+    mean = n > 0 ? mean / static_cast<T>(n) : T{0};
+    for (std::size_t i = 0; i < n; i++) {
+      m2 += (p[i] - mean) * (p[i] - mean);
+    }
+    return;
+  }
+  typename Traits::type lmean[kRegs];
+  typename Traits::type lm2[kRegs];
+  for (std::size_t r = 0; r < kRegs; r++) {
+    lmean[r] = Traits::load(p + r * Traits::size);
+    lm2[r] = Traits::set1(T{0});
+  }
+  for (std::size_t k = 1; k < kCount; k++) {
+    const typename Traits::type kInv =
+        Traits::set1(T{1} / static_cast<T>(k + 1));
+    const T *block = p + k * kLanes;
+    for (std::size_t r = 0; r < kRegs; r++) {
+      const typename Traits::type kX = Traits::load(block + r * Traits::size);
+      const typename Traits::type kDelta = Traits::sub(kX, lmean[r]);
+      lmean[r] = Traits::add(lmean[r], Traits::mul(kDelta, kInv));
+      lm2[r] = Traits::add(lm2[r],
+                           Traits::mul(kDelta, Traits::sub(kX, lmean[r])));
+    }
+  }
+  T means[kLanes];
+  T m2s[kLanes];
+  for (std::size_t r = 0; r < kRegs; r++) {
+    Traits::store(means + r * Traits::size, lmean[r]);
+    Traits::store(m2s + r * Traits::size, lm2[r]);
+  }
+  merge_mean_m2(mean, m2, means, m2s, kLanes, kCount);
+  T tail_mean;
+  T tail_m2;
+  simd_mean_m2<T, T>(p + kFull, n - kFull, tail_mean, tail_m2);
+  merge_mean_m2(kFull, mean, m2, n - kFull, tail_mean, tail_m2);
+}
+
+}  // namespace mu
+#endif  // MU_SIMD_H_
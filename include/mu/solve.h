@@ -0,0 +1,338 @@
+/**
+ * @file solve.h
+ *
+ * matrix decompositions and linear equation systems
+ */
+#ifndef MU_SOLVE_H_
+#define MU_SOLVE_H_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/utility.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief LU decomposition with partial pivoting
+ *
+ * decomposes a square matrix once in O(N^3), so that the determinant, the
+ * inverse and any number of linear equation systems Ax = b can be calculated
+ * from it without decomposing the matrix again. every solve is O(N^2)
+ *
+ * @tparam N
+ * @tparam T floating point type
+ */
+template <std::size_t N, typename T>
+class LU {
+  static_assert(std::is_floating_point<T>::value,
+                "the LU decomposition is only available for floating point "
+                "types");
+
+ public:
+  /**
+   * @brief decomposes a matrix
+   *
+   * @par Example
+   * @snippet example_solve.cpp lu decomposition
+   * @param m
+   */
+  explicit LU(const Matrix<N, N, T> &m) : lu_(m) {
+    swaps_ = mu::lu_decompose<N>(lu_, perm_);
+  }
+
+  /**
+   * @brief true if the matrix is singular, i.e. it has no inverse
+   *
+   * @return bool
+   */
+  bool singular() const noexcept {
+    for (std::size_t i = 0; i < N; i++) {
+      if (lu_[i][i] == T{0}) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief determinant of the matrix
+   *
+   * @return T
+   */
+  T det() const {
+    T ret = (swaps_ % 2 == 0) ? T{1} : T{-1};
+    for (std::size_t i = 0; i < N; i++) {
+      ret *= lu_[i][i];
+    }
+    return ret;
+  }
+
+  /**
+   * @brief solves Ax = b for x
+   *
+   * @param b
+   * @return Vector<N, T> x
+   */
+  Vector<N, T> solve(const Vector<N, T> &b) const {
+    Vector<N, T> ret;
+    mu::lu_solve<N>(lu_, perm_, b, ret);
+    return ret;
+  }
+
+  /**
+   * @brief solves AX = B for X, i.e. for every column of B
+   *
+   * @tparam M
+   * @param b
+   * @return Matrix<N, M, T> X
+   */
+  template <std::size_t M>
+  Matrix<N, M, T> solve(const Matrix<N, M, T> &b) const {
+    Matrix<N, M, T> ret;
+    Vector<N, T> column;
+    Vector<N, T> x;
+    for (std::size_t j = 0; j < M; j++) {
+      for (std::size_t i = 0; i < N; i++) {
+        column[i] = b[i][j];
+      }
+      mu::lu_solve<N>(lu_, perm_, column, x);
+      for (std::size_t i = 0; i < N; i++) {
+        ret[i][j] = x[i];
+      }
+    }
+    return ret;
+  }
+
+  /**
+   * @brief inverse of the matrix
+   *
+   * @return Matrix<N, N, T>
+   */
+  Matrix<N, N, T> inverse() const { return solve(mu::eye<N, T>()); }
+
+  /**
+   * @brief the decomposition
+   *
+   * U on and above the diagonal, L without its unit diagonal below the
+   * diagonal
+   *
+   * @return const Matrix<N, N, T>&
+   */
+  const Matrix<N, N, T> &lu() const noexcept { return lu_; }
+
+  /**
+   * @brief the row permutation. row i of LU is row permutation()[i] of A
+   *
+   * @return const std::array<std::size_t, N>&
+   */
+  const std::array<std::size_t, N> &permutation() const noexcept {
+    return perm_;
+  }
+
+ private:
+  Matrix<N, N, T> lu_;
+  std::array<std::size_t, N> perm_;
+  std::size_t swaps_;
+};
+
+/**
+ * @brief Cholesky decomposition of a symmetric positive definite matrix
+ *
+ * decomposes the matrix into A = LL^T in O(N^3). about twice as fast as the
+ * LU decomposition and numerically stable without pivoting. only the lower
+ * triangle of the matrix is read
+ *
+ * @tparam N
+ * @tparam T floating point type
+ */
+template <std::size_t N, typename T>
+class Cholesky {
+  static_assert(std::is_floating_point<T>::value,
+                "the Cholesky decomposition is only available for floating "
+                "point types");
+
+ public:
+  /**
+   * @brief decomposes a matrix
+   *
+   * @par Example
+   * @snippet example_solve.cpp cholesky decomposition
+   * @param m
+   */
+  explicit Cholesky(const Matrix<N, N, T> &m) : l_{T{0}} {
+    for (std::size_t j = 0; j < N; j++) {
+      T sum = m[j][j];
+      for (std::size_t k = 0; k < j; k++) {
+        sum -= l_[j][k] * l_[j][k];
+      }
+      if (!(sum > T{0})) {
+        positive_definite_ = false;
+        return;
+      }
+      l_[j][j] = mu::sqrt(sum);
+      for (std::size_t i = j + 1; i < N; i++) {
+        T s = m[i][j];
+        for (std::size_t k = 0; k < j; k++) {
+          s -= l_[i][k] * l_[j][k];
+        }
+        l_[i][j] = s / l_[j][j];
+      }
+    }
+  }
+
+  /**
+   * @brief false if the matrix is not (symmetric) positive definite. the
+   * decomposition can't be used in this case
+   *
+   * @return bool
+   */
+  bool positive_definite() const noexcept { return positive_definite_; }
+
+  /**
+   * @brief determinant of the matrix
+   *
+   * @return T
+   */
+  T det() const {
+    T ret{1};
+    for (std::size_t i = 0; i < N; i++) {
+      ret *= l_[i][i];
+    }
+    return ret * ret;
+  }
+
+  /**
+   * @brief solves Ax = b for x
+   *
+   * @param b
+   * @return Vector<N, T> x
+   */
+  Vector<N, T> solve(const Vector<N, T> &b) const {
+    Vector<N, T> ret = b;
+    substitute(ret);
+    return ret;
+  }
+
+  /**
+   * @brief solves AX = B for X, i.e. for every column of B
+   *
+   * @tparam M
+   * @param b
+   * @return Matrix<N, M, T> X
+   */
+  template <std::size_t M>
+  Matrix<N, M, T> solve(const Matrix<N, M, T> &b) const {
+    Matrix<N, M, T> ret;
+    Vector<N, T> x;
+    for (std::size_t j = 0; j < M; j++) {
+      for (std::size_t i = 0; i < N; i++) {
+        x[i] = b[i][j];
+      }
+      substitute(x);
+      for (std::size_t i = 0; i < N; i++) {
+        ret[i][j] = x[i];
+      }
+    }
+    return ret;
+  }
+
+  /**
+   * @brief inverse of the matrix
+   *
+   * @return Matrix<N, N, T>
+   */
+  Matrix<N, N, T> inverse() const { return solve(mu::eye<N, T>()); }
+
+  /**
+   * @brief the lower triangular matrix L
+   *
+   * @return const Matrix<N, N, T>&
+   */
+  const Matrix<N, N, T> &l() const noexcept { return l_; }
+
+ private:
+  Matrix<N, N, T> l_;
+  bool positive_definite_ = true;
+
+  /* Ly = b, then L^Tx = y. in-place */
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void substitute(Vector<N, T> &x) const {
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t k = 0; k < i; k++) {
+        x[i] -= l_[i][k] * x[k];
+      }
+      x[i] /= l_[i][i];
+    }
+    for (std::size_t i = N; i-- > 0;) {
+      for (std::size_t k = i + 1; k < N; k++) {
+        x[i] -= l_[k][i] * x[k];
+      }
+      x[i] /= l_[i][i];
+    }
+  }
+};
+
+/* compile time selection of the solver. sizes up to 4 multiply with the
+ * closed form inverse, larger sizes are decomposed */
+
+template <std::size_t N, std::size_t M, typename T, typename TRhs>
+TRhs solve_fixed(const Matrix<N, M, T> &a, const TRhs &b,
+                 std::true_type /*closed form*/) {
+  return a.inverse().dot(b);
+}
+
+template <std::size_t N, std::size_t M, typename T, typename TRhs>
+TRhs solve_fixed(const Matrix<N, M, T> &a, const TRhs &b,
+                 std::false_type /*closed form*/) {
+  return LU<N, T>(a).solve(b);
+}
+
+/**
+ * @brief solves the linear equation system Ax = b for x
+ *
+ * sizes up to 4x4 use the closed form inverse, larger sizes the LU
+ * decomposition with partial pivoting. to solve for many b with the same A,
+ * use mu::LU or mu::Cholesky directly
+ *
+ * @par Example
+ * @snippet example_solve.cpp solve function
+ * @tparam N
+ * @tparam M
+ * @tparam T floating point type
+ * @param a
+ * @param b
+ * @return Vector<N, T> x
+ */
+template <std::size_t N, std::size_t M, typename T>
+Vector<N, T> solve(const Matrix<N, M, T> &a, const Vector<N, T> &b) {
+  static_assert(N == M, "Matrix dimensions must match to solve a system");
+  return solve_fixed(a, b, std::integral_constant<bool, (N <= 4)>{});
+}
+
+/**
+ * @brief solves the linear equation systems AX = B for X
+ *
+ * see solve(a, b) for vectors
+ *
+ * @par Example
+ * @snippet example_solve.cpp solve matrix function
+ * @tparam N
+ * @tparam M
+ * @tparam T floating point type
+ * @tparam P
+ * @param a
+ * @param b
+ * @return Matrix<N, P, T> X
+ */
+template <std::size_t N, std::size_t M, typename T, std::size_t P>
+Matrix<N, P, T> solve(const Matrix<N, M, T> &a, const Matrix<N, P, T> &b) {
+  static_assert(N == M, "Matrix dimensions must match to solve a system");
+  return solve_fixed(a, b, std::integral_constant<bool, (N <= 4)>{});
+}
+
+}  // namespace mu
+#endif  // MU_SOLVE_H_
@@ -0,0 +1,673 @@
+/**
+ * @file sparse.h
+ *
+ * SparseMatrix class and free functions
+ */
+#ifndef MU_SPARSE_H_
+#define MU_SPARSE_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief storage order of a SparseMatrix
+ */
+enum class SparseFormat {
+  kCSR, /**< compressed sparse rows. the values are stored row by row */
+  kCSC  /**< compressed sparse columns. the values are stored col by col */
+};
+
+/**
+ * @brief a value of a sparse matrix and its position
+ *
+ * @tparam T
+ */
+template <typename T>
+struct Triplet {
+  std::size_t row;
+  std::size_t col;
+  T value;
+};
+
+/**
+ * @brief A matrix that only stores its non-zero values
+ *
+ * the sizes are known at run time. the values of every row (CSR) or column
+ * (CSC) are stored contiguously, ordered by their column (CSR) or row (CSC).
+ * outer_index() has the offset of every row (CSR) or column (CSC) in
+ * inner_index() and values(), plus the total number of values at the end. that
+ * is the layout of most sparse BLAS style kernels.
+ *
+ * the product with a vector only touches the stored values. CSR computes
+ * every value of the result as the dot product of a row, CSC adds up the
+ * scaled columns. see mu::parallel::dot() for the multi-threaded product
+ *
+ * @par Example
+ * @snippet example_sparse.cpp sparse constructor
+ * @tparam T the type of the values inside the matrix
+ * @tparam F SparseFormat::kCSR or SparseFormat::kCSC
+ */
+template <typename T, SparseFormat F = SparseFormat::kCSR>
+class SparseMatrix {
+  static_assert(std::is_arithmetic<T>::value,
+                "SparseMatrix type T must be an arithmetic type");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Construct a new empty SparseMatrix object of size 0x0
+   */
+  SparseMatrix() = default;
+
+  /**
+   * @brief Construct a new SparseMatrix object of size rows x cols without
+   * any values, i.e. all zeros
+   *
+   * @param rows
+   * @param cols
+   */
+  SparseMatrix(size_type rows, size_type cols)
+      : rows_{rows}, cols_{cols}, outer_(outer_size() + 1, 0) {}
+
+  /**
+   * @brief Construct a new SparseMatrix object from a list of values and
+   * their positions
+   *
+   * the triplets can be in any order. the values of triplets with the same
+   * position are added up
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse constructor
+   * @exception std::out_of_range if a position is outside of the matrix
+   * @param rows
+   * @param cols
+   * @param triplets
+   */
+  SparseMatrix(size_type rows, size_type cols,
+               const std::vector<Triplet<T>> &triplets)
+      : SparseMatrix(rows, cols) {
+    /* counting sort by the outer index, then every row (CSR) or column (CSC)
+     * is sorted on its own */
+    for (const auto &t : triplets) {
+      if (t.row >= rows_ || t.col >= cols_) {
+        throw std::out_of_range("SparseMatrix index out of range");
+      }
+      outer_[outer_of(t.row, t.col) + 1]++;
+    }
+    for (size_type o = 0; o < outer_size(); o++) {
+      outer_[o + 1] += outer_[o];
+    }
+    inner_.resize(triplets.size());
+    values_.resize(triplets.size());
+    std::vector<size_type> next(outer_.begin(), outer_.end() - 1);
+    for (const auto &t : triplets) {
+      const size_type kPos = next[outer_of(t.row, t.col)]++;
+      inner_[kPos] = inner_of(t.row, t.col);
+      values_[kPos] = t.value;
+    }
+    sort_and_sum();
+  }
+
+  /**
+   * @brief Construct a new SparseMatrix object from the non-zero values of a
+   * Matrix
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse from matrix constructor
+   * @tparam N
+   * @tparam M
+   * @tparam U
+   * @param m
+   */
+  template <std::size_t N, std::size_t M, class U>
+  explicit SparseMatrix(const Matrix<N, M, U> &m) : SparseMatrix(N, M) {
+    from_dense(m);
+  }
+
+  /**
+   * @brief Construct a new SparseMatrix object from the non-zero values of a
+   * DynMatrix
+   *
+   * @tparam U
+   * @tparam A
+   * @param m
+   */
+  template <class U, class A>
+  explicit SparseMatrix(const DynMatrix<U, A> &m)
+      : SparseMatrix(m.rows(), m.cols()) {
+    from_dense(m);
+  }
+
+  /**
+   * @brief number of rows
+   *
+   * @return size_type
+   */
+  size_type rows() const noexcept { return rows_; }
+
+  /**
+   * @brief number of columns
+   *
+   * @return size_type
+   */
+  size_type cols() const noexcept { return cols_; }
+
+  /**
+   * @brief number of stored values
+   *
+   * @return size_type
+   */
+  size_type nonzeros() const noexcept { return values_.size(); }
+
+  /**
+   * @brief offsets of the rows (CSR) or columns (CSC) in inner_index() and
+   * values()
+   *
+   * rows() + 1 (CSR) or cols() + 1 (CSC) values. the values of row (CSR) or
+   * column (CSC) o are [outer_index()[o], outer_index()[o + 1])
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse storage
+   * @return const size_type*
+   */
+  const size_type *outer_index() const noexcept { return outer_.data(); }
+
+  /**
+   * @brief the column (CSR) or row (CSC) of every stored value
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse storage
+   * @return const size_type*
+   */
+  const size_type *inner_index() const noexcept { return inner_.data(); }
+
+  /**
+   * @brief the stored values
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse storage
+   * @return T*
+   */
+  T *values() noexcept { return values_.data(); }
+
+  /**
+   * @brief the stored values
+   *
+   * @return const T*
+   */
+  const T *values() const noexcept { return values_.data(); }
+
+  /**
+   * @brief the value at a position. zero if it's not stored
+   *
+   * a binary search in the row (CSR) or column (CSC)
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse constructor
+   * @param i row
+   * @param j column
+   * @return T
+   */
+  T operator()(size_type i, size_type j) const {
+    assert(i < rows_ && j < cols_);
+    const size_type kOuter = outer_of(i, j);
+    const auto kFirst = inner_.begin() + outer_[kOuter];
+    const auto kLast = inner_.begin() + outer_[kOuter + 1];
+    const auto kIt = std::lower_bound(kFirst, kLast, inner_of(i, j));
+    if (kIt == kLast || *kIt != inner_of(i, j)) {
+      return T{0};
+    }
+    return values_[kIt - inner_.begin()];
+  }
+
+  /**
+   * @brief all values, including the zeros
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse member functions
+   * @return DynMatrix<T>
+   */
+  DynMatrix<T> to_dense() const {
+    DynMatrix<T> ret(rows_, cols_);
+    for (size_type o = 0; o < outer_size(); o++) {
+      for (size_type k = outer_[o]; k < outer_[o + 1]; k++) {
+        const size_type kRow = F == SparseFormat::kCSR ? o : inner_[k];
+        const size_type kCol = F == SparseFormat::kCSR ? inner_[k] : o;
+        ret[kRow][kCol] = values_[k];
+      }
+    }
+    return ret;
+  }
+
+  /**
+   * @brief the same matrix stored row by row
+   *
+   * O(nonzeros()). a copy if this matrix is CSR already
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse member functions
+   * @return SparseMatrix<T, SparseFormat::kCSR>
+   */
+  SparseMatrix<T, SparseFormat::kCSR> to_csr() const {
+    return converted<SparseFormat::kCSR>(
+        std::integral_constant<bool, F == SparseFormat::kCSR>{});
+  }
+
+  /**
+   * @brief the same matrix stored column by column
+   *
+   * O(nonzeros()). a copy if this matrix is CSC already
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse member functions
+   * @return SparseMatrix<T, SparseFormat::kCSC>
+   */
+  SparseMatrix<T, SparseFormat::kCSC> to_csc() const {
+    return converted<SparseFormat::kCSC>(
+        std::integral_constant<bool, F == SparseFormat::kCSC>{});
+  }
+
+  /**
+   * @brief creates and returns the transposed matrix in the same format
+   *
+   * O(nonzeros()). the CSR arrays of the transposed matrix are the CSC arrays
+   * of this matrix and vice versa
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse member functions
+   * @return SparseMatrix
+   */
+  SparseMatrix transposed() const {
+    SparseMatrix ret;
+    ret.rows_ = cols_;
+    ret.cols_ = rows_;
+    swap_order(ret);
+    return ret;
+  }
+
+  /**
+   * @brief product of a sparse matrix and a vector
+   *
+   * the size of the vector must be equal to the number of columns. only the
+   * stored values are multiplied
+   *
+   * For two objects of different types, specifying the return type is required.
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse dot function
+   * @tparam U
+   * @tparam T2
+   * @tparam A2
+   * @param rhs
+   * @return DynVector<R, mu::rebind_alloc_t<A2, R>> with R the type of the
+   * result
+   */
+  template <typename U = void, typename T2, class A2,
+            class R = std::conditional_t<std::is_same<U, void>::value, T, U>>
+  DynVector<R, mu::rebind_alloc_t<A2, R>> dot(
+      const DynVector<T2, A2> &rhs) const {
+    static_assert(std::is_same<T, T2>::value || !std::is_same<U, void>::value,
+                  "SparseMatrix and DynVector types are different. please "
+                  "specify the return type. e.g. \"mat.dot<float>(vec);\"");
+    assert(cols_ == rhs.size());
+    DynVector<R, mu::rebind_alloc_t<A2, R>> ret(
+        rows_, mu::rebind_alloc_t<A2, R>(rhs.get_allocator()));
+    multiply(rhs.data(), ret.data(), 0, outer_size());
+    return ret;
+  }
+
+  /**
+   * @brief product of a sparse matrix and a Vector of fixed size
+   *
+   * see dot(const DynVector &). the number of rows is only known at run time,
+   * so the result is a DynVector
+   *
+   * @par Example
+   * @snippet example_sparse.cpp sparse dot function
+   * @tparam U
+   * @tparam M
+   * @tparam T2
+   * @param rhs
+   * @return DynVector<R> with R the type of the result
+   */
+  template <typename U = void, std::size_t M, typename T2,
+            class R = std::conditional_t<std::is_same<U, void>::value, T, U>>
+  DynVector<R> dot(const Vector<M, T2> &rhs) const {
+    static_assert(std::is_same<T, T2>::value || !std::is_same<U, void>::value,
+                  "SparseMatrix and Vector types are different. please "
+                  "specify the return type. e.g. \"mat.dot<float>(vec);\"");
+    assert(cols_ == M);
+    DynVector<R> ret(rows_);
+    multiply(rhs.data(), ret.data(), 0, outer_size());
+    return ret;
+  }
+
+  /**
+   * @brief partial product with a vector. the kernel of dot()
+   *
+   * CSR: y[i] = row i times x for the rows [begin, end) \n
+   * CSC: y += column j times x[j] for the columns [begin, end). y must be
+   * initialized, e.g. with zeros
+   *
+   * x has cols() values, y has rows() values
+   *
+   * @tparam T2
+   * @tparam R
+   * @param x
+   * @param y
+   * @param begin
+   * @param end
+   */
+  template <class T2, class R>
+  void multiply(const T2 *x, R *y, size_type begin, size_type end) const {
+    assert(begin <= end && end <= outer_size());
+    multiply(x, y, begin, end,
+             std::integral_constant<bool, F == SparseFormat::kCSR>{});
+  }
+
+ private:
+  size_type rows_{0};
+  size_type cols_{0};
+  std::vector<size_type> outer_ = std::vector<size_type>(1, 0);
+  std::vector<size_type> inner_;
+  std::vector<T> values_;
+
+  template <typename, SparseFormat>
+  friend class SparseMatrix;
+
+  size_type outer_size() const noexcept {
+    return F == SparseFormat::kCSR ? rows_ : cols_;
+  }
+
+  size_type inner_size() const noexcept {
+    return F == SparseFormat::kCSR ? cols_ : rows_;
+  }
+
+  static size_type outer_of(size_type i, size_type j) noexcept {
+    return F == SparseFormat::kCSR ? i : j;
+  }
+
+  static size_type inner_of(size_type i, size_type j) noexcept {
+    return F == SparseFormat::kCSR ? j : i;
+  }
+
+  /* the non-zero values of anything that can be indexed as m[i][j] */
+  template <class TDense>
+  void from_dense(const TDense &m) {
+    for (size_type o = 0; o < outer_size(); o++) {
+      for (size_type in = 0; in < inner_size(); in++) {
+        const auto kValue = F == SparseFormat::kCSR ? m[o][in] : m[in][o];
+        if (kValue != 0) {
+          inner_.push_back(in);
+          values_.push_back(static_cast<T>(kValue));
+        }
+      }
+      outer_[o + 1] = inner_.size();
+    }
+  }
+
+  /* sorts every row (CSR) or column (CSC) by the inner index and adds up the
+   * values with the same position. the order of the values with the same
+   * position is kept, so the sum is deterministic */
+  void sort_and_sum() {
+    std::vector<std::pair<size_type, T>> segment;
+    size_type write = 0;
+    for (size_type o = 0; o < outer_size(); o++) {
+      segment.clear();
+      for (size_type k = outer_[o]; k < outer_[o + 1]; k++) {
+        segment.emplace_back(inner_[k], values_[k]);
+      }
+      std::stable_sort(segment.begin(), segment.end(),
+                       [](const std::pair<size_type, T> &a,
+                          const std::pair<size_type, T> &b) {
+                         return a.first < b.first;
+                       });
+      outer_[o] = write;
+      for (std::size_t s = 0; s < segment.size(); s++) {
+        if (s > 0 && segment[s].first == segment[s - 1].first) {
+          values_[write - 1] += segment[s].second;
+        } else {
+          inner_[write] = segment[s].first;
+          values_[write] = segment[s].second;
+          write++;
+        }
+      }
+    }
+    outer_[outer_size()] = write;
+    inner_.resize(write);
+    values_.resize(write);
+  }
+
+  /* the values in the other order, i.e. the outer and inner index swapped.
+   * both the transpose and the conversion between CSR and CSC. the values of
+   * every outer index of the result are ordered, since the outer indices of
+   * this matrix are visited in order */
+  template <SparseFormat F2>
+  void swap_order(SparseMatrix<T, F2> &ret) const {
+    ret.outer_.assign(inner_size() + 1, 0);
+    ret.inner_.resize(nonzeros());
+    ret.values_.resize(nonzeros());
+    for (const auto &in : inner_) {
+      ret.outer_[in + 1]++;
+    }
+    for (size_type in = 0; in < inner_size(); in++) {
+      ret.outer_[in + 1] += ret.outer_[in];
+    }
+    std::vector<size_type> next(ret.outer_.begin(), ret.outer_.end() - 1);
+    for (size_type o = 0; o < outer_size(); o++) {
+      for (size_type k = outer_[o]; k < outer_[o + 1]; k++) {
+        const size_type kPos = next[inner_[k]]++;
+        ret.inner_[kPos] = o;
+        ret.values_[kPos] = values_[k];
+      }
+    }
+  }
+
+  template <SparseFormat F2>
+  SparseMatrix<T, F2> converted(std::true_type /*same format*/) const {
+    SparseMatrix<T, F2> ret;
+    ret.rows_ = rows_;
+    ret.cols_ = cols_;
+    ret.outer_ = outer_;
+    ret.inner_ = inner_;
+    ret.values_ = values_;
+    return ret;
+  }
+
+  template <SparseFormat F2>
+  SparseMatrix<T, F2> converted(std::false_type /*same format*/) const {
+    SparseMatrix<T, F2> ret;
+    ret.rows_ = rows_;
+    ret.cols_ = cols_;
+    swap_order(ret);
+    return ret;
+  }
+
+  /* the rows are independent of each other */
+  template <class T2, class R>
+  void multiply(const T2 *x, R *y, size_type begin, size_type end,
+                std::true_type /*csr*/) const {
+    for (size_type i = begin; i < end; i++) {
+      R sum{0};
+      for (size_type k = outer_[i]; k < outer_[i + 1]; k++) {
+        sum += values_[k] * x[inner_[k]];
+      }
+      y[i] = sum;
+    }
+  }
+
+  /* every column is added to the result */
+  template <class T2, class R>
+  void multiply(const T2 *x, R *y, size_type begin, size_type end,
+                std::false_type /*csr*/) const {
+    for (size_type j = begin; j < end; j++) {
+      const T2 kX = x[j];
+      for (size_type k = outer_[j]; k < outer_[j + 1]; k++) {
+        y[inner_[k]] += values_[k] * kX;
+      }
+    }
+  }
+};
+
+/************************* convenience functions ***************************/
+
+/**
+ * @brief A sparse matrix stored row by row
+ *
+ * @tparam T
+ */
+template <typename T>
+using CsrMatrix = SparseMatrix<T, SparseFormat::kCSR>;
+
+/**
+ * @brief A sparse matrix stored column by column
+ *
+ * @tparam T
+ */
+template <typename T>
+using CscMatrix = SparseMatrix<T, SparseFormat::kCSC>;
+
+template <typename T, SparseFormat F>
+SparseMatrix<T, F> transposed(const SparseMatrix<T, F> &m) {
+  return m.transposed();
+}
+
+template <typename U = void, typename T, SparseFormat F, typename T2,
+          class A2>
+auto dot(const SparseMatrix<T, F> &lhs, const DynVector<T2, A2> &rhs)
+    -> decltype(lhs.template dot<U>(rhs)) {
+  return lhs.template dot<U>(rhs);
+}
+
+template <typename U = void, typename T, SparseFormat F, std::size_t M,
+          typename T2>
+auto dot(const SparseMatrix<T, F> &lhs, const Vector<M, T2> &rhs)
+    -> decltype(lhs.template dot<U>(rhs)) {
+  return lhs.template dot<U>(rhs);
+}
+
+namespace parallel {
+
+/* the rows of the result are split between the threads. a chunk has about
+ * chunk_size() stored values, so that rows with more values are balanced */
+template <class R, class T, class T2>
+void sparse_multiply(ThreadPool &pool, const SparseMatrix<T> &lhs, const T2 *x,
+                     R *y) {
+  const std::size_t kChunk = std::max<std::size_t>(
+      1, chunk_size<T>() * lhs.rows() /
+             std::max<std::size_t>(lhs.nonzeros(), 1));
+  for_chunks(pool, lhs.rows(), kChunk,
+             [&lhs, x, y](std::size_t begin, std::size_t end) {
+               lhs.multiply(x, y, begin, end);
+             });
+}
+
+/* the columns are split between the threads. every thread adds its columns
+ * up in its own result, which are added up at the end */
+template <class R, class T, class T2>
+void sparse_multiply(ThreadPool &pool,
+                     const SparseMatrix<T, SparseFormat::kCSC> &lhs,
+                     const T2 *x, R *y) {
+  const std::size_t kRows = lhs.rows();
+  const std::size_t kTasks = pool.size() + 1;
+  const std::size_t kChunk = (lhs.cols() + kTasks - 1) / kTasks;
+  std::vector<std::vector<R>> partial(kTasks);
+  for_chunks(pool, lhs.cols(), kChunk,
+             [&lhs, &partial, x, kRows, kChunk](std::size_t begin,
+                                                 std::size_t end) {
+               std::vector<R> &part = partial[begin / kChunk];
+               part.assign(kRows, R{0});
+               lhs.multiply(x, part.data(), begin, end);
+             });
+  for_chunks(pool, kRows, chunk_size<R>(),
+             [&partial, y](std::size_t begin, std::size_t end) {
+               std::fill(y + begin, y + end, R{0});
+               for (const auto &part : partial) {
+                 /* empty if there were less columns than tasks */
+                 if (part.empty()) {
+                   continue;
+                 }
+                 for (std::size_t i = begin; i < end; i++) {
+                   y[i] += part[i];
+                 }
+               }
+             });
+}
+
+/**
+ * @brief product of a sparse matrix and a vector in parallel
+ *
+ * CSR splits the rows between the threads. CSC splits the columns, every
+ * thread has its own result of rows() values that are added up at the end.
+ * the result is the same as the one of SparseMatrix::dot()
+ *
+ * @par Example
+ * @snippet example_sparse.cpp sparse parallel dot function
+ * @tparam U
+ * @tparam T
+ * @tparam F
+ * @tparam T2
+ * @tparam A2
+ * @param pool
+ * @param lhs
+ * @param rhs
+ * @return DynVector<R, mu::rebind_alloc_t<A2, R>> with R the type of the
+ * result
+ */
+template <typename U = void, typename T, SparseFormat F, typename T2,
+          class A2,
+          class R = std::conditional_t<std::is_same<U, void>::value, T, U>>
+// NOLINTNEXTLINE(runtime/references) the pool is shared, not copied
+DynVector<R, mu::rebind_alloc_t<A2, R>> dot(ThreadPool &pool,
+                                           const SparseMatrix<T, F> &lhs,
+                                           const DynVector<T2, A2> &rhs) {
+  static_assert(std::is_same<T, T2>::value || !std::is_same<U, void>::value,
+                "SparseMatrix and DynVector types are different. please "
+                "specify the return type. e.g. \"dot<float>(mat, vec);\"");
+  assert(lhs.cols() == rhs.size());
+  DynVector<R, mu::rebind_alloc_t<A2, R>> ret(
+      lhs.rows(), mu::rebind_alloc_t<A2, R>(rhs.get_allocator()));
+  sparse_multiply(pool, lhs, rhs.data(), ret.data());
+  return ret;
+}
+
+/**
+ * @brief product of a sparse matrix and a vector in parallel
+ *
+ * uses the default pool
+ *
+ * @tparam U
+ * @tparam T
+ * @tparam F
+ * @tparam T2
+ * @tparam A2
+ * @param lhs
+ * @param rhs
+ * @return DynVector<R, mu::rebind_alloc_t<A2, R>> with R the type of the
+ * result
+ */
+template <typename U = void, typename T, SparseFormat F, typename T2,
+          class A2>
+auto dot(const SparseMatrix<T, F> &lhs, const DynVector<T2, A2> &rhs)
+    -> decltype(dot<U>(default_pool(), lhs, rhs)) {
+  return dot<U>(default_pool(), lhs, rhs);
+}
+
+}  // namespace parallel
+}  // namespace mu
+#endif  // MU_SPARSE_H_
@@ -0,0 +1,222 @@
+/**
+ * @file statistics.h
+ *
+ * RunningStats class
+ */
+#ifndef MU_STATISTICS_H_
+#define MU_STATISTICS_H_
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "mu/matrix.h"
+#include "mu/utility.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief statistics of a stream of Vectors
+ *
+ * tracks the per-component mean, variance, minimum and maximum and the
+ * covariance of all samples that were pushed, without storing them. every
+ * update is O(N^2) because of the covariance, the memory is constant.
+ *
+ * the mean and the co-moments are updated with Welford's algorithm, so the
+ * results stay accurate for long streams and for values with a large offset.
+ * two objects can be merged, e.g. the partial results of several threads
+ *
+ * @tparam N size of the samples
+ * @tparam T floating point type
+ */
+template <std::size_t N, class T>
+class RunningStats {
+  static_assert(N != 0, "size cannot be zero");
+  static_assert(std::is_floating_point<T>::value,
+                "RunningStats is only available for floating point types");
+
+ public:
+  /**
+   * @brief Construct a new RunningStats object without any samples
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats push function
+   */
+  RunningStats() = default;
+
+  /**
+   * @brief adds a sample
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats push function
+   * @param sample
+   */
+  void push(const Vector<N, T> &sample) {
+    count_++;
+    const T kInv = T{1} / static_cast<T>(count_);
+    Vector<N, T> delta;
+    for (std::size_t i = 0; i < N; i++) {
+      delta[i] = sample[i] - mean_[i];
+      mean_[i] += delta[i] * kInv;
+      min_[i] = mu::min(min_[i], sample[i]);
+      max_[i] = mu::max(max_[i], sample[i]);
+    }
+    /* the co-moment uses the difference to the old and to the new mean */
+    for (std::size_t i = 0; i < N; i++) {
+      const T kDelta = sample[i] - mean_[i];
+      for (std::size_t j = 0; j < N; j++) {
+        comoment_[i][j] += kDelta * delta[j];
+      }
+    }
+  }
+
+  /**
+   * @brief adds all samples of another object
+   *
+   * the result is the same as if every sample of the other object had been
+   * pushed to this one, up to rounding (Chan et al.)
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats merge function
+   * @param other
+   * @return RunningStats& this object
+   */
+  RunningStats &merge(const RunningStats &other) {
+    if (other.count_ == 0) {
+      return *this;
+    }
+    if (count_ == 0) {
+      *this = other;
+      return *this;
+    }
+    const T kNa = static_cast<T>(count_);
+    const T kNb = static_cast<T>(other.count_);
+    const T kN = kNa + kNb;
+    Vector<N, T> delta;
+    for (std::size_t i = 0; i < N; i++) {
+      delta[i] = other.mean_[i] - mean_[i];
+      mean_[i] += delta[i] * kNb / kN;
+      min_[i] = mu::min(min_[i], other.min_[i]);
+      max_[i] = mu::max(max_[i], other.max_[i]);
+    }
+    const T kWeight = kNa * kNb / kN;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < N; j++) {
+        comoment_[i][j] +=
+            other.comoment_[i][j] + delta[i] * delta[j] * kWeight;
+      }
+    }
+    count_ += other.count_;
+    return *this;
+  }
+
+  /**
+   * @brief removes all samples
+   */
+  void clear() { *this = RunningStats(); }
+
+  /**
+   * @brief number of samples
+   *
+   * @return std::size_t
+   */
+  std::size_t count() const noexcept { return count_; }
+
+  /**
+   * @brief per-component mean. zero without any samples
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats push function
+   * @return const Vector<N, T>&
+   */
+  const Vector<N, T> &mean() const noexcept { return mean_; }
+
+  /**
+   * @brief per-component (population) variance
+   *
+   * \f$ \sigma^2 = \frac{\sum(x_i - \mu)^2}{n} \f$
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats push function
+   * @return Vector<N, T>
+   */
+  Vector<N, T> variance() const { return comoment_.diag() / divisor(0); }
+
+  /**
+   * @brief per-component sample variance (Bessel's correction)
+   *
+   * \f$ s^2 = \frac{\sum(x_i - \mu)^2}{n - 1} \f$
+   *
+   * @return Vector<N, T>
+   */
+  Vector<N, T> sample_variance() const {
+    return comoment_.diag() / divisor(1);
+  }
+
+  /**
+   * @brief per-component (population) standard deviation
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats push function
+   * @return Vector<N, T>
+   */
+  Vector<N, T> std() const {
+    Vector<N, T> ret = variance();
+    for (auto &item : ret) {
+      item = mu::sqrt(item);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief (population) covariance matrix
+   *
+   * the diagonal is the variance
+   *
+   * @par Example
+   * @snippet example_statistics.cpp runningstats covariance function
+   * @return Matrix<N, N, T>
+   */
+  Matrix<N, N, T> covariance() const { return comoment_ / divisor(0); }
+
+  /**
+   * @brief sample covariance matrix (Bessel's correction)
+   *
+   * @return Matrix<N, N, T>
+   */
+  Matrix<N, N, T> sample_covariance() const {
+    return comoment_ / divisor(1);
+  }
+
+  /**
+   * @brief per-component minimum. the largest value of T without any samples
+   *
+   * @return const Vector<N, T>&
+   */
+  const Vector<N, T> &min() const noexcept { return min_; }
+
+  /**
+   * @brief per-component maximum. the lowest value of T without any samples
+   *
+   * @return const Vector<N, T>&
+   */
+  const Vector<N, T> &max() const noexcept { return max_; }
+
+ private:
+  std::size_t count_ = 0;
+  Vector<N, T> mean_ = Vector<N, T>{T{0}};
+  Vector<N, T> min_ = Vector<N, T>{std::numeric_limits<T>::max()};
+  Vector<N, T> max_ = Vector<N, T>{std::numeric_limits<T>::lowest()};
+  /* sum of the products of the differences from the mean */
+  Matrix<N, N, T> comoment_ = Matrix<N, N, T>{T{0}};
+
+  /* count minus the degrees of freedom. NaN if there are too few samples */
+  T divisor(std::size_t ddof) const {
+    return count_ > ddof ? static_cast<T>(count_ - ddof)
+                         : std::numeric_limits<T>::quiet_NaN();
+  }
+};
+
+}  // namespace mu
+#endif  // MU_STATISTICS_H_
@@ -1,9 +1,13 @@
 #ifndef MU_TYPETRAITS_H_
 #define MU_TYPETRAITS_H_
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 #include "mu/literals.h"
 #include "mu/utility.h"
@@ -85,6 +89,176 @@ constexpr bool TypeTraitsFloatingPoint<T>::equals(const T lhs, const T rhs) {
   return (kAbsDiff / (kAbsLhs + kAbsRhs)) < TypeTraits<T>::epsilon();
 }
 
+/******************************* Tolerance *********************************/
+
+/**
+ * @brief comparison modes of mu::equals
+ */
+enum class ToleranceMode {
+  kRelative, /* relative epsilon check of TypeTraits<T>::equals */
+  kUlp,      /* at most a number of units in the last place (ulps) apart */
+  kAbsolute  /* the absolute difference is at most a maximum */
+};
+
+/**
+ * @brief how close two values must be to be considered equal
+ *
+ * in every mode, values that are == are equal (e.g. two infinities) and NaN
+ * is never equal. the ulps are the number of representable values between
+ * two floating point values. integral values are one ulp apart
+ *
+ * @code
+ * mu::equals(a, b, mu::Tolerance::ulp(4));
+ * mu::equals(a, b, mu::Tolerance::absolute(1e-3));
+ * @endcode
+ */
+struct Tolerance {
+  ToleranceMode mode;
+  std::uint64_t ulps;
+  long double max_diff;
+
+  /* TypeTraits<T>::equals, the same as operator== */
+  static constexpr Tolerance relative() {
+    return {ToleranceMode::kRelative, 0, 0.0L};
+  }
+  static constexpr Tolerance ulp(std::uint64_t ulps) {
+    return {ToleranceMode::kUlp, ulps, 0.0L};
+  }
+  static constexpr Tolerance absolute(long double max_diff) {
+    return {ToleranceMode::kAbsolute, 0, max_diff};
+  }
+};
+
+/* the ulps between two float or double values. their bits are mapped to
+ * integers that are ordered like the values, i.e. -0 and +0 are both 0 and a
+ * negative value is the negated bits of its magnitude. the result for NaN is
+ * meaningless, so callers check for it */
+template <class TUInt, class T>
+inline std::uint64_t ulp_distance_bits(T lhs, T rhs) {
+  static_assert(sizeof(TUInt) == sizeof(T), "integer must have the same size");
+  constexpr TUInt kSign = TUInt{1} << (sizeof(TUInt) * 8 - 1);
+  TUInt lhs_bits;
+  TUInt rhs_bits;
+  std::memcpy(&lhs_bits, &lhs, sizeof(T));
+  std::memcpy(&rhs_bits, &rhs, sizeof(T));
+  const std::int64_t kMagLhs = static_cast<std::int64_t>(lhs_bits & ~kSign);
+  const std::int64_t kMagRhs = static_cast<std::int64_t>(rhs_bits & ~kSign);
+  const std::int64_t kLhs = (lhs_bits & kSign) != 0 ? -kMagLhs : kMagLhs;
+  const std::int64_t kRhs = (rhs_bits & kSign) != 0 ? -kMagRhs : kMagRhs;
+  /* the difference of two doubles doesn't fit into int64 */
+  const std::uint64_t kULhs = static_cast<std::uint64_t>(kLhs);
+  const std::uint64_t kURhs = static_cast<std::uint64_t>(kRhs);
+  return kLhs >= kRhs ? kULhs - kURhs : kURhs - kULhs;
+}
+
+/**
+ * @brief true if two floating point values are at most ulps apart
+ *
+ * every other floating point type (long double) steps through the values with
+ * std::nextafter, so it takes time linear in ulps
+ *
+ * @tparam T floating point type
+ * @param lhs
+ * @param rhs
+ * @param ulps
+ * @return bool
+ */
+template <class T>
+inline bool equals_ulp(T lhs, T rhs, std::uint64_t ulps) {
+  if (lhs == rhs) {
+    return true;
+  }
+  /* false for NaN */
+  if (!(lhs < rhs) && !(rhs < lhs)) {
+    return false;
+  }
+  const T kTo = std::max(lhs, rhs);
+  T x = std::min(lhs, rhs);
+  for (std::uint64_t i = 0; i < ulps && x < kTo; i++) {
+    x = std::nextafter(x, kTo);
+  }
+  return x == kTo;
+}
+
+/* branchless, so that loops over many values are vectorized */
+inline bool equals_ulp(float lhs, float rhs, std::uint64_t ulps) {
+  return (lhs == rhs) | ((lhs == lhs) & (rhs == rhs) &
+                         (ulp_distance_bits<std::uint32_t>(lhs, rhs) <= ulps));
+}
+
+/* see above */
+inline bool equals_ulp(double lhs, double rhs, std::uint64_t ulps) {
+  return (lhs == rhs) | ((lhs == lhs) & (rhs == rhs) &
+                         (ulp_distance_bits<std::uint64_t>(lhs, rhs) <= ulps));
+}
+
+/**
+ * @brief true if the absolute difference of two floating point values is at
+ * most max_diff
+ *
+ * @tparam T floating point type
+ * @param lhs
+ * @param rhs
+ * @param max_diff
+ * @return bool
+ */
+template <class T>
+inline bool equals_absolute(T lhs, T rhs, T max_diff) {
+  return (lhs == rhs) | (std::abs(lhs - rhs) <= max_diff);
+}
+
+/* floating point values */
+template <class T>
+inline bool equals(T lhs, T rhs, const Tolerance &tolerance,
+                   std::true_type /*floating point*/) {
+  switch (tolerance.mode) {
+    case ToleranceMode::kUlp:
+      return equals_ulp(lhs, rhs, tolerance.ulps);
+    case ToleranceMode::kAbsolute:
+      return equals_absolute(lhs, rhs, static_cast<T>(tolerance.max_diff));
+    case ToleranceMode::kRelative:
+    default:
+      return TypeTraits<T>::equals(lhs, rhs);
+  }
+}
+
+/* integral values. they are exact, one ulp is a difference of one */
+template <class T>
+inline bool equals(T lhs, T rhs, const Tolerance &tolerance,
+                   std::false_type /*floating point*/) {
+  /* the difference of the extremes of a signed type only fits unsigned */
+  const std::uint64_t kULhs = static_cast<std::uint64_t>(lhs);
+  const std::uint64_t kURhs = static_cast<std::uint64_t>(rhs);
+  const std::uint64_t kDiff = lhs > rhs ? kULhs - kURhs : kURhs - kULhs;
+  switch (tolerance.mode) {
+    case ToleranceMode::kUlp:
+      return kDiff <= tolerance.ulps;
+    case ToleranceMode::kAbsolute:
+      return static_cast<long double>(kDiff) <= tolerance.max_diff;
+    case ToleranceMode::kRelative:
+    default:
+      return lhs == rhs;
+  }
+}
+
+/**
+ * @brief equality check of two values with a tolerance
+ *
+ * @code
+ * mu::equals(1.0F, std::nextafter(1.0F, 2.0F), mu::Tolerance::ulp(1)); // true
+ * @endcode
+ *
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @param tolerance
+ * @return bool
+ */
+template <class T>
+inline bool equals(T lhs, T rhs, const Tolerance &tolerance) {
+  return equals(lhs, rhs, tolerance, std::is_floating_point<T>{});
+}
+
 /******************* unwrap std::reference_wrapper *************************/
 
 /* helper struct. must never be instantiated by itself */
@@ -113,13 +287,13 @@ using unwrap_ref_t = typename UnwrapRef<T>::type;
  * https://stackoverflow.com/questions/65310179/initialize-double-nested-stdarray-from-variadic-template-array-reference-const
  */
 template <std::size_t N, typename T, std::size_t... Is>
-std::array<T, N> to_array_impl(const T (&arr)[N],
+constexpr std::array<T, N> to_array_impl(const T (&arr)[N],
                                std::index_sequence<Is...> /*unused*/) {
   return std::array<T, N>{arr[Is]...};
 }
 
 template <std::size_t N, typename T>
-std::array<T, N> to_array(const T (&arr)[N]) {
+constexpr std::array<T, N> to_array(const T (&arr)[N]) {
   return to_array_impl(arr, std::make_index_sequence<N>{});
 }
 
@@ -137,5 +311,36 @@ struct conjunction<Head, Tail...>
 template <bool B>
 struct conjunction<B> : std::integral_constant<bool, B> {};
 
+/* is_constant_evaluated helper (c++20 has std::is_constant_evaluated)
+ * true while a constant expression is evaluated. constexpr functions use it to
+ * fall back to a portable loop instead of the SIMD kernels, which can't be
+ * evaluated at compile time. the builtin is available in GCC >= 9, Clang >= 9
+ * and MSVC >= 19.25. without it, the portable loop is always used */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define MU_HAS_IS_CONSTANT_EVALUATED
+#endif
+#endif
+#if !defined(MU_HAS_IS_CONSTANT_EVALUATED) &&                     \
+    ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+     (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define MU_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+constexpr bool is_constant_evaluated() noexcept {
+#if defined(MU_HAS_IS_CONSTANT_EVALUATED)
+  return __builtin_is_constant_evaluated();
+#else
+  return true;
+#endif
+}
+
+/* tag of the constructors that leave the values uninitialized, for results
+ * that are overwritten completely. constant expressions require every object
+ * to be initialized, so constexpr functions only use them at run time, e.g.
+ * is_constant_evaluated() ? Vector<N, T>{} : Vector<N, T>(mu::uninitialized) */
+struct Uninitialized {};
+constexpr Uninitialized uninitialized{};
+
 }  // namespace mu
 #endif  // MU_TYPETRAITS_H_
\ No newline at end of file
@@ -7,8 +7,14 @@
 #define MU_UTILITY_H_
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace mu {
@@ -46,10 +52,267 @@ using std::tan;
 using std::numeric_limits;
 
 /**
- * @brief calulates the determinant of an arbitrary matrix
+ * @brief sine and cosine of the same angle
  *
- * see
- * https://stackoverflow.com/questions/7898305/calculating-the-determinant-in-c
+ * compilers merge the two calls into a single sincos call (GCC, Clang with
+ * glibc), which calculates both for about the cost of one of them
+ *
+ * @tparam T floating point type
+ * @param angle [rad]
+ * @param sin
+ * @param cos
+ */
+template <typename T>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void sincos(T angle, T &sin, T &cos) {
+  static_assert(std::is_floating_point<T>::value,
+                "sincos is only available for floating point types");
+  sin = std::sin(angle);
+  cos = std::cos(angle);
+}
+
+/******************************* determinant ********************************/
+
+/* the determinant functions work on any square "matrix" that can be indexed
+ * twice, i.e. m[i][j]. e.g. std::array<mu::Vector<N, T>, N> (the storage of
+ * a mu::Matrix), std::array<std::array<T, N>, N> or
+ * std::vector<std::vector<T>>. the matrix is always taken by value since the
+ * factorization works in-place */
+
+/* closed form solutions for small matrices */
+
+template <typename T, typename TMatrix>
+T det_1x1(const TMatrix &m) {
+  return m[0][0];
+}
+
+template <typename T, typename TMatrix>
+T det_2x2(const TMatrix &m) {
+  return m[0][0] * m[1][1] - m[0][1] * m[1][0];
+}
+
+template <typename T, typename TMatrix>
+T det_3x3(const TMatrix &m) {
+  return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+         m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+         m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+template <typename T, typename TMatrix>
+T det_4x4(const TMatrix &m) {
+  /* 2x2 sub-determinants of the two bottom rows. each one is used twice */
+  const T kC0 = m[2][0] * m[3][1] - m[2][1] * m[3][0];
+  const T kC1 = m[2][0] * m[3][2] - m[2][2] * m[3][0];
+  const T kC2 = m[2][0] * m[3][3] - m[2][3] * m[3][0];
+  const T kC3 = m[2][1] * m[3][2] - m[2][2] * m[3][1];
+  const T kC4 = m[2][1] * m[3][3] - m[2][3] * m[3][1];
+  const T kC5 = m[2][2] * m[3][3] - m[2][3] * m[3][2];
+  return m[0][0] * (m[1][1] * kC5 - m[1][2] * kC4 + m[1][3] * kC3) -
+         m[0][1] * (m[1][0] * kC5 - m[1][2] * kC2 + m[1][3] * kC1) +
+         m[0][2] * (m[1][0] * kC4 - m[1][1] * kC2 + m[1][3] * kC0) -
+         m[0][3] * (m[1][0] * kC3 - m[1][1] * kC1 + m[1][2] * kC0);
+}
+
+/**
+ * @brief LU decomposition with partial pivoting, in-place. the size is known
+ * at run time
+ *
+ * O(n^3). PA = LU. afterwards, the matrix holds U on and above the diagonal
+ * and L (without its unit diagonal) below the diagonal. row i of PA is row
+ * perm[i] of A.
+ *
+ * a column without a non-zero pivot is skipped, so the decomposition always
+ * finishes. the matrix is singular if a value on the diagonal of U is zero
+ *
+ * @tparam TMatrix
+ * @param m
+ * @param n
+ * @param perm n row indices, nullptr if the permutation isn't needed (e.g.
+ * for the determinant)
+ * @return std::size_t number of row swaps
+ */
+template <typename TMatrix>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+std::size_t lu_decompose(TMatrix &m, std::size_t n, std::size_t *perm) {
+  std::size_t swaps = 0;
+  for (std::size_t i = 0; perm != nullptr && i < n; i++) {
+    perm[i] = i;
+  }
+  for (std::size_t k = 0; k < n; k++) {
+    /* pivot: the row with the largest absolute value in column k */
+    std::size_t p = k;
+    for (std::size_t i = k + 1; i < n; i++) {
+      if (mu::abs(m[i][k]) > mu::abs(m[p][k])) {
+        p = i;
+      }
+    }
+    if (p != k) {
+      std::swap(m[p], m[k]);
+      if (perm != nullptr) {
+        std::swap(perm[p], perm[k]);
+      }
+      swaps++;
+    }
+    if (m[k][k] == 0) {
+      continue;
+    }
+    for (std::size_t i = k + 1; i < n; i++) {
+      m[i][k] /= m[k][k];
+      for (std::size_t j = k + 1; j < n; j++) {
+        m[i][j] -= m[i][k] * m[k][j];
+      }
+    }
+  }
+  return swaps;
+}
+
+/**
+ * @brief LU decomposition with partial pivoting, in-place
+ *
+ * see lu_decompose(m, n, perm)
+ *
+ * @tparam N
+ * @tparam TMatrix
+ * @param m
+ * @param perm
+ * @return std::size_t number of row swaps
+ */
+template <std::size_t N, typename TMatrix>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+std::size_t lu_decompose(TMatrix &m, std::array<std::size_t, N> &perm) {
+  return lu_decompose(m, N, perm.data());
+}
+
+/**
+ * @brief determinant by LU decomposition with partial pivoting. floating
+ * point types
+ *
+ * O(n^3). the matrix is overwritten by lu_decompose(). the determinant is the
+ * product of the diagonal of U, negated for every row swap
+ *
+ * @tparam T
+ * @tparam TMatrix
+ * @param m
+ * @param n
+ * @return T
+ */
+template <typename T, typename TMatrix>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+T det_factorize(TMatrix &m, std::size_t n, std::true_type /*floating*/) {
+  const std::size_t kSwaps = lu_decompose(m, n, nullptr);
+  T ret{1};
+  for (std::size_t i = 0; i < n; i++) {
+    ret *= m[i][i];
+  }
+  return kSwaps % 2 == 0 ? ret : -ret;
+}
+
+/**
+ * @brief determinant by fraction-free gaussian elimination (Bareiss
+ * algorithm). integral types
+ *
+ * O(n^3). every division is exact, so there is no rounding involved. the
+ * determinant is the last element of the diagonal, negated for every row swap.
+ * the numerator of every step is the product of two sub-determinants, so it
+ * is calculated in a wider type
+ *
+ * @tparam T
+ * @tparam TMatrix
+ * @param m
+ * @param n
+ * @return T
+ */
+template <typename T, typename TMatrix>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+T det_factorize(TMatrix &m, std::size_t n, std::false_type /*floating*/) {
+  if (n == 0) {
+    return T{1};
+  }
+  using TWide = std::conditional_t<(sizeof(T) < sizeof(std::intmax_t)),
+                                   std::intmax_t, T>;
+  bool negate = false;
+  TWide prev{1};
+  for (std::size_t k = 0; k + 1 < n; k++) {
+    /* pivot: any row with a non-zero value in column k */
+    if (m[k][k] == T{0}) {
+      std::size_t p = k + 1;
+      while (p < n && m[p][k] == T{0}) {
+        p++;
+      }
+      if (p == n) {
+        return T{0};
+      }
+      std::swap(m[p], m[k]);
+      negate = !negate;
+    }
+    for (std::size_t i = k + 1; i < n; i++) {
+      for (std::size_t j = k + 1; j < n; j++) {
+        m[i][j] = static_cast<T>((TWide(m[i][j]) * m[k][k] -
+                                  TWide(m[i][k]) * m[k][j]) /
+                                 prev);
+      }
+    }
+    prev = m[k][k];
+  }
+  return negate ? T(-m[n - 1][n - 1]) : T(m[n - 1][n - 1]);
+}
+
+/* compile time selection of the fixed size determinant. sizes larger than 4
+ * are tagged with 0 and factorized */
+
+template <typename T, typename TMatrix>
+T calc_det_fixed(const TMatrix &m,
+                 std::integral_constant<std::size_t, 1> /*size*/) {
+  return det_1x1<T>(m);
+}
+
+template <typename T, typename TMatrix>
+T calc_det_fixed(const TMatrix &m,
+                 std::integral_constant<std::size_t, 2> /*size*/) {
+  return det_2x2<T>(m);
+}
+
+template <typename T, typename TMatrix>
+T calc_det_fixed(const TMatrix &m,
+                 std::integral_constant<std::size_t, 3> /*size*/) {
+  return det_3x3<T>(m);
+}
+
+template <typename T, typename TMatrix>
+T calc_det_fixed(const TMatrix &m,
+                 std::integral_constant<std::size_t, 4> /*size*/) {
+  return det_4x4<T>(m);
+}
+
+template <typename T, typename TMatrix>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+T calc_det_fixed(TMatrix &m, std::integral_constant<std::size_t, 0> /*size*/) {
+  return det_factorize<T>(m, m.size(), std::is_floating_point<T>{});
+}
+
+/**
+ * @brief calculates the determinant of a square matrix of fixed size
+ *
+ * does not allocate. sizes up to 4x4 use a closed form solution, larger sizes
+ * are factorized in O(N^3) on the (copied) matrix. both are chosen at compile
+ * time
+ *
+ * @tparam TRow row type, e.g. mu::Vector<N, T> or std::array<T, N>
+ * @tparam N
+ * @param matrix
+ * @return TRow::value_type
+ */
+template <typename TRow, std::size_t N>
+typename TRow::value_type calc_det(std::array<TRow, N> matrix) {
+  return calc_det_fixed<typename TRow::value_type>(
+      matrix, std::integral_constant<std::size_t, (N <= 4 ? N : 0)>{});
+}
+
+/**
+ * @brief calculates the determinant of a square matrix of dynamic size
+ *
+ * sizes up to 4x4 use a closed form solution, larger sizes are factorized in
+ * O(n^3) on the (copied) matrix
  *
  * @tparam T
  * @param matrix
@@ -57,47 +320,348 @@ using std::numeric_limits;
  */
 template <typename T>
 T calc_det(std::vector<std::vector<T>> matrix) {
-  T ret = 0;
-  // 1x1
-  if (matrix.size() == 1) {
-    return matrix[0][0];
+  switch (matrix.size()) {
+    case 1:
+      return det_1x1<T>(matrix);
+    case 2:
+      return det_2x2<T>(matrix);
+    case 3:
+      return det_3x3<T>(matrix);
+    case 4:
+      return det_4x4<T>(matrix);
+    default:
+      return det_factorize<T>(matrix, matrix.size(),
+                              std::is_floating_point<T>{});
   }
-  // 2x2
-  if (matrix.size() == 2) {
-    ret = (matrix[0][0] * matrix[1][1] - matrix[0][1] * matrix[1][0]);
-    return ret;
+}
+
+/********************************* inverse **********************************/
+
+/* the inverse functions work on the same kind of matrices as the determinant
+ * functions, with a fixed size N. the inverse is written to a second matrix
+ * (ret) that must not be the same object. for a singular matrix the result
+ * contains infinite or NaN values (division by zero). floating point types
+ * only */
+
+/* closed form solutions for small matrices (adjugate divided by the
+ * determinant) */
+
+template <typename T, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void inv_1x1(const TMatrix &m, TOut &ret) {
+  ret[0][0] = T{1} / m[0][0];
+}
+
+template <typename T, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void inv_2x2(const TMatrix &m, TOut &ret) {
+  const T kInvDet = T{1} / det_2x2<T>(m);
+  ret[0][0] = m[1][1] * kInvDet;
+  ret[0][1] = -m[0][1] * kInvDet;
+  ret[1][0] = -m[1][0] * kInvDet;
+  ret[1][1] = m[0][0] * kInvDet;
+}
+
+template <typename T, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void inv_3x3(const TMatrix &m, TOut &ret) {
+  /* cofactors of the first column are also used for the determinant */
+  const T kC00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+  const T kC10 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+  const T kC20 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+  const T kInvDet = T{1} / (m[0][0] * kC00 + m[0][1] * kC10 + m[0][2] * kC20);
+  ret[0][0] = kC00 * kInvDet;
+  ret[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * kInvDet;
+  ret[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * kInvDet;
+  ret[1][0] = kC10 * kInvDet;
+  ret[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * kInvDet;
+  ret[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * kInvDet;
+  ret[2][0] = kC20 * kInvDet;
+  ret[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * kInvDet;
+  ret[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * kInvDet;
+}
+
+template <typename T, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void inv_4x4(const TMatrix &m, TOut &ret) {
+  /* 2x2 sub-determinants of the two top rows (kS) and the two bottom rows
+   * (kC). every cofactor is a combination of three of them */
+  const T kS0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+  const T kS1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+  const T kS2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+  const T kS3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+  const T kS4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+  const T kS5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+  const T kC5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+  const T kC4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+  const T kC3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+  const T kC2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+  const T kC1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+  const T kC0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+  const T kInvDet = T{1} / (kS0 * kC5 - kS1 * kC4 + kS2 * kC3 + kS3 * kC2 -
+                            kS4 * kC1 + kS5 * kC0);
+  ret[0][0] = (m[1][1] * kC5 - m[1][2] * kC4 + m[1][3] * kC3) * kInvDet;
+  ret[0][1] = (-m[0][1] * kC5 + m[0][2] * kC4 - m[0][3] * kC3) * kInvDet;
+  ret[0][2] = (m[3][1] * kS5 - m[3][2] * kS4 + m[3][3] * kS3) * kInvDet;
+  ret[0][3] = (-m[2][1] * kS5 + m[2][2] * kS4 - m[2][3] * kS3) * kInvDet;
+  ret[1][0] = (-m[1][0] * kC5 + m[1][2] * kC2 - m[1][3] * kC1) * kInvDet;
+  ret[1][1] = (m[0][0] * kC5 - m[0][2] * kC2 + m[0][3] * kC1) * kInvDet;
+  ret[1][2] = (-m[3][0] * kS5 + m[3][2] * kS2 - m[3][3] * kS1) * kInvDet;
+  ret[1][3] = (m[2][0] * kS5 - m[2][2] * kS2 + m[2][3] * kS1) * kInvDet;
+  ret[2][0] = (m[1][0] * kC4 - m[1][1] * kC2 + m[1][3] * kC0) * kInvDet;
+  ret[2][1] = (-m[0][0] * kC4 + m[0][1] * kC2 - m[0][3] * kC0) * kInvDet;
+  ret[2][2] = (m[3][0] * kS4 - m[3][1] * kS2 + m[3][3] * kS0) * kInvDet;
+  ret[2][3] = (-m[2][0] * kS4 + m[2][1] * kS2 - m[2][3] * kS0) * kInvDet;
+  ret[3][0] = (-m[1][0] * kC3 + m[1][1] * kC1 - m[1][2] * kC0) * kInvDet;
+  ret[3][1] = (m[0][0] * kC3 - m[0][1] * kC1 + m[0][2] * kC0) * kInvDet;
+  ret[3][2] = (-m[3][0] * kS3 + m[3][1] * kS1 - m[3][2] * kS0) * kInvDet;
+  ret[3][3] = (m[2][0] * kS3 - m[2][1] * kS1 + m[2][2] * kS0) * kInvDet;
+}
+
+/**
+ * @brief solves LUx = Pb by forward and back substitution
+ *
+ * O(N^2). lu and perm are the result of lu_decompose(). x must not be the same
+ * object as b
+ *
+ * @tparam N
+ * @tparam TMatrix
+ * @tparam TIn
+ * @tparam TOut
+ * @param lu
+ * @param perm
+ * @param b
+ * @param x
+ */
+template <std::size_t N, typename TMatrix, typename TIn, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void lu_solve(const TMatrix &lu, const std::array<std::size_t, N> &perm,
+              const TIn &b, TOut &x) {
+  /* Ly = Pb. L has a unit diagonal */
+  for (std::size_t i = 0; i < N; i++) {
+    x[i] = b[perm[i]];
+    for (std::size_t k = 0; k < i; k++) {
+      x[i] -= lu[i][k] * x[k];
+    }
   }
-  // 3x3 or higher
-  for (std::size_t p = 0; p < matrix[0].size(); p++) {
-    // this loop iterates on each elements of the first row in the matrix.
-    // at each element we cancel the row and column it exist in
-    // and form a matrix from the rest of the elements in the matrix
-    std::vector<std::vector<T>> temp_matrix;  // to hold the shaped matrix;
-    for (std::size_t i = 1; i < matrix.size(); i++) {
-      // iteration will start from row one cancelling the first row values
-      std::vector<T> temp_row;
-      for (std::size_t j = 0; j < matrix[i].size(); j++) {
-        // iteration will pass all cells of the i row excluding the j
-        // value that match p column
-        if (j != p) {
-          temp_row.push_back(matrix[i][j]);  // add current cell to TempRow
+  /* Ux = y */
+  for (std::size_t i = N; i-- > 0;) {
+    for (std::size_t k = i + 1; k < N; k++) {
+      x[i] -= lu[i][k] * x[k];
+    }
+    x[i] /= lu[i][i];
+  }
+}
+
+/* compile time selection of the fixed size inverse. sizes larger than 4 are
+ * tagged with 0 and factorized */
+
+template <typename T, std::size_t N, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void calc_inverse_fixed(const TMatrix &m, TOut &ret,
+                        std::integral_constant<std::size_t, 1> /*size*/) {
+  inv_1x1<T>(m, ret);
+}
+
+template <typename T, std::size_t N, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void calc_inverse_fixed(const TMatrix &m, TOut &ret,
+                        std::integral_constant<std::size_t, 2> /*size*/) {
+  inv_2x2<T>(m, ret);
+}
+
+template <typename T, std::size_t N, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void calc_inverse_fixed(const TMatrix &m, TOut &ret,
+                        std::integral_constant<std::size_t, 3> /*size*/) {
+  inv_3x3<T>(m, ret);
+}
+
+template <typename T, std::size_t N, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void calc_inverse_fixed(const TMatrix &m, TOut &ret,
+                        std::integral_constant<std::size_t, 4> /*size*/) {
+  inv_4x4<T>(m, ret);
+}
+
+template <typename T, std::size_t N, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void calc_inverse_fixed(const TMatrix &m, TOut &ret,
+                        std::integral_constant<std::size_t, 0> /*size*/) {
+  /* solve for every column of the identity matrix */
+  TMatrix lu = m;
+  std::array<std::size_t, N> perm;
+  lu_decompose<N>(lu, perm);
+  std::array<T, N> e{};
+  std::array<T, N> x;
+  for (std::size_t j = 0; j < N; j++) {
+    e[j] = T{1};
+    lu_solve<N>(lu, perm, e, x);
+    e[j] = T{0};
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i][j] = x[i];
+    }
+  }
+}
+
+/**
+ * @brief calculates the inverse of a square matrix of fixed size
+ *
+ * does not allocate. sizes up to 4x4 use a closed form solution, larger sizes
+ * are factorized in O(N^3) by LU decomposition with partial pivoting. both are
+ * chosen at compile time
+ *
+ * @tparam T floating point type
+ * @tparam N
+ * @tparam TMatrix
+ * @tparam TOut
+ * @param m
+ * @param ret
+ */
+template <typename T, std::size_t N, typename TMatrix, typename TOut>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+void calc_inverse(const TMatrix &m, TOut &ret) {
+  static_assert(std::is_floating_point<T>::value,
+                "the inverse can only be calculated for floating point types");
+  calc_inverse_fixed<T, N>(
+      m, ret, std::integral_constant<std::size_t, (N <= 4 ? N : 0)>{});
+}
+
+/***************************** sorting network ******************************/
+
+/* sizes up to this one are sorted by a sorting network, larger sizes by
+ * std::sort. the number of comparators of the network grows with
+ * O(N log^2 N) and it is fully unrolled */
+constexpr std::size_t kSortNetworkMax = 32;
+
+/**
+ * @brief compares two values and swaps them if they are out of order
+ *
+ * branchless. both results depend on the same comparison, so equal values
+ * that differ (e.g. -0.0 and 0.0) are never duplicated
+ *
+ * @tparam T
+ * @param a the smaller value afterwards
+ * @param b the larger value afterwards
+ */
+template <typename T>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void compare_swap(T &a, T &b, std::false_type /*integral*/) {
+  const bool kSwap = b < a;
+  const T kLo = kSwap ? b : a;
+  const T kHi = kSwap ? a : b;
+  a = kLo;
+  b = kHi;
+}
+
+/* equal integers are identical, so min and max can't duplicate a value. the
+ * compiler maps them to min/max or conditional move instructions */
+template <typename T>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void compare_swap(T &a, T &b, std::true_type /*integral*/) {
+  const T kLo = std::min(a, b);
+  const T kHi = std::max(a, b);
+  a = kLo;
+  b = kHi;
+}
+
+template <typename T>
+// NOLINTNEXTLINE(runtime/references) intentional non-const reference
+inline void compare_swap(T &a, T &b) {
+  compare_swap(a, b, std::is_integral<T>{});
+}
+
+/* the comparators of Batcher's odd-even merge sort for any N (Knuth, TAOCP
+ * vol. 3, 5.3.4). the same loops count the comparators and generate them at
+ * compile time */
+
+template <std::size_t N>
+struct SortNetwork {
+  /* a network for N = 0 or 1 has no comparators */
+  std::size_t lo[N > 1 ? N * N : 1] = {};
+  std::size_t hi[N > 1 ? N * N : 1] = {};
+  std::size_t size = 0;
+};
+
+template <std::size_t N>
+constexpr SortNetwork<N> make_sort_network() {
+  SortNetwork<N> ret;
+  for (std::size_t p = 1; p < N; p *= 2) {
+    for (std::size_t k = p; k >= 1; k /= 2) {
+      for (std::size_t j = k % p; j + k < N; j += 2 * k) {
+        for (std::size_t i = 0; i < k && i + j + k < N; i++) {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+            ret.lo[ret.size] = i + j;
+            ret.hi[ret.size] = i + j + k;
+            ret.size++;
+          }
         }
       }
-      if (temp_row.size() > 0) {
-        temp_matrix.push_back(temp_row);
-      }
-      // after adding each row of the new matrix to the vector temp_row
-      // we add it to the vector temp_matrix which is the vector where the
-      // new matrix will be formed
     }
-    ret = ret + matrix[0][p] * pow(-1, p) * calc_det(temp_matrix);
-    // then we calculate the value of determinant by using a recursive way
-    // where we re-call the function by passing to it the new formed matrix
-    // we keep doing this until we get our determinant
   }
   return ret;
 }
 
+template <std::size_t N, typename T, std::size_t... I>
+inline void sort_network(T *data, std::index_sequence<I...> /*comparators*/) {
+  /* static, so that there is one table per N instead of one on the stack per
+   * call, e.g. without optimization */
+  static constexpr SortNetwork<N> kNetwork = make_sort_network<N>();
+  /* one compare_swap per comparator with constant indices (c++14 has no fold
+   * expressions) */
+  static_cast<void>(std::initializer_list<int>{
+      0, (compare_swap(data[kNetwork.lo[I]], data[kNetwork.hi[I]]), 0)...});
+}
+
+/* a network without comparators (N < 2) */
+template <std::size_t N, typename T>
+inline void sort_network(T * /*data*/, std::index_sequence<> /*comparators*/) {}
+
+/**
+ * @brief sorts N values in ascending order with a sorting network
+ *
+ * the sequence of comparisons only depends on N. it's generated at compile
+ * time and every comparison is a separate branchless compare_swap, so there
+ * are neither loops nor data dependent branches
+ *
+ * @tparam N
+ * @tparam T
+ * @param data
+ */
+template <std::size_t N, typename T>
+inline void sort_network(T *data) {
+  sort_network<N>(data,
+                  std::make_index_sequence<make_sort_network<N>().size>{});
+}
+
+/* compile time selection of the sorting algorithm */
+
+template <std::size_t N, typename T>
+inline void sort_fixed(T *data, std::true_type /*network*/) {
+  sort_network<N>(data);
+}
+
+template <std::size_t N, typename T>
+inline void sort_fixed(T *data, std::false_type /*network*/) {
+  std::sort(data, data + N);
+}
+
+/**
+ * @brief sorts N values in ascending order
+ *
+ * small sizes (see kSortNetworkMax) use a sorting network, larger sizes
+ * std::sort
+ *
+ * @tparam N
+ * @tparam T
+ * @param data
+ */
+template <std::size_t N, typename T>
+inline void sort_fixed(T *data) {
+  sort_fixed<N>(data,
+                std::integral_constant<bool, (N <= kSortNetworkMax)>{});
+}
+
 }  // namespace mu
 
 #endif  // MU_UTILITY_H_
\ No newline at end of file
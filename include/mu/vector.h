@@ -16,6 +16,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "mu/simd.h"
 #include "mu/typetraits.h"
 #include "mu/utility.h"
 
@@ -41,6 +42,13 @@ class Matrix;
  * - implementation-defined extended floating-point types including any
  *   cv-qualified variants. (float, double, long double)
  *
+ * the constructors, element access, arithmetic operators and most of the
+ * functions that don't need the standard math library are constexpr. they
+ * can be evaluated at compile time, also in c++14. at run time, the same
+ * functions use the SIMD kernels
+ *
+ * @par Example
+ * @snippet example_vector.cpp vector constant expression
  * @tparam N size
  * @tparam T the type of the values inside the vector
  */
@@ -66,6 +74,14 @@ class Vector {
    */
   constexpr Vector() = default;
 
+  /**
+   * @brief Construct a new Vector object whose values are not initialized,
+   * not even in constant expressions
+   *
+   * for results that are overwritten completely at run time
+   */
+  explicit Vector(mu::Uninitialized /*unused*/) {}
+
   /**
    * @brief Construct a new Vector object from a number of N values
    *
@@ -84,7 +100,7 @@ class Vector {
                          T, std::remove_reference_t<TArgs>>::value...>::value),
                 int> = 0>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Vector(TArgs &&... args) : data_{std::forward<TArgs>(args)...} {}
+  constexpr Vector(TArgs &&... args) : data_{std::forward<TArgs>(args)...} {}
 
   /**
    * @brief Construct a new Vector from an existing Vector of a different type
@@ -100,9 +116,11 @@ class Vector {
    */
   template <std::size_t Nn, class U>
   // NOLINTNEXTLINE(runtime/explicit) implicit conversion is intentional
-  Vector(const Vector<Nn, U> &v) {
+  constexpr Vector(const Vector<Nn, U> &v) : data_{} {
     static_assert(N == Nn, "Vector size mismatch");
-    std::transform(v.begin(), v.end(), begin(), [](U data) { return data; });
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = static_cast<T>(v[i]);
+    }
   }
 
   /**
@@ -113,7 +131,7 @@ class Vector {
    * @param a
    */
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Vector(const std::array<T, N> &a) : data_{a} {}
+  constexpr Vector(const std::array<T, N> &a) : data_{a} {}
 
   /**
    * @brief Construct a new Vector object from an std::array of a different type
@@ -128,8 +146,10 @@ class Vector {
   template <typename U = T,
             std::enable_if_t<std::is_arithmetic<U>::value, int> = 0>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Vector(const std::array<U, N> &a) {
-    std::transform(a.begin(), a.end(), begin(), [](U data) { return data; });
+  constexpr Vector(const std::array<U, N> &a) : data_{} {
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = static_cast<T>(a[i]);
+    }
   }
 
   /**
@@ -145,8 +165,10 @@ class Vector {
   template <typename U = T,
             std::enable_if_t<std::is_arithmetic<U>::value, int> = 0>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Vector(const U &value) {
-    data_.fill(value);
+  constexpr Vector(const U &value) : data_{} {
+    for (std::size_t i = 0; i < N; i++) {
+      (*this)[i] = static_cast<T>(value);
+    }
   }
 
   /**
@@ -203,7 +225,12 @@ class Vector {
    * @param idx
    * @return T&
    */
-  T &operator[](size_type idx) noexcept { return data_[idx]; }
+  constexpr T &operator[](size_type idx) noexcept {
+    /* the non-const operator[] of std::array is constexpr since c++17. the
+     * const one since c++14 */
+    return const_cast<T &>(
+        static_cast<const std::array<T, N> &>(data_)[idx]);
+  }
 
   /**
    * @brief const access an element within the vector
@@ -215,7 +242,9 @@ class Vector {
    * @param idx
    * @return const T&
    */
-  const T &operator[](size_type idx) const noexcept { return data_[idx]; }
+  constexpr const T &operator[](size_type idx) const noexcept {
+    return data_[idx];
+  }
 
   /**
    * @brief access an element within the vector
@@ -239,6 +268,28 @@ class Vector {
    */
   const T &at(size_type idx) const { return data_.at(idx); }
 
+  /**
+   * @brief returns a pointer to the first element
+   *
+   * the elements are stored contiguously
+   *
+   * @par Example
+   * @snippet example_vector.cpp vector data function
+   * @return T*
+   */
+  T *data() noexcept { return data_.data(); }
+
+  /**
+   * @brief returns a const pointer to the first element
+   *
+   * the elements are stored contiguously
+   *
+   * @par Example
+   * @snippet example_vector.cpp vector const data function
+   * @return const T*
+   */
+  const T *data() const noexcept { return data_.data(); }
+
   /**
    * @brief returns the size of the vector
    *
@@ -293,7 +344,7 @@ class Vector {
    * @snippet example_vector.cpp vector min function
    * @return T
    */
-  T min() const {
+  constexpr T min() const {
     T ret(data_[0]);
     for (std::size_t i = 1; i < N; i++) {
       ret = mu::min(ret, data_[i]);
@@ -308,7 +359,7 @@ class Vector {
    * @snippet example_vector.cpp vector max function
    * @return T
    */
-  T max() const {
+  constexpr T max() const {
     T ret(data_[0]);
     for (std::size_t i = 1; i < N; i++) {
       ret = mu::max(ret, data_[i]);
@@ -323,10 +374,10 @@ class Vector {
    * @snippet example_vector.cpp vector sum function
    * @return T
    */
-  T sum() const {
+  constexpr T sum() const {
     T ret{};
-    for (const auto &item : data_) {
-      ret += item;
+    for (std::size_t i = 0; i < N; i++) {
+      ret += data_[i];
     }
     return ret;
   }
@@ -346,7 +397,7 @@ class Vector {
    * @return U
    */
   template <typename U = T>
-  U mean() const {
+  constexpr U mean() const {
     return U(sum()) / N;
   }
 
@@ -377,7 +428,7 @@ class Vector {
    * @return std::conditional_t<std::is_same<U, void>::value, T, U>
    */
   template <typename U = void, std::size_t N2, typename T2>
-  std::conditional_t<std::is_same<U, void>::value, T, U> dot(
+  constexpr std::conditional_t<std::is_same<U, void>::value, T, U> dot(
       const Vector<N2, T2> &rhs) const {
     static_assert(N == N2, "Vector size mismatch");
     using U_ = std::conditional_t<!std::is_same<T, T2>::value, U, T>;
@@ -424,7 +475,8 @@ class Vector {
    * Vector<M2, U>>
    */
   template <typename U = void, std::size_t N2, std::size_t M2, typename T2>
-  std::conditional_t<std::is_same<U, void>::value, Vector<M2, T>, Vector<M2, U>>
+  constexpr std::conditional_t<std::is_same<U, void>::value, Vector<M2, T>,
+                               Vector<M2, U>>
   dot(const Matrix<N2, M2, T2> &rhs) const {
     static_assert(N == N2,
                   "Vector-Matrix dimension mismatch. Vector size must be equal "
@@ -434,7 +486,9 @@ class Vector {
         !std::is_same<U_, void>::value,
         "Vector and Matrix types are different. please specify the return "
         "type. e.g. \"vec.dot<float>(mat);\"");
-    Vector<M2, U_> ret;
+    Vector<M2, U_> ret = mu::is_constant_evaluated()
+                         ? Vector<M2, U_>{}
+                         : Vector<M2, U_>(mu::uninitialized);
     for (std::size_t i = 0; i < M2; i++) {
       U_ sum{0};
       for (std::size_t k = 0; k < N; k++) {
@@ -445,11 +499,35 @@ class Vector {
     return ret;
   }
 
+  /**
+   * @brief calculates the (population) variance
+   *
+   * \f$ \sigma^2 = \frac{\sum(x_i - \mu)^2}{N} \f$
+   *
+   * for a floating point return type, the mean and the variance are
+   * calculated together in a single, numerically stable pass (Welford).
+   * integral return types use the integral mean
+   *
+   * @par Example
+   * @snippet example_vector.cpp vector variance function
+   * @tparam U
+   * @return U
+   */
+  template <class U = T>
+  U variance() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return m2 / N;
+  }
+
   /**
    * @brief calculates the standard deviation
    *
    * $$ \sigma = \sqrt{\frac{\sum(x_i - \mu)^2}{N}} $$
    *
+   * see variance()
+   *
    * @par Example
    * @snippet example_vector.cpp vector std function
    * @tparam U
@@ -457,12 +535,25 @@ class Vector {
    */
   template <class U = T>
   U std() const {
-    U sum{0};
-    U m = mean<U>();
-    for (const auto &item : data_) {
-      sum += mu::pow(item - m, 2);
-    }
-    return U(mu::sqrt(sum / N));
+    return U(mu::sqrt(variance<U>()));
+  }
+
+  /**
+   * @brief calculates the mean and the standard deviation
+   *
+   * both from the same single pass over the elements. see variance()
+   *
+   * @par Example
+   * @snippet example_vector.cpp vector mean_and_std function
+   * @tparam U
+   * @return std::pair<U, U> mean (first) and standard deviation (second)
+   */
+  template <class U = T>
+  std::pair<U, U> mean_and_std() const {
+    U m;
+    U m2;
+    calc_mean_m2(m, m2, std::is_floating_point<U>{});
+    return {m, U(mu::sqrt(m2 / N))};
   }
 
   /**
@@ -533,10 +624,13 @@ class Vector {
   /**
    * @brief sort vector elements in ascending order
    *
+   * sizes up to 32 are sorted by a branchless sorting network, larger sizes
+   * by std::sort (see mu::sort_fixed)
+   *
    * @par Example
    * @snippet example_vector.cpp vector sort function
    */
-  void sort() { mu::sort(begin(), end()); }
+  void sort() { mu::sort_fixed<N>(data()); }
 
   /**
    * @brief sort vector elements by providing a condition
@@ -610,18 +704,21 @@ class Vector {
    * the first argument, then casting both values to the type of the second
    * argument.
    *
+   * floating point values of the same type are compared with a SIMD kernel
+   * (see mu::simd_equals), except in constant expressions
+   *
    * @param rhs
    * @return bool true if equal, false if unequal
    */
   template <typename U = T>
-  bool operator==(const Vector<N, U> &rhs) const {
-    for (std::size_t i = 0; i < N; i++) {
-      if (!mu::TypeTraits<T>::equals(data_[i], rhs[i]) ||
-          !mu::TypeTraits<U>::equals(data_[i], rhs[i])) {
-        return false;
-      }
+  constexpr bool operator==(const Vector<N, U> &rhs) const {
+    if (!mu::is_constant_evaluated()) {
+      return equals_simd(
+          rhs, std::integral_constant<bool, std::is_same<T, U>::value &&
+                                                std::is_floating_point<
+                                                    T>::value>{});
     }
-    return true;
+    return equals_loop(rhs);
   }
 
   /**
@@ -631,65 +728,81 @@ class Vector {
    * @return bool true if unequal, false if equal
    */
   template <typename U = T>
-  bool operator!=(const Vector<N, U> &rhs) const {
+  constexpr bool operator!=(const Vector<N, U> &rhs) const {
     return !operator==(rhs);
   }
 
+  /**
+   * @brief equality check with a tolerance
+   *
+   * compares the values with a relative epsilon (the same as operator==), a
+   * number of ulps or an absolute difference. see mu::Tolerance
+   *
+   * @code
+   * a.equals(b, mu::Tolerance::ulp(4));
+   * @endcode
+   *
+   * @param rhs
+   * @param tolerance
+   * @return bool
+   */
+  bool equals(const Vector &rhs, const mu::Tolerance &tolerance) const {
+    return equals_tolerance(rhs, tolerance, std::is_floating_point<T>{});
+  }
+
   /**
    * @brief plus equal operator
    *
-   * subject to implicit conversions
+   * subject to implicit conversions \n
+   * vectorized for two Vectors of the same type (see mu::SimdTraits)
    *
    * @tparam U
    * @param rhs
    * @return Vector<N, T>&
    */
   template <typename U = T>
-  Vector<N, T> &operator+=(const Vector<N, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] += rhs[i];
-    }
+  constexpr Vector<N, T> &operator+=(const Vector<N, U> &rhs) {
+    apply<mu::SimdAdd>(rhs);
     return *this;
   }
 
   /**
    * @brief minus equal operator
    *
-   * subject to implicit conversions
+   * subject to implicit conversions \n
+   * vectorized for two Vectors of the same type (see mu::SimdTraits)
    *
    * @tparam U
    * @param rhs
    * @return Vector<N, T>&
    */
   template <typename U = T>
-  Vector<N, T> &operator-=(const Vector<N, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] -= rhs[i];
-    }
+  constexpr Vector<N, T> &operator-=(const Vector<N, U> &rhs) {
+    apply<mu::SimdSub>(rhs);
     return *this;
   }
 
   /**
    * @brief multiplication equal operator
    *
-   * subject to implicit conversions
+   * subject to implicit conversions \n
+   * vectorized for two Vectors of the same type (see mu::SimdTraits)
    *
    * @tparam U
    * @param rhs
    * @return Vector<N, T>&
    */
   template <typename U = T>
-  Vector<N, T> &operator*=(const Vector<N, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] *= rhs[i];
-    }
+  constexpr Vector<N, T> &operator*=(const Vector<N, U> &rhs) {
+    apply<mu::SimdMul>(rhs);
     return *this;
   }
 
   /**
    * @brief divison equal operator
    *
-   * subject to implicit conversions
+   * subject to implicit conversions \n
+   * vectorized for two Vectors of the same type (see mu::SimdTraits) \n
    * division by zero on integral type vector elements results in undefined
    * behavior
    *
@@ -698,10 +811,8 @@ class Vector {
    * @return Vector<N, T>&
    */
   template <typename U = T>
-  Vector<N, T> &operator/=(const Vector<N, U> &rhs) {
-    for (std::size_t i = 0; i < N; i++) {
-      data_[i] /= rhs[i];
-    }
+  constexpr Vector<N, T> &operator/=(const Vector<N, U> &rhs) {
+    apply<mu::SimdDiv>(rhs);
     return *this;
   }
 
@@ -712,7 +823,8 @@ class Vector {
    * since it's the only type "family" that is allowed inside a Vector.
    *
    * the vector elements and the scalar can be of different types. c++ usual
-   * conversion rules apply.
+   * conversion rules apply. if they are of the same type, the operation is
+   * vectorized (see mu::SimdTraits).
    *
    * placed inside this class because write access to member data is required
    */
@@ -725,11 +837,10 @@ class Vector {
    * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,Vector<N, T> &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value, Vector<N, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Vector<N, T> &>
   operator+=(const TScalar &scalar) {
-    for (auto &item : data_) {
-      item += scalar;
-    }
+    apply_scalar<mu::SimdAdd>(scalar);
     return *this;
   }
 
@@ -742,11 +853,10 @@ class Vector {
    * &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value, Vector<N, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Vector<N, T> &>
   operator-=(const TScalar &scalar) {
-    for (auto &item : data_) {
-      item -= scalar;
-    }
+    apply_scalar<mu::SimdSub>(scalar);
     return *this;
   }
 
@@ -758,11 +868,10 @@ class Vector {
    * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,Vector<N, T> &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value, Vector<N, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Vector<N, T> &>
   operator*=(const TScalar &scalar) {
-    for (auto &item : data_) {
-      item *= scalar;
-    }
+    apply_scalar<mu::SimdMul>(scalar);
     return *this;
   }
 
@@ -777,7 +886,8 @@ class Vector {
    * &>
    */
   template <class TScalar>
-  typename std::enable_if_t<std::is_arithmetic<TScalar>::value, Vector<N, T> &>
+  constexpr typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
+                                      Vector<N, T> &>
   operator/=(const TScalar &scalar) {
     /* a division by zero of an integral type is undefined in standard c++
      * however, in the context of this Vector class, it is seen as rather
@@ -785,9 +895,7 @@ class Vector {
     if (std::is_integral<TScalar>::value) {
       assert(scalar != static_cast<TScalar>(0));
     }
-    for (auto &item : data_) {
-      item /= scalar;
-    }
+    apply_scalar<mu::SimdDiv>(scalar);
     return *this;
   }
 
@@ -795,6 +903,87 @@ class Vector {
 
  protected:
   std::array<T, N> data_;
+
+ private:
+  /* lhs[i] op= rhs[i]. the SIMD kernels can't be evaluated at compile time,
+   * so constant expressions use the portable loop */
+  template <class TOp, class U>
+  constexpr void apply(const Vector<N, U> &rhs) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        TOp::scalar((*this)[i], rhs[i]);
+      }
+    } else {
+      mu::simd_apply<TOp, N>(data(), rhs.data());
+    }
+  }
+
+  /* lhs[i] op= scalar. see apply() */
+  template <class TOp, class TScalar>
+  constexpr void apply_scalar(const TScalar &scalar) {
+    if (mu::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < N; i++) {
+        TOp::scalar((*this)[i], scalar);
+      }
+    } else {
+      mu::simd_apply_scalar<TOp, N>(data(), scalar);
+    }
+  }
+
+  /* both ways, see operator== */
+  template <class U>
+  constexpr bool equals_loop(const Vector<N, U> &rhs) const {
+    for (std::size_t i = 0; i < N; i++) {
+      if (!mu::TypeTraits<T>::equals(data_[i], rhs[i]) ||
+          !mu::TypeTraits<U>::equals(data_[i], rhs[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /* floating point values of the same type */
+  bool equals_simd(const Vector &rhs, std::true_type /*simd*/) const {
+    return mu::simd_equals(data(), rhs.data(), N);
+  }
+
+  template <class U>
+  bool equals_simd(const Vector<N, U> &rhs, std::false_type /*simd*/) const {
+    return equals_loop(rhs);
+  }
+
+  bool equals_tolerance(const Vector &rhs, const mu::Tolerance &tolerance,
+                        std::true_type /*floating point*/) const {
+    return mu::simd_equals(data(), rhs.data(), N, tolerance);
+  }
+
+  bool equals_tolerance(const Vector &rhs, const mu::Tolerance &tolerance,
+                        std::false_type /*floating point*/) const {
+    for (std::size_t i = 0; i < N; i++) {
+      if (!mu::equals(data_[i], rhs[i], tolerance)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /* mean and sum of squared differences from the mean in a single pass */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::true_type /*floating point*/) const {
+    mu::simd_mean_m2(data(), N, m, m2);
+  }
+
+  /* the integral mean is truncated, so the differences need a second pass */
+  template <class U>
+  // NOLINTNEXTLINE(runtime/references) intentional non-const reference
+  void calc_mean_m2(U &m, U &m2, std::false_type /*floating point*/) const {
+    m = mean<U>();
+    m2 = U{0};
+    for (const auto &item : data_) {
+      m2 += mu::pow(item - m, 2);
+    }
+  }
 };
 
 /********************************** I/O ************************************/
@@ -827,8 +1016,8 @@ std::ostream &operator<<(std::ostream &os, const Vector<Nn, U> &v) {
  * @return Vector<N, T>
  */
 template <std::size_t N, class T, class U = T>
-inline Vector<N, T> operator+(const Vector<N, T> &lhs,
-                              const Vector<N, U> &rhs) {
+constexpr Vector<N, T> operator+(const Vector<N, T> &lhs,
+                                 const Vector<N, U> &rhs) {
   return Vector<N, T>(lhs) += rhs;
 }
 
@@ -843,8 +1032,8 @@ inline Vector<N, T> operator+(const Vector<N, T> &lhs,
  * @return Vector<N, T>
  */
 template <std::size_t N, class T, class U = T>
-inline Vector<N, T> operator-(const Vector<N, T> &lhs,
-                              const Vector<N, U> &rhs) {
+constexpr Vector<N, T> operator-(const Vector<N, T> &lhs,
+                                 const Vector<N, U> &rhs) {
   return Vector<N, T>(lhs) -= rhs;
 }
 
@@ -859,8 +1048,8 @@ inline Vector<N, T> operator-(const Vector<N, T> &lhs,
  * @return Vector<N, T>
  */
 template <std::size_t N, class T, class U = T>
-inline Vector<N, T> operator*(const Vector<N, T> &lhs,
-                              const Vector<N, U> &rhs) {
+constexpr Vector<N, T> operator*(const Vector<N, T> &lhs,
+                                 const Vector<N, U> &rhs) {
   return Vector<N, T>(lhs) *= rhs;
 }
 
@@ -875,8 +1064,8 @@ inline Vector<N, T> operator*(const Vector<N, T> &lhs,
  * @return Vector<N, T>
  */
 template <std::size_t N, class T, class U = T>
-inline Vector<N, T> operator/(const Vector<N, T> &lhs,
-                              const Vector<N, U> &rhs) {
+constexpr Vector<N, T> operator/(const Vector<N, T> &lhs,
+                                 const Vector<N, U> &rhs) {
   return Vector<N, T>(lhs) /= rhs;
 }
 
@@ -896,7 +1085,7 @@ inline Vector<N, T> operator/(const Vector<N, T> &lhs,
  */
 template <std::size_t N, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Vector<N, T>> inline
+                          Vector<N, T>> constexpr
 operator+(const Vector<N, T> &lhs, const TScalar &rhs) {
   return Vector<N, T>(lhs) += rhs;
 }
@@ -915,7 +1104,7 @@ operator+(const Vector<N, T> &lhs, const TScalar &rhs) {
  */
 template <std::size_t N, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Vector<N, T>> inline
+                          Vector<N, T>> constexpr
 operator+(const TScalar &lhs, const Vector<N, T> &rhs) {
   return Vector<N, T>(rhs) += lhs;
 }
@@ -932,7 +1121,7 @@ operator+(const TScalar &lhs, const Vector<N, T> &rhs) {
  */
 template <std::size_t N, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Vector<N, T>> inline
+                          Vector<N, T>> constexpr
 operator-(const Vector<N, T> &lhs, const TScalar &rhs) {
   return Vector<N, T>(lhs) -= rhs;
 }
@@ -951,7 +1140,7 @@ operator-(const Vector<N, T> &lhs, const TScalar &rhs) {
  */
 template <std::size_t N, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Vector<N, T>> inline
+                          Vector<N, T>> constexpr
 operator*(const Vector<N, T> &lhs, const TScalar &rhs) {
   return Vector<N, T>(lhs) *= rhs;
 }
@@ -970,7 +1159,7 @@ operator*(const Vector<N, T> &lhs, const TScalar &rhs) {
  */
 template <std::size_t N, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Vector<N, T>> inline
+                          Vector<N, T>> constexpr
 operator*(const TScalar &lhs, const Vector<N, T> &rhs) {
   return Vector<N, T>(rhs) *= lhs;
 }
@@ -987,7 +1176,7 @@ operator*(const TScalar &lhs, const Vector<N, T> &rhs) {
  */
 template <std::size_t N, class T, class TScalar>
 typename std::enable_if_t<std::is_arithmetic<TScalar>::value,
-                          Vector<N, T>> inline
+                          Vector<N, T>> constexpr
 operator/(const Vector<N, T> &lhs, const TScalar &rhs) {
   return Vector<N, T>(lhs) /= rhs;
 }
@@ -995,36 +1184,37 @@ operator/(const Vector<N, T> &lhs, const TScalar &rhs) {
 /************************* convenience functions ***************************/
 
 template <std::size_t N, class T>
-inline T min(const Vector<N, T> &v) {
+constexpr T min(const Vector<N, T> &v) {
   return v.min();
 }
 
 template <std::size_t N, class T>
-inline T max(const Vector<N, T> &v) {
+constexpr T max(const Vector<N, T> &v) {
   return v.max();
 }
 
 template <std::size_t N, class T>
-inline T sum(const Vector<N, T> &v) {
+constexpr T sum(const Vector<N, T> &v) {
   return v.sum();
 }
 
 template <class U = void, std::size_t N, typename T>
-inline std::conditional_t<std::is_same<U, void>::value, T, U> mean(
+constexpr std::conditional_t<std::is_same<U, void>::value, T, U> mean(
     const Vector<N, T> &v) {
   return v
       .template mean<std::conditional_t<std::is_same<U, void>::value, T, U>>();
 }
 
 template <class U = void, std::size_t N1, class T1, std::size_t N2, class T2>
-inline std::conditional_t<std::is_same<U, void>::value, T1, U> dot(
+constexpr std::conditional_t<std::is_same<U, void>::value, T1, U> dot(
     const Vector<N1, T1> &lhs, const Vector<N2, T2> &rhs) {
   return lhs.template dot<U>(rhs);
 }
 
 template <typename U = void, std::size_t N, typename T, std::size_t N2,
           std::size_t M2, typename T2>
-std::conditional_t<std::is_same<U, void>::value, Vector<M2, T>, Vector<M2, U>>
+constexpr std::conditional_t<std::is_same<U, void>::value, Vector<M2, T>,
+                             Vector<M2, U>>
 dot(const Vector<N, T> &lhs, const Matrix<N2, M2, T2> &rhs) {
   return lhs.template dot<U>(rhs);
 }
@@ -1070,12 +1260,12 @@ inline Vector<N, T> sorted(const Vector<N, T> &v, const Compare &compare) {
 }
 
 template <std::size_t N, typename T = int>
-inline Vector<N, T> ones() {
+constexpr Vector<N, T> ones() {
   return Vector<N, T>{T{1}};
 }
 
 template <std::size_t N, typename T = int>
-inline Vector<N, T> zeros() {
+constexpr Vector<N, T> zeros() {
   return Vector<N, T>{T{0}};
 }
 
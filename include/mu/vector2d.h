@@ -32,7 +32,7 @@ class Vector2D : public Vector<2, T> {
    */
   template <class Tt = T>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Vector2D(const Vector<2, Tt>& other) : Vector<2, T>(other) {}
+  constexpr Vector2D(const Vector<2, Tt>& other) : Vector<2, T>(other) {}
 
   /**
    * @brief x component
@@ -41,7 +41,7 @@ class Vector2D : public Vector<2, T> {
    * @snippet example_vector2d.cpp vector2d x function
    * @return T&
    */
-  T& x() noexcept { return Vector<2, T>::data_[0]; }
+  constexpr T& x() noexcept { return (*this)[0]; }
 
   /**
    * @brief const x component
@@ -50,7 +50,7 @@ class Vector2D : public Vector<2, T> {
    * @snippet example_vector2d.cpp vector2d const x function
    * @return const T&
    */
-  const T& x() const noexcept { return Vector<2, T>::data_[0]; }
+  constexpr const T& x() const noexcept { return (*this)[0]; }
 
   /**
    * @brief y component
@@ -59,7 +59,7 @@ class Vector2D : public Vector<2, T> {
    * @snippet example_vector2d.cpp vector2d y function
    * @return T&
    */
-  T& y() noexcept { return Vector<2, T>::data_[1]; }
+  constexpr T& y() noexcept { return (*this)[1]; }
 
   /**
    * @brief const y component
@@ -68,12 +68,13 @@ class Vector2D : public Vector<2, T> {
    * @snippet example_vector2d.cpp vector2d const y function
    * @return const T&
    */
-  const T& y() const noexcept { return Vector<2, T>::data_[1]; }
+  constexpr const T& y() const noexcept { return (*this)[1]; }
 
   /**
    * @brief rotates this Vector by an angle [rad]
    *
-   * the euclidean vector length remains unchanged by rotation!
+   * the euclidean vector length remains unchanged by rotation! to rotate many
+   * vectors by the same angle, see mu::Rotation2D
    *
    * @par Example
    * @snippet example_vector2d.cpp vector2d rotate function
@@ -86,8 +87,10 @@ class Vector2D : public Vector<2, T> {
       TScalar angle) {
     const T kX = x();
     const T kY = y();
-    Vector<2, T>::data_[0] = ((kX * mu::cos(angle)) - (kY * mu::sin(angle)));
-    Vector<2, T>::data_[1] = ((kX * mu::sin(angle)) + (kY * mu::cos(angle)));
+    const auto kCos = mu::cos(angle);
+    const auto kSin = mu::sin(angle);
+    Vector<2, T>::data_[0] = ((kX * kCos) - (kY * kSin));
+    Vector<2, T>::data_[1] = ((kX * kSin) + (kY * kCos));
   }
 
   /**
@@ -103,10 +106,11 @@ class Vector2D : public Vector<2, T> {
    */
   template <class TScalar = T>
   typename std::enable_if_t<std::is_arithmetic<TScalar>::value, Vector2D<T>>
-  rotated(TScalar angle) {
-    Vector2D<T> ret(*this);
-    ret.rotate(angle);
-    return ret;
+  rotated(TScalar angle) const {
+    const auto kCos = mu::cos(angle);
+    const auto kSin = mu::sin(angle);
+    return Vector2D<T>{T((x() * kCos) - (y() * kSin)),
+                       T((x() * kSin) + (y() * kCos))};
   }
 };
 
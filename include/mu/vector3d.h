@@ -6,6 +6,9 @@
 #ifndef MU_VECTOR3D_H_
 #define MU_VECTOR3D_H_
 
+#include <type_traits>
+
+#include "mu/utility.h"
 #include "mu/vector.h"
 
 namespace mu {
@@ -33,7 +36,7 @@ class Vector3D : public Vector<3, T> {
    */
   template <class Tt = T>
   // NOLINTNEXTLINE(runtime/explicit) implicit to make copy-init. work
-  Vector3D(const Vector<3, T>& other) : Vector<3, T>(other) {}
+  constexpr Vector3D(const Vector<3, T>& other) : Vector<3, T>(other) {}
 
   /**
    * @brief x component
@@ -42,7 +45,7 @@ class Vector3D : public Vector<3, T> {
    * @snippet example_vector3d.cpp vector3d x function
    * @return T&
    */
-  T& x() noexcept { return Vector<3, T>::data_[0]; }
+  constexpr T& x() noexcept { return (*this)[0]; }
 
   /**
    * @brief const x component
@@ -51,7 +54,7 @@ class Vector3D : public Vector<3, T> {
    * @snippet example_vector3d.cpp vector3d const x function
    * @return const T&
    */
-  const T& x() const noexcept { return Vector<3, T>::data_[0]; }
+  constexpr const T& x() const noexcept { return (*this)[0]; }
 
   /**
    * @brief y component
@@ -60,7 +63,7 @@ class Vector3D : public Vector<3, T> {
    * @snippet example_vector3d.cpp vector3d y function
    * @return T&
    */
-  T& y() noexcept { return Vector<3, T>::data_[1]; }
+  constexpr T& y() noexcept { return (*this)[1]; }
 
   /**
    * @brief const y component
@@ -69,7 +72,7 @@ class Vector3D : public Vector<3, T> {
    * @snippet example_vector3d.cpp vector3d const y function
    * @return const T&
    */
-  const T& y() const noexcept { return Vector<3, T>::data_[1]; }
+  constexpr const T& y() const noexcept { return (*this)[1]; }
 
   /**
    * @brief z component
@@ -78,7 +81,7 @@ class Vector3D : public Vector<3, T> {
    * @snippet example_vector3d.cpp vector3d z function
    * @return T&
    */
-  T& z() noexcept { return Vector<3, T>::data_[2]; }
+  constexpr T& z() noexcept { return (*this)[2]; }
 
   /**
    * @brief const z component
@@ -87,8 +90,228 @@ class Vector3D : public Vector<3, T> {
    * @snippet example_vector3d.cpp vector3d const z function
    * @return const T&
    */
-  const T& z() const noexcept { return Vector<3, T>::data_[2]; }
+  constexpr const T& z() const noexcept { return (*this)[2]; }
+
+  /**
+   * @brief cross product
+   *
+   * \f$ a \times b = (a_y b_z - a_z b_y, a_z b_x - a_x b_z, a_x b_y - a_y b_x)
+   * \f$
+   *
+   * the result is perpendicular to both vectors
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d cross function
+   * @param rhs
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> cross(const Vector<3, T>& rhs) const {
+    return Vector3D<T>{T((*this)[1] * rhs[2] - (*this)[2] * rhs[1]),
+                       T((*this)[2] * rhs[0] - (*this)[0] * rhs[2]),
+                       T((*this)[0] * rhs[1] - (*this)[1] * rhs[0])};
+  }
+
+  /**
+   * @brief normalized cross product, e.g. the normal of a plane
+   *
+   * fused kernel. the cross product is normalized without building
+   * intermediate vectors and with a single square root. the result is
+   * returned as
+   * - the type of this vector (default)
+   * - the explicitly stated type
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d unit_cross function
+   * @tparam U
+   * @param rhs
+   * @return Vector3D<U>
+   */
+  template <class U = T>
+  Vector3D<U> unit_cross(const Vector<3, T>& rhs) const {
+    const U kX = U((*this)[1] * rhs[2] - (*this)[2] * rhs[1]);
+    const U kY = U((*this)[2] * rhs[0] - (*this)[0] * rhs[2]);
+    const U kZ = U((*this)[0] * rhs[1] - (*this)[1] * rhs[0]);
+    const U kInv = U(1) / U(mu::sqrt(kX * kX + kY * kY + kZ * kZ));
+    return Vector3D<U>{U(kX * kInv), U(kY * kInv), U(kZ * kInv)};
+  }
+
+  /**
+   * @brief cosine of the angle between this and another vector
+   *
+   * \f$ \cos \theta = \frac{a \cdot b}{|a| |b|} \f$
+   *
+   * fused kernel. the dot product and both squared lengths are calculated in
+   * one pass and only a single square root is needed. the result is returned
+   * as
+   * - the type of this vector (default)
+   * - the explicitly stated type
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d cos_angle function
+   * @tparam U
+   * @param rhs
+   * @return U
+   */
+  template <class U = T>
+  U cos_angle(const Vector<3, T>& rhs) const {
+    U dot{0};
+    U len_lhs{0};
+    U len_rhs{0};
+    for (std::size_t i = 0; i < 3; i++) {
+      dot += U((*this)[i]) * U(rhs[i]);
+      len_lhs += U((*this)[i]) * U((*this)[i]);
+      len_rhs += U(rhs[i]) * U(rhs[i]);
+    }
+    return U(dot / mu::sqrt(len_lhs * len_rhs));
+  }
+
+  /**
+   * @brief rotates this Vector around an axis by an angle [rad]
+   *
+   * Rodrigues' rotation formula. the axis does not have to be normalized,
+   * it must not be zero. the euclidean vector length remains unchanged by
+   * rotation! to rotate many vectors by the same rotation, see mu::Quaternion
+   *
+   * \f$ v' = v \cos \theta + (k \times v) \sin \theta +
+   * k (k \cdot v)(1 - \cos \theta) \f$
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d rotate function
+   * @tparam TScalar
+   * @param axis
+   * @param angle
+   * @return std::enable_if<std::is_arithmetic<TScalar>::value, void>::type
+   */
+  template <class TScalar = T>
+  typename std::enable_if_t<std::is_arithmetic<TScalar>::value, void> rotate(
+      const Vector<3, T>& axis, TScalar angle) {
+    using U = std::conditional_t<std::is_floating_point<TScalar>::value,
+                                 TScalar, double>;
+    const U kInv = U(1) / U(mu::sqrt(U(axis.dot(axis))));
+    const U kKx = U(axis[0]) * kInv;
+    const U kKy = U(axis[1]) * kInv;
+    const U kKz = U(axis[2]) * kInv;
+    const U kX = U(x());
+    const U kY = U(y());
+    const U kZ = U(z());
+    const U kCos = U(mu::cos(angle));
+    const U kSin = U(mu::sin(angle));
+    const U kDot = (kKx * kX + kKy * kY + kKz * kZ) * (U(1) - kCos);
+    Vector<3, T>::data_[0] = T(kX * kCos + (kKy * kZ - kKz * kY) * kSin +
+                               kKx * kDot);
+    Vector<3, T>::data_[1] = T(kY * kCos + (kKz * kX - kKx * kZ) * kSin +
+                               kKy * kDot);
+    Vector<3, T>::data_[2] = T(kZ * kCos + (kKx * kY - kKy * kX) * kSin +
+                               kKz * kDot);
+  }
+
+  /**
+   * @brief returns a Vector3D that is rotated around an axis by an angle [rad]
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d rotated function
+   * @see @ref rotate()
+   * @tparam TScalar
+   * @param axis
+   * @param angle
+   * @return std::enable_if<std::is_arithmetic<TScalar>::value,
+   * Vector3D<T>>::type
+   */
+  template <class TScalar = T>
+  typename std::enable_if_t<std::is_arithmetic<TScalar>::value, Vector3D<T>>
+  rotated(const Vector<3, T>& axis, TScalar angle) const {
+    Vector3D<T> ret(*this);
+    ret.rotate(axis, angle);
+    return ret;
+  }
+
+  /**
+   * @brief projects this Vector onto another one
+   *
+   * \f$ v' = \frac{v \cdot n}{n \cdot n} n \f$
+   *
+   * the other vector does not have to be normalized, it must not be zero.
+   * for an integral type the scale is calculated in double and the values are
+   * rounded to the nearest integer
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d project function
+   * @param onto
+   */
+  constexpr void project(const Vector<3, T>& onto) {
+    using U = std::conditional_t<std::is_floating_point<T>::value, T, double>;
+    const U kScale = U(this->dot(onto)) / U(onto.dot(onto));
+    for (std::size_t i = 0; i < 3; i++) {
+      const U kValue = U(onto[i]) * kScale;
+      (*this)[i] = std::is_integral<T>::value
+                       ? T(kValue < U(0) ? kValue - U(0.5) : kValue + U(0.5))
+                       : T(kValue);
+    }
+  }
+
+  /**
+   * @brief returns the projection of this Vector onto another one
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d projected function
+   * @see @ref project()
+   * @param onto
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> projected(const Vector<3, T>& onto) const {
+    Vector3D<T> ret(*this);
+    ret.project(onto);
+    return ret;
+  }
+
+  /**
+   * @brief reflects this Vector at a plane, e.g. a surface
+   *
+   * \f$ v' = v - 2 (v \cdot n) n \f$
+   *
+   * the normal of the plane must be normalized
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d reflect function
+   * @param normal
+   */
+  constexpr void reflect(const Vector<3, T>& normal) {
+    const T kScale = T(2) * this->dot(normal);
+    for (std::size_t i = 0; i < 3; i++) {
+      (*this)[i] -= normal[i] * kScale;
+    }
+  }
+
+  /**
+   * @brief returns this Vector reflected at a plane
+   *
+   * @par Example
+   * @snippet example_vector3d.cpp vector3d reflected function
+   * @see @ref reflect()
+   * @param normal
+   * @return Vector3D<T>
+   */
+  constexpr Vector3D<T> reflected(const Vector<3, T>& normal) const {
+    Vector3D<T> ret(*this);
+    ret.reflect(normal);
+    return ret;
+  }
 };
 
+/**
+ * @brief cross product
+ *
+ * see Vector3D::cross()
+ *
+ * @tparam T
+ * @param lhs
+ * @param rhs
+ * @return Vector3D<T>
+ */
+template <typename T>
+constexpr Vector3D<T> cross(const Vector<3, T>& lhs, const Vector<3, T>& rhs) {
+  return Vector3D<T>(lhs).cross(rhs);
+}
+
 }  // namespace mu
 #endif  // MU_VECTOR3D_H_
\ No newline at end of file
@@ -0,0 +1,779 @@
+/**
+ * @file vectorbatch.h
+ *
+ * VectorBatch class and free functions
+ */
+#ifndef MU_VECTORBATCH_H_
+#define MU_VECTORBATCH_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mu/simd.h"
+#include "mu/utility.h"
+#include "mu/vector.h"
+
+namespace mu {
+
+/**
+ * @brief A batch of vectors (structure of arrays)
+ *
+ * stores many Vectors of size N. instead of one Vector after another, every
+ * component has its own contiguous lane, i.e. all x components, then all y
+ * components and so on. this way an operation is applied to many Vectors at
+ * once with SIMD registers (see mu::SimdTraits).
+ *
+ * the operations behave like the ones of a single Vector, applied to every
+ * Vector of the batch. single Vectors are copied in (gather) and out (scatter)
+ * of the batch.
+ *
+ * @tparam N size of each vector
+ * @tparam T the type of the values inside the vectors
+ */
+template <std::size_t N, class T>
+class VectorBatch {
+  static_assert(N != 0, "size cannot be zero");
+  static_assert(std::is_arithmetic<T>::value,
+                "Type must be an arithmetic type");
+
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Construct a new empty VectorBatch object
+   */
+  VectorBatch() = default;
+
+  /**
+   * @brief Construct a new VectorBatch object of count zero Vectors
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch count constructor
+   * @param count
+   */
+  explicit VectorBatch(std::size_t count) { resize(count); }
+
+  /**
+   * @brief Construct a new VectorBatch object of count copies of a Vector
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch count value constructor
+   * @param count
+   * @param value
+   */
+  VectorBatch(std::size_t count, const Vector<N, T> &value) {
+    for (std::size_t c = 0; c < N; c++) {
+      lanes_[c].assign(count, value[c]);
+    }
+  }
+
+  /**
+   * @brief Construct a new VectorBatch object from a range of Vectors
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch range constructor
+   * @see @ref gather()
+   * @tparam TIt
+   * @param first
+   * @param last
+   */
+  template <class TIt>
+  VectorBatch(TIt first, TIt last) {
+    gather(first, last);
+  }
+
+  /**
+   * @brief Construct a new VectorBatch object from a list of Vectors
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch initializer list constructor
+   * @param list
+   */
+  VectorBatch(std::initializer_list<Vector<N, T>> list) {
+    gather(list.begin(), list.end());
+  }
+
+  /**
+   * @brief number of Vectors
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const noexcept { return lanes_[0].size(); }
+
+  /**
+   * @brief true if there are no Vectors
+   *
+   * @return bool
+   */
+  bool empty() const noexcept { return lanes_[0].empty(); }
+
+  /**
+   * @brief changes the number of Vectors. new Vectors are zero
+   *
+   * @param count
+   */
+  void resize(std::size_t count) {
+    for (auto &lane : lanes_) {
+      lane.resize(count, T{0});
+    }
+  }
+
+  /**
+   * @brief reserves memory for count Vectors
+   *
+   * @param count
+   */
+  void reserve(std::size_t count) {
+    for (auto &lane : lanes_) {
+      lane.reserve(count);
+    }
+  }
+
+  /**
+   * @brief removes all Vectors
+   */
+  void clear() noexcept {
+    for (auto &lane : lanes_) {
+      lane.clear();
+    }
+  }
+
+  /**
+   * @brief appends a Vector
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch push_back function
+   * @param v
+   */
+  void push_back(const Vector<N, T> &v) {
+    for (std::size_t c = 0; c < N; c++) {
+      lanes_[c].push_back(v[c]);
+    }
+  }
+
+  /**
+   * @brief pointer to the contiguous values of a component
+   *
+   * e.g. lane(0) points to all x components
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch lane function
+   * @param c component
+   * @return T*
+   */
+  T *lane(std::size_t c) noexcept {
+    assert(c < N);
+    return lanes_[c].data();
+  }
+
+  /**
+   * @brief const pointer to the contiguous values of a component
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch const lane function
+   * @param c component
+   * @return const T*
+   */
+  const T *lane(std::size_t c) const noexcept {
+    assert(c < N);
+    return lanes_[c].data();
+  }
+
+  /**
+   * @brief copies a single Vector out of the batch
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch get function
+   * @param idx
+   * @return Vector<N, T>
+   */
+  Vector<N, T> get(std::size_t idx) const {
+    assert(idx < size());
+    Vector<N, T> ret;
+    for (std::size_t c = 0; c < N; c++) {
+      ret[c] = lanes_[c][idx];
+    }
+    return ret;
+  }
+
+  /**
+   * @brief copies a single Vector into the batch
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch set function
+   * @param idx
+   * @param v
+   */
+  void set(std::size_t idx, const Vector<N, T> &v) {
+    assert(idx < size());
+    for (std::size_t c = 0; c < N; c++) {
+      lanes_[c][idx] = v[c];
+    }
+  }
+
+  /**
+   * @brief replaces the content by a range of Vectors
+   *
+   * e.g. from a std::vector<mu::Vector3D<float>>. every Vector is split into
+   * its components
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch gather function
+   * @tparam TIt iterator to a Vector<N, T> (or a derived class)
+   * @param first
+   * @param last
+   */
+  template <class TIt>
+  void gather(TIt first, TIt last) {
+    const auto kCount = static_cast<std::size_t>(std::distance(first, last));
+    for (auto &lane : lanes_) {
+      lane.resize(kCount);
+    }
+    for (std::size_t i = 0; first != last; ++first, i++) {
+      const Vector<N, T> &v = *first;
+      for (std::size_t c = 0; c < N; c++) {
+        lanes_[c][i] = v[c];
+      }
+    }
+  }
+
+  /**
+   * @brief writes all Vectors to an output iterator
+   *
+   * e.g. into a std::vector<mu::Vector3D<float>>. every Vector is put together
+   * from its components
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch scatter function
+   * @tparam TOutIt
+   * @param out
+   * @return TOutIt iterator past the last written Vector
+   */
+  template <class TOutIt>
+  TOutIt scatter(TOutIt out) const {
+    for (std::size_t i = 0; i < size(); i++) {
+      *out = get(i);
+      ++out;
+    }
+    return out;
+  }
+
+  /**
+   * @brief dot product of every pair of Vectors of two batches
+   *
+   * see Vector::dot(). For two batches of the same type, specifying the return
+   * type is optional. For two batches of different types, specifying the
+   * return type is required.
+   *
+   * Batch sizes must be equal
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch dot function
+   * @tparam U
+   * @tparam T2
+   * @param rhs
+   * @return std::vector<std::conditional_t<std::is_same<U, void>::value, T,
+   * U>>
+   */
+  template <typename U = void, typename T2>
+  std::vector<std::conditional_t<std::is_same<U, void>::value, T, U>> dot(
+      const VectorBatch<N, T2> &rhs) const {
+    using U_ = std::conditional_t<!std::is_same<T, T2>::value, U, T>;
+    static_assert(!std::is_same<U_, void>::value,
+                  "VectorBatch types are different. please specify the return "
+                  "type. e.g. \"batch1.dot<float>(batch2);\"");
+    assert(size() == rhs.size());
+    using R = std::conditional_t<std::is_same<U, void>::value, T, U>;
+    std::vector<U_> ret(size(), U_{});
+    for (std::size_t c = 0; c < N; c++) {
+      mu::simd_mul_add(ret.data(), lane(c), rhs.lane(c), size());
+    }
+    return convert<R>(std::move(ret), std::is_same<R, U_>{});
+  }
+
+  /**
+   * @brief euclidean length of every Vector
+   *
+   * see Vector::length()
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch length function
+   * @tparam U
+   * @return std::vector<U>
+   */
+  template <class U = T>
+  std::vector<U> length() const {
+    return length<U>(dot(*this), std::is_same<U, T>{});
+  }
+
+  /**
+   * @brief normalizes every Vector
+   *
+   * see Vector::normalize()
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch normalize function
+   */
+  void normalize() {
+    const std::vector<T> kLength = length();
+    for (std::size_t c = 0; c < N; c++) {
+      mu::simd_apply<mu::SimdDiv>(lane(c), kLength.data(), size());
+    }
+  }
+
+  /**
+   * @brief returns a batch of normalized Vectors
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch normalized function
+   * @see @ref normalize()
+   * @return VectorBatch<N, T>
+   */
+  VectorBatch<N, T> normalized() const {
+    VectorBatch<N, T> ret(*this);
+    ret.normalize();
+    return ret;
+  }
+
+  /**
+   * @brief rotates every two dimensional Vector by an angle [rad]
+   *
+   * see Vector2D::rotate(). sine and cosine are calculated only once for the
+   * whole batch
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch rotate function
+   * @tparam TScalar
+   * @param angle
+   * @return std::enable_if_t<N == 2 && std::is_arithmetic<TScalar>::value>
+   */
+  template <class TScalar = T, std::size_t N_ = N>
+  std::enable_if_t<N_ == 2 && std::is_arithmetic<TScalar>::value> rotate(
+      TScalar angle) {
+    rotate(mu::cos(angle), mu::sin(angle),
+           std::integral_constant<bool, std::is_same<TScalar, T>::value &&
+                                            (SimdTraits<T>::size > 1)>{});
+  }
+
+  /**
+   * @brief returns a batch of two dimensional Vectors that are rotated by an
+   * angle [rad]
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch rotated function
+   * @see @ref rotate()
+   * @tparam TScalar
+   * @param angle
+   * @return std::enable_if_t<N == 2 && std::is_arithmetic<TScalar>::value,
+   * VectorBatch<N, T>>
+   */
+  template <class TScalar = T, std::size_t N_ = N>
+  std::enable_if_t<N_ == 2 && std::is_arithmetic<TScalar>::value,
+                   VectorBatch<N, T>>
+  rotated(TScalar angle) const {
+    VectorBatch<N, T> ret(*this);
+    ret.rotate(angle);
+    return ret;
+  }
+
+  /**
+   * @brief elementwise addition of two batches
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch plus equal operator
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator+=(const VectorBatch<N, U> &rhs) {
+    return apply<mu::SimdAdd>(rhs);
+  }
+
+  /**
+   * @brief elementwise subtraction of two batches
+   *
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator-=(const VectorBatch<N, U> &rhs) {
+    return apply<mu::SimdSub>(rhs);
+  }
+
+  /**
+   * @brief elementwise multiplication of two batches
+   *
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator*=(const VectorBatch<N, U> &rhs) {
+    return apply<mu::SimdMul>(rhs);
+  }
+
+  /**
+   * @brief elementwise division of two batches
+   *
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator/=(const VectorBatch<N, U> &rhs) {
+    return apply<mu::SimdDiv>(rhs);
+  }
+
+  /**
+   * @brief adds the same Vector to every Vector
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch plus equal vector operator
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator+=(const Vector<N, U> &rhs) {
+    return apply<mu::SimdAdd>(rhs);
+  }
+
+  /**
+   * @brief subtracts the same Vector from every Vector
+   *
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator-=(const Vector<N, U> &rhs) {
+    return apply<mu::SimdSub>(rhs);
+  }
+
+  /**
+   * @brief multiplies every Vector elementwise with the same Vector
+   *
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator*=(const Vector<N, U> &rhs) {
+    return apply<mu::SimdMul>(rhs);
+  }
+
+  /**
+   * @brief divides every Vector elementwise by the same Vector
+   *
+   * @tparam U
+   * @param rhs
+   * @return VectorBatch<N, T>&
+   */
+  template <class U>
+  VectorBatch<N, T> &operator/=(const Vector<N, U> &rhs) {
+    return apply<mu::SimdDiv>(rhs);
+  }
+
+  /**
+   * @brief adds a scalar to every value
+   *
+   * @par Example
+   * @snippet example_vectorbatch.cpp vectorbatch plus equal scalar operator
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * VectorBatch<N, T> &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T> &>
+  operator+=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdAdd>(scalar);
+  }
+
+  /**
+   * @brief subtracts a scalar from every value
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * VectorBatch<N, T> &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T> &>
+  operator-=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdSub>(scalar);
+  }
+
+  /**
+   * @brief multiplies every value with a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * VectorBatch<N, T> &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T> &>
+  operator*=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdMul>(scalar);
+  }
+
+  /**
+   * @brief divides every value by a scalar
+   *
+   * @tparam TScalar
+   * @param scalar
+   * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+   * VectorBatch<N, T> &>
+   */
+  template <class TScalar>
+  std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T> &>
+  operator/=(const TScalar &scalar) {
+    return apply_scalar<mu::SimdDiv>(scalar);
+  }
+
+ private:
+  std::array<std::vector<T>, N> lanes_;
+
+  /* the dot products are calculated like Vector::dot() and converted to the
+   * return type afterwards */
+  template <class R, class U>
+  static std::vector<R> convert(std::vector<U> &&v, std::true_type /*same*/) {
+    return std::move(v);
+  }
+
+  template <class R, class U>
+  static std::vector<R> convert(std::vector<U> &&v, std::false_type /*same*/) {
+    return std::vector<R>(v.begin(), v.end());
+  }
+
+  /* square root of the dot products. in-place for the same type */
+  template <class U>
+  static std::vector<U> length(std::vector<T> dot, std::true_type /*same*/) {
+    mu::simd_sqrt(dot.data(), dot.size());
+    return dot;
+  }
+
+  template <class U>
+  static std::vector<U> length(const std::vector<T> &dot,
+                               std::false_type /*same*/) {
+    std::vector<U> ret(dot.size());
+    for (std::size_t i = 0; i < dot.size(); i++) {
+      ret[i] = U(mu::sqrt(dot[i]));
+    }
+    return ret;
+  }
+
+  /* rotation with sine and cosine of the same type (SIMD) */
+  void rotate(T cos, T sin, std::true_type /*simd*/) {
+    using Traits = SimdTraits<T>;
+    T *x = lane(0);
+    T *y = lane(1);
+    const std::size_t kFull = size() - (size() % Traits::size);
+    const typename Traits::type kCos = Traits::set1(cos);
+    const typename Traits::type kSin = Traits::set1(sin);
+    for (std::size_t i = 0; i < kFull; i += Traits::size) {
+      const typename Traits::type kX = Traits::load(x + i);
+      const typename Traits::type kY = Traits::load(y + i);
+      Traits::store(x + i,
+                    Traits::sub(Traits::mul(kX, kCos), Traits::mul(kY, kSin)));
+      Traits::store(y + i,
+                    Traits::add(Traits::mul(kX, kSin), Traits::mul(kY, kCos)));
+    }
+    rotate(cos, sin, kFull, size());
+  }
+
+  /* rotation with sine and cosine of any type */
+  template <class TScalar>
+  void rotate(TScalar cos, TScalar sin, std::false_type /*simd*/) {
+    rotate(cos, sin, 0, size());
+  }
+
+  template <class TScalar>
+  void rotate(TScalar cos, TScalar sin, std::size_t first, std::size_t last) {
+    T *x = lane(0);
+    T *y = lane(1);
+    for (std::size_t i = first; i < last; i++) {
+      const T kX = x[i];
+      const T kY = y[i];
+      x[i] = ((kX * cos) - (kY * sin));
+      y[i] = ((kX * sin) + (kY * cos));
+    }
+  }
+
+  template <class TOp, class U>
+  VectorBatch<N, T> &apply(const VectorBatch<N, U> &rhs) {
+    assert(size() == rhs.size());
+    for (std::size_t c = 0; c < N; c++) {
+      mu::simd_apply<TOp>(lane(c), rhs.lane(c), size());
+    }
+    return *this;
+  }
+
+  template <class TOp, class U>
+  VectorBatch<N, T> &apply(const Vector<N, U> &rhs) {
+    for (std::size_t c = 0; c < N; c++) {
+      mu::simd_apply_scalar<TOp>(lane(c), rhs[c], size());
+    }
+    return *this;
+  }
+
+  template <class TOp, class TScalar>
+  VectorBatch<N, T> &apply_scalar(const TScalar &scalar) {
+    for (std::size_t c = 0; c < N; c++) {
+      mu::simd_apply_scalar<TOp>(lane(c), scalar, size());
+    }
+    return *this;
+  }
+};
+
+/**
+ * @brief plus operator
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return VectorBatch<N, T>
+ */
+template <std::size_t N, class T, class U>
+VectorBatch<N, T> operator+(VectorBatch<N, T> lhs,
+                            const VectorBatch<N, U> &rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+/**
+ * @brief minus operator
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return VectorBatch<N, T>
+ */
+template <std::size_t N, class T, class U>
+VectorBatch<N, T> operator-(VectorBatch<N, T> lhs,
+                            const VectorBatch<N, U> &rhs) {
+  lhs -= rhs;
+  return lhs;
+}
+
+/**
+ * @brief multiplication operator
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return VectorBatch<N, T>
+ */
+template <std::size_t N, class T, class U>
+VectorBatch<N, T> operator*(VectorBatch<N, T> lhs,
+                            const VectorBatch<N, U> &rhs) {
+  lhs *= rhs;
+  return lhs;
+}
+
+/**
+ * @brief division operator
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam U
+ * @param lhs
+ * @param rhs
+ * @return VectorBatch<N, T>
+ */
+template <std::size_t N, class T, class U>
+VectorBatch<N, T> operator/(VectorBatch<N, T> lhs,
+                            const VectorBatch<N, U> &rhs) {
+  lhs /= rhs;
+  return lhs;
+}
+
+/**
+ * @brief batch and scalar addition
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * VectorBatch<N, T>>
+ */
+template <std::size_t N, class T, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T>>
+operator+(VectorBatch<N, T> lhs, const TScalar &scalar) {
+  lhs += scalar;
+  return lhs;
+}
+
+/**
+ * @brief batch and scalar subtraction
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * VectorBatch<N, T>>
+ */
+template <std::size_t N, class T, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T>>
+operator-(VectorBatch<N, T> lhs, const TScalar &scalar) {
+  lhs -= scalar;
+  return lhs;
+}
+
+/**
+ * @brief batch and scalar multiplication
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * VectorBatch<N, T>>
+ */
+template <std::size_t N, class T, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T>>
+operator*(VectorBatch<N, T> lhs, const TScalar &scalar) {
+  lhs *= scalar;
+  return lhs;
+}
+
+/**
+ * @brief batch and scalar division
+ *
+ * @tparam N
+ * @tparam T
+ * @tparam TScalar
+ * @param lhs
+ * @param scalar
+ * @return std::enable_if_t<std::is_arithmetic<TScalar>::value,
+ * VectorBatch<N, T>>
+ */
+template <std::size_t N, class T, class TScalar>
+std::enable_if_t<std::is_arithmetic<TScalar>::value, VectorBatch<N, T>>
+operator/(VectorBatch<N, T> lhs, const TScalar &scalar) {
+  lhs /= scalar;
+  return lhs;
+}
+
+}  // namespace mu
+#endif  // MU_VECTORBATCH_H_
@@ -0,0 +1,41 @@
+#ifndef TESTS_COUNTING_ALLOCATOR_H_
+#define TESTS_COUNTING_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+
+/**
+ * allocator for the tests of the heap-backed types (DynVector, DynMatrix).
+ * it counts the allocations of all its copies, i.e. also the rebound ones
+ */
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t *count) : count_{count} {}
+  template <class U>
+  // NOLINTNEXTLINE(runtime/explicit) allocators must be convertible
+  CountingAllocator(const CountingAllocator<U> &other)
+      : count_{other.count_} {}
+
+  T *allocate(std::size_t n) {
+    (*count_)++;
+    return std::allocator<T>{}.allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <class U>
+  bool operator==(const CountingAllocator<U> &rhs) const {
+    return count_ == rhs.count_;
+  }
+  template <class U>
+  bool operator!=(const CountingAllocator<U> &rhs) const {
+    return count_ != rhs.count_;
+  }
+
+  std::size_t *count_;
+};
+
+#endif  // TESTS_COUNTING_ALLOCATOR_H_
@@ -220,6 +220,22 @@ TYPED_TEST_P(MatrixTypeFixture, MemberFuncNCols) {
   EXPECT_TRUE(noexcept(obj.n_cols()));
 }
 
+TYPED_TEST_P(MatrixTypeFixture, MemberFuncData) {
+  /** arrange */
+  TypeParam obj{this->values};
+  /** action */
+  auto* data = obj.data();
+  const auto* data_const = static_cast<const TypeParam&>(obj).data();
+  /** assert */
+  const std::size_t kCols = obj.size()[1];
+  for (typename TestFixture::size_type i = 0; i < obj.size()[0]; i++) {
+    for (typename TestFixture::size_type j = 0; j < kCols; j++) {
+      EXPECT_EQ(data[i * kCols + j], this->values[i][j]);
+      EXPECT_EQ(&data_const[i * kCols + j], &obj[i][j]);
+    }
+  }
+}
+
 TYPED_TEST_P(MatrixTypeFixture, MemberFuncBegin) {
   /** arrange */
   TypeParam obj{this->values};
@@ -419,6 +435,46 @@ TYPED_TEST_P(MatrixTypeFixture, MemberFuncStdConvertedType) {
   EXPECT_FLOAT_EQ(std, comp);
 }
 
+TYPED_TEST_P(MatrixTypeFixture, MemberFuncVariance) {
+  /** arrange */
+  TypeParam obj{this->values};
+  /** action */
+  typename TestFixture::value_type var = obj.variance();
+  /** assert */
+  typename TestFixture::value_type sum{};
+  for (const auto& row : this->values) {
+    sum += std::accumulate(row.begin(), row.end(),
+                           static_cast<typename TestFixture::value_type>(0));
+  }
+  typename TestFixture::value_type mean;
+  mean = sum / (this->values.size() * this->values[0].size());
+
+  typename TestFixture::value_type sum2{0};
+  for (const auto& row : this->values) {
+    for (const auto& item : row) {
+      sum2 += mu::pow(item - mean, 2);
+    }
+  }
+  typename TestFixture::value_type comp;
+  comp = sum2 / (this->values.size() * this->values[0].size());
+  EXPECT_FLOAT_EQ(var, comp);
+}
+
+TYPED_TEST_P(MatrixTypeFixture, MemberFuncMeanAndStd) {
+  /** arrange */
+  TypeParam obj{this->values};
+  /** action */
+  auto res = obj.mean_and_std();
+  auto res2 = obj.template mean_and_std<typename TestFixture::ConvertedType>();
+  /** assert */
+  EXPECT_FLOAT_EQ(res.first, obj.mean());
+  EXPECT_FLOAT_EQ(res.second, obj.std());
+  EXPECT_FLOAT_EQ(res2.first,
+                  obj.template mean<typename TestFixture::ConvertedType>());
+  EXPECT_FLOAT_EQ(res2.second,
+                  obj.template std<typename TestFixture::ConvertedType>());
+}
+
 TYPED_TEST_P(MatrixTypeFixture, MemberFuncDiag) {
   /** arrange */
   TypeParam obj{this->values};
@@ -718,10 +774,12 @@ REGISTER_TYPED_TEST_SUITE_P(
     ConstructorCopy, ConstructorMove, OperatorCopyAssignment,
     OperatorMoveAssignment, OperatorBrackets, OperatorBracketsConst,
     MemberFuncAt, MemberFuncAtConst, MemberFuncSize, MemberFuncNRows,
-    MemberFuncNCols, MemberFuncBegin, MemberFuncBeginConst, MemberFuncEnd,
-    MemberFuncEndConst, MemberFuncRow, MemberFuncCol, MemberFuncMin,
-    MemberFuncMax, MemberFuncSum, MemberFuncMean, MemberFuncDiag, MemberFuncDet,
+    MemberFuncNCols, MemberFuncData, MemberFuncBegin, MemberFuncBeginConst,
+    MemberFuncEnd, MemberFuncEndConst, MemberFuncRow, MemberFuncCol,
+    MemberFuncMin, MemberFuncMax, MemberFuncSum, MemberFuncMean, MemberFuncDiag,
+    MemberFuncDet,
     MemberFuncMeanConvertedType, MemberFuncStd, MemberFuncStdConvertedType,
+    MemberFuncVariance, MemberFuncMeanAndStd,
     MemberFuncTranspose, MemberFuncTransposed, OperatorStreamOut,
     UtilityFuncMin, UtilityFuncMax, UtilityFuncSum, UtilityFuncMean,
     UtilityFuncMeanConvertedType, UtilityFuncDiagMakeVector, UtilityFuncDet,
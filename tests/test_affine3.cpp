@@ -0,0 +1,287 @@
+#include <cstddef>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/affine3.h"
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/vector.h"
+#include "mu/vector3d.h"
+
+/**
+ * every transformation is checked against the homogeneous 4x4 matrix of the
+ * same transformation, i.e. Matrix<4, 4>::dot with w = 1 for points and w = 0
+ * for directions
+ */
+
+using Affine3Types = ::testing::Types<float, double>;
+
+template <typename T>
+class Affine3Fixture : public ::testing::Test {
+ public:
+  static T tolerance() { return std::is_same<T, float>::value ? 1e-5 : 1e-12; }
+
+  /* rotation, non-uniform scale and translation */
+  static mu::Affine3<T> arbitrary(std::size_t seed = 0) {
+    const mu::Quaternion<T> kRot{
+        mu::Vector3D<T>{T{1}, static_cast<T>(seed) + T{2}, T{-3}},
+        T{0.7} + static_cast<T>(seed)};
+    mu::Matrix<3, 3, T> linear = kRot.to_matrix();
+    for (std::size_t i = 0; i < 3; i++) {
+      linear[i][i] += static_cast<T>(i + seed) * T{0.5};
+    }
+    return mu::Affine3<T>{
+        linear, mu::Vector3D<T>{T{0.5}, static_cast<T>(seed) - T{1}, T{2}}};
+  }
+
+  static mu::Affine3<T> rigid(std::size_t seed = 0) {
+    return mu::Affine3<T>{
+        mu::Quaternion<T>{
+            mu::Vector3D<T>{T{-2}, T{1}, static_cast<T>(seed) + T{1}},
+            T{1.3} - static_cast<T>(seed)},
+        mu::Vector3D<T>{T{3}, T{-1}, static_cast<T>(seed)}};
+  }
+
+  static std::vector<mu::Vector3D<T>> points(std::size_t count) {
+    std::vector<mu::Vector3D<T>> ret(count);
+    for (std::size_t i = 0; i < count; i++) {
+      ret[i] = mu::Vector3D<T>{static_cast<T>(i % 5) - T{2},
+                               static_cast<T>(i % 3) + T{0.5},
+                               static_cast<T>(i % 7) * T{-0.25}};
+    }
+    return ret;
+  }
+
+  /* homogeneous 4x4 matrix times [ v, w ] */
+  static mu::Vector3D<T> homogeneous(const mu::Matrix<4, 4, T> &m,
+                                     const mu::Vector3D<T> &v, T w) {
+    const mu::Vector<4, T> kRes =
+        m.dot(mu::Vector<4, T>{T{v[0]}, T{v[1]}, T{v[2]}, T{w}});
+    return mu::Vector3D<T>{T{kRes[0]}, T{kRes[1]}, T{kRes[2]}};
+  }
+
+  static void expect_near(const mu::Vector3D<T> &a, const mu::Vector3D<T> &b) {
+    for (std::size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(a[i], b[i], tolerance() * 10);
+    }
+  }
+
+  static void expect_near(const mu::Affine3<T> &a, const mu::Affine3<T> &b) {
+    for (std::size_t i = 0; i < 3; i++) {
+      for (std::size_t j = 0; j < 3; j++) {
+        EXPECT_NEAR(a.linear()[i][j], b.linear()[i][j], tolerance() * 10);
+      }
+    }
+    expect_near(a.translation(), b.translation());
+  }
+};
+
+TYPED_TEST_SUITE(Affine3Fixture, Affine3Types);
+
+TYPED_TEST(Affine3Fixture, ConstructorDefault) {
+  /** action */
+  constexpr mu::Affine3<TypeParam> kA;
+  /** assert */
+  static_assert(kA.linear() == mu::eye<3, TypeParam>(), "");
+  static_assert(kA.translation() == mu::Vector3D<TypeParam>{TypeParam{0}}, "");
+  const mu::Vector3D<TypeParam> kV{TypeParam{1}, TypeParam{2}, TypeParam{3}};
+  EXPECT_EQ(kA.transform_point(kV), kV);
+  EXPECT_EQ(kA.to_matrix(), (mu::eye<4, TypeParam>()));
+}
+
+TYPED_TEST(Affine3Fixture, ConstructorLinearTranslation) {
+  /** arrange */
+  const mu::Matrix<3, 3, TypeParam> kL{
+      {TypeParam{1}, TypeParam{2}, TypeParam{3}},
+      {TypeParam{4}, TypeParam{5}, TypeParam{6}},
+      {TypeParam{7}, TypeParam{8}, TypeParam{10}}};
+  const mu::Vector3D<TypeParam> kT{TypeParam{-1}, TypeParam{0}, TypeParam{1}};
+  /** action */
+  mu::Affine3<TypeParam> a{kL, kT};
+  mu::Affine3<TypeParam> b{kL};
+  /** assert */
+  EXPECT_EQ(a.linear(), kL);
+  EXPECT_EQ(a.translation(), kT);
+  EXPECT_EQ(b.linear(), kL);
+  EXPECT_EQ(b.translation(), mu::Vector3D<TypeParam>{TypeParam{0}});
+}
+
+TYPED_TEST(Affine3Fixture, ConstructorQuaternion) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ{
+      mu::Vector3D<TypeParam>{TypeParam{1}, TypeParam{1}, TypeParam{0}},
+      TypeParam{0.4}};
+  const mu::Vector3D<TypeParam> kT{TypeParam{2}, TypeParam{3}, TypeParam{4}};
+  /** action */
+  mu::Affine3<TypeParam> a{kQ, kT};
+  /** assert */
+  EXPECT_EQ(a.linear(), kQ.to_matrix());
+  EXPECT_EQ(a.translation(), kT);
+  for (const auto &kP : TestFixture::points(5)) {
+    TestFixture::expect_near(a.transform_point(kP), kQ.rotate(kP) + kT);
+  }
+}
+
+TYPED_TEST(Affine3Fixture, ConstructorMatrix) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  /** action */
+  mu::Affine3<TypeParam> res{kA.to_matrix()};
+  /** assert */
+  EXPECT_EQ(res, kA);
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncAccessors) {
+  /** arrange */
+  mu::Affine3<TypeParam> a;
+  /** action */
+  a.linear()[0][1] = TypeParam{2};
+  a.translation()[2] = TypeParam{-3};
+  /** assert */
+  const mu::Matrix<4, 4, TypeParam> kM = a.to_matrix();
+  EXPECT_EQ(kM[0][1], TypeParam{2});
+  EXPECT_EQ(kM[2][3], TypeParam{-3});
+  EXPECT_EQ(kM[3][3], TypeParam{1});
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncTransformPoint) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  const mu::Matrix<4, 4, TypeParam> kM = kA.to_matrix();
+  for (const auto &kP : TestFixture::points(8)) {
+    /** action */
+    mu::Vector3D<TypeParam> res = kA.transform_point(kP);
+    /** assert */
+    TestFixture::expect_near(res, TestFixture::homogeneous(kM, kP, 1));
+  }
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncTransformDirection) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  const mu::Matrix<4, 4, TypeParam> kM = kA.to_matrix();
+  for (const auto &kD : TestFixture::points(8)) {
+    /** action */
+    mu::Vector3D<TypeParam> res = kA.transform_direction(kD);
+    /** assert */
+    TestFixture::expect_near(res, TestFixture::homogeneous(kM, kD, 0));
+  }
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncTransformPointsRange) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  for (std::size_t n : {0, 1, 7}) {
+    const std::vector<mu::Vector3D<TypeParam>> kPoints = TestFixture::points(n);
+    std::vector<mu::Vector3D<TypeParam>> res(n);
+    std::vector<mu::Vector3D<TypeParam>> in_place = kPoints;
+    /** action */
+    auto end = kA.transform_points(kPoints.begin(), kPoints.end(), res.begin());
+    kA.transform_points(in_place.data(), in_place.data() + n, in_place.data());
+    /** assert */
+    EXPECT_EQ(end, res.end());
+    for (std::size_t i = 0; i < n; i++) {
+      TestFixture::expect_near(res[i], kA.transform_point(kPoints[i]));
+      EXPECT_EQ(in_place[i], res[i]);
+    }
+  }
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncInverse) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  /** action */
+  mu::Affine3<TypeParam> res = kA.inverse();
+  /** assert */
+  TestFixture::expect_near(res * kA, mu::Affine3<TypeParam>{});
+  TestFixture::expect_near(kA * res, mu::Affine3<TypeParam>{});
+  for (const auto &kP : TestFixture::points(5)) {
+    TestFixture::expect_near(res.transform_point(kA.transform_point(kP)), kP);
+  }
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncRigidInverse) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::rigid();
+  /** action */
+  mu::Affine3<TypeParam> res = kA.rigid_inverse();
+  /** assert */
+  TestFixture::expect_near(res, kA.inverse());
+  TestFixture::expect_near(res * kA, mu::Affine3<TypeParam>{});
+  for (const auto &kP : TestFixture::points(5)) {
+    TestFixture::expect_near(res.transform_point(kA.transform_point(kP)), kP);
+  }
+}
+
+TYPED_TEST(Affine3Fixture, MemberFuncToMatrix) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  /** action */
+  mu::Matrix<4, 4, TypeParam> res = kA.to_matrix();
+  /** assert */
+  for (std::size_t i = 0; i < 3; i++) {
+    for (std::size_t j = 0; j < 3; j++) {
+      EXPECT_EQ(res[i][j], kA.linear()[i][j]);
+    }
+    EXPECT_EQ(res[i][3], kA.translation()[i]);
+  }
+  EXPECT_EQ(res[3], (mu::Vector<4, TypeParam>{TypeParam{0}, TypeParam{0},
+                                              TypeParam{0}, TypeParam{1}}));
+}
+
+TYPED_TEST(Affine3Fixture, OperatorEquality) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  mu::Affine3<TypeParam> b = kA;
+  /** action */
+  b.translation()[1] += TypeParam{1};
+  /** assert */
+  EXPECT_TRUE(kA == TestFixture::arbitrary());
+  EXPECT_FALSE(kA != TestFixture::arbitrary());
+  EXPECT_TRUE(kA != b);
+}
+
+TYPED_TEST(Affine3Fixture, OperatorMultiplication) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary(0);
+  const mu::Affine3<TypeParam> kB = TestFixture::arbitrary(1);
+  /** action */
+  mu::Affine3<TypeParam> res = kA * kB;
+  mu::Affine3<TypeParam> res2 = kA;
+  res2 *= kB;
+  /** assert */
+  EXPECT_EQ(res, res2);
+  TestFixture::expect_near(
+      res, mu::Affine3<TypeParam>{kA.to_matrix().dot(kB.to_matrix())});
+  for (const auto &kP : TestFixture::points(5)) {
+    TestFixture::expect_near(res.transform_point(kP),
+                             kA.transform_point(kB.transform_point(kP)));
+  }
+}
+
+TYPED_TEST(Affine3Fixture, OperatorMultiplicationConstexpr) {
+  /** arrange */
+  constexpr mu::Affine3<TypeParam> kA{
+      mu::Matrix<3, 3, TypeParam>{{TypeParam{0}, TypeParam{-1}, TypeParam{0}},
+                                  {TypeParam{1}, TypeParam{0}, TypeParam{0}},
+                                  {TypeParam{0}, TypeParam{0}, TypeParam{1}}},
+      mu::Vector3D<TypeParam>{TypeParam{1}, TypeParam{2}, TypeParam{3}}};
+  /** action */
+  constexpr mu::Affine3<TypeParam> kRes = kA * kA.rigid_inverse();
+  /** assert */
+  static_assert(kRes == mu::Affine3<TypeParam>{}, "");
+}
+
+TYPED_TEST(Affine3Fixture, OperatorStreamOut) {
+  /** arrange */
+  const mu::Affine3<TypeParam> kA = TestFixture::arbitrary();
+  std::stringstream ss;
+  std::stringstream ss_matrix;
+  /** action */
+  ss << kA;
+  ss_matrix << kA.to_matrix();
+  /** assert */
+  EXPECT_EQ(ss.str(), ss_matrix.str());
+}
@@ -0,0 +1,260 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/aligned.h"
+#include "mu/matrix.h"
+#include "mu/simd.h"
+#include "mu/vector.h"
+
+/**
+ * the aligned operators are checked against the operators of Vector and
+ * Matrix for the same values. the sizes are smaller, equal and larger than
+ * the SIMD register sizes, so that the padding is covered
+ */
+
+using AlignedTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class AlignedFixture : public ::testing::Test {
+ public:
+  /* non-zero values, so that the division is defined */
+  template <std::size_t N>
+  static mu::Vector<N, T> values(int seed) {
+    mu::Vector<N, T> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i] = static_cast<T>(1 + (i * 7 + seed * 3) % 11);
+    }
+    return ret;
+  }
+
+  template <std::size_t N, std::size_t M>
+  static mu::Matrix<N, M, T> matrix(int seed) {
+    mu::Matrix<N, M, T> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i] = values<M>(seed + static_cast<int>(i));
+    }
+    return ret;
+  }
+
+  static bool is_aligned(const void *p) {
+    return reinterpret_cast<std::uintptr_t>(p) %
+               mu::SimdTraits<T>::alignment ==
+           0;
+  }
+
+  /* the padding behind the values is zero initialized */
+  template <std::size_t N>
+  static void expect_padding(const mu::AlignedVector<N, T> &v) {
+    for (std::size_t i = N; i < v.padded_size(); i++) {
+      EXPECT_EQ(v.data()[i], T{0});
+    }
+  }
+
+  template <std::size_t N>
+  static void check_vector() {
+    /** arrange */
+    const mu::Vector<N, T> kA = values<N>(0);
+    const mu::Vector<N, T> kB = values<N>(1);
+    const mu::AlignedVector<N, T> kAlignedA = kA;
+    const mu::AlignedVector<N, T> kAlignedB = kB;
+    const T kScalar{3};
+    /** action */
+    mu::AlignedVector<N, T> add = kAlignedA + kAlignedB;
+    mu::AlignedVector<N, T> sub = kAlignedA - kAlignedB;
+    mu::AlignedVector<N, T> mul = kAlignedA * kAlignedB;
+    mu::AlignedVector<N, T> div = kAlignedA / kAlignedB;
+    mu::AlignedVector<N, T> add_scalar = kAlignedA;
+    add_scalar += kScalar;
+    mu::AlignedVector<N, T> div_scalar = kAlignedA;
+    div_scalar /= kScalar;
+    /** assert */
+    EXPECT_EQ(add, kA + kB);
+    EXPECT_EQ(sub, kA - kB);
+    EXPECT_EQ(mul, kA * kB);
+    EXPECT_EQ(div, kA / kB);
+    EXPECT_EQ(add_scalar, kA + kScalar);
+    EXPECT_EQ(div_scalar, kA / kScalar);
+  }
+
+  template <std::size_t N, std::size_t M>
+  static void check_matrix() {
+    /** arrange */
+    const mu::Matrix<N, M, T> kA = matrix<N, M>(0);
+    const mu::Matrix<N, M, T> kB = matrix<N, M>(5);
+    const mu::AlignedMatrix<N, M, T> kAlignedA = kA;
+    const mu::AlignedMatrix<N, M, T> kAlignedB = kB;
+    const T kScalar{3};
+    /** action */
+    mu::AlignedMatrix<N, M, T> add = kAlignedA + kAlignedB;
+    mu::AlignedMatrix<N, M, T> sub = kAlignedA - kAlignedB;
+    mu::AlignedMatrix<N, M, T> mul = kAlignedA * kAlignedB;
+    mu::AlignedMatrix<N, M, T> div = kAlignedA / kAlignedB;
+    mu::AlignedMatrix<N, M, T> sub_scalar = kAlignedA;
+    sub_scalar -= kScalar;
+    mu::AlignedMatrix<N, M, T> mul_scalar = kAlignedA;
+    mul_scalar *= kScalar;
+    /** assert */
+    EXPECT_TRUE(is_aligned(&kAlignedA[0][0]));
+    EXPECT_EQ(add, kA + kB);
+    EXPECT_EQ(sub, kA - kB);
+    EXPECT_EQ(mul, kA * kB);
+    EXPECT_EQ(div, kA / kB);
+    EXPECT_EQ(sub_scalar, kA - kScalar);
+    EXPECT_EQ(mul_scalar, kA * kScalar);
+  }
+};
+
+TYPED_TEST_SUITE(AlignedFixture, AlignedTypes);
+
+TYPED_TEST(AlignedFixture, PaddedSize) {
+  /** assert */
+  constexpr std::size_t kSize = mu::SimdTraits<TypeParam>::size;
+  static_assert(mu::simd_padded_size<1, TypeParam>() == kSize, "");
+  static_assert(mu::simd_padded_size<kSize, TypeParam>() == kSize, "");
+  static_assert(mu::simd_padded_size<kSize + 1, TypeParam>() == 2 * kSize, "");
+  static_assert(sizeof(mu::AlignedVector<3, TypeParam>) ==
+                    mu::simd_padded_size<3, TypeParam>() * sizeof(TypeParam),
+                "");
+  static_assert(mu::AlignedVector<3, TypeParam>::padded_size() ==
+                    mu::simd_padded_size<3, TypeParam>(),
+                "");
+  static_assert(alignof(mu::AlignedVector<3, TypeParam>) ==
+                    mu::SimdTraits<TypeParam>::alignment,
+                "");
+  static_assert(alignof(mu::AlignedMatrix<4, 4, TypeParam>) ==
+                    mu::SimdTraits<TypeParam>::alignment,
+                "");
+}
+
+TYPED_TEST(AlignedFixture, VectorConstructor) {
+  /** action */
+  mu::AlignedVector<3, TypeParam> a{TypeParam{1}, TypeParam{2}, TypeParam{3}};
+  mu::AlignedVector<3, TypeParam> b{TypeParam{4}};
+  mu::AlignedVector<3, TypeParam> c = mu::Vector<3, double>{1.0, 2.0, 3.0};
+  /** assert */
+  EXPECT_EQ(a, (mu::Vector<3, TypeParam>{TypeParam{1}, TypeParam{2},
+                                         TypeParam{3}}));
+  EXPECT_EQ(b, (mu::Vector<3, TypeParam>{TypeParam{4}}));
+  EXPECT_EQ(c, a);
+  TestFixture::expect_padding(a);
+  TestFixture::expect_padding(b);
+  TestFixture::expect_padding(c);
+}
+
+TYPED_TEST(AlignedFixture, VectorAlignment) {
+  /** action */
+  mu::AlignedVector<3, TypeParam> a;
+  std::vector<mu::AlignedVector<5, TypeParam>> v(7);
+  /** assert */
+  EXPECT_TRUE(TestFixture::is_aligned(a.data()));
+  for (const auto &kV : v) {
+    EXPECT_TRUE(TestFixture::is_aligned(kV.data()));
+  }
+}
+
+TYPED_TEST(AlignedFixture, AllocatorAlignment) {
+  /** action */
+  std::vector<mu::AlignedVector<3, TypeParam>,
+              mu::AlignedAllocator<mu::AlignedVector<3, TypeParam>>>
+      v(9);
+  std::vector<mu::AlignedMatrix<3, 3, TypeParam>,
+              mu::AlignedAllocator<mu::AlignedMatrix<3, 3, TypeParam>>>
+      m(5);
+  std::vector<TypeParam, mu::AlignedAllocator<TypeParam, 256>> values(3);
+  /** assert */
+  for (const auto &kV : v) {
+    EXPECT_TRUE(TestFixture::is_aligned(kV.data()));
+  }
+  for (const auto &kM : m) {
+    EXPECT_TRUE(TestFixture::is_aligned(kM.data()));
+  }
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % 256, 0U);
+}
+
+TYPED_TEST(AlignedFixture, AllocatorContainer) {
+  /** arrange */
+  using TVector = mu::AlignedVector<3, TypeParam>;
+  std::vector<TVector, mu::AlignedAllocator<TVector>> v;
+  const TVector kOffset{TypeParam{1}, TypeParam{2}, TypeParam{3}};
+  /** action */
+  for (int i = 0; i < 100; i++) {
+    v.push_back(TestFixture::template values<3>(i));  // reallocates
+  }
+  for (auto &p : v) {
+    p += kOffset;
+  }
+  /** assert */
+  for (std::size_t i = 0; i < v.size(); i++) {
+    EXPECT_TRUE(TestFixture::is_aligned(v[i].data()));
+    const mu::Vector<3, TypeParam> kExpected =
+        TestFixture::template values<3>(static_cast<int>(i)) +
+        mu::Vector<3, TypeParam>(kOffset);
+    EXPECT_EQ(v[i], kExpected);
+    TestFixture::expect_padding(v[i]);
+  }
+  EXPECT_TRUE((mu::AlignedAllocator<TVector>{} ==
+               mu::AlignedAllocator<TypeParam, alignof(TVector)>{}));
+}
+
+TYPED_TEST(AlignedFixture, VectorOperators) {
+  TestFixture::template check_vector<1>();
+  TestFixture::template check_vector<3>();
+  TestFixture::template check_vector<4>();
+  TestFixture::template check_vector<7>();
+  TestFixture::template check_vector<8>();
+  TestFixture::template check_vector<17>();
+}
+
+TYPED_TEST(AlignedFixture, VectorOperatorsDifferentTypes) {
+  /** arrange */
+  mu::AlignedVector<3, TypeParam> a{TypeParam{1}, TypeParam{2}, TypeParam{3}};
+  const mu::Vector<3, short> kB{short{1}, short{1}, short{1}};
+  /** action */
+  a += kB;
+  a *= 2;
+  /** assert */
+  EXPECT_EQ(a, (mu::Vector<3, TypeParam>{TypeParam{4}, TypeParam{6},
+                                         TypeParam{8}}));
+  TestFixture::expect_padding(a);
+}
+
+TYPED_TEST(AlignedFixture, VectorOperatorsConstexpr) {
+  /** action */
+  constexpr mu::AlignedVector<3, TypeParam> kA{TypeParam{1}, TypeParam{2},
+                                               TypeParam{3}};
+  constexpr mu::AlignedVector<3, TypeParam> kRes = kA + kA;
+  /** assert */
+  static_assert(kRes[0] == TypeParam{2} && kRes[2] == TypeParam{6}, "");
+}
+
+TYPED_TEST(AlignedFixture, VectorBaseFunctions) {
+  /** arrange */
+  const mu::AlignedVector<3, TypeParam> kA{TypeParam{1}, TypeParam{5},
+                                           TypeParam{3}};
+  /** action */
+  TypeParam sum = kA.sum();
+  TypeParam min = kA.min();
+  /** assert */
+  EXPECT_EQ(sum, TypeParam{9});
+  EXPECT_EQ(min, TypeParam{1});
+}
+
+TYPED_TEST(AlignedFixture, MatrixOperators) {
+  TestFixture::template check_matrix<1, 1>();
+  TestFixture::template check_matrix<3, 3>();
+  TestFixture::template check_matrix<4, 4>();
+  TestFixture::template check_matrix<2, 7>();
+  TestFixture::template check_matrix<8, 8>();
+}
+
+TYPED_TEST(AlignedFixture, MatrixOperatorsConstexpr) {
+  /** action */
+  constexpr mu::AlignedMatrix<2, 2, TypeParam> kA{
+      {TypeParam{1}, TypeParam{2}}, {TypeParam{3}, TypeParam{4}}};
+  constexpr mu::AlignedMatrix<2, 2, TypeParam> kRes = kA * kA;
+  /** assert */
+  static_assert(kRes[0][1] == TypeParam{4} && kRes[1][1] == TypeParam{16},
+                "");
+}
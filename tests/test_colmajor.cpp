@@ -0,0 +1,244 @@
+#include <array>
+#include <cstddef>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "mu/colmajor.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/**
+ * every ColMajorMatrix function is compared to the same function of the
+ * (row-major) Matrix with the same values
+ */
+
+using ColMajorTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class ColMajorFixture : public ::testing::Test {
+ public:
+  /* non-zero values, so that the division is defined */
+  template <std::size_t N, std::size_t M, typename U = T>
+  static mu::Matrix<N, M, U> values(int seed) {
+    mu::Matrix<N, M, U> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        ret[i][j] = static_cast<U>(1 + (i * 7 + j * 5 + seed * 3) % 11);
+      }
+    }
+    return ret;
+  }
+
+  /* the ColMajorMatrix and the Matrix have the same values */
+  template <std::size_t N, std::size_t M>
+  static void expect_eq(const mu::ColMajorMatrix<N, M, T> &cm,
+                        const mu::Matrix<N, M, T> &m) {
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        EXPECT_EQ(cm(i, j), m[i][j]);
+      }
+    }
+  }
+};
+
+TYPED_TEST_SUITE(ColMajorFixture, ColMajorTypes);
+
+TYPED_TEST(ColMajorFixture, ConstructorMatrix) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  /** action */
+  const mu::ColMajorMatrix<3, 5, TypeParam> kCm(kM);
+  /** assert */
+  TestFixture::expect_eq(kCm, kM);
+  EXPECT_EQ(kCm.n_rows(), 3);
+  EXPECT_EQ(kCm.n_cols(), 5);
+  EXPECT_EQ(kCm.size()[0], 3);
+  EXPECT_EQ(kCm.size()[1], 5);
+}
+
+TYPED_TEST(ColMajorFixture, ConstructorMatrixDifferentType) {
+  /** arrange */
+  const mu::Matrix<2, 3, int> kM = TestFixture::template values<2, 3, int>(0);
+  /** action */
+  const mu::ColMajorMatrix<2, 3, TypeParam> kCm(kM);
+  /** assert */
+  TestFixture::expect_eq(kCm, mu::Matrix<2, 3, TypeParam>(kM));
+}
+
+TYPED_TEST(ColMajorFixture, ConstructorColumns) {
+  /** arrange */
+  const mu::Matrix<3, 2, TypeParam> kT = TestFixture::template values<3, 2>(0);
+  const std::array<mu::Vector<2, TypeParam>, 3> kCols = {kT[0], kT[1], kT[2]};
+  /** action */
+  const mu::ColMajorMatrix<2, 3, TypeParam> kCm(kCols);
+  /** assert */
+  TestFixture::expect_eq(kCm, kT.transposed());
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncData) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  mu::ColMajorMatrix<3, 5, TypeParam> cm(kM);
+  /** action */
+  TypeParam *values = cm.data();
+  /** assert */
+  for (std::size_t i = 0; i < 3; i++) {
+    for (std::size_t j = 0; j < 5; j++) {
+      EXPECT_EQ(values[j * 3 + i], kM[i][j]);
+    }
+  }
+  /* writes through the pointer */
+  values[1 * 3 + 2] = TypeParam{42};
+  EXPECT_EQ(cm(2, 1), TypeParam{42});
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncRowCol) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  mu::ColMajorMatrix<3, 5, TypeParam> cm(kM);
+  /** action & assert */
+  for (std::size_t j = 0; j < 5; j++) {
+    EXPECT_EQ(cm.col(j), kM.col(j));
+    /* the column is a reference to contiguous values */
+    EXPECT_EQ(cm.col(j).data(), cm.data() + j * 3);
+  }
+  for (std::size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(cm.row(i), kM.row(i));
+  }
+  cm.col(4)[0] = TypeParam{42};
+  EXPECT_EQ(cm(0, 4), TypeParam{42});
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncToMatrixTransposed) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  const mu::ColMajorMatrix<3, 5, TypeParam> kCm(kM);
+  /** action */
+  const mu::Matrix<3, 5, TypeParam> kRes = kCm.to_matrix();
+  const mu::Matrix<5, 3, TypeParam> &kTransposed = kCm.transposed();
+  /** assert */
+  EXPECT_EQ(kRes, kM);
+  EXPECT_EQ(kTransposed, kM.transposed());
+  /* the transposed matrix is the same memory */
+  EXPECT_EQ(kTransposed.data(), kCm.data());
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncStatistics) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  const mu::ColMajorMatrix<3, 5, TypeParam> kCm(kM);
+  /** action & assert */
+  EXPECT_EQ(kCm.min(), kM.min());
+  EXPECT_EQ(kCm.max(), kM.max());
+  EXPECT_EQ(kCm.sum(), kM.sum());
+  EXPECT_EQ(kCm.mean(), kM.mean());
+  EXPECT_NEAR(kCm.template variance<double>(), kM.template variance<double>(),
+              1e-9);
+  EXPECT_NEAR(kCm.template std<double>(), kM.template std<double>(), 1e-9);
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncDotMatrix) {
+  /** arrange */
+  const mu::Matrix<3, 4, TypeParam> kA = TestFixture::template values<3, 4>(0);
+  const mu::Matrix<4, 5, TypeParam> kB = TestFixture::template values<4, 5>(1);
+  /** action */
+  const mu::ColMajorMatrix<3, 5, TypeParam> kRes =
+      mu::ColMajorMatrix<3, 4, TypeParam>(kA).dot(
+          mu::ColMajorMatrix<4, 5, TypeParam>(kB));
+  /** assert */
+  TestFixture::expect_eq(kRes, kA.dot(kB));
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncDotVector) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  const mu::Vector<5, TypeParam> kV = TestFixture::template values<1, 5>(1)[0];
+  /** action */
+  const mu::Vector<3, TypeParam> kRes =
+      mu::ColMajorMatrix<3, 5, TypeParam>(kM).dot(kV);
+  /** assert */
+  EXPECT_EQ(kRes, kM.dot(kV));
+}
+
+TYPED_TEST(ColMajorFixture, MemberFuncDotVectorDifferentType) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kM = TestFixture::template values<3, 5>(0);
+  const mu::Vector<5, int> kV = TestFixture::template values<1, 5, int>(1)[0];
+  /** action */
+  const mu::Vector<3, double> kRes =
+      mu::ColMajorMatrix<3, 5, TypeParam>(kM).template dot<double>(kV);
+  /** assert */
+  EXPECT_EQ(kRes, kM.template dot<double>(kV));
+}
+
+TYPED_TEST(ColMajorFixture, OperatorsMatrix) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kA = TestFixture::template values<3, 5>(0);
+  const mu::Matrix<3, 5, TypeParam> kB = TestFixture::template values<3, 5>(1);
+  const mu::ColMajorMatrix<3, 5, TypeParam> kCa(kA);
+  const mu::ColMajorMatrix<3, 5, TypeParam> kCb(kB);
+  /** action & assert */
+  TestFixture::expect_eq(kCa + kCb, kA + kB);
+  TestFixture::expect_eq(kCa - kCb, kA - kB);
+  TestFixture::expect_eq(kCa * kCb, kA * kB);
+  TestFixture::expect_eq(kCa / kCb, kA / kB);
+  EXPECT_TRUE((kCa == mu::ColMajorMatrix<3, 5, TypeParam>(kA)));
+  EXPECT_TRUE(kCa != kCb);
+}
+
+TYPED_TEST(ColMajorFixture, OperatorsScalar) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kA = TestFixture::template values<3, 5>(0);
+  mu::ColMajorMatrix<3, 5, TypeParam> cm(kA);
+  mu::Matrix<3, 5, TypeParam> m(kA);
+  /** action */
+  cm += TypeParam{2};
+  m += TypeParam{2};
+  cm -= TypeParam{1};
+  m -= TypeParam{1};
+  cm *= TypeParam{3};
+  m *= TypeParam{3};
+  cm /= TypeParam{2};
+  m /= TypeParam{2};
+  /** assert */
+  TestFixture::expect_eq(cm, m);
+  TestFixture::expect_eq(cm * TypeParam{2}, m * TypeParam{2});
+  TestFixture::expect_eq(TypeParam{2} * cm, TypeParam{2} * m);
+}
+
+TYPED_TEST(ColMajorFixture, OperatorStreamOut) {
+  /** arrange */
+  const mu::Matrix<2, 3, TypeParam> kM = TestFixture::template values<2, 3>(0);
+  std::stringstream ss_cm;
+  std::stringstream ss_m;
+  /** action */
+  ss_cm << mu::ColMajorMatrix<2, 3, TypeParam>(kM);
+  ss_m << kM;
+  /** assert */
+  EXPECT_EQ(ss_cm.str(), ss_m.str());
+}
+
+TYPED_TEST(ColMajorFixture, UtilityFuncs) {
+  /** arrange */
+  const mu::Matrix<3, 4, TypeParam> kA = TestFixture::template values<3, 4>(0);
+  const mu::Matrix<4, 2, TypeParam> kB = TestFixture::template values<4, 2>(1);
+  const mu::Vector<4, TypeParam> kV = TestFixture::template values<1, 4>(2)[0];
+  /** action */
+  const mu::ColMajorMatrix<3, 4, TypeParam> kCa = mu::to_col_major(kA);
+  const mu::ColMajorMatrix<4, 2, TypeParam> kCb = mu::to_col_major(kB);
+  /** assert */
+  TestFixture::expect_eq(kCa, kA);
+  TestFixture::expect_eq(mu::dot(kCa, kCb), mu::dot(kA, kB));
+  EXPECT_EQ(mu::dot(kCa, kV), mu::dot(kA, kV));
+}
+
+TEST(ColMajor, ConstantExpression) {
+  /** action */
+  constexpr mu::ColMajorMatrix<2, 2, int> kCm(
+      mu::Matrix<2, 2, int>{{1, 2}, {3, 4}});
+  constexpr mu::Vector<2, int> kRes = kCm.dot(mu::Vector<2, int>{1, 1});
+  /** assert */
+  static_assert(kCm(0, 1) == 2, "");
+  static_assert(kCm.sum() == 10, "");
+  static_assert(kRes[0] == 3 && kRes[1] == 7, "");
+}
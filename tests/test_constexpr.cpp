@@ -0,0 +1,161 @@
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+#include "mu/vector2d.h"
+#include "mu/vector3d.h"
+
+/**
+ * every object is created at compile time (constexpr). the static_asserts
+ * check the results during compilation, the EXPECTs check that the same
+ * results are calculated at run time by the SIMD kernels
+ */
+
+namespace {
+
+constexpr mu::Vector<3, float> kVecA{1.0F, 2.0F, 3.0F};
+constexpr mu::Vector<3, float> kVecB{4.0F, 5.0F, 6.0F};
+constexpr mu::Matrix<2, 3, int> kMatA{{1, 2, 3}, {4, 5, 6}};
+constexpr mu::Matrix<3, 2, int> kMatB{{1, 0}, {0, 1}, {2, 2}};
+
+/* a lookup matrix that is calculated by a constexpr function */
+constexpr mu::Matrix<3, 3, int> squares() {
+  mu::Matrix<3, 3, int> ret{0};
+  for (std::size_t i = 0; i < 3; i++) {
+    for (std::size_t j = 0; j < 3; j++) {
+      ret[i][j] = static_cast<int>(i * j);
+    }
+  }
+  ret += mu::eye<3, int>();
+  ret *= 2;
+  return ret;
+}
+
+}  // namespace
+
+TEST(Constexpr, VectorConstructors) {
+  /** action */
+  constexpr mu::Vector<3, int> kSingle{7};
+  constexpr mu::Vector<3, double> kConverted = kVecA;
+  constexpr mu::Vector<2, int> kArray = std::array<int, 2>{1, 2};
+  constexpr mu::Vector<2, int> kArrayConverted = std::array<float, 2>{1.5F, 2};
+  /** assert */
+  static_assert(kSingle[2] == 7, "");
+  static_assert(kConverted[1] == 2.0, "");
+  static_assert(kArray[1] == 2, "");
+  static_assert(kArrayConverted[0] == 1, "");
+  EXPECT_EQ(kSingle, (mu::Vector<3, int>{7, 7, 7}));
+  EXPECT_EQ(kConverted, (mu::Vector<3, double>{1.0, 2.0, 3.0}));
+}
+
+TEST(Constexpr, VectorFunctions) {
+  /** action */
+  constexpr float kDot = kVecA.dot(kVecB);
+  constexpr float kSum = kVecA.sum();
+  constexpr float kMin = mu::min(kVecB);
+  constexpr float kMax = kVecB.max();
+  constexpr float kMean = mu::mean(kVecB);
+  constexpr mu::Vector<3, int> kDotMatrix = mu::Vector<2, int>{1, 1}.dot(kMatA);
+  /** assert */
+  static_assert(kDot == 32.0F, "");
+  static_assert(kSum == 6.0F, "");
+  static_assert(kMin == 4.0F && kMax == 6.0F && kMean == 5.0F, "");
+  static_assert(kDotMatrix[0] == 5 && kDotMatrix[2] == 9, "");
+  EXPECT_EQ(kDot, kVecA.dot(kVecB));
+  EXPECT_EQ(kDotMatrix, (mu::Vector<2, int>{1, 1}).dot(kMatA));
+}
+
+TEST(Constexpr, VectorOperators) {
+  /** action */
+  constexpr mu::Vector<3, float> kPlus = kVecA + kVecB;
+  constexpr mu::Vector<3, float> kMinus = kVecA - kVecB;
+  constexpr mu::Vector<3, float> kMultiply = kVecA * kVecB;
+  constexpr mu::Vector<3, float> kDivide = kVecB / kVecA;
+  constexpr mu::Vector<3, float> kScalar = (2.0F * kVecA + 1.0F) / 2.0F - 1.0F;
+  /** assert */
+  static_assert(kPlus[2] == 9.0F, "");
+  static_assert(kMinus[2] == -3.0F, "");
+  static_assert(kMultiply[2] == 18.0F, "");
+  static_assert(kDivide[2] == 2.0F, "");
+  static_assert(kScalar[2] == 2.5F, "");
+  static_assert(kPlus == mu::Vector<3, float>{5.0F, 7.0F, 9.0F}, "");
+  static_assert(kPlus != kMinus, "");
+  EXPECT_EQ(kPlus, kVecA + kVecB);
+  EXPECT_EQ(kMinus, kVecA - kVecB);
+  EXPECT_EQ(kMultiply, kVecA * kVecB);
+  EXPECT_EQ(kDivide, kVecB / kVecA);
+  EXPECT_EQ(kScalar, (2.0F * kVecA + 1.0F) / 2.0F - 1.0F);
+}
+
+TEST(Constexpr, VectorDerived) {
+  /** action */
+  constexpr mu::Vector2D<int> kVec2D{1, 2};
+  constexpr mu::Vector3D<float> kVec3D = kVecA + kVecB;
+  /** assert */
+  static_assert(kVec2D.x() == 1 && kVec2D.y() == 2, "");
+  static_assert(kVec3D.z() == 9.0F, "");
+  EXPECT_EQ(kVec3D.z(), 9.0F);
+}
+
+TEST(Constexpr, MatrixConstructors) {
+  /** action */
+  constexpr mu::Matrix<2, 2, int> kSingle{3};
+  constexpr mu::Matrix<2, 3, float> kConverted = kMatA;
+  constexpr mu::Matrix<1, 2, int> kArrays =
+      std::array<std::array<float, 2>, 1>{{{1.5F, 2.5F}}};
+  /** assert */
+  static_assert(kSingle[1][1] == 3, "");
+  static_assert(kConverted[1][2] == 6.0F, "");
+  static_assert(kArrays[0][1] == 2, "");
+  EXPECT_EQ(kConverted, (mu::Matrix<2, 3, float>(kMatA)));
+}
+
+TEST(Constexpr, MatrixFunctions) {
+  /** action */
+  constexpr mu::Matrix<2, 2, int> kDot = kMatA.dot(kMatB);
+  constexpr mu::Vector<2, int> kDotVector = kMatA.dot(mu::Vector<3, int>{1});
+  constexpr mu::Matrix<3, 2, int> kTransposed = mu::transposed(kMatA);
+  constexpr mu::Vector<2, int> kDiag = kMatA.diag();
+  constexpr mu::Vector<2, int> kCol = kMatA.col(2);
+  constexpr int kSum = kMatA.sum();
+  constexpr int kMin = kMatA.min();
+  constexpr int kMax = mu::max(kMatA);
+  /** assert */
+  static_assert(kDot == mu::Matrix<2, 2, int>{{7, 8}, {16, 17}}, "");
+  static_assert(kDotVector[0] == 6 && kDotVector[1] == 15, "");
+  static_assert(kTransposed[2][1] == 6, "");
+  static_assert(kDiag[0] == 1 && kDiag[1] == 5, "");
+  static_assert(kCol[1] == 6, "");
+  static_assert(kSum == 21 && kMin == 1 && kMax == 6, "");
+  EXPECT_EQ(kDot, kMatA.dot(kMatB));
+  EXPECT_EQ(kTransposed, kMatA.transposed());
+}
+
+TEST(Constexpr, MatrixOperators) {
+  /** action */
+  constexpr mu::Matrix<2, 3, int> kPlus = kMatA + kMatA;
+  constexpr mu::Matrix<2, 3, int> kScalar = (kMatA * 3 - 1) / 2;
+  constexpr mu::Matrix<3, 3, int> kSquares = squares();
+  /** assert */
+  static_assert(kPlus[1][2] == 12, "");
+  static_assert(kScalar[1][2] == 8, "");
+  static_assert(kSquares[2][2] == 10 && kSquares[1][0] == 0, "");
+  EXPECT_EQ(kPlus, kMatA + kMatA);
+  EXPECT_EQ(kScalar, (kMatA * 3 - 1) / 2);
+}
+
+TEST(Constexpr, FreeFunctions) {
+  /** action */
+  constexpr mu::Matrix<3, 3, float> kEye = mu::eye<3, float>();
+  constexpr mu::Matrix<2, 3, int> kOnes = mu::ones<2, 3>();
+  constexpr mu::Matrix<2, 3, int> kZeros = mu::zeros<2, 3>();
+  constexpr mu::Vector<3, int> kVecOnes = mu::ones<3>();
+  constexpr mu::Vector<3, int> kVecZeros = mu::zeros<3>();
+  constexpr mu::Matrix<3, 3, float> kDiag = mu::diag(kVecA);
+  /** assert */
+  static_assert(kEye[1][1] == 1.0F && kEye[1][2] == 0.0F, "");
+  static_assert(kOnes.sum() == 6 && kZeros.sum() == 0, "");
+  static_assert(kVecOnes.sum() == 3 && kVecZeros.sum() == 0, "");
+  static_assert(kDiag[2][2] == 3.0F && kDiag.sum() == 6.0F, "");
+  static_assert(kEye.dot(kVecA) == kVecA, "");
+  EXPECT_EQ(kEye, (mu::eye<3, float>()));
+}
@@ -0,0 +1,306 @@
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "counting_allocator.h"
+#include "gtest/gtest.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/**
+ * every DynMatrix function is compared to the same function of a Matrix of
+ * the same size. the number of columns is smaller and larger than the SIMD
+ * register sizes, so that full registers and the remaining values are both
+ * covered
+ */
+
+/*
+ * types with and without a SIMD implementation
+ */
+using DynMatrixTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class DynMatrixFixture : public ::testing::Test {
+ public:
+  /* non-zero values, so that the division is defined */
+  template <std::size_t N, std::size_t M, typename U = T>
+  static mu::Matrix<N, M, U> values(int seed) {
+    mu::Matrix<N, M, U> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        ret[i][j] = static_cast<U>(1 + (i * 7 + j * 5 + seed * 3) % 11);
+      }
+    }
+    return ret;
+  }
+
+  /* the DynMatrix and the Matrix have the same values */
+  template <std::size_t N, std::size_t M, class A>
+  static void expect_eq(const mu::DynMatrix<T, A> &dyn,
+                        const mu::Matrix<N, M, T> &mat) {
+    ASSERT_EQ(dyn.rows(), N);
+    ASSERT_EQ(dyn.cols(), M);
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        EXPECT_EQ(dyn[i][j], mat[i][j]);
+      }
+    }
+  }
+};
+
+TYPED_TEST_SUITE(DynMatrixFixture, DynMatrixTypes);
+
+TYPED_TEST(DynMatrixFixture, ConstructorDefault) {
+  /** action */
+  mu::DynMatrix<TypeParam> m;
+  /** assert */
+  EXPECT_EQ(m.rows(), 0);
+  EXPECT_EQ(m.cols(), 0);
+  EXPECT_TRUE(m.empty());
+}
+
+TYPED_TEST(DynMatrixFixture, ConstructorSize) {
+  /** action */
+  mu::DynMatrix<TypeParam> m(2, 3);
+  /** assert */
+  EXPECT_EQ(m.size(), (std::array<std::size_t, 2>{2, 3}));
+  for (const auto &item : m) {
+    EXPECT_EQ(item, TypeParam{0});
+  }
+}
+
+TYPED_TEST(DynMatrixFixture, ConstructorSizeValue) {
+  /** action */
+  mu::DynMatrix<TypeParam> m(2, 3, TypeParam{4});
+  /** assert */
+  EXPECT_EQ(m.size(), (std::array<std::size_t, 2>{2, 3}));
+  for (const auto &item : m) {
+    EXPECT_EQ(item, TypeParam{4});
+  }
+}
+
+TYPED_TEST(DynMatrixFixture, ConstructorInitializerList) {
+  /** action */
+  mu::DynMatrix<TypeParam> m{{TypeParam{1}, TypeParam{2}, TypeParam{3}},
+                             {TypeParam{4}, TypeParam{5}, TypeParam{6}}};
+  /** assert */
+  EXPECT_EQ(m.rows(), 2);
+  EXPECT_EQ(m.cols(), 3);
+  EXPECT_EQ(m[0][2], TypeParam{3});
+  EXPECT_EQ(m[1][0], TypeParam{4});
+  EXPECT_EQ(m.data()[5], TypeParam{6});
+}
+
+TYPED_TEST(DynMatrixFixture, ConstructorMatrix) {
+  /** arrange */
+  const mu::Matrix<3, 17, TypeParam> kMat =
+      TestFixture::template values<3, 17>(0);
+  /** action */
+  const mu::DynMatrix<TypeParam> kDyn(kMat);
+  /** assert */
+  TestFixture::expect_eq(kDyn, kMat);
+}
+
+TYPED_TEST(DynMatrixFixture, Allocator) {
+  /** arrange */
+  std::size_t count = 0;
+  CountingAllocator<TypeParam> alloc(&count);
+  const mu::DynMatrix<TypeParam, CountingAllocator<TypeParam>> kM(4, 4,
+                                                                  alloc);
+  /** action */
+  const auto kDot = kM.dot(kM);
+  const auto kRow = kM.row(1);
+  /** assert */
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(kDot.get_allocator(), alloc);
+  EXPECT_EQ(kRow.get_allocator(), alloc);
+}
+
+TYPED_TEST(DynMatrixFixture, At) {
+  /** arrange */
+  mu::DynMatrix<TypeParam> m(2, 3);
+  /** action */
+  m.at(1, 2) = TypeParam{7};
+  /** assert */
+  EXPECT_EQ(m[1][2], TypeParam{7});
+  EXPECT_THROW(m.at(2, 0), std::out_of_range);
+  EXPECT_THROW(m.at(0, 3), std::out_of_range);
+}
+
+TYPED_TEST(DynMatrixFixture, RowColDiag) {
+  /** arrange */
+  const mu::Matrix<3, 4, TypeParam> kMat =
+      TestFixture::template values<3, 4>(1);
+  const mu::DynMatrix<TypeParam> kDyn(kMat);
+  /** action & assert */
+  EXPECT_EQ(kDyn.row(1), mu::DynVector<TypeParam>(kMat.row(1)));
+  EXPECT_EQ(kDyn.col(2), mu::DynVector<TypeParam>(kMat.col(2)));
+  EXPECT_EQ(kDyn.diag(), mu::DynVector<TypeParam>(kMat.diag()));
+}
+
+TYPED_TEST(DynMatrixFixture, Statistics) {
+  /** arrange */
+  const mu::Matrix<5, 7, TypeParam> kMat =
+      TestFixture::template values<5, 7>(1);
+  const mu::DynMatrix<TypeParam> kDyn(kMat);
+  /** action & assert */
+  EXPECT_EQ(kDyn.min(), kMat.min());
+  EXPECT_EQ(kDyn.max(), kMat.max());
+  EXPECT_EQ(kDyn.sum(), kMat.sum());
+  EXPECT_EQ(kDyn.mean(), kMat.mean());
+  EXPECT_DOUBLE_EQ(kDyn.template variance<double>(),
+                   kMat.template variance<double>());
+  EXPECT_DOUBLE_EQ(kDyn.template std<double>(), kMat.template std<double>());
+  EXPECT_EQ(kDyn.variance(), kMat.variance());
+  const std::pair<double, double> kRes =
+      kDyn.template mean_and_std<double>();
+  const std::pair<double, double> kComp =
+      kMat.template mean_and_std<double>();
+  EXPECT_DOUBLE_EQ(kRes.first, kComp.first);
+  EXPECT_DOUBLE_EQ(kRes.second, kComp.second);
+  EXPECT_EQ(mu::min(kDyn), kMat.min());
+  EXPECT_EQ(mu::max(kDyn), kMat.max());
+  EXPECT_EQ(mu::sum(kDyn), kMat.sum());
+  EXPECT_EQ(mu::mean(kDyn), kMat.mean());
+}
+
+TYPED_TEST(DynMatrixFixture, Det) {
+  /** arrange */
+  const mu::Matrix<2, 2, TypeParam> kMat2{{TypeParam{3}, TypeParam{1}},
+                                          {TypeParam{2}, TypeParam{4}}};
+  const mu::Matrix<6, 6, TypeParam> kMat6 =
+      mu::eye<6, TypeParam>() * TypeParam{2};
+  const mu::Matrix<7, 7, TypeParam> kMat7 =
+      TestFixture::template values<7, 7>(2);
+  /** action & assert */
+  EXPECT_EQ(mu::DynMatrix<TypeParam>(kMat2).det(), kMat2.det());
+  EXPECT_EQ(mu::DynMatrix<TypeParam>(kMat6).det(), kMat6.det());
+  EXPECT_EQ(mu::DynMatrix<TypeParam>(kMat7).det(), kMat7.det());
+}
+
+TYPED_TEST(DynMatrixFixture, Transpose) {
+  /** arrange */
+  const mu::Matrix<5, 5, TypeParam> kMat =
+      TestFixture::template values<5, 5>(0);
+  mu::DynMatrix<TypeParam> dyn(kMat);
+  /** action */
+  dyn.transpose();
+  /** assert */
+  TestFixture::expect_eq(dyn, kMat.transposed());
+}
+
+TYPED_TEST(DynMatrixFixture, Transposed) {
+  /** arrange */
+  const mu::Matrix<3, 17, TypeParam> kMat =
+      TestFixture::template values<3, 17>(0);
+  const mu::DynMatrix<TypeParam> kDyn(kMat);
+  /** action */
+  const mu::DynMatrix<TypeParam> kRes = kDyn.transposed();
+  /** assert */
+  TestFixture::expect_eq(kRes, kMat.transposed());
+}
+
+TYPED_TEST(DynMatrixFixture, DotMatrix) {
+  /** arrange */
+  const mu::Matrix<3, 5, TypeParam> kA = TestFixture::template values<3, 5>(0);
+  const mu::Matrix<5, 17, TypeParam> kB =
+      TestFixture::template values<5, 17>(1);
+  const mu::DynMatrix<TypeParam> kDynA(kA);
+  const mu::DynMatrix<TypeParam> kDynB(kB);
+  /** action */
+  const mu::DynMatrix<TypeParam> kRes = kDynA.dot(kDynB);
+  const mu::DynMatrix<TypeParam> kResFree = mu::dot(kDynA, kDynB);
+  /** assert */
+  TestFixture::expect_eq(kRes, kA.dot(kB));
+  TestFixture::expect_eq(kResFree, kA.dot(kB));
+}
+
+TYPED_TEST(DynMatrixFixture, DotMatrixLarge) {
+  /** arrange */
+  /* larger than the tiles of the blocked kernel */
+  const mu::Matrix<9, 70, TypeParam> kA =
+      TestFixture::template values<9, 70>(0);
+  const mu::Matrix<70, 33, TypeParam> kB =
+      TestFixture::template values<70, 33>(1);
+  /** action */
+  const mu::DynMatrix<TypeParam> kRes =
+      mu::DynMatrix<TypeParam>(kA).dot(mu::DynMatrix<TypeParam>(kB));
+  /** assert */
+  TestFixture::expect_eq(kRes, kA.dot(kB));
+}
+
+TYPED_TEST(DynMatrixFixture, DotMatrixDifferentType) {
+  /** arrange */
+  const mu::DynMatrix<TypeParam> kA{{TypeParam{1}, TypeParam{2}}};
+  const mu::DynMatrix<int> kB{{3}, {4}};
+  /** action */
+  const mu::DynMatrix<double> kRes = kA.template dot<double>(kB);
+  /** assert */
+  EXPECT_EQ(kRes, (mu::DynMatrix<double>{{11.0}}));
+}
+
+TYPED_TEST(DynMatrixFixture, DotVector) {
+  /** arrange */
+  const mu::Matrix<3, 17, TypeParam> kA =
+      TestFixture::template values<3, 17>(0);
+  const mu::Vector<17, TypeParam> kB = kA.row(1);
+  const mu::DynMatrix<TypeParam> kDynA(kA);
+  const mu::DynVector<TypeParam> kDynB(kB);
+  /** action */
+  const mu::DynVector<TypeParam> kRes = kDynA.dot(kDynB);
+  const mu::DynVector<double> kResDouble =
+      kDynA.template dot<double>(mu::DynVector<int>(kB));
+  /** assert */
+  EXPECT_EQ(kRes, mu::DynVector<TypeParam>(kA.dot(kB)));
+  EXPECT_EQ(mu::dot(kDynA, kDynB), kRes);
+  EXPECT_EQ(kResDouble, mu::DynVector<double>(kA.dot(kB)));
+}
+
+TYPED_TEST(DynMatrixFixture, Equality) {
+  /** arrange */
+  const mu::DynMatrix<TypeParam> kA(2, 3, TypeParam{1});
+  const mu::DynMatrix<TypeParam> kB(3, 2, TypeParam{1});
+  mu::DynMatrix<TypeParam> c(kA);
+  c[1][2] = TypeParam{2};
+  /** action & assert */
+  EXPECT_TRUE(kA == kA);
+  EXPECT_FALSE(kA == kB);
+  EXPECT_FALSE(kA == c);
+  EXPECT_TRUE(kA != kB);
+  EXPECT_TRUE(kA != c);
+}
+
+TYPED_TEST(DynMatrixFixture, Operators) {
+  /** arrange */
+  const mu::Matrix<3, 7, TypeParam> kA = TestFixture::template values<3, 7>(0);
+  const mu::Matrix<3, 7, TypeParam> kB = TestFixture::template values<3, 7>(1);
+  const mu::DynMatrix<TypeParam> kDynA(kA);
+  const mu::DynMatrix<TypeParam> kDynB(kB);
+  /** action & assert */
+  TestFixture::expect_eq(kDynA + kDynB, kA + kB);
+  TestFixture::expect_eq(kDynA - kDynB, kA - kB);
+  TestFixture::expect_eq(kDynA * kDynB, kA * kB);
+  TestFixture::expect_eq(kDynA / kDynB, kA / kB);
+  TestFixture::expect_eq(kDynA + TypeParam{2}, kA + TypeParam{2});
+  TestFixture::expect_eq(kDynA - TypeParam{2}, kA - TypeParam{2});
+  TestFixture::expect_eq(kDynA * TypeParam{2}, kA * TypeParam{2});
+  TestFixture::expect_eq(kDynA / TypeParam{2}, kA / TypeParam{2});
+}
+
+TYPED_TEST(DynMatrixFixture, StreamOut) {
+  /** arrange */
+  const mu::Matrix<2, 2, TypeParam> kMat{{TypeParam{1}, TypeParam{2}},
+                                         {TypeParam{3}, TypeParam{4}}};
+  const mu::DynMatrix<TypeParam> kDyn(kMat);
+  std::stringstream ss;
+  std::stringstream ss_comp;
+  /** action */
+  ss << kDyn;
+  ss_comp << kMat;
+  /** assert */
+  EXPECT_EQ(ss.str(), ss_comp.str());
+}
@@ -0,0 +1,287 @@
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "counting_allocator.h"
+#include "gtest/gtest.h"
+#include "mu/dynvector.h"
+#include "mu/vector.h"
+
+/**
+ * every DynVector function is compared to the same function of a Vector of
+ * the same size. the sizes are smaller, equal and larger than the SIMD
+ * register sizes, so that full registers and the remaining values are both
+ * covered
+ */
+
+/*
+ * types with and without a SIMD implementation
+ */
+using DynVectorTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class DynVectorFixture : public ::testing::Test {
+ public:
+  /* non-zero values, so that the division is defined */
+  template <std::size_t N, typename U = T>
+  static mu::Vector<N, U> values(int seed) {
+    mu::Vector<N, U> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i] = static_cast<U>(1 + (i * 7 + seed * 3) % 11);
+    }
+    return ret;
+  }
+};
+
+TYPED_TEST_SUITE(DynVectorFixture, DynVectorTypes);
+
+TYPED_TEST(DynVectorFixture, ConstructorDefault) {
+  /** action */
+  mu::DynVector<TypeParam> v;
+  /** assert */
+  EXPECT_EQ(v.size(), 0);
+  EXPECT_TRUE(v.empty());
+}
+
+TYPED_TEST(DynVectorFixture, ConstructorSize) {
+  /** action */
+  mu::DynVector<TypeParam> v(5);
+  /** assert */
+  EXPECT_EQ(v.size(), 5);
+  for (const auto &item : v) {
+    EXPECT_EQ(item, TypeParam{0});
+  }
+}
+
+TYPED_TEST(DynVectorFixture, ConstructorSizeValue) {
+  /** action */
+  mu::DynVector<TypeParam> v(5, TypeParam{3});
+  /** assert */
+  EXPECT_EQ(v.size(), 5);
+  for (const auto &item : v) {
+    EXPECT_EQ(item, TypeParam{3});
+  }
+}
+
+TYPED_TEST(DynVectorFixture, ConstructorInitializerList) {
+  /** action */
+  mu::DynVector<TypeParam> v{TypeParam{1}, TypeParam{2}, TypeParam{3}};
+  /** assert */
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], TypeParam{1});
+  EXPECT_EQ(v[1], TypeParam{2});
+  EXPECT_EQ(v[2], TypeParam{3});
+}
+
+TYPED_TEST(DynVectorFixture, ConstructorVector) {
+  /** arrange */
+  const mu::Vector<17, TypeParam> kVec = TestFixture::template values<17>(0);
+  /** action */
+  const mu::DynVector<TypeParam> kDyn(kVec);
+  /** assert */
+  ASSERT_EQ(kDyn.size(), 17);
+  for (std::size_t i = 0; i < 17; i++) {
+    EXPECT_EQ(kDyn[i], kVec[i]);
+  }
+}
+
+TYPED_TEST(DynVectorFixture, ConstructorIterators) {
+  /** arrange */
+  const std::vector<TypeParam> kValues{TypeParam{4}, TypeParam{5}};
+  /** action */
+  const mu::DynVector<TypeParam> kDyn(kValues.begin(), kValues.end());
+  /** assert */
+  EXPECT_EQ(kDyn, (mu::DynVector<TypeParam>{TypeParam{4}, TypeParam{5}}));
+}
+
+TYPED_TEST(DynVectorFixture, Allocator) {
+  /** arrange */
+  std::size_t count = 0;
+  CountingAllocator<TypeParam> alloc(&count);
+  /** action */
+  mu::DynVector<TypeParam, CountingAllocator<TypeParam>> v(35, alloc);
+  mu::DynVector<TypeParam, CountingAllocator<TypeParam>> copy(v);
+  v += copy;
+  /** assert */
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(v.get_allocator(), alloc);
+}
+
+TYPED_TEST(DynVectorFixture, Resize) {
+  /** arrange */
+  mu::DynVector<TypeParam> v(2, TypeParam{1});
+  /** action */
+  v.resize(4);
+  /** assert */
+  EXPECT_EQ(v, (mu::DynVector<TypeParam>{TypeParam{1}, TypeParam{1},
+                                          TypeParam{0}, TypeParam{0}}));
+}
+
+TYPED_TEST(DynVectorFixture, At) {
+  /** arrange */
+  mu::DynVector<TypeParam> v(2);
+  /** action */
+  v.at(1) = TypeParam{2};
+  /** assert */
+  EXPECT_EQ(v[1], TypeParam{2});
+  EXPECT_THROW(v.at(2), std::out_of_range);
+}
+
+TYPED_TEST(DynVectorFixture, Statistics) {
+  /** arrange */
+  const mu::Vector<35, TypeParam> kVec = TestFixture::template values<35>(1);
+  const mu::DynVector<TypeParam> kDyn(kVec);
+  /** action & assert */
+  EXPECT_EQ(kDyn.min(), kVec.min());
+  EXPECT_EQ(kDyn.max(), kVec.max());
+  EXPECT_EQ(kDyn.sum(), kVec.sum());
+  EXPECT_EQ(kDyn.mean(), kVec.mean());
+  EXPECT_DOUBLE_EQ(kDyn.template mean<double>(), kVec.template mean<double>());
+  EXPECT_DOUBLE_EQ(kDyn.template variance<double>(),
+                   kVec.template variance<double>());
+  EXPECT_DOUBLE_EQ(kDyn.template std<double>(), kVec.template std<double>());
+  EXPECT_EQ(kDyn.variance(), kVec.variance());
+  const std::pair<double, double> kRes =
+      kDyn.template mean_and_std<double>();
+  const std::pair<double, double> kComp =
+      kVec.template mean_and_std<double>();
+  EXPECT_DOUBLE_EQ(kRes.first, kComp.first);
+  EXPECT_DOUBLE_EQ(kRes.second, kComp.second);
+  EXPECT_EQ(mu::min(kDyn), kVec.min());
+  EXPECT_EQ(mu::max(kDyn), kVec.max());
+  EXPECT_EQ(mu::sum(kDyn), kVec.sum());
+  EXPECT_EQ(mu::mean(kDyn), kVec.mean());
+}
+
+TYPED_TEST(DynVectorFixture, Dot) {
+  for (std::size_t n : {0, 1, 3, 4, 7, 8, 16, 17, 35}) {
+    /** arrange */
+    const mu::Vector<35, TypeParam> kA = TestFixture::template values<35>(0);
+    const mu::Vector<35, TypeParam> kB = TestFixture::template values<35>(1);
+    const mu::DynVector<TypeParam> kDynA(kA.begin(), kA.begin() + n);
+    const mu::DynVector<TypeParam> kDynB(kB.begin(), kB.begin() + n);
+    TypeParam comp{0};
+    for (std::size_t i = 0; i < n; i++) {
+      comp += kA[i] * kB[i];
+    }
+    /** action & assert */
+    EXPECT_EQ(kDynA.dot(kDynB), comp);
+    EXPECT_EQ(mu::dot(kDynA, kDynB), comp);
+  }
+}
+
+TYPED_TEST(DynVectorFixture, DotDifferentType) {
+  /** arrange */
+  const mu::DynVector<TypeParam> kA{TypeParam{1}, TypeParam{2}};
+  const mu::DynVector<int> kB{3, 4};
+  /** action */
+  const double kRes = kA.template dot<double>(kB);
+  /** assert */
+  EXPECT_DOUBLE_EQ(kRes, 11.0);
+  EXPECT_DOUBLE_EQ(mu::dot<double>(kA, kB), 11.0);
+}
+
+TYPED_TEST(DynVectorFixture, LengthNormalize) {
+  /** arrange */
+  mu::DynVector<TypeParam> v{TypeParam{3}, TypeParam{4}};
+  /** action & assert */
+  EXPECT_EQ(v.length(), TypeParam{5});
+  if (std::is_floating_point<TypeParam>::value) {
+    const mu::DynVector<TypeParam> kNorm = v.normalized();
+    EXPECT_EQ(kNorm, (mu::DynVector<TypeParam>{TypeParam(0.6),
+                                                TypeParam(0.8)}));
+    v.normalize();
+    EXPECT_EQ(v, kNorm);
+  }
+}
+
+TYPED_TEST(DynVectorFixture, Equality) {
+  /** arrange */
+  const mu::DynVector<TypeParam> kA{TypeParam{1}, TypeParam{2}};
+  const mu::DynVector<TypeParam> kB{TypeParam{1}, TypeParam{3}};
+  const mu::DynVector<TypeParam> kC{TypeParam{1}};
+  /** action & assert */
+  EXPECT_TRUE(kA == kA);
+  EXPECT_FALSE(kA == kB);
+  EXPECT_FALSE(kA == kC);
+  EXPECT_TRUE(kA != kB);
+  EXPECT_TRUE(kA != kC);
+}
+
+TYPED_TEST(DynVectorFixture, EqualitySizes) {
+  for (std::size_t n : {1, 3, 4, 7, 8, 16, 17, 35}) {
+    /** arrange. the last value is different */
+    const mu::Vector<35, TypeParam> kA = TestFixture::template values<35>(0);
+    const mu::DynVector<TypeParam> kDynA(kA.begin(), kA.begin() + n);
+    mu::DynVector<TypeParam> b = kDynA;
+    b[n - 1] += TypeParam{1};
+    /** action & assert */
+    EXPECT_TRUE(kDynA == mu::DynVector<TypeParam>(kDynA));
+    EXPECT_FALSE(kDynA == b);
+    EXPECT_TRUE(kDynA == mu::DynVector<double>(kA.begin(), kA.begin() + n));
+    EXPECT_TRUE(kDynA.equals(b, mu::Tolerance::absolute(1)));
+    EXPECT_FALSE(kDynA.equals(b, mu::Tolerance::absolute(0.5)));
+    EXPECT_FALSE(kDynA.equals(b, mu::Tolerance::ulp(0)));
+    EXPECT_FALSE(kDynA.equals(mu::DynVector<TypeParam>(n + 1),
+                              mu::Tolerance::absolute(1000)));
+  }
+}
+
+TYPED_TEST(DynVectorFixture, Operators) {
+  for (std::size_t n : {1, 3, 4, 7, 8, 16, 17, 35}) {
+    /** arrange */
+    const mu::Vector<35, TypeParam> kA = TestFixture::template values<35>(0);
+    const mu::Vector<35, TypeParam> kB = TestFixture::template values<35>(1);
+    const mu::DynVector<TypeParam> kDynA(kA.begin(), kA.begin() + n);
+    const mu::DynVector<TypeParam> kDynB(kB.begin(), kB.begin() + n);
+    /** action */
+    const mu::DynVector<TypeParam> kAdd = kDynA + kDynB;
+    const mu::DynVector<TypeParam> kSub = kDynA - kDynB;
+    const mu::DynVector<TypeParam> kMul = kDynA * kDynB;
+    const mu::DynVector<TypeParam> kDiv = kDynA / kDynB;
+    const mu::DynVector<TypeParam> kAddS = kDynA + TypeParam{2};
+    const mu::DynVector<TypeParam> kSubS = kDynA - TypeParam{2};
+    const mu::DynVector<TypeParam> kMulS = kDynA * TypeParam{2};
+    const mu::DynVector<TypeParam> kDivS = kDynA / TypeParam{2};
+    /** assert */
+    const mu::Vector<35, TypeParam> kAddC = kA + kB;
+    const mu::Vector<35, TypeParam> kSubC = kA - kB;
+    const mu::Vector<35, TypeParam> kMulC = kA * kB;
+    const mu::Vector<35, TypeParam> kDivC = kA / kB;
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(kAdd[i], kAddC[i]);
+      EXPECT_EQ(kSub[i], kSubC[i]);
+      EXPECT_EQ(kMul[i], kMulC[i]);
+      EXPECT_EQ(kDiv[i], kDivC[i]);
+      EXPECT_EQ(kAddS[i], kA[i] + TypeParam{2});
+      EXPECT_EQ(kSubS[i], kA[i] - TypeParam{2});
+      EXPECT_EQ(kMulS[i], kA[i] * TypeParam{2});
+      EXPECT_EQ(kDivS[i], kA[i] / TypeParam{2});
+    }
+  }
+}
+
+TYPED_TEST(DynVectorFixture, OperatorsDifferentType) {
+  /** arrange */
+  mu::DynVector<TypeParam> v{TypeParam{4}, TypeParam{6}};
+  const mu::DynVector<int> kB{1, 2};
+  /** action */
+  v += kB;
+  /** assert */
+  EXPECT_EQ(v, (mu::DynVector<TypeParam>{TypeParam{5}, TypeParam{8}}));
+}
+
+TYPED_TEST(DynVectorFixture, StreamOut) {
+  /** arrange */
+  const mu::DynVector<TypeParam> kDyn{TypeParam{1}, TypeParam{2}};
+  const mu::Vector<2, TypeParam> kVec{TypeParam{1}, TypeParam{2}};
+  std::stringstream ss;
+  std::stringstream ss_comp;
+  /** action */
+  ss << kDyn;
+  ss_comp << kVec;
+  /** assert */
+  EXPECT_EQ(ss.str(), ss_comp.str());
+}
@@ -0,0 +1,188 @@
+#include <cstddef>
+#include <type_traits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "mu/expression.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+#include "mu/vector2d.h"
+
+/**
+ * every lazy expression is compared to the same chain of eager operators. the
+ * results must be exactly equal, since every single operation is the same
+ */
+
+/*******************************Vector*****************************************/
+
+template <typename T>
+class ExpressionVectorFixture : public ::testing::Test {
+ public:
+  static constexpr std::size_t kSize = 7;
+  void SetUp() override {
+    for (std::size_t i = 0; i < kSize; i++) {
+      a[i] = static_cast<T>(1.5F * (i + 1));
+      b[i] = static_cast<T>(2.5F * (i + 2));
+      c[i] = static_cast<T>(0.5F * (i + 3));
+      d[i] = static_cast<T>(3.0F + i);
+    }
+  }
+  mu::Vector<kSize, T> a;
+  mu::Vector<kSize, T> b;
+  mu::Vector<kSize, T> c;
+  mu::Vector<kSize, T> d;
+};
+
+using ExpressionTypes = ::testing::Types<float, double, int>;
+TYPED_TEST_SUITE(ExpressionVectorFixture, ExpressionTypes);
+
+TYPED_TEST(ExpressionVectorFixture, Leaf) {
+  /** action */
+  mu::Vector<TestFixture::kSize, TypeParam> res = mu::lazy(this->a);
+  /** assert */
+  EXPECT_THAT(res, ::testing::ContainerEq(this->a));
+}
+
+TYPED_TEST(ExpressionVectorFixture, OperatorPlus) {
+  mu::Vector<TestFixture::kSize, TypeParam> res = mu::lazy(this->a) + this->b;
+  EXPECT_THAT(res, ::testing::ContainerEq(this->a + this->b));
+}
+
+TYPED_TEST(ExpressionVectorFixture, OperatorMinus) {
+  mu::Vector<TestFixture::kSize, TypeParam> res = this->a - mu::lazy(this->b);
+  EXPECT_THAT(res, ::testing::ContainerEq(this->a - this->b));
+}
+
+TYPED_TEST(ExpressionVectorFixture, OperatorMultiply) {
+  mu::Vector<TestFixture::kSize, TypeParam> res =
+      mu::lazy(this->a) * mu::lazy(this->b);
+  EXPECT_THAT(res, ::testing::ContainerEq(this->a * this->b));
+}
+
+TYPED_TEST(ExpressionVectorFixture, OperatorDivide) {
+  mu::Vector<TestFixture::kSize, TypeParam> res = mu::lazy(this->b) / this->a;
+  EXPECT_THAT(res, ::testing::ContainerEq(this->b / this->a));
+}
+
+TYPED_TEST(ExpressionVectorFixture, OperatorsScalar) {
+  auto s = static_cast<TypeParam>(2);
+  mu::Vector<TestFixture::kSize, TypeParam> res1 = mu::lazy(this->a) + s;
+  mu::Vector<TestFixture::kSize, TypeParam> res2 = s + mu::lazy(this->a);
+  mu::Vector<TestFixture::kSize, TypeParam> res3 = mu::lazy(this->a) - s;
+  mu::Vector<TestFixture::kSize, TypeParam> res4 = mu::lazy(this->a) * s;
+  mu::Vector<TestFixture::kSize, TypeParam> res5 = s * mu::lazy(this->a);
+  mu::Vector<TestFixture::kSize, TypeParam> res6 = mu::lazy(this->a) / s;
+  EXPECT_THAT(res1, ::testing::ContainerEq(this->a + s));
+  EXPECT_THAT(res2, ::testing::ContainerEq(s + this->a));
+  EXPECT_THAT(res3, ::testing::ContainerEq(this->a - s));
+  EXPECT_THAT(res4, ::testing::ContainerEq(this->a * s));
+  EXPECT_THAT(res5, ::testing::ContainerEq(s * this->a));
+  EXPECT_THAT(res6, ::testing::ContainerEq(this->a / s));
+}
+
+TYPED_TEST(ExpressionVectorFixture, Chain) {
+  /** action */
+  mu::Vector<TestFixture::kSize, TypeParam> res =
+      (mu::lazy(this->a) + mu::lazy(this->b) * this->c - this->d) * 3 /
+      this->c;
+  /** assert */
+  EXPECT_THAT(res, ::testing::ContainerEq((this->a + this->b * this->c -
+                                           this->d) *
+                                          3 / this->c));
+}
+
+TYPED_TEST(ExpressionVectorFixture, ChainAssignment) {
+  /** arrange */
+  mu::Vector<TestFixture::kSize, TypeParam> res;
+  /** action */
+  res = mu::lazy(this->a) * this->b + mu::lazy(this->c) * this->d;
+  /** assert */
+  EXPECT_THAT(res,
+              ::testing::ContainerEq(this->a * this->b + this->c * this->d));
+}
+
+TYPED_TEST(ExpressionVectorFixture, Aliasing) {
+  /** arrange */
+  auto comp = this->a * this->b + this->a;
+  /** action */
+  /* the destination is also an operand */
+  mu::assign(this->a, mu::lazy(this->a) * this->b + this->a);
+  /** assert */
+  EXPECT_THAT(this->a, ::testing::ContainerEq(comp));
+}
+
+TYPED_TEST(ExpressionVectorFixture, Eval) {
+  /** action */
+  auto res = (mu::lazy(this->a) - this->b).eval();
+  /** assert */
+  EXPECT_TRUE((std::is_same<decltype(res),
+                            mu::Vector<TestFixture::kSize, TypeParam>>::value));
+  EXPECT_THAT(res, ::testing::ContainerEq(this->a - this->b));
+}
+
+TYPED_TEST(ExpressionVectorFixture, DifferentTypes) {
+  /** arrange */
+  mu::Vector<TestFixture::kSize, short> e{short{3}};
+  /** action */
+  /* like the eager operators, the result has the type of the left operand */
+  mu::Vector<TestFixture::kSize, TypeParam> res1 = mu::lazy(this->a) / e;
+  mu::Vector<TestFixture::kSize, short> res2 = mu::lazy(e) * this->a;
+  mu::Vector<TestFixture::kSize, double> res3;
+  mu::assign(res3, mu::lazy(this->a) + this->b);
+  /** assert */
+  EXPECT_THAT(res1, ::testing::ContainerEq(this->a / e));
+  EXPECT_THAT(res2, ::testing::ContainerEq(e * this->a));
+  mu::Vector<TestFixture::kSize, double> comp3 = this->a + this->b;
+  EXPECT_THAT(res3, ::testing::ContainerEq(comp3));
+}
+
+TEST(ExpressionVector, DerivedType) {
+  /** arrange */
+  mu::Vector2D<float> a{1.0F, 2.0F};
+  mu::Vector2D<float> b{3.0F, 4.0F};
+  /** action */
+  mu::Vector2D<float> res = (mu::lazy(a) + b * 2.0F).eval();
+  mu::Vector2D<float> res2;
+  mu::assign(res2, mu::lazy(a) * b);
+  /** assert */
+  EXPECT_THAT(res, ::testing::ElementsAre(7.0F, 10.0F));
+  EXPECT_THAT(res2, ::testing::ElementsAre(3.0F, 8.0F));
+}
+
+/*******************************Matrix*****************************************/
+
+template <typename T>
+class ExpressionMatrixFixture : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (std::size_t i = 0; i < 3; i++) {
+      for (std::size_t j = 0; j < 4; j++) {
+        a[i][j] = static_cast<T>(1.5F * (i + j + 1));
+        b[i][j] = static_cast<T>(2.5F * (i * j + 1));
+        c[i][j] = static_cast<T>(0.5F * (i + 2 * j + 2));
+      }
+    }
+  }
+  mu::Matrix<3, 4, T> a;
+  mu::Matrix<3, 4, T> b;
+  mu::Matrix<3, 4, T> c;
+};
+
+TYPED_TEST_SUITE(ExpressionMatrixFixture, ExpressionTypes);
+
+TYPED_TEST(ExpressionMatrixFixture, Chain) {
+  /** action */
+  mu::Matrix<3, 4, TypeParam> res =
+      mu::lazy(this->a) * this->b - mu::lazy(this->c) / 2 + this->a;
+  /** assert */
+  EXPECT_EQ(res, this->a * this->b - this->c / 2 + this->a);
+}
+
+TYPED_TEST(ExpressionMatrixFixture, Assign) {
+  /** arrange */
+  mu::Matrix<3, 4, TypeParam> comp = 2 * this->a + this->b / this->c;
+  /** action */
+  mu::assign(this->a, 2 * mu::lazy(this->a) + mu::lazy(this->b) / this->c);
+  /** assert */
+  EXPECT_EQ(this->a, comp);
+}
@@ -0,0 +1,260 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ios>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/format.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/**
+ * the text of format_to is compared to operator<< and to the expected text
+ * of each style. floating point values must read back as the same value
+ */
+
+using FormatTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class FormatFixture : public ::testing::Test {
+ public:
+  /* the formatted text of x, "<null>" if the buffer is too small */
+  template <class X>
+  static std::string format(const X &x, std::size_t size = 1024,
+                            const mu::FormatStyle &style =
+                                mu::FormatStyle::plain()) {
+    std::vector<char> buffer(size);
+    char *end = mu::format_to(buffer.data(), buffer.data() + size, x, style);
+    return end == nullptr ? "<null>" : std::string(buffer.data(), end);
+  }
+
+  template <std::size_t N, std::size_t M>
+  static mu::Matrix<N, M, T> values(int seed) {
+    mu::Matrix<N, M, T> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        /* negative and fractional (for floating point types) values */
+        ret[i][j] = static_cast<T>(static_cast<T>(i * M + j + seed) / 4 - 3);
+      }
+    }
+    return ret;
+  }
+};
+
+TYPED_TEST_SUITE(FormatFixture, FormatTypes);
+
+TYPED_TEST(FormatFixture, VectorPlainStreamOut) {
+  /** arrange */
+  const mu::Vector<5, TypeParam> kV = TestFixture::template values<1, 5>(0)[0];
+  std::stringstream ss;
+  ss << kV;
+  /** action & assert */
+  EXPECT_EQ(TestFixture::format(kV), ss.str());
+}
+
+TYPED_TEST(FormatFixture, MatrixPlainStreamOut) {
+  /** arrange */
+  const mu::Matrix<3, 4, TypeParam> kM = TestFixture::template values<3, 4>(0);
+  std::stringstream ss;
+  ss << kM;
+  /** action & assert */
+  EXPECT_EQ(TestFixture::format(kM), ss.str());
+}
+
+TYPED_TEST(FormatFixture, BufferTooSmall) {
+  /** arrange */
+  const mu::Matrix<3, 4, TypeParam> kM = TestFixture::template values<3, 4>(0);
+  const std::string kText = TestFixture::format(kM);
+  /** action & assert. every buffer that is one character too small */
+  for (std::size_t size = 0; size < kText.size(); size++) {
+    EXPECT_EQ(TestFixture::format(kM, size), "<null>") << size;
+  }
+  EXPECT_EQ(TestFixture::format(kM, kText.size()), kText);
+  EXPECT_EQ(TestFixture::format(kM[0], 0), "<null>");
+  EXPECT_EQ(TestFixture::format(kM[0][0], 0), "<null>");
+}
+
+TYPED_TEST(FormatFixture, FormatMaxSize) {
+  /** arrange. the values with the most characters */
+  mu::Vector<4, TypeParam> v = {
+      std::numeric_limits<TypeParam>::lowest(),
+      std::numeric_limits<TypeParam>::min(),
+      std::numeric_limits<TypeParam>::max(),
+      static_cast<TypeParam>(-1) / static_cast<TypeParam>(3)};
+  if (std::is_floating_point<TypeParam>::value) {
+    v[1] = -std::numeric_limits<TypeParam>::denorm_min();
+  }
+  mu::Matrix<2, 4, TypeParam> m;
+  m[0] = v;
+  m[1] = v;
+  const mu::Matrix<2, 4, TypeParam> kM = m;
+  for (const mu::FormatStyle &kStyle :
+       {mu::FormatStyle::plain(), mu::FormatStyle::csv(),
+        mu::FormatStyle::json()}) {
+    /** action */
+    const std::size_t kVectorSize = mu::format_max_size(v, kStyle);
+    const std::size_t kMatrixSize = mu::format_max_size(kM, kStyle);
+    /** assert */
+    EXPECT_NE(TestFixture::format(v, kVectorSize, kStyle), "<null>");
+    EXPECT_NE(TestFixture::format(kM, kMatrixSize, kStyle), "<null>");
+  }
+}
+
+TYPED_TEST(FormatFixture, RoundTrip) {
+  /** arrange. values across the whole range */
+  std::vector<TypeParam> values = {TypeParam{0},
+                                   std::numeric_limits<TypeParam>::lowest(),
+                                   std::numeric_limits<TypeParam>::max(),
+                                   std::numeric_limits<TypeParam>::min()};
+  TypeParam x = static_cast<TypeParam>(1);
+  for (int i = 0; i < 1000; i++) {
+    x = static_cast<TypeParam>(x * static_cast<TypeParam>(-1.37) +
+                               static_cast<TypeParam>(i % 3));
+    values.push_back(x);
+  }
+  for (TypeParam value : values) {
+    /** action */
+    const std::string kText = TestFixture::format(value);
+    /** assert */
+    EXPECT_EQ(static_cast<TypeParam>(std::strtold(kText.c_str(), nullptr)),
+              value)
+        << kText;
+  }
+}
+
+TEST(Format, Scalar) {
+  /** action & assert */
+  EXPECT_EQ(FormatFixture<int>::format(0), "0");
+  EXPECT_EQ(FormatFixture<int>::format(-42), "-42");
+  EXPECT_EQ(FormatFixture<int>::format(std::numeric_limits<int>::min()),
+            "-2147483648");
+  EXPECT_EQ(
+      FormatFixture<int>::format(std::numeric_limits<std::uint64_t>::max()),
+      "18446744073709551615");
+  EXPECT_EQ(FormatFixture<int>::format(std::int8_t{-128}), "-128");
+  EXPECT_EQ(FormatFixture<int>::format(true), "1");
+  /* the shortest text that reads back as the same value */
+  EXPECT_EQ(FormatFixture<int>::format(0.1F), "0.1");
+  EXPECT_EQ(FormatFixture<int>::format(0.1), "0.1");
+  EXPECT_EQ(FormatFixture<int>::format(-2.5F), "-2.5");
+  EXPECT_EQ(FormatFixture<int>::format(1e30), "1e+30");
+  EXPECT_EQ(FormatFixture<int>::format(0.3F), "0.3");
+}
+
+TEST(Format, Styles) {
+  /** arrange */
+  const mu::Vector<3, int> kV = {1, -2, 3};
+  const mu::Matrix<2, 2, float> kM = {{1.5F, 2.0F}, {-3.25F, 4.0F}};
+  /** action & assert */
+  EXPECT_EQ(FormatFixture<int>::format(kV), "[ 1, -2, 3 ]");
+  EXPECT_EQ(FormatFixture<int>::format(kV, 64, mu::FormatStyle::csv()),
+            "1,-2,3");
+  EXPECT_EQ(FormatFixture<int>::format(kV, 64, mu::FormatStyle::json()),
+            "[1,-2,3]");
+  EXPECT_EQ(FormatFixture<int>::format(kM), "[ [ 1.5, 2 ],\n  [ -3.25, 4 ] ]");
+  EXPECT_EQ(FormatFixture<int>::format(kM, 64, mu::FormatStyle::csv()),
+            "1.5,2,-3.25,4");
+  EXPECT_EQ(FormatFixture<int>::format(kM, 64, mu::FormatStyle::json()),
+            "[[1.5,2],[-3.25,4]]");
+  /* a custom style */
+  const mu::FormatStyle kTsv = {"", "\t", "", "", "\t", "", "", "\n", "\n"};
+  EXPECT_EQ(FormatFixture<int>::format(kV, 64, kTsv), "1\t-2\t3");
+}
+
+TEST(Format, List) {
+  /** arrange */
+  const std::array<mu::Vector<2, int>, 3> kList = {
+      mu::Vector<2, int>{1, 2}, mu::Vector<2, int>{3, 4},
+      mu::Vector<2, int>{5, 6}};
+  std::array<char, 64> buffer{};
+  /** action */
+  char *json_end =
+      mu::format_to(buffer.data(), buffer.data() + buffer.size(),
+                    kList.data(), kList.size(), mu::FormatStyle::json());
+  const std::string kJson(buffer.data(), json_end);
+  char *csv_end =
+      mu::format_to(buffer.data(), buffer.data() + buffer.size(),
+                    kList.data(), kList.size(), mu::FormatStyle::csv());
+  const std::string kCsv(buffer.data(), csv_end);
+  char *empty_end = mu::format_to(buffer.data(), buffer.data() + 2,
+                                  kList.data(), 0, mu::FormatStyle::json());
+  /** assert */
+  EXPECT_EQ(kJson, "[[1,2],[3,4],[5,6]]");
+  EXPECT_EQ(kCsv, "1,2\n3,4\n5,6\n");
+  EXPECT_EQ(std::string(buffer.data(), empty_end), "[]");
+  EXPECT_EQ(mu::format_to(buffer.data(), buffer.data() + 10, kList.data(),
+                          kList.size(), mu::FormatStyle::json()),
+            nullptr);
+}
+
+TYPED_TEST(FormatFixture, Writer) {
+  /** arrange */
+  std::vector<mu::Matrix<2, 3, TypeParam>> matrices;
+  for (int i = 0; i < 1000; i++) {
+    matrices.push_back(TestFixture::template values<2, 3>(i));
+  }
+  std::vector<char> buffer(1 << 20);
+  for (const mu::FormatStyle &kStyle :
+       {mu::FormatStyle::plain(), mu::FormatStyle::csv(),
+        mu::FormatStyle::json()}) {
+    /* a buffer size that is smaller than an element, too */
+    for (std::size_t buffer_size : {std::size_t{1}, std::size_t{100},
+                                    std::size_t{1 << 16}}) {
+      std::stringstream ss;
+      /** action */
+      {
+        mu::FormatWriter writer(ss, kStyle, buffer_size);
+        writer.write(matrices[0]);
+        writer.write(matrices.data() + 1, matrices.size() - 1);
+        EXPECT_EQ(writer.size(), matrices.size());
+      }
+      /** assert */
+      char *end = mu::format_to(buffer.data(), buffer.data() + buffer.size(),
+                                matrices.data(), matrices.size(), kStyle);
+      EXPECT_EQ(ss.str(), std::string(buffer.data(), end));
+    }
+  }
+}
+
+TEST(Format, WriterClose) {
+  /** arrange */
+  std::stringstream ss;
+  mu::FormatWriter writer(ss, mu::FormatStyle::json());
+  /** action */
+  writer.write(mu::Vector<2, int>{1, 2});
+  writer.flush();
+  const std::string kFlushed = ss.str();
+  writer.close();
+  writer.close();
+  /** assert */
+  EXPECT_EQ(kFlushed, "[[1,2]");
+  EXPECT_EQ(ss.str(), "[[1,2]]");
+}
+
+TEST(Format, WriterStreamError) {
+  /** arrange */
+  /* the default overflow() fails, so every write sets the badbit */
+  struct FailingBuffer : std::streambuf {};
+  FailingBuffer buffer;
+  std::ostream os(&buffer);
+  os.exceptions(std::ios_base::badbit);
+  /** action & assert */
+  EXPECT_NO_THROW({
+    mu::FormatWriter writer(os, mu::FormatStyle::json());
+    writer.write(mu::Vector<2, int>{1, 2});
+    /* the list stays open, so the destructor writes to the stream again */
+    EXPECT_THROW(writer.close(), std::ios_base::failure);
+  });
+  /* the destructor is the first to write */
+  EXPECT_NO_THROW({
+    mu::FormatWriter writer(os, mu::FormatStyle::json());
+    writer.write(mu::Vector<2, int>{1, 2});
+  });
+}
@@ -0,0 +1,97 @@
+#include <cstddef>
+
+#include "gtest/gtest.h"
+#include "mu/gemm.h"
+#include "mu/matrix.h"
+
+/**
+ * the blocked kernel is checked against the naive loop for sizes that are
+ * smaller, equal and larger than the tile sizes and the SIMD register sizes,
+ * so that full tiles and the remaining rows and columns are both covered
+ */
+
+/*
+ * types with and without a SIMD implementation
+ */
+using GemmTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class GemmFixture : public ::testing::Test {
+ public:
+  template <std::size_t N, std::size_t M, typename U = T>
+  static mu::Matrix<N, M, U> values(int seed) {
+    mu::Matrix<N, M, U> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        ret[i][j] = static_cast<U>(
+            static_cast<int>((i * 7 + j * 5 + seed) % 9) - 4);
+      }
+    }
+    return ret;
+  }
+
+  /* multiplies an NxK and a KxP matrix with both kernels */
+  template <std::size_t N, std::size_t K, std::size_t P, typename T2 = T,
+            typename U = T>
+  static void check() {
+    const mu::Matrix<N, K, T> kLhs = values<N, K>(0);
+    const mu::Matrix<K, P, T2> kRhs = GemmFixture<T2>::template values<K, P>(1);
+    mu::Matrix<N, P, U> res;
+    mu::Matrix<N, P, U> comp;
+    /** action */
+    mu::gemm_blocked<N, K, P, U>(kLhs, kRhs, res);
+    mu::gemm_naive<N, K, P, U>(kLhs, kRhs, comp);
+    /** assert */
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < P; j++) {
+        EXPECT_EQ(res[i][j], comp[i][j]);
+      }
+    }
+  }
+};
+
+TYPED_TEST_SUITE(GemmFixture, GemmTypes);
+
+TYPED_TEST(GemmFixture, Square) {
+  TestFixture::template check<1, 1, 1>();
+  TestFixture::template check<3, 3, 3>();
+  TestFixture::template check<4, 4, 4>();
+  TestFixture::template check<16, 16, 16>();
+  TestFixture::template check<64, 64, 64>();
+}
+
+TYPED_TEST(GemmFixture, NonSquare) {
+  /* remaining rows (N % 4), columns (P % register size) and more than one
+   * block in k and p direction */
+  TestFixture::template check<5, 3, 7>();
+  TestFixture::template check<7, 70, 3>();
+  TestFixture::template check<6, 65, 17>();
+  TestFixture::template check<3, 2, 259>();
+  TestFixture::template check<9, 130, 35>();
+}
+
+TYPED_TEST(GemmFixture, DifferentTypes) {
+  /* no SIMD. the c++ usual arithmetic conversions apply */
+  TestFixture::template check<5, 9, 17, short, double>();
+  TestFixture::template check<8, 67, 9, long, long double>();
+}
+
+TYPED_TEST(GemmFixture, MemberFuncDotBlocked) {
+  /** arrange */
+  const mu::Matrix<12, 70, TypeParam> kLhs =
+      TestFixture::template values<12, 70>(2);
+  const mu::Matrix<70, 20, TypeParam> kRhs =
+      TestFixture::template values<70, 20>(3);
+  /** action */
+  mu::Matrix<12, 20, TypeParam> res = kLhs.dot(kRhs);
+  /** assert */
+  for (std::size_t i = 0; i < 12; i++) {
+    for (std::size_t j = 0; j < 20; j++) {
+      TypeParam sum{0};
+      for (std::size_t k = 0; k < 70; k++) {
+        sum += kLhs[i][k] * kRhs[k][j];
+      }
+      EXPECT_EQ(res[i][j], sum);
+    }
+  }
+}
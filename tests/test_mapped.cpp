@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/mapped.h"
+#include "mu/matrix.h"
+#include "mu/vector.h"
+
+/**
+ * every file is written by a MappedArrayWriter and read back by a
+ * MappedArray
+ */
+
+using MappedTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class MappedFixture : public ::testing::Test {
+ public:
+  /* a different file per test, removed afterwards */
+  void SetUp() override {
+    const ::testing::TestInfo *kInfo =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+    /* typed test suite names contain a '/' */
+    std::string name = std::string(kInfo->test_suite_name()) + "_" +
+                       kInfo->name();
+    std::replace(name.begin(), name.end(), '/', '_');
+    path_ = ::testing::TempDir() + "mu_" + name + ".bin";
+  }
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  static std::vector<mu::Vector<3, T>> vectors(std::size_t size) {
+    std::vector<mu::Vector<3, T>> ret(size);
+    for (std::size_t i = 0; i < size; i++) {
+      ret[i] = {static_cast<T>(i), static_cast<T>(i % 7), static_cast<T>(3)};
+    }
+    return ret;
+  }
+
+  static std::vector<mu::Matrix<4, 4, T>> matrices(std::size_t size) {
+    std::vector<mu::Matrix<4, 4, T>> ret(size);
+    for (std::size_t i = 0; i < size; i++) {
+      for (std::size_t j = 0; j < 16; j++) {
+        ret[i][j / 4][j % 4] = static_cast<T>((i + j) % 11);
+      }
+    }
+    return ret;
+  }
+
+  std::string path_;
+};
+
+TYPED_TEST_SUITE(MappedFixture, MappedTypes);
+
+TYPED_TEST(MappedFixture, WriterPushBackVector) {
+  /** arrange */
+  const std::vector<mu::Vector<3, TypeParam>> kVectors =
+      TestFixture::vectors(1000);
+  /** action */
+  {
+    mu::MappedArrayWriter<mu::Vector<3, TypeParam>> writer(this->path_);
+    for (const auto &v : kVectors) {
+      writer.push_back(v);
+    }
+    EXPECT_EQ(writer.size(), 1000);
+  }
+  const mu::MappedArray<mu::Vector<3, TypeParam>> kRes(this->path_);
+  /** assert */
+  ASSERT_EQ(kRes.size(), 1000);
+  EXPECT_FALSE(kRes.empty());
+  for (std::size_t i = 0; i < kVectors.size(); i++) {
+    EXPECT_EQ(kRes[i], kVectors[i]);
+  }
+  EXPECT_EQ(kRes.at(999), kVectors[999]);
+  EXPECT_EQ((std::vector<mu::Vector<3, TypeParam>>(kRes.begin(), kRes.end())),
+            kVectors);
+}
+
+TYPED_TEST(MappedFixture, WriterWriteMatrix) {
+  /** arrange */
+  const std::vector<mu::Matrix<4, 4, TypeParam>> kMatrices =
+      TestFixture::matrices(100);
+  /** action. in two parts and a single element in between */
+  mu::MappedArrayWriter<mu::Matrix<4, 4, TypeParam>> writer(this->path_);
+  writer.write(kMatrices.data(), 60);
+  writer.push_back(kMatrices[60]);
+  writer.write(kMatrices.data() + 61, 39);
+  writer.close();
+  const mu::MappedArray<mu::Matrix<4, 4, TypeParam>> kRes(this->path_);
+  /** assert */
+  ASSERT_EQ(kRes.size(), 100);
+  for (std::size_t i = 0; i < kMatrices.size(); i++) {
+    EXPECT_EQ(kRes[i], kMatrices[i]);
+  }
+}
+
+TYPED_TEST(MappedFixture, FileLayout) {
+  /** arrange */
+  const std::vector<mu::Vector<3, TypeParam>> kVectors =
+      TestFixture::vectors(5);
+  /** action */
+  {
+    mu::MappedArrayWriter<mu::Vector<3, TypeParam>> writer(this->path_);
+    writer.write(kVectors.data(), kVectors.size());
+  }
+  std::ifstream file(this->path_, std::ios::binary | std::ios::ate);
+  const mu::MappedArray<mu::Vector<3, TypeParam>> kRes(this->path_);
+  /** assert. the header and then the values without any padding */
+  EXPECT_EQ(static_cast<std::size_t>(file.tellg()),
+            64 + 5 * 3 * sizeof(TypeParam));
+  const mu::MappedHeader kHeader = kRes.header();
+  EXPECT_EQ(std::string(kHeader.magic, 4), "MUAR");
+  EXPECT_EQ(kHeader.version, mu::kMappedVersion);
+  EXPECT_EQ(kHeader.tag,
+            static_cast<std::uint8_t>(mu::scalar_tag<TypeParam>()));
+  EXPECT_EQ(kHeader.endian, mu::MappedHeader::native_endian());
+  EXPECT_EQ(kHeader.rows, 3);
+  EXPECT_EQ(kHeader.cols, 1);
+  EXPECT_EQ(kHeader.count, 5);
+  EXPECT_EQ(reinterpret_cast<const TypeParam *>(kRes.data())[3 * 4],
+            kVectors[4][0]);
+}
+
+TYPED_TEST(MappedFixture, Empty) {
+  /** action */
+  mu::MappedArrayWriter<mu::Vector<3, TypeParam>>{this->path_};
+  const mu::MappedArray<mu::Vector<3, TypeParam>> kRes(this->path_);
+  const mu::MappedArray<mu::Vector<3, TypeParam>> kDefault;
+  /** assert */
+  EXPECT_TRUE(kRes.empty());
+  EXPECT_EQ(kRes.begin(), kRes.end());
+  EXPECT_THROW(kRes.at(0), std::out_of_range);
+  EXPECT_TRUE(kDefault.empty());
+  EXPECT_EQ(kDefault.data(), nullptr);
+}
+
+TYPED_TEST(MappedFixture, Move) {
+  /** arrange */
+  {
+    mu::MappedArrayWriter<mu::Vector<3, TypeParam>> writer(this->path_);
+    writer.write(TestFixture::vectors(10).data(), 10);
+  }
+  mu::MappedArray<mu::Vector<3, TypeParam>> a(this->path_);
+  const mu::Vector<3, TypeParam> *kData = a.data();
+  /** action */
+  mu::MappedArray<mu::Vector<3, TypeParam>> b(std::move(a));
+  mu::MappedArray<mu::Vector<3, TypeParam>> c;
+  c = std::move(b);
+  /** assert. the same mapping */
+  EXPECT_EQ(c.data(), kData);
+  EXPECT_EQ(c.size(), 10);
+  EXPECT_EQ(c[9], TestFixture::vectors(10)[9]);
+}
+
+TYPED_TEST(MappedFixture, WriterMove) {
+  /** arrange */
+  mu::MappedArrayWriter<mu::Vector<3, TypeParam>> a(this->path_);
+  a.push_back(TestFixture::vectors(1)[0]);
+  /** action */
+  mu::MappedArrayWriter<mu::Vector<3, TypeParam>> b(std::move(a));
+  b.push_back(TestFixture::vectors(1)[0]);
+  b.close();
+  /** assert */
+  EXPECT_EQ((mu::MappedArray<mu::Vector<3, TypeParam>>(this->path_).size()),
+            2);
+}
+
+TYPED_TEST(MappedFixture, OpenErrors) {
+  /** arrange */
+  {
+    mu::MappedArrayWriter<mu::Vector<3, TypeParam>> writer(this->path_);
+    writer.write(TestFixture::vectors(4).data(), 4);
+  }
+  /** action & assert */
+  EXPECT_THROW((mu::MappedArray<mu::Vector<3, TypeParam>>{this->path_ + ".no"}),
+               std::system_error);
+  /* another shape or value type. a Matrix<3, 1> is the same shape */
+  EXPECT_EQ((mu::MappedArray<mu::Matrix<3, 1, TypeParam>>{this->path_}.size()),
+            4);
+  EXPECT_THROW((mu::MappedArray<mu::Vector<4, TypeParam>>{this->path_}),
+               std::runtime_error);
+  EXPECT_THROW((mu::MappedArray<mu::Matrix<1, 3, TypeParam>>{this->path_}),
+               std::runtime_error);
+  EXPECT_THROW((mu::MappedArray<mu::Vector<3, std::int16_t>>{this->path_}),
+               std::runtime_error);
+  EXPECT_THROW((mu::MappedArrayWriter<mu::Vector<3, TypeParam>>{"/no/dir/x"}),
+               std::runtime_error);
+}
+
+TYPED_TEST(MappedFixture, OpenCorruptHeader) {
+  const std::vector<std::pair<std::size_t, char>> kPatches = {
+      {0, 'X'},     // magic
+      {4, 99},      // version
+      {7, 3},       // byte order
+      {16, 5},      // count larger than the file
+      {std::size_t(-1), 0}};  // truncated header
+  for (const auto &kPatch : kPatches) {
+    /** arrange */
+    {
+      mu::MappedArrayWriter<mu::Vector<3, TypeParam>> writer(this->path_);
+      writer.write(TestFixture::vectors(4).data(), 4);
+    }
+    if (kPatch.first == std::size_t(-1)) {
+      std::ofstream(this->path_, std::ios::binary | std::ios::trunc)
+          .write("MUAR", 4);
+    } else {
+      std::fstream file(this->path_,
+                        std::ios::binary | std::ios::in | std::ios::out);
+      file.seekp(static_cast<std::streamoff>(kPatch.first));
+      file.put(kPatch.second);
+    }
+    /** action & assert */
+    EXPECT_THROW((mu::MappedArray<mu::Vector<3, TypeParam>>{this->path_}),
+                 std::runtime_error)
+        << "byte " << kPatch.first;
+  }
+}
+
+TEST(Mapped, ScalarTag) {
+  /** action & assert */
+  static_assert(mu::scalar_tag<std::int8_t>() == mu::ScalarTag::kInt8, "");
+  static_assert(mu::scalar_tag<std::uint8_t>() == mu::ScalarTag::kUInt8, "");
+  static_assert(mu::scalar_tag<std::int16_t>() == mu::ScalarTag::kInt16, "");
+  static_assert(mu::scalar_tag<std::uint16_t>() == mu::ScalarTag::kUInt16, "");
+  static_assert(mu::scalar_tag<std::int32_t>() == mu::ScalarTag::kInt32, "");
+  static_assert(mu::scalar_tag<std::uint32_t>() == mu::ScalarTag::kUInt32, "");
+  static_assert(mu::scalar_tag<std::int64_t>() == mu::ScalarTag::kInt64, "");
+  static_assert(mu::scalar_tag<std::uint64_t>() == mu::ScalarTag::kUInt64, "");
+  static_assert(mu::scalar_tag<float>() == mu::ScalarTag::kFloat, "");
+  static_assert(mu::scalar_tag<double>() == mu::ScalarTag::kDouble, "");
+  static_assert(mu::scalar_tag<int>() == mu::ScalarTag::kInt32, "");
+}
@@ -0,0 +1,214 @@
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/vector.h"
+
+/**
+ * every parallel algorithm is compared to the serial result for pools with
+ * zero (everything runs on the calling thread), one and several worker threads
+ */
+
+class ParallelFixture : public ::testing::TestWithParam<std::size_t> {
+ public:
+  mu::parallel::ThreadPool pool{GetParam()};
+
+  static std::vector<mu::Vector<3, float>> vectors(std::size_t count) {
+    std::vector<mu::Vector<3, float>> ret(count);
+    for (std::size_t i = 0; i < count; i++) {
+      ret[i] = {static_cast<float>(1 + i % 7), static_cast<float>(2 + i % 5),
+                static_cast<float>(3 + i % 3)};
+    }
+    return ret;
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(Threads, ParallelFixture,
+                         ::testing::Values(0, 1, 4));
+
+TEST_P(ParallelFixture, ThreadPoolSize) {
+  EXPECT_EQ(pool.size(), GetParam());
+}
+
+TEST_P(ParallelFixture, ThreadPoolSubmit) {
+  /** arrange */
+  std::atomic<int> counter{0};
+  /** action */
+  for (int i = 0; i < 100; i++) {
+    pool.submit([&counter] { counter++; });
+  }
+  while (counter < 100) {
+    pool.run_pending();
+  }
+  /** assert */
+  EXPECT_EQ(counter, 100);
+  EXPECT_FALSE(pool.run_pending());
+}
+
+TEST_P(ParallelFixture, ForChunks) {
+  for (std::size_t count : {0, 1, 7, 100, 1001}) {
+    for (std::size_t chunk : {0, 1, 3, 64, 2000}) {
+      /** arrange */
+      std::vector<std::atomic<int>> visited(count);
+      /** action */
+      mu::parallel::for_chunks(pool, count, chunk,
+                               [&visited](std::size_t begin, std::size_t end) {
+                                 for (std::size_t i = begin; i < end; i++) {
+                                   visited[i]++;
+                                 }
+                               });
+      /** assert */
+      for (const auto &item : visited) {
+        EXPECT_EQ(item, 1);
+      }
+    }
+  }
+}
+
+TEST_P(ParallelFixture, ForChunksException) {
+  /** action & assert */
+  EXPECT_THROW(mu::parallel::for_chunks(pool, 100, 10,
+                                        [](std::size_t begin, std::size_t) {
+                                          if (begin == 50) {
+                                            throw std::runtime_error("error");
+                                          }
+                                        }),
+               std::runtime_error);
+}
+
+TEST_P(ParallelFixture, ForChunksNested) {
+  /** arrange */
+  std::atomic<int> counter{0};
+  /** action */
+  mu::parallel::for_chunks(
+      pool, 8, 1, [this, &counter](std::size_t, std::size_t) {
+        mu::parallel::for_chunks(pool, 8, 1,
+                                 [&counter](std::size_t, std::size_t) {
+                                   counter++;
+                                 });
+      });
+  /** assert */
+  EXPECT_EQ(counter, 64);
+}
+
+TEST_P(ParallelFixture, ForEach) {
+  /** arrange */
+  std::vector<mu::Vector<3, float>> res = vectors(5000);
+  std::vector<mu::Vector<3, float>> comp = res;
+  /** action */
+  mu::parallel::for_each(pool, res.begin(), res.end(),
+                         [](mu::Vector<3, float> &v) { v.normalize(); });
+  /** assert */
+  for (auto &v : comp) {
+    v.normalize();
+  }
+  EXPECT_EQ(res, comp);
+}
+
+TEST_P(ParallelFixture, Transform) {
+  /** arrange */
+  std::vector<mu::Matrix<2, 3, int>> matrices(3000);
+  for (std::size_t i = 0; i < matrices.size(); i++) {
+    matrices[i] = mu::Matrix<2, 3, int>{
+        {static_cast<int>(i), 1, 2}, {3, 4, static_cast<int>(i % 11)}};
+  }
+  std::vector<mu::Matrix<3, 2, int>> res(matrices.size());
+  /** action */
+  auto last = mu::parallel::transform(
+      pool, matrices.begin(), matrices.end(), res.begin(),
+      [](const mu::Matrix<2, 3, int> &m) { return m.transposed(); });
+  /** assert */
+  EXPECT_EQ(last, res.end());
+  for (std::size_t i = 0; i < matrices.size(); i++) {
+    EXPECT_EQ(res[i], matrices[i].transposed());
+  }
+}
+
+TEST_P(ParallelFixture, TransformBinary) {
+  /** arrange */
+  const std::vector<mu::Vector<3, float>> kLhs = vectors(5000);
+  const std::vector<mu::Vector<3, float>> kRhs = vectors(5001);
+  std::vector<float> res(kLhs.size());
+  /** action */
+  auto last = mu::parallel::transform(
+      pool, kLhs.begin(), kLhs.end(), kRhs.begin() + 1, res.begin(),
+      [](const mu::Vector<3, float> &a, const mu::Vector<3, float> &b) {
+        return a.dot(b);
+      });
+  /** assert */
+  EXPECT_EQ(last, res.end());
+  for (std::size_t i = 0; i < kLhs.size(); i++) {
+    EXPECT_EQ(res[i], kLhs[i].dot(kRhs[i + 1]));
+  }
+}
+
+TEST_P(ParallelFixture, Reduce) {
+  /** arrange */
+  const std::vector<mu::Vector<3, float>> kVectors = vectors(10000);
+  const mu::Vector<3, float> kInit = {0.0F, 0.0F, 0.0F};
+  /** action */
+  mu::Vector<3, float> res =
+      mu::parallel::reduce(pool, kVectors.begin(), kVectors.end(), kInit,
+                           std::plus<mu::Vector<3, float>>());
+  /** assert */
+  mu::Vector<3, float> comp = kInit;
+  for (const auto &v : kVectors) {
+    comp += v;
+  }
+  EXPECT_EQ(res, comp);
+}
+
+TEST_P(ParallelFixture, ReduceEmpty) {
+  /** arrange */
+  const std::vector<int> kValues;
+  /** action */
+  int res = mu::parallel::reduce(pool, kValues.begin(), kValues.end(), 7,
+                                 std::plus<int>());
+  /** assert */
+  EXPECT_EQ(res, 7);
+}
+
+TEST(Parallel, ReduceDeterministic) {
+  /** arrange */
+  std::vector<float> values(100000);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = 1.0F / static_cast<float>(1 + i);
+  }
+  mu::parallel::ThreadPool pool0(0);
+  mu::parallel::ThreadPool pool3(3);
+  /** action */
+  float res0 = mu::parallel::reduce(pool0, values.begin(), values.end(), 0.0F,
+                                    std::plus<float>());
+  float res3 = mu::parallel::reduce(pool3, values.begin(), values.end(), 0.0F,
+                                    std::plus<float>());
+  /** assert */
+  EXPECT_EQ(res0, res3);
+}
+
+TEST(Parallel, DefaultPool) {
+  /** arrange */
+  std::vector<int> values(1000, 2);
+  /** action */
+  mu::parallel::for_each(values.begin(), values.end(), [](int &v) { v *= 3; });
+  std::vector<int> res(values.size());
+  mu::parallel::transform(values.begin(), values.end(), res.begin(),
+                          [](int v) { return v + 1; });
+  mu::parallel::transform(values.begin(), values.end(), res.begin(),
+                          res.begin(), [](int a, int b) { return a * b; });
+  int sum = mu::parallel::reduce(res.begin(), res.end(), 0, std::plus<int>());
+  std::atomic<int> chunks{0};
+  mu::parallel::for_chunks(10, 1,
+                           [&chunks](std::size_t, std::size_t) { chunks++; });
+  /** assert */
+  EXPECT_EQ(values[999], 6);
+  EXPECT_EQ(res[999], 42);
+  EXPECT_EQ(sum, 42000);
+  EXPECT_EQ(chunks, 10);
+  EXPECT_EQ(mu::parallel::default_pool().size(),
+            mu::parallel::ThreadPool::default_threads());
+}
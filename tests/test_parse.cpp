@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/format.h"
+#include "mu/mapped.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/parse.h"
+#include "mu/vector.h"
+
+/**
+ * the text of operator<< and format_to in every style is parsed back to the
+ * same values
+ */
+
+using ParseTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class ParseFixture : public ::testing::Test {
+ public:
+  template <std::size_t N, std::size_t M>
+  static mu::Matrix<N, M, T> values(int seed) {
+    mu::Matrix<N, M, T> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < M; j++) {
+        /* negative and fractional (for floating point types) values */
+        ret[i][j] = static_cast<T>(static_cast<T>(i * M + j + seed) / 3 - 5);
+      }
+    }
+    return ret;
+  }
+
+  /* the text of FormatWriter */
+  template <class E>
+  static std::string text(const std::vector<E> &list,
+                          const mu::FormatStyle &style) {
+    std::stringstream ss;
+    mu::FormatWriter writer(ss, style);
+    writer.write(list.data(), list.size());
+    writer.close();
+    return ss.str();
+  }
+
+  template <class E>
+  static std::vector<E> parse(const std::string &text) {
+    return mu::parse_list<E>(text.data(), text.data() + text.size());
+  }
+};
+
+TYPED_TEST_SUITE(ParseFixture, ParseTypes);
+
+TYPED_TEST(ParseFixture, VectorStreamOut) {
+  /** arrange. operator<< writes 6 significant digits */
+  const mu::Vector<4, TypeParam> kV(mu::Vector<4, double>{-1.25, 2.5, 0.0, 30.0});
+  std::stringstream ss;
+  ss << kV << " tail";
+  const std::string kText = ss.str();
+  mu::Vector<4, TypeParam> res;
+  /** action */
+  const char *end = mu::parse_from(kText.data(), kText.data() + kText.size(),
+                                   res);
+  /** assert. the closing bracket is consumed */
+  ASSERT_NE(end, nullptr);
+  EXPECT_EQ(std::string(end), " tail");
+  EXPECT_EQ(res, kV);
+}
+
+TYPED_TEST(ParseFixture, MatrixStyles) {
+  /** arrange */
+  const mu::Matrix<3, 2, TypeParam> kM = TestFixture::template values<3, 2>(1);
+  for (const mu::FormatStyle &kStyle :
+       {mu::FormatStyle::plain(), mu::FormatStyle::csv(),
+        mu::FormatStyle::json()}) {
+    char buffer[512];
+    char *text_end = mu::format_to(buffer, buffer + sizeof(buffer), kM, kStyle);
+    mu::Matrix<3, 2, TypeParam> res;
+    /** action */
+    const char *end = mu::parse_from(buffer, text_end, res);
+    /** assert */
+    EXPECT_EQ(end, text_end);
+    EXPECT_EQ(res, kM);
+  }
+}
+
+TYPED_TEST(ParseFixture, ListStyles) {
+  /** arrange */
+  std::vector<mu::Matrix<2, 3, TypeParam>> matrices;
+  for (int i = 0; i < 50; i++) {
+    matrices.push_back(TestFixture::template values<2, 3>(i));
+  }
+  for (const mu::FormatStyle &kStyle :
+       {mu::FormatStyle::plain(), mu::FormatStyle::csv(),
+        mu::FormatStyle::json()}) {
+    /** action */
+    const auto kRes = TestFixture::template parse<mu::Matrix<2, 3, TypeParam>>(
+        TestFixture::text(matrices, kStyle));
+    /** assert */
+    EXPECT_EQ(kRes, matrices);
+  }
+}
+
+TYPED_TEST(ParseFixture, ListWhitespace) {
+  using V = mu::Vector<3, TypeParam>;
+  /** arrange. tabs, windows line endings and no line ending at the end */
+  const std::string kText = "1 2\t3\r\n  4 5 6\r\n\n7\t8 9";
+  /** action */
+  const auto kRes =
+      TestFixture::template parse<mu::Vector<3, TypeParam>>(kText);
+  /** assert */
+  ASSERT_EQ(kRes.size(), 3);
+  EXPECT_EQ(kRes[0], V(mu::Vector<3, int>{1, 2, 3}));
+  EXPECT_EQ(kRes[2], V(mu::Vector<3, int>{7, 8, 9}));
+  EXPECT_TRUE(TestFixture::template parse<V>("").empty());
+  EXPECT_TRUE(mu::parse_list<V>(nullptr, nullptr).empty());
+}
+
+TYPED_TEST(ParseFixture, ListErrors) {
+  using V = mu::Vector<3, TypeParam>;
+  /** action & assert */
+  /* not a multiple of the element size */
+  EXPECT_THROW(TestFixture::template parse<V>("1,2,3\n4,5"),
+               std::invalid_argument);
+  /* the offset of the invalid value */
+  try {
+    TestFixture::template parse<V>("1,2,3\n4,x5,6");
+    FAIL() << "no exception";
+  } catch (const std::invalid_argument &e) {
+    EXPECT_EQ(std::string(e.what()), "invalid value at offset 8");
+  }
+}
+
+TYPED_TEST(ParseFixture, ParallelList) {
+  /** arrange */
+  std::vector<mu::Vector<3, TypeParam>> vectors;
+  for (int i = 0; i < 3000; i++) {
+    vectors.push_back(TestFixture::template values<1, 3>(i)[0]);
+  }
+  for (const mu::FormatStyle &kStyle :
+       {mu::FormatStyle::plain(), mu::FormatStyle::csv(),
+        mu::FormatStyle::json()}) {
+    const std::string kText = TestFixture::text(vectors, kStyle);
+    for (std::size_t threads : {0, 1, 4}) {
+      mu::parallel::ThreadPool pool(threads);
+      /* chunks that split elements, a JSON text is a single line */
+      for (std::size_t chunk : {1, 100, 1 << 20}) {
+        /** action */
+        const auto kRes = mu::parallel::parse_list<mu::Vector<3, TypeParam>>(
+            pool, kText.data(), kText.data() + kText.size(), chunk);
+        /** assert */
+        EXPECT_EQ(kRes, vectors);
+      }
+    }
+  }
+}
+
+TYPED_TEST(ParseFixture, ParallelListErrors) {
+  using V = mu::Vector<3, TypeParam>;
+  /** arrange */
+  std::string text;
+  for (int i = 0; i < 1000; i++) {
+    text += "1 2 3\n";
+  }
+  mu::parallel::ThreadPool pool(3);
+  /** action & assert */
+  EXPECT_THROW(mu::parallel::parse_list<V>(
+                   pool, text.data(), text.data() + text.size() - 3, 64),
+               std::invalid_argument);
+  text[3000] = 'x';
+  EXPECT_THROW(mu::parallel::parse_list<V>(
+                   pool, text.data(), text.data() + text.size(), 64),
+               std::invalid_argument);
+}
+
+TYPED_TEST(ParseFixture, MappedFile) {
+  /** arrange */
+  const std::string kPath = ::testing::TempDir() + "mu_parse_" +
+                            std::to_string(sizeof(TypeParam)) +
+                            (std::is_integral<TypeParam>::value ? "i" : "f") +
+                            ".csv";
+  std::vector<mu::Vector<3, TypeParam>> vectors;
+  for (int i = 0; i < 100; i++) {
+    vectors.push_back(TestFixture::template values<1, 3>(i)[0]);
+  }
+  std::ofstream(kPath) << TestFixture::text(vectors, mu::FormatStyle::csv());
+  const mu::MappedFile kFile(kPath);
+  mu::parallel::ThreadPool pool(2);
+  /** action */
+  const auto kRes = mu::parse_list<mu::Vector<3, TypeParam>>(kFile);
+  const auto kParallelRes =
+      mu::parallel::parse_list<mu::Vector<3, TypeParam>>(pool, kFile);
+  /** assert */
+  EXPECT_EQ(kRes, vectors);
+  EXPECT_EQ(kParallelRes, vectors);
+  std::remove(kPath.c_str());
+}
+
+TEST(Parse, Scalar) {
+  /** arrange */
+  int i = 0;
+  std::uint8_t u = 0;
+  std::int64_t l = 0;
+  float f = 0;
+  double d = 0;
+  const auto kParse = [](const std::string &text, auto &value) {
+    return mu::parse_from(text.data(), text.data() + text.size(), value) !=
+           nullptr;
+  };
+  /** action & assert */
+  EXPECT_TRUE(kParse("  -42", i));
+  EXPECT_EQ(i, -42);
+  EXPECT_TRUE(kParse("-2147483648", i));
+  EXPECT_EQ(i, std::numeric_limits<int>::min());
+  EXPECT_FALSE(kParse("2147483648", i));
+  EXPECT_TRUE(kParse("255", u));
+  EXPECT_EQ(u, 255);
+  EXPECT_FALSE(kParse("256", u));
+  EXPECT_FALSE(kParse("-1", u));
+  EXPECT_TRUE(kParse("-9223372036854775808", l));
+  EXPECT_EQ(l, std::numeric_limits<std::int64_t>::min());
+  EXPECT_FALSE(kParse("1.5", i));
+  EXPECT_FALSE(kParse("-", i));
+  EXPECT_FALSE(kParse("", i));
+  EXPECT_TRUE(kParse("0.1", f));
+  EXPECT_EQ(f, 0.1F);
+  EXPECT_TRUE(kParse("-1.5e-3", d));
+  EXPECT_EQ(d, -1.5e-3);
+  EXPECT_TRUE(kParse("1e300", d));
+  EXPECT_FALSE(kParse("1e300", f));
+  EXPECT_FALSE(kParse("1.5x", f));
+  EXPECT_FALSE(kParse("1..5", d));
+  EXPECT_EQ(mu::parse_from(nullptr, nullptr, i), nullptr);
+}
+
+/* std::from_chars (since C++17) and parse_value_strto() (before) accept the
+ * same text with the same value */
+template <typename T>
+void expect_parse_paths(const std::string &text, bool valid) {
+  T from_chars{0};
+  T strto{0};
+  const char *first = text.data();
+  const char *last = text.data() + text.size();
+  EXPECT_EQ(mu::parse_from(first, last, from_chars) != nullptr, valid) << text;
+  EXPECT_EQ(mu::parse_value_strto(first, last, &strto), valid) << text;
+  if (valid && std::isnan(from_chars)) {
+    EXPECT_TRUE(std::isnan(strto)) << text;
+  } else if (valid) {
+    EXPECT_EQ(strto, from_chars) << text;
+  }
+}
+
+TEST(Parse, FloatingPointPaths) {
+  /** action & assert */
+  for (const std::string kText :
+       {"0.1", "-1.5e-3", ".5", "5.", "-0", "0e-999", "inf", "-Infinity",
+        "nan", "NaN", "1e-40", "1.5e-45"}) {
+    expect_parse_paths<float>(kText, true);
+    expect_parse_paths<double>(kText, true);
+  }
+  /* subnormal or out of range of float only */
+  for (const std::string kText : {"1e-310", "5e-324", "1e39", "-1e39"}) {
+    expect_parse_paths<float>(kText, false);
+    expect_parse_paths<double>(kText, true);
+  }
+  /* underflow to zero, overflow, '+', hexadecimal and incomplete values */
+  for (const std::string kText :
+       {"1e-400", "1e309", "+1", "0x10", "-0x1p3", "1e", "e5", "-", "inf0"}) {
+    expect_parse_paths<float>(kText, false);
+    expect_parse_paths<double>(kText, false);
+  }
+}
+
+TEST(Parse, VectorShortText) {
+  /** arrange */
+  const std::string kText = "[ 1, 2 ]";
+  mu::Vector<3, int> v;
+  /** action & assert */
+  EXPECT_EQ(mu::parse_from(kText.data(), kText.data() + kText.size(), v),
+            nullptr);
+}
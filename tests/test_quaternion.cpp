@@ -0,0 +1,293 @@
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/quaternion.h"
+#include "mu/vector3d.h"
+
+/**
+ * rotations are checked against the rotation matrix of the same rotation and
+ * against known results for rotations around the coordinate axes
+ */
+
+using QuaternionTypes = ::testing::Types<float, double>;
+
+template <typename T>
+class QuaternionFixture : public ::testing::Test {
+ public:
+  static constexpr T kPi = T{3.14159265358979323846L};
+
+  static mu::Vector3D<T> vec(double x, double y, double z) {
+    return mu::Vector3D<T>{static_cast<T>(x), static_cast<T>(y),
+                           static_cast<T>(z)};
+  }
+
+  static T tolerance() { return std::is_same<T, float>::value ? 1e-5 : 1e-12; }
+
+  /* an arbitrary rotation that is not around a coordinate axis */
+  static mu::Quaternion<T> arbitrary(std::size_t seed = 0) {
+    return mu::Quaternion<T>{
+        mu::Vector3D<T>{T{1}, static_cast<T>(seed) + T{2}, T{-3}},
+        T{0.7} + static_cast<T>(seed)};
+  }
+
+  static std::vector<mu::Vector3D<T>> points(std::size_t count) {
+    std::vector<mu::Vector3D<T>> ret(count);
+    for (std::size_t i = 0; i < count; i++) {
+      ret[i] = mu::Vector3D<T>{static_cast<T>(i % 5) - T{2},
+                               static_cast<T>(i % 3) + T{0.5},
+                               static_cast<T>(i % 7) * T{-0.25}};
+    }
+    return ret;
+  }
+
+  static void expect_near(const mu::Vector3D<T> &a, const mu::Vector3D<T> &b) {
+    for (std::size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(a[i], b[i], tolerance() * 10);
+    }
+  }
+
+  /* q and -q are the same rotation */
+  static void expect_same_rotation(const mu::Quaternion<T> &a,
+                                   const mu::Quaternion<T> &b) {
+    EXPECT_NEAR(std::abs(a.dot(b)), T{1}, tolerance() * 10);
+  }
+};
+
+TYPED_TEST_SUITE(QuaternionFixture, QuaternionTypes);
+
+TYPED_TEST(QuaternionFixture, ConstructorDefault) {
+  /** action */
+  constexpr mu::Quaternion<TypeParam> kQ;
+  /** assert */
+  static_assert(kQ.w() == TypeParam{1} && kQ.x() == TypeParam{0}, "");
+  EXPECT_EQ(kQ, (mu::Quaternion<TypeParam>{1, 0, 0, 0}));
+  EXPECT_EQ(kQ.rotate(TestFixture::vec(1, 2, 3)),
+            TestFixture::vec(1, 2, 3));
+}
+
+TYPED_TEST(QuaternionFixture, ConstructorComponents) {
+  /** action */
+  mu::Quaternion<TypeParam> q{1, 2, 3, 4};
+  /** assert */
+  EXPECT_EQ(q.w(), TypeParam{1});
+  EXPECT_EQ(q.x(), TypeParam{2});
+  EXPECT_EQ(q.y(), TypeParam{3});
+  EXPECT_EQ(q.z(), TypeParam{4});
+  EXPECT_EQ(q.vec(), TestFixture::vec(2, 3, 4));
+}
+
+TYPED_TEST(QuaternionFixture, ConstructorAxisAngle) {
+  /** arrange */
+  const TypeParam kHalfPi = TestFixture::kPi / 2;
+  /** action */
+  mu::Quaternion<TypeParam> qz{TestFixture::vec(0, 0, 5), kHalfPi};
+  mu::Quaternion<TypeParam> qx{TestFixture::vec(2, 0, 0), kHalfPi};
+  /** assert */
+  EXPECT_NEAR(qz.norm(), TypeParam{1}, TestFixture::tolerance());
+  TestFixture::expect_near(qz.rotate(TestFixture::vec(1, 0, 0)),
+                           TestFixture::vec(0, 1, 0));
+  TestFixture::expect_near(qx.rotate(TestFixture::vec(0, 1, 0)),
+                           TestFixture::vec(0, 0, 1));
+}
+
+TYPED_TEST(QuaternionFixture, ConstructorMatrix) {
+  /* one rotation for every branch of the conversion */
+  const TypeParam kPi = TestFixture::kPi;
+  const std::vector<mu::Quaternion<TypeParam>> kRotations{
+      TestFixture::arbitrary(),
+      {TestFixture::vec(1, 0, 0), kPi},
+      {TestFixture::vec(0, 1, 0), kPi},
+      {TestFixture::vec(0, 0, 1), kPi},
+      {TestFixture::vec(1, 1, 1), TypeParam{3}}};
+  for (const auto &kQ : kRotations) {
+    /** action */
+    mu::Quaternion<TypeParam> res{kQ.to_matrix()};
+    /** assert */
+    EXPECT_GE(res.w(), TypeParam{0});
+    TestFixture::expect_same_rotation(res, kQ);
+  }
+}
+
+TYPED_TEST(QuaternionFixture, MemberFuncToMatrix) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ = TestFixture::arbitrary();
+  const std::vector<mu::Vector3D<TypeParam>> kPoints =
+      TestFixture::points(16);
+  /** action */
+  mu::Matrix<3, 3, TypeParam> res = kQ.to_matrix();
+  /** assert */
+  EXPECT_NEAR(res.det(), TypeParam{1}, TestFixture::tolerance() * 10);
+  for (const auto &kP : kPoints) {
+    TestFixture::expect_near(res.dot(kP), kQ.rotate(kP));
+  }
+}
+
+TYPED_TEST(QuaternionFixture, MemberFuncRotate) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ = TestFixture::arbitrary();
+  const mu::Vector3D<TypeParam> kV = TestFixture::vec(1, -2, 3);
+  /** action */
+  mu::Vector3D<TypeParam> res = kQ.rotate(kV);
+  /** assert */
+  EXPECT_NEAR(res.length(), kV.length(), TestFixture::tolerance() * 10);
+  /* q v q* with the imaginary part of v */
+  mu::Quaternion<TypeParam> comp =
+      kQ * mu::Quaternion<TypeParam>{0, kV[0], kV[1], kV[2]} * kQ.conjugate();
+  EXPECT_NEAR(comp.w(), TypeParam{0}, TestFixture::tolerance() * 10);
+  TestFixture::expect_near(res, comp.vec());
+}
+
+TYPED_TEST(QuaternionFixture, MemberFuncRotateRange) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ = TestFixture::arbitrary();
+  const std::vector<mu::Vector3D<TypeParam>> kPoints =
+      TestFixture::points(37);
+  std::vector<mu::Vector3D<TypeParam>> res(kPoints.size());
+  std::vector<mu::Vector3D<TypeParam>> in_place = kPoints;
+  /** action */
+  auto end = kQ.rotate(kPoints.begin(), kPoints.end(), res.begin());
+  mu::rotate(kQ, in_place.data(), in_place.data() + in_place.size(),
+             in_place.data());
+  /** assert */
+  EXPECT_EQ(end, res.end());
+  for (std::size_t i = 0; i < kPoints.size(); i++) {
+    TestFixture::expect_near(res[i], kQ.rotate(kPoints[i]));
+    EXPECT_EQ(in_place[i], res[i]);
+  }
+}
+
+TYPED_TEST(QuaternionFixture, MemberFuncNormalize) {
+  /** arrange */
+  mu::Quaternion<TypeParam> q{1, 2, 2, 4};
+  /** action */
+  mu::Quaternion<TypeParam> res = q.normalized();
+  q.normalize();
+  /** assert */
+  EXPECT_EQ(res, q);
+  EXPECT_NEAR(q.norm(), TypeParam{1}, TestFixture::tolerance());
+  EXPECT_NEAR(q.w(), TypeParam{0.2}, TestFixture::tolerance());
+  EXPECT_NEAR(q.z(), TypeParam{0.8}, TestFixture::tolerance());
+}
+
+TYPED_TEST(QuaternionFixture, MemberFuncConjugateInverse) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ{1, 2, 3, 4};
+  const mu::Quaternion<TypeParam> kU = TestFixture::arbitrary();
+  const mu::Vector3D<TypeParam> kV = TestFixture::vec(3, 2, 1);
+  /** action */
+  mu::Quaternion<TypeParam> res = kQ * kQ.inverse();
+  mu::Vector3D<TypeParam> back = kU.conjugate().rotate(kU.rotate(kV));
+  /** assert */
+  EXPECT_EQ(kQ.conjugate(), (mu::Quaternion<TypeParam>{1, -2, -3, -4}));
+  EXPECT_NEAR(res.w(), TypeParam{1}, TestFixture::tolerance());
+  EXPECT_NEAR(res.vec().length(), TypeParam{0}, TestFixture::tolerance());
+  TestFixture::expect_near(back, kV);
+}
+
+TYPED_TEST(QuaternionFixture, OperatorMultiplication) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kA = TestFixture::arbitrary(0);
+  const mu::Quaternion<TypeParam> kB = TestFixture::arbitrary(1);
+  const mu::Vector3D<TypeParam> kV = TestFixture::vec(1, 2, 3);
+  /** action */
+  mu::Quaternion<TypeParam> res = kA * kB;
+  mu::Quaternion<TypeParam> res2 = kA;
+  res2 *= kB;
+  /** assert */
+  EXPECT_EQ(res, res2);
+  /* b is applied first */
+  TestFixture::expect_near(res.rotate(kV), kA.rotate(kB.rotate(kV)));
+  mu::Matrix<3, 3, TypeParam> comp = kA.to_matrix().dot(kB.to_matrix());
+  TestFixture::expect_near(res.rotate(kV), comp.dot(kV));
+  /* i * j = k */
+  EXPECT_EQ((mu::Quaternion<TypeParam>{0, 1, 0, 0} *
+             mu::Quaternion<TypeParam>{0, 0, 1, 0}),
+            (mu::Quaternion<TypeParam>{0, 0, 0, 1}));
+}
+
+TYPED_TEST(QuaternionFixture, OperatorEquality) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ{1, 2, 3, 4};
+  /** assert */
+  EXPECT_TRUE(kQ == (mu::Quaternion<TypeParam>{1, 2, 3, 4}));
+  EXPECT_TRUE(kQ != -kQ);
+  EXPECT_FALSE(kQ != kQ);
+}
+
+TYPED_TEST(QuaternionFixture, FreeFuncSlerp) {
+  /** arrange */
+  const TypeParam kPi = TestFixture::kPi;
+  const mu::Vector3D<TypeParam> kAxis = TestFixture::vec(0, 0, 1);
+  const mu::Quaternion<TypeParam> kA{kAxis, TypeParam{0}};
+  const mu::Quaternion<TypeParam> kB{kAxis, kPi / 2};
+  /** action */
+  mu::Quaternion<TypeParam> res0 = mu::slerp(kA, kB, TypeParam{0});
+  mu::Quaternion<TypeParam> res1 = mu::slerp(kA, kB, TypeParam{1});
+  mu::Quaternion<TypeParam> res = mu::slerp(kA, kB, TypeParam{0.25});
+  /* -b is the same rotation, the shorter path must still be taken */
+  mu::Quaternion<TypeParam> res_neg = mu::slerp(kA, -kB, TypeParam{0.25});
+  /** assert */
+  TestFixture::expect_same_rotation(res0, kA);
+  TestFixture::expect_same_rotation(res1, kB);
+  TestFixture::expect_same_rotation(res, {kAxis, kPi / 8});
+  TestFixture::expect_same_rotation(res_neg, {kAxis, kPi / 8});
+  EXPECT_NEAR(res.norm(), TypeParam{1}, TestFixture::tolerance());
+}
+
+TYPED_TEST(QuaternionFixture, FreeFuncSlerpNearlyEqual) {
+  /** arrange */
+  const mu::Vector3D<TypeParam> kAxis = TestFixture::vec(1, 1, 0);
+  const mu::Quaternion<TypeParam> kA{kAxis, TypeParam{1}};
+  const mu::Quaternion<TypeParam> kB{kAxis, TypeParam{1.001}};
+  /** action */
+  mu::Quaternion<TypeParam> res = mu::slerp(kA, kB, TypeParam{0.5});
+  mu::Quaternion<TypeParam> same = mu::slerp(kA, kA, TypeParam{0.5});
+  /** assert */
+  TestFixture::expect_same_rotation(res, {kAxis, TypeParam{1.0005}});
+  EXPECT_TRUE(std::isfinite(same.w()));
+  TestFixture::expect_same_rotation(same, kA);
+}
+
+TYPED_TEST(QuaternionFixture, FreeFuncNlerp) {
+  /** arrange */
+  const TypeParam kPi = TestFixture::kPi;
+  const mu::Vector3D<TypeParam> kAxis = TestFixture::vec(0, 1, 0);
+  const mu::Quaternion<TypeParam> kA{kAxis, -kPi / 4};
+  const mu::Quaternion<TypeParam> kB{kAxis, kPi / 4};
+  /** action */
+  mu::Quaternion<TypeParam> res = mu::nlerp(kA, kB, TypeParam{0.5});
+  mu::Quaternion<TypeParam> res_neg = mu::nlerp(kA, -kB, TypeParam{0.5});
+  /** assert */
+  EXPECT_NEAR(res.norm(), TypeParam{1}, TestFixture::tolerance());
+  /* symmetric, so the midpoint is the same as for slerp */
+  TestFixture::expect_same_rotation(res, mu::Quaternion<TypeParam>{});
+  TestFixture::expect_same_rotation(res_neg, mu::Quaternion<TypeParam>{});
+}
+
+TYPED_TEST(QuaternionFixture, Print) {
+  /** arrange */
+  const mu::Quaternion<TypeParam> kQ{1, 2, 3, 4};
+  std::stringstream ss;
+  /** action */
+  ss << kQ;
+  /** assert */
+  EXPECT_EQ(ss.str(), "[ 1, 2, 3, 4 ]");
+}
+
+TEST(Quaternion, Constexpr) {
+  /** action */
+  constexpr mu::Quaternion<double> kQ{0, 1, 0, 0};
+  constexpr mu::Vector3D<double> kRotated = kQ.rotate({1.0, 2.0, 3.0});
+  constexpr mu::Matrix<3, 3, double> kR = kQ.to_matrix();
+  constexpr mu::Quaternion<double> kProduct = kQ * kQ;
+  /** assert */
+  static_assert(kRotated[0] == 1.0 && kRotated[1] == -2.0, "");
+  static_assert(kR[0][0] == 1.0 && kR[1][1] == -1.0, "");
+  static_assert(kProduct.w() == -1.0, "");
+  EXPECT_EQ(kRotated, (mu::Vector3D<double>{1.0, -2.0, -3.0}));
+}
@@ -0,0 +1,183 @@
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/literals.h"
+#include "mu/matrix.h"
+#include "mu/rotation2d.h"
+#include "mu/vector2d.h"
+
+/**
+ * every rotation is checked against Vector2D::rotate() with the same angle.
+ * the batched rotation is checked for sizes that are smaller and larger than
+ * the SIMD register sizes, for pointers (SIMD) and other iterators
+ */
+
+using Rotation2DTypes = ::testing::Types<float, double>;
+
+template <typename T>
+class Rotation2DFixture : public ::testing::Test {
+ public:
+  static constexpr T kAngle = T{0.7};
+
+  static T tolerance() { return std::is_same<T, float>::value ? 1e-5 : 1e-12; }
+
+  static std::vector<mu::Vector2D<T>> points(std::size_t count) {
+    std::vector<mu::Vector2D<T>> ret(count);
+    for (std::size_t i = 0; i < count; i++) {
+      ret[i] = mu::Vector2D<T>{static_cast<T>(i % 5) - T{2},
+                               static_cast<T>(i % 3) + T{0.5}};
+    }
+    return ret;
+  }
+
+  static void expect_near(const mu::Vector2D<T> &a, const mu::Vector2D<T> &b) {
+    EXPECT_NEAR(a[0], b[0], tolerance() * 10);
+    EXPECT_NEAR(a[1], b[1], tolerance() * 10);
+  }
+};
+
+TYPED_TEST_SUITE(Rotation2DFixture, Rotation2DTypes);
+
+TYPED_TEST(Rotation2DFixture, ConstructorDefault) {
+  /** action */
+  constexpr mu::Rotation2D<TypeParam> kRot;
+  /** assert */
+  static_assert(kRot.cos() == TypeParam{1} && kRot.sin() == TypeParam{0}, "");
+  const mu::Vector2D<TypeParam> kV{TypeParam{1}, TypeParam{2}};
+  EXPECT_EQ(kRot.rotate(kV), kV);
+}
+
+TYPED_TEST(Rotation2DFixture, ConstructorAngle) {
+  /** action */
+  mu::Rotation2D<TypeParam> rot{TestFixture::kAngle};
+  mu::Rotation2D<TypeParam> rot_neg{-mu::pi2};
+  /** assert */
+  EXPECT_EQ(rot.cos(), std::cos(TestFixture::kAngle));
+  EXPECT_EQ(rot.sin(), std::sin(TestFixture::kAngle));
+  EXPECT_NEAR(rot.angle(), TestFixture::kAngle, TestFixture::tolerance());
+  EXPECT_NEAR(rot_neg.angle(), -mu::pi2, TestFixture::tolerance());
+}
+
+TYPED_TEST(Rotation2DFixture, ConstructorCosSin) {
+  /** action */
+  constexpr mu::Rotation2D<TypeParam> kRot{TypeParam{0}, TypeParam{1}};
+  /** assert */
+  static_assert(kRot.cos() == TypeParam{0} && kRot.sin() == TypeParam{1}, "");
+  EXPECT_NEAR(kRot.angle(), mu::pi2, TestFixture::tolerance());
+}
+
+TYPED_TEST(Rotation2DFixture, MemberFuncRotate) {
+  /** arrange */
+  const mu::Rotation2D<TypeParam> kRot{TestFixture::kAngle};
+  const std::vector<mu::Vector2D<TypeParam>> kPoints = TestFixture::points(8);
+  for (const auto &kP : kPoints) {
+    /** action */
+    mu::Vector2D<TypeParam> res = kRot.rotate(kP);
+    /** assert */
+    TestFixture::expect_near(res, kP.rotated(TestFixture::kAngle));
+    EXPECT_NEAR(res.length(), kP.length(), TestFixture::tolerance() * 10);
+  }
+}
+
+TYPED_TEST(Rotation2DFixture, MemberFuncRotateRange) {
+  /** arrange */
+  const mu::Rotation2D<TypeParam> kRot{TestFixture::kAngle};
+  for (std::size_t n : {0, 1, 2, 3, 4, 7, 8, 9, 33}) {
+    const std::vector<mu::Vector2D<TypeParam>> kPoints = TestFixture::points(n);
+    std::vector<mu::Vector2D<TypeParam>> res(n);
+    std::vector<mu::Vector2D<TypeParam>> res_it(n);
+    std::vector<mu::Vector2D<TypeParam>> in_place = kPoints;
+    /** action */
+    mu::Vector2D<TypeParam> *end =
+        kRot.rotate(kPoints.data(), kPoints.data() + n, res.data());
+    auto end_it = kRot.rotate(kPoints.begin(), kPoints.end(), res_it.begin());
+    kRot.rotate(in_place.data(), in_place.data() + n, in_place.data());
+    /** assert */
+    EXPECT_EQ(end, res.data() + n);
+    EXPECT_EQ(end_it, res_it.end());
+    for (std::size_t i = 0; i < n; i++) {
+      TestFixture::expect_near(res[i], kRot.rotate(kPoints[i]));
+      TestFixture::expect_near(res_it[i], kRot.rotate(kPoints[i]));
+      EXPECT_EQ(in_place[i], res[i]);
+    }
+  }
+}
+
+TYPED_TEST(Rotation2DFixture, MemberFuncRotateRangeNonContiguous) {
+  /** arrange */
+  const mu::Rotation2D<TypeParam> kRot{TestFixture::kAngle};
+  const std::vector<mu::Vector2D<TypeParam>> kPoints = TestFixture::points(5);
+  std::list<mu::Vector2D<TypeParam>> in_place(kPoints.begin(), kPoints.end());
+  /** action */
+  kRot.rotate(in_place.begin(), in_place.end(), in_place.begin());
+  /** assert */
+  std::size_t i = 0;
+  for (const auto &kP : in_place) {
+    TestFixture::expect_near(kP, kRot.rotate(kPoints[i++]));
+  }
+}
+
+TYPED_TEST(Rotation2DFixture, MemberFuncInverse) {
+  /** arrange */
+  const mu::Rotation2D<TypeParam> kRot{TestFixture::kAngle};
+  const mu::Vector2D<TypeParam> kV{TypeParam{3}, TypeParam{-1}};
+  /** action */
+  mu::Rotation2D<TypeParam> res = kRot.inverse();
+  /** assert */
+  EXPECT_EQ(res, mu::Rotation2D<TypeParam>{-TestFixture::kAngle});
+  TestFixture::expect_near(res.rotate(kRot.rotate(kV)), kV);
+}
+
+TYPED_TEST(Rotation2DFixture, MemberFuncToMatrix) {
+  /** arrange */
+  const mu::Rotation2D<TypeParam> kRot{TestFixture::kAngle};
+  const std::vector<mu::Vector2D<TypeParam>> kPoints = TestFixture::points(4);
+  /** action */
+  mu::Matrix<2, 2, TypeParam> res = kRot.to_matrix();
+  /** assert */
+  EXPECT_NEAR(res.det(), TypeParam{1}, TestFixture::tolerance());
+  for (const auto &kP : kPoints) {
+    TestFixture::expect_near(res.dot(kP), kRot.rotate(kP));
+  }
+}
+
+TYPED_TEST(Rotation2DFixture, OperatorMultiplication) {
+  /** arrange */
+  const mu::Rotation2D<TypeParam> kA{TestFixture::kAngle};
+  const mu::Rotation2D<TypeParam> kB{TypeParam{-2}};
+  /** action */
+  mu::Rotation2D<TypeParam> res = kA * kB;
+  mu::Rotation2D<TypeParam> res2 = kA;
+  res2 *= kB;
+  /** assert */
+  EXPECT_EQ(res, res2);
+  EXPECT_NEAR(res.angle(), TestFixture::kAngle - TypeParam{2},
+              TestFixture::tolerance());
+  EXPECT_TRUE(res != kA);
+}
+
+TYPED_TEST(Rotation2DFixture, FreeFuncRotateAngles) {
+  /** arrange */
+  const std::vector<mu::Vector2D<TypeParam>> kPoints = TestFixture::points(9);
+  std::vector<TypeParam> angles(kPoints.size());
+  for (std::size_t i = 0; i < angles.size(); i++) {
+    angles[i] = static_cast<TypeParam>(i) * TypeParam{0.4} - TypeParam{1};
+  }
+  std::vector<mu::Vector2D<TypeParam>> res(kPoints.size());
+  std::vector<mu::Vector2D<TypeParam>> in_place = kPoints;
+  /** action */
+  auto end = mu::rotate(kPoints.begin(), kPoints.end(), angles.begin(),
+                        res.begin());
+  mu::rotate(in_place.begin(), in_place.end(), angles.begin(),
+             in_place.begin());
+  /** assert */
+  EXPECT_EQ(end, res.end());
+  for (std::size_t i = 0; i < kPoints.size(); i++) {
+    TestFixture::expect_near(res[i], kPoints[i].rotated(angles[i]));
+    EXPECT_EQ(in_place[i], res[i]);
+  }
+}
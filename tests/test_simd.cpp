@@ -0,0 +1,451 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/simd.h"
+
+/**
+ * the kernels are checked against plain loops for sizes that are smaller,
+ * equal and larger than the SIMD register sizes (SSE, AVX, AVX-512), so that
+ * full registers and the remaining values are both covered
+ */
+
+/*
+ * types with and without a SIMD implementation
+ */
+using SimdTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class SimdFixture : public ::testing::Test {
+ public:
+  /* non-zero values, so that the division is defined */
+  template <std::size_t N>
+  static std::array<T, N> values(int seed) {
+    std::array<T, N> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i] = static_cast<T>(1 + (i * 7 + seed * 3) % 11);
+    }
+    return ret;
+  }
+
+  /* applies the kernel (vector <> vector) and compares it to a plain loop */
+  template <class TOp, std::size_t N, typename U = T>
+  static void check() {
+    std::array<T, N> res = values<N>(0);
+    std::array<U, N> rhs = SimdFixture<U>::template values<N>(1);
+    std::array<T, N> comp = res;
+    /** action */
+    mu::simd_apply<TOp, N>(res.data(), rhs.data());
+    /** assert */
+    for (std::size_t i = 0; i < N; i++) {
+      TOp::scalar(comp[i], rhs[i]);
+      EXPECT_EQ(res[i], comp[i]);
+    }
+  }
+
+  /* applies the kernel (vector <> scalar) and compares it to a plain loop */
+  template <class TOp, std::size_t N, typename U = T>
+  static void check_scalar() {
+    std::array<T, N> res = values<N>(0);
+    const U kScalar = static_cast<U>(3);
+    std::array<T, N> comp = res;
+    /** action */
+    mu::simd_apply_scalar<TOp, N>(res.data(), kScalar);
+    /** assert */
+    for (std::size_t i = 0; i < N; i++) {
+      TOp::scalar(comp[i], kScalar);
+      EXPECT_EQ(res[i], comp[i]);
+    }
+  }
+
+  template <class TOp>
+  static void check_sizes() {
+    check<TOp, 1>();
+    check<TOp, 3>();
+    check<TOp, 4>();
+    check<TOp, 7>();
+    check<TOp, 8>();
+    check<TOp, 16>();
+    check<TOp, 17>();
+    check<TOp, 35>();
+    check_scalar<TOp, 1>();
+    check_scalar<TOp, 3>();
+    check_scalar<TOp, 4>();
+    check_scalar<TOp, 7>();
+    check_scalar<TOp, 8>();
+    check_scalar<TOp, 16>();
+    check_scalar<TOp, 17>();
+    check_scalar<TOp, 35>();
+  }
+};
+
+TYPED_TEST_SUITE(SimdFixture, SimdTypes);
+
+TYPED_TEST(SimdFixture, Add) {
+  TestFixture::template check_sizes<mu::SimdAdd>();
+}
+
+TYPED_TEST(SimdFixture, Sub) {
+  TestFixture::template check_sizes<mu::SimdSub>();
+}
+
+TYPED_TEST(SimdFixture, Mul) {
+  TestFixture::template check_sizes<mu::SimdMul>();
+}
+
+TYPED_TEST(SimdFixture, Div) {
+  TestFixture::template check_sizes<mu::SimdDiv>();
+}
+
+TYPED_TEST(SimdFixture, Aligned) {
+  /** arrange */
+  constexpr std::size_t kAlign = mu::SimdTraits<TypeParam>::alignment;
+  const std::array<TypeParam, 35> kValues = TestFixture::template values<35>(0);
+  alignas(kAlign) std::array<TypeParam, 35> res = kValues;
+  alignas(kAlign) std::array<TypeParam, 35> res_scalar = kValues;
+  alignas(kAlign) std::array<TypeParam, 35> rhs =
+      TestFixture::template values<35>(1);
+  std::array<TypeParam, 35> comp = kValues;
+  std::array<TypeParam, 35> comp_scalar = kValues;
+  /** action */
+  mu::simd_apply_aligned<mu::SimdMul>(res.data(), rhs.data(), 35);
+  mu::simd_apply_scalar_aligned<mu::SimdSub>(res_scalar.data(), TypeParam{3},
+                                             35);
+  /** assert */
+  for (std::size_t i = 0; i < 35; i++) {
+    mu::SimdMul::scalar(comp[i], rhs[i]);
+    mu::SimdSub::scalar(comp_scalar[i], TypeParam{3});
+    EXPECT_EQ(res[i], comp[i]);
+    EXPECT_EQ(res_scalar[i], comp_scalar[i]);
+  }
+}
+
+TYPED_TEST(SimdFixture, DifferentTypes) {
+  /* no SIMD. the c++ usual arithmetic conversions apply */
+  TestFixture::template check<mu::SimdAdd, 9, short>();
+  TestFixture::template check<mu::SimdDiv, 9, long double>();
+  TestFixture::template check_scalar<mu::SimdMul, 9, short>();
+  TestFixture::template check_scalar<mu::SimdDiv, 9, long double>();
+}
+
+TYPED_TEST(SimdFixture, MulAdd) {
+  for (std::size_t n : {1, 3, 4, 7, 8, 16, 17, 35}) {
+    /** arrange */
+    const std::array<TypeParam, 35> kA = TestFixture::template values<35>(0);
+    const std::array<TypeParam, 35> kB = TestFixture::template values<35>(1);
+    std::array<TypeParam, 35> res = TestFixture::template values<35>(2);
+    std::array<double, 35> res_double{};
+    std::array<TypeParam, 35> comp = res;
+    /** action */
+    mu::simd_mul_add(res.data(), kA.data(), kB.data(), n);
+    mu::simd_mul_add(res_double.data(), kA.data(), kB.data(), n);
+    /** assert */
+    for (std::size_t i = 0; i < 35; i++) {
+      if (i < n) {
+        comp[i] += kA[i] * kB[i];
+        EXPECT_EQ(res_double[i], static_cast<double>(kA[i] * kB[i]));
+      }
+      EXPECT_EQ(res[i], comp[i]);
+    }
+  }
+}
+
+TYPED_TEST(SimdFixture, Dot) {
+  for (std::size_t n : {0, 1, 3, 4, 7, 8, 16, 17, 35}) {
+    /** arrange */
+    const std::array<TypeParam, 35> kA = TestFixture::template values<35>(0);
+    const std::array<TypeParam, 35> kB = TestFixture::template values<35>(1);
+    TypeParam comp{0};
+    for (std::size_t i = 0; i < n; i++) {
+      comp += kA[i] * kB[i];
+    }
+    /** action */
+    const TypeParam kRes = mu::simd_dot(kA.data(), kB.data(), n);
+    /** assert */
+    EXPECT_EQ(kRes, comp);
+  }
+}
+
+TYPED_TEST(SimdFixture, Sqrt) {
+  for (std::size_t n : {1, 3, 4, 7, 8, 16, 17, 35}) {
+    /** arrange */
+    std::array<TypeParam, 35> res = TestFixture::template values<35>(0);
+    std::array<TypeParam, 35> comp = res;
+    /** action */
+    mu::simd_sqrt(res.data(), n);
+    /** assert */
+    for (std::size_t i = 0; i < 35; i++) {
+      if (i < n) {
+        comp[i] = static_cast<TypeParam>(std::sqrt(comp[i]));
+      }
+      EXPECT_EQ(res[i], comp[i]);
+    }
+  }
+}
+
+TYPED_TEST(SimdFixture, RotatePairs) {
+  for (std::size_t n : {1, 2, 3, 4, 7, 8, 16, 17}) {
+    /** arrange */
+    std::array<TypeParam, 35> res = TestFixture::template values<35>(0);
+    std::array<TypeParam, 35> in_place = res;
+    const std::array<TypeParam, 35> kIn = res;
+    const TypeParam kCos = static_cast<TypeParam>(0.6);
+    const TypeParam kSin = static_cast<TypeParam>(-0.8);
+    /** action */
+    mu::simd_rotate_pairs(res.data(), kIn.data(), n, kCos, kSin);
+    mu::simd_rotate_pairs(in_place.data(), in_place.data(), n, kCos, kSin);
+    /** assert */
+    for (std::size_t i = 0; i < 35; i++) {
+      TypeParam comp = kIn[i];
+      if (i < 2 * n) {
+        const std::size_t kX = i - (i % 2);
+        comp = static_cast<TypeParam>(
+            i % 2 == 0 ? kIn[kX] * kCos - kIn[kX + 1] * kSin
+                       : kIn[kX] * kSin + kIn[kX + 1] * kCos);
+      }
+      EXPECT_NEAR(res[i], comp, std::abs(comp) * 1e-6);
+      EXPECT_EQ(in_place[i], res[i]);
+    }
+  }
+}
+
+TEST(Simd, TraitsSize) {
+  /* a register holds exactly "size" values */
+  EXPECT_EQ(mu::SimdTraits<int>::size, 1);
+  EXPECT_EQ(sizeof(mu::SimdTraits<float>::type),
+            mu::SimdTraits<float>::size * sizeof(float));
+  EXPECT_EQ(sizeof(mu::SimdTraits<double>::type),
+            mu::SimdTraits<double>::size * sizeof(double));
+}
+
+TEST(Simd, TraitsAlignment) {
+  /* the alignment of a register in memory */
+  EXPECT_EQ(mu::SimdTraits<int>::alignment, alignof(int));
+  EXPECT_EQ(mu::SimdTraits<float>::alignment,
+            alignof(mu::SimdTraits<float>::type));
+  EXPECT_EQ(mu::SimdTraits<double>::alignment,
+            alignof(mu::SimdTraits<double>::type));
+}
+
+/*
+ * mean and m2 (Welford) for floating point types only
+ */
+template <typename T>
+class SimdMeanM2Fixture : public ::testing::Test {
+ public:
+  static T epsilon() { return std::is_same<T, float>::value ? 1e-4 : 1e-12; }
+
+  /* compares the kernel to the two pass calculation in long double */
+  template <std::size_t N>
+  static void check(T offset, T tolerance) {
+    /** arrange */
+    std::array<T, N> values;
+    for (std::size_t i = 0; i < N; i++) {
+      values[i] = offset + static_cast<T>((i * 7) % 11) / 4;
+    }
+    /** action */
+    T mean;
+    T m2;
+    mu::simd_mean_m2(values.data(), N, mean, m2);
+    /** assert */
+    long double comp_mean = 0;
+    for (const auto &item : values) {
+      comp_mean += item;
+    }
+    comp_mean /= N;
+    long double comp_m2 = 0;
+    for (const auto &item : values) {
+      comp_m2 += (item - comp_mean) * (item - comp_mean);
+    }
+    EXPECT_NEAR(mean, comp_mean, std::abs(offset + 1) * tolerance);
+    EXPECT_NEAR(m2, comp_m2, (comp_m2 + 1) * tolerance);
+  }
+};
+
+using SimdFloatingTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(SimdMeanM2Fixture, SimdFloatingTypes);
+
+TYPED_TEST(SimdMeanM2Fixture, MeanM2) {
+  const TypeParam kTolerance = this->epsilon();
+  TestFixture::template check<1>(0, kTolerance);
+  TestFixture::template check<3>(0, kTolerance);
+  TestFixture::template check<16>(0, kTolerance);
+  TestFixture::template check<17>(0, kTolerance);
+  TestFixture::template check<31>(0, kTolerance);
+  TestFixture::template check<67>(0, kTolerance);
+  TestFixture::template check<1000>(0, kTolerance);
+}
+
+TYPED_TEST(SimdMeanM2Fixture, MeanM2LargeOffset) {
+  /* the sum of squares minus the squared sum loses all digits for these
+   * offsets. the error of Welford's algorithm grows with the offset relative
+   * to the spread of the values (about 1) */
+  const TypeParam kOffset = std::is_same<TypeParam, float>::value ? 1e3 : 1e6;
+  TestFixture::template check<67>(kOffset, this->epsilon() * kOffset);
+  TestFixture::template check<1000>(kOffset, this->epsilon() * kOffset);
+}
+
+TYPED_TEST(SimdMeanM2Fixture, MeanM2DifferentTypes) {
+  /** arrange */
+  const std::array<int, 5> kValues = {2, 4, 4, 5, 5};
+  /** action */
+  TypeParam mean;
+  TypeParam m2;
+  mu::simd_mean_m2(kValues.data(), kValues.size(), mean, m2);
+  /** assert */
+  EXPECT_FLOAT_EQ(mean, 4);
+  EXPECT_FLOAT_EQ(m2, 6);
+}
+
+TYPED_TEST(SimdMeanM2Fixture, MergeMeanM2) {
+  /** arrange */
+  TypeParam mean = 3;  // {2, 4}
+  TypeParam m2 = 2;
+  /** action */
+  mu::merge_mean_m2<TypeParam>(2, mean, m2, 3, 6, 2);  // {5, 6, 7}
+  mu::merge_mean_m2<TypeParam>(5, mean, m2, 0, 100, 100);
+  /** assert */
+  EXPECT_FLOAT_EQ(mean, 4.8);
+  EXPECT_FLOAT_EQ(m2, 14.8);
+}
+
+/*
+ * equality with a tolerance for floating point types only. every pair of
+ * special values is placed at several positions of otherwise equal values and
+ * the kernels are compared to the checks of a single pair
+ */
+template <typename T>
+class SimdEqualsFixture : public ::testing::Test {
+ public:
+  static std::vector<T> specials() {
+    const T kEps = mu::TypeTraits<T>::epsilon();
+    const T kMin = std::numeric_limits<T>::min();
+    const T kMax = std::numeric_limits<T>::max();
+    const T kInf = std::numeric_limits<T>::infinity();
+    return {T{0},
+            T{-0.0},
+            T{1},
+            -T{1},
+            1 + kEps / 4,
+            1 + kEps * 4,
+            std::nextafter(T{1}, T{2}),
+            kMin / 10,
+            kMin / 5,
+            kMin * 100,
+            kMin * 200,
+            std::numeric_limits<T>::denorm_min(),
+            kMax,
+            -kMax,
+            kMax / 2,
+            kInf,
+            -kInf,
+            std::numeric_limits<T>::quiet_NaN()};
+  }
+
+  /* calls check(a, b, n, x, y) for every pair x, y at several positions */
+  template <class TCheck>
+  static void for_each_pair(TCheck check) {
+    const std::vector<T> kSpecials = specials();
+    for (std::size_t n : {1, 3, 4, 7, 8, 16, 17, 35}) {
+      for (std::size_t pos : {std::size_t{0}, n / 2, n - 1}) {
+        for (const T &x : kSpecials) {
+          for (const T &y : kSpecials) {
+            std::vector<T> a(n, T{1.5});
+            std::vector<T> b(n, T{1.5});
+            a[pos] = x;
+            b[pos] = y;
+            check(a.data(), b.data(), n, x, y);
+          }
+        }
+      }
+    }
+  }
+};
+
+TYPED_TEST_SUITE(SimdEqualsFixture, SimdFloatingTypes);
+
+TYPED_TEST(SimdEqualsFixture, EqualsRelative) {
+  using T = TypeParam;
+  TestFixture::for_each_pair([](const T *a, const T *b, std::size_t n, T x,
+                                T y) {
+    EXPECT_EQ(mu::simd_equals(a, b, n), mu::TypeTraits<T>::equals(x, y))
+        << x << " " << y << " " << n;
+    EXPECT_EQ(mu::simd_equals(a, b, n, mu::Tolerance::relative()),
+              mu::TypeTraits<T>::equals(x, y));
+  });
+}
+
+TYPED_TEST(SimdEqualsFixture, EqualsUlp) {
+  using T = TypeParam;
+  TestFixture::for_each_pair([](const T *a, const T *b, std::size_t n, T x,
+                                T y) {
+    for (std::uint64_t ulps : {0, 1, 4, 1 << 30}) {
+      EXPECT_EQ(mu::simd_equals(a, b, n, mu::Tolerance::ulp(ulps)),
+                mu::equals_ulp(x, y, ulps))
+          << x << " " << y << " " << n;
+    }
+  });
+}
+
+TYPED_TEST(SimdEqualsFixture, EqualsAbsolute) {
+  using T = TypeParam;
+  TestFixture::for_each_pair([](const T *a, const T *b, std::size_t n, T x,
+                                T y) {
+    for (T max_diff : {T{0}, static_cast<T>(1e-3), T{2}}) {
+      EXPECT_EQ(mu::simd_equals(a, b, n, mu::Tolerance::absolute(max_diff)),
+                mu::equals_absolute(x, y, max_diff))
+          << x << " " << y << " " << n;
+    }
+  });
+}
+
+TYPED_TEST(SimdEqualsFixture, EqualsRelativeBoundary) {
+  using T = TypeParam;
+  /* relative differences around epsilon. every value must be checked */
+  for (const double kFactor : {0.5, 1.9, 1.99, 2.0, 2.01, 2.1}) {
+    std::vector<T> a(67);
+    std::vector<T> b(67);
+    bool comp = true;
+    for (std::size_t i = 0; i < a.size(); i++) {
+      a[i] = static_cast<T>(i % 2 == 0 ? 1 : -1) * static_cast<T>(i + 1) / 3;
+      b[i] = a[i] *
+             (1 + mu::TypeTraits<T>::epsilon() * static_cast<T>(kFactor));
+      comp = comp && mu::TypeTraits<T>::equals(a[i], b[i]);
+    }
+    EXPECT_EQ(mu::simd_equals(a.data(), b.data(), a.size()), comp) << kFactor;
+  }
+}
+
+TEST(Simd, TraitsMask) {
+  using Traits = mu::SimdTraits<float>;
+  /** arrange */
+  std::array<float, Traits::size> values;
+  values.fill(1.0F);
+  const Traits::type kOnes = Traits::load(values.data());
+  const Traits::type kTwos = Traits::set1(2.0F);
+  /** action & assert */
+  EXPECT_TRUE(Traits::all(Traits::eq(kOnes, kOnes)));
+  EXPECT_TRUE(Traits::all(Traits::lt(kOnes, kTwos)));
+  EXPECT_TRUE(Traits::all(Traits::le(kOnes, kOnes)));
+  EXPECT_FALSE(Traits::all(Traits::lt(kOnes, kOnes)));
+  EXPECT_TRUE(Traits::all(
+      Traits::mask_andnot(Traits::eq(kOnes, kOnes), Traits::eq(kOnes, kTwos))));
+  EXPECT_FALSE(Traits::all(
+      Traits::mask_and(Traits::eq(kOnes, kOnes), Traits::eq(kOnes, kTwos))));
+  EXPECT_TRUE(Traits::all(
+      Traits::mask_or(Traits::eq(kOnes, kTwos), Traits::le(kOnes, kTwos))));
+  values.back() = -2.0F;
+  EXPECT_FALSE(Traits::all(Traits::eq(Traits::abs(Traits::load(values.data())),
+                                      Traits::load(values.data()))));
+  EXPECT_TRUE(Traits::all(Traits::le(Traits::abs(Traits::load(values.data())),
+                                     kTwos)));
+  /* the portable implementation */
+  EXPECT_EQ(mu::SimdTraits<int>::abs(-3), 3);
+  EXPECT_TRUE(mu::SimdTraits<int>::all(mu::SimdTraits<int>::mask_andnot(
+      mu::SimdTraits<int>::le(1, 1), mu::SimdTraits<int>::lt(1, 1))));
+}
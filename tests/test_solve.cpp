@@ -0,0 +1,274 @@
+#include <cmath>
+#include <cstddef>
+
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/solve.h"
+#include "mu/vector.h"
+
+/**
+ * every inverse and solution is checked by multiplying it with the original
+ * matrix. the closed form sizes 1 to 4 and the LU decomposition for larger
+ * sizes are covered
+ */
+
+using SolveTypes = ::testing::Types<float, double>;
+
+template <typename T>
+class SolveFixture : public ::testing::Test {
+ public:
+  /* well conditioned, non-symmetric matrix that requires row swaps */
+  template <std::size_t N>
+  static mu::Matrix<N, N, T> values() {
+    mu::Matrix<N, N, T> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < N; j++) {
+        ret[i][j] = static_cast<T>(static_cast<int>((i * 7 + j * 5) % 9) - 4);
+      }
+      ret[i][(i + 1) % N] += static_cast<T>(4 * N + 1);
+    }
+    return ret;
+  }
+
+  /* symmetric positive definite matrix */
+  template <std::size_t N>
+  static mu::Matrix<N, N, T> spd() {
+    const mu::Matrix<N, N, T> kA = values<N>();
+    mu::Matrix<N, N, T> ret = kA.transposed().dot(kA);
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i][i] += T{1};
+    }
+    return ret;
+  }
+
+  template <std::size_t N>
+  static mu::Vector<N, T> rhs() {
+    mu::Vector<N, T> ret;
+    for (std::size_t i = 0; i < N; i++) {
+      ret[i] = static_cast<T>(static_cast<int>(i % 5) - 2);
+    }
+    return ret;
+  }
+
+  static T tolerance() { return std::is_same<T, float>::value ? 1e-4 : 1e-10; }
+
+  template <std::size_t N>
+  static void expect_identity(const mu::Matrix<N, N, T> &m) {
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < N; j++) {
+        EXPECT_NEAR(m[i][j], i == j ? T{1} : T{0}, tolerance());
+      }
+    }
+  }
+
+  template <std::size_t N>
+  static void expect_near(const mu::Vector<N, T> &a,
+                          const mu::Vector<N, T> &b) {
+    for (std::size_t i = 0; i < N; i++) {
+      EXPECT_NEAR(a[i], b[i], tolerance() * 100);
+    }
+  }
+
+  template <std::size_t N>
+  static void check_inverse() {
+    /** arrange */
+    const mu::Matrix<N, N, T> kA = values<N>();
+    /** action */
+    mu::Matrix<N, N, T> res = kA.inverse();
+    /** assert */
+    expect_identity<N>(kA.dot(res));
+    expect_identity<N>(res.dot(kA));
+  }
+
+  template <std::size_t N>
+  static void check_solve() {
+    /** arrange */
+    const mu::Matrix<N, N, T> kA = values<N>();
+    const mu::Vector<N, T> kB = rhs<N>();
+    /** action */
+    mu::Vector<N, T> res = mu::solve(kA, kB);
+    /** assert */
+    expect_near<N>(kA.dot(res), kB);
+  }
+};
+
+TYPED_TEST_SUITE(SolveFixture, SolveTypes, );
+
+TYPED_TEST(SolveFixture, MemberFuncInverse) {
+  TestFixture::template check_inverse<1>();
+  TestFixture::template check_inverse<2>();
+  TestFixture::template check_inverse<3>();
+  TestFixture::template check_inverse<4>();
+  TestFixture::template check_inverse<5>();
+  TestFixture::template check_inverse<6>();
+  TestFixture::template check_inverse<8>();
+}
+
+TYPED_TEST(SolveFixture, MemberFuncInverseSingular) {
+  /** arrange */
+  const mu::Matrix<2, 2, TypeParam> kA2{TypeParam{1}};
+  const mu::Matrix<3, 3, TypeParam> kA3{TypeParam{1}};
+  const mu::Matrix<4, 4, TypeParam> kA4{TypeParam{1}};
+  const mu::Matrix<5, 5, TypeParam> kA5{TypeParam{1}};
+  /** action */
+  mu::Matrix<2, 2, TypeParam> res2 = kA2.inverse();
+  mu::Matrix<3, 3, TypeParam> res3 = kA3.inverse();
+  mu::Matrix<4, 4, TypeParam> res4 = kA4.inverse();
+  mu::Matrix<5, 5, TypeParam> res5 = kA5.inverse();
+  /** assert */
+  EXPECT_FALSE(std::isfinite(res2[0][0]));
+  EXPECT_FALSE(std::isfinite(res3[0][0]));
+  EXPECT_FALSE(std::isfinite(res4[0][0]));
+  EXPECT_FALSE(std::isfinite(res5[4][4]));
+}
+
+TYPED_TEST(SolveFixture, FreeFuncInverse) {
+  /** arrange */
+  const mu::Matrix<3, 3, TypeParam> kA = TestFixture::template values<3>();
+  /** action */
+  mu::Matrix<3, 3, TypeParam> res = mu::inverse(kA);
+  /** assert */
+  TestFixture::template expect_identity<3>(kA.dot(res));
+}
+
+TEST(Solve, MemberFuncInverseIntegral) {
+  /** arrange */
+  const mu::Matrix<2, 2, int> kA{{4, 7}, {2, 6}};
+  /** action */
+  mu::Matrix<2, 2, double> res = kA.inverse<double>();
+  mu::Matrix<2, 2, float> res2 = mu::inverse<float>(kA);
+  /** assert */
+  EXPECT_DOUBLE_EQ(res[0][0], 0.6);
+  EXPECT_DOUBLE_EQ(res[0][1], -0.7);
+  EXPECT_DOUBLE_EQ(res[1][0], -0.2);
+  EXPECT_DOUBLE_EQ(res[1][1], 0.4);
+  EXPECT_FLOAT_EQ(res2[0][0], 0.6F);
+}
+
+TYPED_TEST(SolveFixture, FreeFuncSolve) {
+  TestFixture::template check_solve<1>();
+  TestFixture::template check_solve<2>();
+  TestFixture::template check_solve<3>();
+  TestFixture::template check_solve<4>();
+  TestFixture::template check_solve<5>();
+  TestFixture::template check_solve<8>();
+}
+
+TYPED_TEST(SolveFixture, FreeFuncSolveMatrix) {
+  /** arrange */
+  const mu::Matrix<6, 6, TypeParam> kA = TestFixture::template values<6>();
+  const mu::Matrix<6, 2, TypeParam> kB{
+      {TypeParam{1}, TypeParam{0}}, {TypeParam{2}, TypeParam{1}},
+      {TypeParam{3}, TypeParam{0}}, {TypeParam{4}, TypeParam{1}},
+      {TypeParam{5}, TypeParam{0}}, {TypeParam{6}, TypeParam{1}}};
+  const mu::Matrix<3, 3, TypeParam> kA3 = TestFixture::template values<3>();
+  const mu::Matrix<3, 3, TypeParam> kI3 = mu::eye<3, TypeParam>();
+  /** action */
+  mu::Matrix<6, 2, TypeParam> res = mu::solve(kA, kB);
+  mu::Matrix<3, 3, TypeParam> res3 = mu::solve(kA3, kI3);
+  /** assert */
+  mu::Matrix<6, 2, TypeParam> comp = kA.dot(res);
+  for (std::size_t i = 0; i < 6; i++) {
+    for (std::size_t j = 0; j < 2; j++) {
+      EXPECT_NEAR(comp[i][j], kB[i][j], TestFixture::tolerance() * 100);
+    }
+  }
+  TestFixture::template expect_identity<3>(kA3.dot(res3));
+}
+
+TYPED_TEST(SolveFixture, LU) {
+  /** arrange */
+  const mu::Matrix<5, 5, TypeParam> kA = TestFixture::template values<5>();
+  const mu::Vector<5, TypeParam> kB = TestFixture::template rhs<5>();
+  /** action */
+  const mu::LU<5, TypeParam> kLU(kA);
+  /** assert */
+  EXPECT_FALSE(kLU.singular());
+  const double kDet = mu::Matrix<5, 5, double>(kA).det();
+  EXPECT_NEAR(kLU.det(), kDet, std::abs(kDet) * TestFixture::tolerance());
+  TestFixture::template expect_near<5>(kA.dot(kLU.solve(kB)), kB);
+  TestFixture::template expect_identity<5>(kA.dot(kLU.inverse()));
+  // reassemble PA = LU
+  mu::Matrix<5, 5, TypeParam> l = mu::eye<5, TypeParam>();
+  mu::Matrix<5, 5, TypeParam> u{TypeParam{0}};
+  for (std::size_t i = 0; i < 5; i++) {
+    for (std::size_t j = 0; j < 5; j++) {
+      (j < i ? l : u)[i][j] = kLU.lu()[i][j];
+    }
+  }
+  mu::Matrix<5, 5, TypeParam> comp = l.dot(u);
+  for (std::size_t i = 0; i < 5; i++) {
+    for (std::size_t j = 0; j < 5; j++) {
+      EXPECT_NEAR(comp[i][j], kA[kLU.permutation()[i]][j],
+                  TestFixture::tolerance() * 100);
+    }
+  }
+}
+
+TYPED_TEST(SolveFixture, LUReuse) {
+  /** arrange */
+  const mu::Matrix<6, 6, TypeParam> kA = TestFixture::template values<6>();
+  const mu::LU<6, TypeParam> kLU(kA);
+  const mu::Matrix<6, 6, TypeParam> kB = mu::eye<6, TypeParam>();
+  /** action */
+  mu::Matrix<6, 6, TypeParam> res = kLU.solve(kB);
+  /** assert */
+  for (std::size_t j = 0; j < 6; j++) {
+    const mu::Vector<6, TypeParam> kX = kLU.solve(kB.transposed()[j]);
+    for (std::size_t i = 0; i < 6; i++) {
+      EXPECT_EQ(res[i][j], kX[i]);
+    }
+  }
+}
+
+TYPED_TEST(SolveFixture, LUSingular) {
+  /** arrange */
+  const mu::Matrix<3, 3, TypeParam> kA{
+      {TypeParam{1}, TypeParam{2}, TypeParam{3}},
+      {TypeParam{2}, TypeParam{4}, TypeParam{6}},
+      {TypeParam{1}, TypeParam{0}, TypeParam{1}}};
+  /** action */
+  const mu::LU<3, TypeParam> kLU(kA);
+  /** assert */
+  EXPECT_TRUE(kLU.singular());
+  EXPECT_EQ(kLU.det(), TypeParam{0});
+}
+
+TYPED_TEST(SolveFixture, Cholesky) {
+  /** arrange */
+  const mu::Matrix<6, 6, TypeParam> kA = TestFixture::template spd<6>();
+  const mu::Vector<6, TypeParam> kB = TestFixture::template rhs<6>();
+  /** action */
+  const mu::Cholesky<6, TypeParam> kChol(kA);
+  /** assert */
+  EXPECT_TRUE(kChol.positive_definite());
+  const mu::Matrix<6, 6, TypeParam> kL = kChol.l();
+  for (std::size_t i = 0; i < 6; i++) {
+    for (std::size_t j = i + 1; j < 6; j++) {
+      EXPECT_EQ(kL[i][j], TypeParam{0});
+    }
+  }
+  mu::Matrix<6, 6, TypeParam> comp = kL.dot(kL.transposed());
+  for (std::size_t i = 0; i < 6; i++) {
+    for (std::size_t j = 0; j < 6; j++) {
+      EXPECT_NEAR(comp[i][j], kA[i][j], std::abs(kA[i][j]) * 1e-5);
+    }
+  }
+  const mu::LU<6, TypeParam> kLU(kA);
+  EXPECT_NEAR(kChol.det(), kLU.det(),
+              std::abs(kLU.det()) * TestFixture::tolerance() * 10);
+  TestFixture::template expect_near<6>(kA.dot(kChol.solve(kB)), kB);
+  TestFixture::template expect_identity<6>(kA.dot(kChol.inverse()));
+  mu::Matrix<6, 6, TypeParam> res = kChol.solve(kA);
+  TestFixture::template expect_identity<6>(res);
+}
+
+TYPED_TEST(SolveFixture, CholeskyNotPositiveDefinite) {
+  /** arrange */
+  const mu::Matrix<2, 2, TypeParam> kA{{TypeParam{1}, TypeParam{2}},
+                                       {TypeParam{2}, TypeParam{1}}};
+  /** action */
+  const mu::Cholesky<2, TypeParam> kChol(kA);
+  /** assert */
+  EXPECT_FALSE(kChol.positive_definite());
+}
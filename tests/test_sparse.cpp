@@ -0,0 +1,261 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/dynmatrix.h"
+#include "mu/dynvector.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/sparse.h"
+#include "mu/vector.h"
+
+/**
+ * every SparseMatrix function is compared to the same function of a DynMatrix
+ * with the same values, for both formats (CSR and CSC)
+ */
+
+template <typename T, mu::SparseFormat F>
+struct SparseParam {
+  using type = T;
+  static constexpr mu::SparseFormat format = F;
+};
+
+using SparseTypes = ::testing::Types<
+    SparseParam<float, mu::SparseFormat::kCSR>,
+    SparseParam<float, mu::SparseFormat::kCSC>,
+    SparseParam<double, mu::SparseFormat::kCSR>,
+    SparseParam<double, mu::SparseFormat::kCSC>,
+    SparseParam<int, mu::SparseFormat::kCSR>,
+    SparseParam<int, mu::SparseFormat::kCSC>>;
+
+template <typename TParam>
+class SparseFixture : public ::testing::Test {
+ public:
+  using T = typename TParam::type;
+  using Sparse = mu::SparseMatrix<T, TParam::format>;
+
+  /* about every 7th value is non-zero. the values are small integers, so
+   * that the products are exact in any order */
+  static mu::DynMatrix<T> dense(std::size_t rows, std::size_t cols,
+                                std::size_t seed = 0) {
+    mu::DynMatrix<T> ret(rows, cols);
+    for (std::size_t i = 0; i < rows; i++) {
+      for (std::size_t j = 0; j < cols; j++) {
+        if ((i * 5 + j * 3 + seed) % 7 == 0) {
+          ret[i][j] = static_cast<T>(1 + (i + j * 2 + seed) % 9);
+        }
+      }
+    }
+    return ret;
+  }
+
+  static mu::DynVector<T> vector(std::size_t size) {
+    mu::DynVector<T> ret(size);
+    for (std::size_t i = 0; i < size; i++) {
+      ret[i] = static_cast<T>(1 + i % 4);
+    }
+    return ret;
+  }
+};
+
+TYPED_TEST_SUITE(SparseFixture, SparseTypes);
+
+TYPED_TEST(SparseFixture, ConstructorSize) {
+  /** action */
+  const typename TestFixture::Sparse kA(3, 5);
+  /** assert */
+  EXPECT_EQ(kA.rows(), 3);
+  EXPECT_EQ(kA.cols(), 5);
+  EXPECT_EQ(kA.nonzeros(), 0);
+  EXPECT_EQ(kA.to_dense(), (mu::DynMatrix<typename TestFixture::T>(3, 5)));
+}
+
+TYPED_TEST(SparseFixture, ConstructorDefault) {
+  /** action */
+  const typename TestFixture::Sparse kA;
+  /** assert */
+  EXPECT_EQ(kA.rows(), 0);
+  EXPECT_EQ(kA.cols(), 0);
+  EXPECT_EQ(kA.nonzeros(), 0);
+  EXPECT_EQ(kA.outer_index()[0], 0);
+}
+
+TYPED_TEST(SparseFixture, ConstructorTriplets) {
+  using T = typename TestFixture::T;
+  /** arrange. unordered and with two values at the same position */
+  const std::vector<mu::Triplet<T>> kTriplets = {
+      {2, 1, T{3}}, {0, 3, T{1}}, {1, 0, T{2}}, {2, 1, T{4}}, {0, 0, T{5}}};
+  /** action */
+  const typename TestFixture::Sparse kA(3, 4, kTriplets);
+  /** assert */
+  EXPECT_EQ(kA.nonzeros(), 4);
+  const mu::DynMatrix<T> kComp = {{T{5}, T{0}, T{0}, T{1}},
+                                  {T{2}, T{0}, T{0}, T{0}},
+                                  {T{0}, T{7}, T{0}, T{0}}};
+  EXPECT_EQ(kA.to_dense(), kComp);
+  for (std::size_t i = 0; i < 3; i++) {
+    for (std::size_t j = 0; j < 4; j++) {
+      EXPECT_EQ(kA(i, j), kComp[i][j]);
+    }
+  }
+}
+
+TYPED_TEST(SparseFixture, ConstructorTripletsOutOfRange) {
+  using T = typename TestFixture::T;
+  /** action & assert */
+  EXPECT_THROW(typename TestFixture::Sparse(2, 2, {{2, 0, T{1}}}),
+               std::out_of_range);
+  EXPECT_THROW(typename TestFixture::Sparse(2, 2, {{0, 2, T{1}}}),
+               std::out_of_range);
+}
+
+TYPED_TEST(SparseFixture, ConstructorDense) {
+  using T = typename TestFixture::T;
+  /** arrange */
+  const mu::DynMatrix<T> kDense = TestFixture::dense(13, 9);
+  const mu::Matrix<2, 3, T> kFixed = {{T{0}, T{1}, T{0}}, {T{2}, T{0}, T{3}}};
+  /** action */
+  const typename TestFixture::Sparse kA(kDense);
+  const typename TestFixture::Sparse kB(kFixed);
+  /** assert */
+  EXPECT_EQ(kA.to_dense(), kDense);
+  EXPECT_EQ(kB.to_dense(), mu::DynMatrix<T>(kFixed));
+  EXPECT_EQ(kB.nonzeros(), 3);
+}
+
+TYPED_TEST(SparseFixture, MemberFuncStorage) {
+  using T = typename TestFixture::T;
+  /** arrange */
+  const mu::Matrix<2, 3, T> kFixed = {{T{0}, T{1}, T{0}}, {T{2}, T{0}, T{3}}};
+  /** action */
+  const typename TestFixture::Sparse kA(kFixed);
+  /** assert. the outer index of every value is ordered */
+  const bool kCsr = TypeParam::format == mu::SparseFormat::kCSR;
+  const std::size_t kOuter = kCsr ? 2 : 3;
+  for (std::size_t o = 0; o < kOuter; o++) {
+    for (std::size_t k = kA.outer_index()[o]; k < kA.outer_index()[o + 1];
+         k++) {
+      const std::size_t kIn = kA.inner_index()[k];
+      EXPECT_EQ(kA.values()[k], kCsr ? kFixed[o][kIn] : kFixed[kIn][o]);
+      if (k > kA.outer_index()[o]) {
+        EXPECT_LT(kA.inner_index()[k - 1], kIn);
+      }
+    }
+  }
+  EXPECT_EQ(kA.outer_index()[kOuter], 3);
+}
+
+TYPED_TEST(SparseFixture, MemberFuncTransposed) {
+  /** arrange */
+  const mu::DynMatrix<typename TestFixture::T> kDense =
+      TestFixture::dense(13, 9);
+  const typename TestFixture::Sparse kA(kDense);
+  /** action */
+  const typename TestFixture::Sparse kRes = kA.transposed();
+  /** assert */
+  EXPECT_EQ(kRes.rows(), 9);
+  EXPECT_EQ(kRes.cols(), 13);
+  EXPECT_EQ(kRes.to_dense(), kDense.transposed());
+  EXPECT_EQ(mu::transposed(kA).to_dense(), kDense.transposed());
+}
+
+TYPED_TEST(SparseFixture, MemberFuncToCsrToCsc) {
+  /** arrange */
+  const mu::DynMatrix<typename TestFixture::T> kDense =
+      TestFixture::dense(13, 9);
+  const typename TestFixture::Sparse kA(kDense);
+  /** action */
+  const auto kCsr = kA.to_csr();
+  const auto kCsc = kA.to_csc();
+  /** assert */
+  EXPECT_EQ(kCsr.to_dense(), kDense);
+  EXPECT_EQ(kCsc.to_dense(), kDense);
+  EXPECT_EQ(kCsr.nonzeros(), kA.nonzeros());
+  EXPECT_EQ(kCsc.nonzeros(), kA.nonzeros());
+}
+
+TYPED_TEST(SparseFixture, MemberFuncDotDynVector) {
+  for (std::size_t rows : {1, 7, 64}) {
+    /** arrange */
+    const mu::DynMatrix<typename TestFixture::T> kDense =
+        TestFixture::dense(rows, 33);
+    const mu::DynVector<typename TestFixture::T> kV = TestFixture::vector(33);
+    /** action */
+    const mu::DynVector<typename TestFixture::T> kRes =
+        typename TestFixture::Sparse(kDense).dot(kV);
+    /** assert */
+    EXPECT_EQ(kRes, kDense.dot(kV));
+  }
+}
+
+TYPED_TEST(SparseFixture, MemberFuncDotDynVectorDifferentType) {
+  /** arrange */
+  const mu::DynMatrix<typename TestFixture::T> kDense =
+      TestFixture::dense(9, 13);
+  mu::DynVector<int> v(13);
+  for (std::size_t i = 0; i < 13; i++) {
+    v[i] = static_cast<int>(i % 3) - 1;
+  }
+  /** action */
+  const mu::DynVector<double> kRes =
+      typename TestFixture::Sparse(kDense).template dot<double>(v);
+  /** assert */
+  EXPECT_EQ(kRes, kDense.template dot<double>(v));
+}
+
+TYPED_TEST(SparseFixture, MemberFuncDotVector) {
+  using T = typename TestFixture::T;
+  /** arrange */
+  const mu::Matrix<3, 4, T> kFixed = {{T{0}, T{1}, T{0}, T{2}},
+                                      {T{2}, T{0}, T{3}, T{0}},
+                                      {T{0}, T{0}, T{0}, T{0}}};
+  const mu::Vector<4, T> kV = {T{1}, T{2}, T{3}, T{4}};
+  /** action */
+  const mu::DynVector<T> kRes = typename TestFixture::Sparse(kFixed).dot(kV);
+  /** assert */
+  EXPECT_EQ(kRes, mu::DynVector<T>(kFixed.dot(kV)));
+  EXPECT_EQ(mu::dot(typename TestFixture::Sparse(kFixed), kV), kRes);
+}
+
+TYPED_TEST(SparseFixture, UtilityFuncDot) {
+  /** arrange */
+  const mu::DynMatrix<typename TestFixture::T> kDense =
+      TestFixture::dense(9, 13);
+  const mu::DynVector<typename TestFixture::T> kV = TestFixture::vector(13);
+  /** action */
+  const mu::DynVector<typename TestFixture::T> kRes =
+      mu::dot(typename TestFixture::Sparse(kDense), kV);
+  /** assert */
+  EXPECT_EQ(kRes, kDense.dot(kV));
+}
+
+TYPED_TEST(SparseFixture, ParallelDot) {
+  for (std::size_t threads : {0, 1, 4}) {
+    mu::parallel::ThreadPool pool(threads);
+    for (std::size_t size : {1, 3, 100, 1000}) {
+      /** arrange */
+      const mu::DynMatrix<typename TestFixture::T> kDense =
+          TestFixture::dense(size, size, threads);
+      const typename TestFixture::Sparse kA(kDense);
+      const mu::DynVector<typename TestFixture::T> kV =
+          TestFixture::vector(size);
+      /** action */
+      const mu::DynVector<typename TestFixture::T> kRes =
+          mu::parallel::dot(pool, kA, kV);
+      /** assert */
+      EXPECT_EQ(kRes, kA.dot(kV));
+    }
+  }
+}
+
+TEST(Sparse, ParallelDotDefaultPool) {
+  /** arrange */
+  const mu::CsrMatrix<float> kA(
+      100, 50, {{0, 0, 1.0F}, {99, 49, 2.0F}, {50, 10, 3.0F}});
+  const mu::DynVector<float> kV(50, 1.0F);
+  /** action */
+  const mu::DynVector<float> kRes = mu::parallel::dot(kA, kV);
+  /** assert */
+  EXPECT_EQ(kRes, kA.dot(kV));
+}
@@ -0,0 +1,213 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/matrix.h"
+#include "mu/parallel.h"
+#include "mu/statistics.h"
+#include "mu/vector.h"
+
+/**
+ * the running statistics are compared to the two pass calculation over all
+ * samples in long double
+ */
+
+using StatisticsTypes = ::testing::Types<float, double>;
+
+template <typename T>
+class RunningStatsFixture : public ::testing::Test {
+ public:
+  static std::vector<mu::Vector<3, T>> samples(std::size_t count,
+                                               T offset = 0) {
+    std::vector<mu::Vector<3, T>> ret(count);
+    for (std::size_t i = 0; i < count; i++) {
+      const T kX = static_cast<T>((i * 7) % 13) / 4;
+      ret[i] = {offset + kX, offset - 2 * kX + static_cast<T>(i % 3),
+                static_cast<T>((i * 5) % 11)};
+    }
+    return ret;
+  }
+
+  static T tolerance() { return std::is_same<T, float>::value ? 1e-4 : 1e-12; }
+
+  /* two pass covariance in long double (population) */
+  static mu::Matrix<3, 3, long double> covariance(
+      const std::vector<mu::Vector<3, T>> &values) {
+    mu::Vector<3, long double> mean{0.0L};
+    for (const auto &v : values) {
+      for (std::size_t i = 0; i < 3; i++) {
+        mean[i] += v[i];
+      }
+    }
+    mean /= static_cast<long double>(values.size());
+    mu::Matrix<3, 3, long double> ret{0.0L};
+    for (const auto &v : values) {
+      for (std::size_t i = 0; i < 3; i++) {
+        for (std::size_t j = 0; j < 3; j++) {
+          ret[i][j] += (v[i] - mean[i]) * (v[j] - mean[j]);
+        }
+      }
+    }
+    return ret / static_cast<long double>(values.size());
+  }
+
+  static void expect_stats(const mu::RunningStats<3, T> &stats,
+                           const std::vector<mu::Vector<3, T>> &values,
+                           T tolerance) {
+    const mu::Matrix<3, 3, long double> kCov = covariance(values);
+    const mu::Matrix<3, 3, T> kRes = stats.covariance();
+    for (std::size_t i = 0; i < 3; i++) {
+      long double mean = 0;
+      T min = values[0][i];
+      T max = values[0][i];
+      for (const auto &v : values) {
+        mean += v[i];
+        min = std::min(min, v[i]);
+        max = std::max(max, v[i]);
+      }
+      mean /= values.size();
+      EXPECT_NEAR(stats.mean()[i], mean, (std::abs(mean) + 1) * tolerance);
+      EXPECT_EQ(stats.min()[i], min);
+      EXPECT_EQ(stats.max()[i], max);
+      EXPECT_NEAR(stats.variance()[i], kCov[i][i],
+                  (kCov[i][i] + 1) * tolerance);
+      for (std::size_t j = 0; j < 3; j++) {
+        EXPECT_NEAR(kRes[i][j], kCov[i][j],
+                    (std::abs(kCov[i][j]) + 1) * tolerance);
+      }
+    }
+  }
+};
+
+TYPED_TEST_SUITE(RunningStatsFixture, StatisticsTypes);
+
+TYPED_TEST(RunningStatsFixture, ConstructorDefault) {
+  /** action */
+  mu::RunningStats<3, TypeParam> stats;
+  /** assert */
+  EXPECT_EQ(stats.count(), 0);
+  EXPECT_EQ(stats.mean(), (mu::Vector<3, TypeParam>{TypeParam{0}}));
+  EXPECT_EQ(stats.min()[0], std::numeric_limits<TypeParam>::max());
+  EXPECT_EQ(stats.max()[0], std::numeric_limits<TypeParam>::lowest());
+  EXPECT_TRUE(std::isnan(stats.variance()[0]));
+  EXPECT_TRUE(std::isnan(stats.covariance()[0][1]));
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncPush) {
+  /** arrange */
+  const auto kSamples = TestFixture::samples(1000);
+  mu::RunningStats<3, TypeParam> stats;
+  /** action */
+  for (const auto &sample : kSamples) {
+    stats.push(sample);
+  }
+  /** assert */
+  EXPECT_EQ(stats.count(), kSamples.size());
+  TestFixture::expect_stats(stats, kSamples, TestFixture::tolerance());
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncPushLargeOffset) {
+  /** arrange */
+  const TypeParam kOffset = std::is_same<TypeParam, float>::value ? 1e3 : 1e7;
+  const auto kSamples = TestFixture::samples(1000, kOffset);
+  mu::RunningStats<3, TypeParam> stats;
+  /** action */
+  for (const auto &sample : kSamples) {
+    stats.push(sample);
+  }
+  /** assert */
+  TestFixture::expect_stats(stats, kSamples,
+                            TestFixture::tolerance() * kOffset);
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncPushSingle) {
+  /** arrange */
+  mu::RunningStats<3, TypeParam> stats;
+  const mu::Vector<3, TypeParam> kSample{TypeParam{1}, TypeParam{2},
+                                         TypeParam{3}};
+  /** action */
+  stats.push(kSample);
+  /** assert */
+  EXPECT_EQ(stats.mean(), kSample);
+  EXPECT_EQ(stats.min(), kSample);
+  EXPECT_EQ(stats.max(), kSample);
+  EXPECT_EQ(stats.variance(), (mu::Vector<3, TypeParam>{TypeParam{0}}));
+  EXPECT_EQ(stats.std(), (mu::Vector<3, TypeParam>{TypeParam{0}}));
+  EXPECT_TRUE(std::isnan(stats.sample_variance()[0]));
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncSampleVariance) {
+  /** arrange */
+  mu::RunningStats<3, TypeParam> stats;
+  for (const auto &sample : TestFixture::samples(10)) {
+    stats.push(sample);
+  }
+  /** action */
+  mu::Vector<3, TypeParam> res = stats.sample_variance();
+  mu::Matrix<3, 3, TypeParam> res2 = stats.sample_covariance();
+  /** assert */
+  for (std::size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(res[i], stats.variance()[i] * 10 / 9,
+                TestFixture::tolerance() * 10);
+    EXPECT_NEAR(res2[0][i], stats.covariance()[0][i] * 10 / 9,
+                TestFixture::tolerance() * 10);
+    EXPECT_NEAR(stats.std()[i], std::sqrt(stats.variance()[i]),
+                TestFixture::tolerance());
+  }
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncMerge) {
+  /** arrange */
+  const auto kSamples = TestFixture::samples(1000);
+  mu::RunningStats<3, TypeParam> a;
+  mu::RunningStats<3, TypeParam> b;
+  mu::RunningStats<3, TypeParam> empty;
+  for (std::size_t i = 0; i < kSamples.size(); i++) {
+    (i < 300 ? a : b).push(kSamples[i]);
+  }
+  /** action */
+  a.merge(empty).merge(b);
+  empty.merge(a);
+  /** assert */
+  EXPECT_EQ(a.count(), kSamples.size());
+  TestFixture::expect_stats(a, kSamples, TestFixture::tolerance());
+  EXPECT_EQ(empty.count(), a.count());
+  EXPECT_EQ(empty.mean(), a.mean());
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncMergeParallel) {
+  /** arrange */
+  const auto kSamples = TestFixture::samples(10000);
+  mu::parallel::ThreadPool pool(3);
+  std::vector<mu::RunningStats<3, TypeParam>> partial(10);
+  /** action */
+  mu::parallel::for_chunks(
+      pool, kSamples.size(), 1000,
+      [&kSamples, &partial](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+          partial[begin / 1000].push(kSamples[i]);
+        }
+      });
+  mu::RunningStats<3, TypeParam> res = mu::parallel::reduce(
+      pool, partial.begin(), partial.end(), mu::RunningStats<3, TypeParam>(),
+      [](mu::RunningStats<3, TypeParam> lhs,
+         const mu::RunningStats<3, TypeParam> &rhs) {
+        return lhs.merge(rhs);
+      });
+  /** assert */
+  EXPECT_EQ(res.count(), kSamples.size());
+  TestFixture::expect_stats(res, kSamples, TestFixture::tolerance());
+}
+
+TYPED_TEST(RunningStatsFixture, MemberFuncClear) {
+  /** arrange */
+  mu::RunningStats<3, TypeParam> stats;
+  stats.push(mu::Vector<3, TypeParam>{TypeParam{1}});
+  /** action */
+  stats.clear();
+  /** assert */
+  EXPECT_EQ(stats.count(), 0);
+  EXPECT_EQ(stats.mean(), (mu::Vector<3, TypeParam>{TypeParam{0}}));
+}
@@ -1,3 +1,7 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 #include "gtest/gtest.h"
 #include "mu/typetraits.h"
 
@@ -55,4 +59,76 @@ TYPED_TEST(TypeTraitsFixture, EqualsRelative) {
   bool res = mu::TypeTraits<TypeParam>::equals(lhs, rhs);
   /** assert */
   EXPECT_FALSE(res);
-}
\ No newline at end of file
+}
+
+TYPED_TEST(TypeTraitsFixture, EqualsToleranceRelative) {
+  /** arrange */
+  const TypeParam kA = 1;
+  const TypeParam kB = 1 + mu::TypeTraits<TypeParam>::epsilon() / 4;
+  const TypeParam kC = 1 + mu::TypeTraits<TypeParam>::epsilon() * 4;
+  /** action & assert. the same as TypeTraits<T>::equals */
+  EXPECT_TRUE(mu::equals(kA, kB, mu::Tolerance::relative()));
+  EXPECT_FALSE(mu::equals(kA, kC, mu::Tolerance::relative()));
+}
+
+TYPED_TEST(TypeTraitsFixture, EqualsToleranceUlp) {
+  /** arrange */
+  const TypeParam kA = 1;
+  const TypeParam kInf = std::numeric_limits<TypeParam>::infinity();
+  const TypeParam kMin = std::numeric_limits<TypeParam>::denorm_min();
+  TypeParam b = kA;
+  for (int i = 0; i < 3; i++) {
+    b = std::nextafter(b, TypeParam{2});
+  }
+  /** action & assert */
+  EXPECT_TRUE(mu::equals(kA, b, mu::Tolerance::ulp(3)));
+  EXPECT_TRUE(mu::equals(b, kA, mu::Tolerance::ulp(3)));
+  EXPECT_FALSE(mu::equals(kA, b, mu::Tolerance::ulp(2)));
+  EXPECT_TRUE(mu::equals(kA, kA, mu::Tolerance::ulp(0)));
+  /* across zero: -min, -0, +0, +min */
+  EXPECT_TRUE(mu::equals(TypeParam{-0.0}, TypeParam{0}, mu::Tolerance::ulp(0)));
+  EXPECT_TRUE(mu::equals(-kMin, kMin, mu::Tolerance::ulp(2)));
+  EXPECT_FALSE(mu::equals(-kMin, kMin, mu::Tolerance::ulp(1)));
+  /* the largest finite value is one ulp away from infinity */
+  EXPECT_TRUE(mu::equals(kInf, kInf, mu::Tolerance::ulp(0)));
+  EXPECT_TRUE(mu::equals(std::numeric_limits<TypeParam>::max(), kInf,
+                         mu::Tolerance::ulp(1)));
+  EXPECT_FALSE(mu::equals(-kInf, kInf, mu::Tolerance::ulp(1000)));
+}
+
+TYPED_TEST(TypeTraitsFixture, EqualsToleranceAbsolute) {
+  /** arrange */
+  const TypeParam kA = 1000;
+  const TypeParam kB = 1000.5;
+  const TypeParam kInf = std::numeric_limits<TypeParam>::infinity();
+  /** action & assert */
+  EXPECT_TRUE(mu::equals(kA, kB, mu::Tolerance::absolute(0.5)));
+  EXPECT_FALSE(mu::equals(kA, kB, mu::Tolerance::absolute(0.25)));
+  EXPECT_TRUE(mu::equals(kInf, kInf, mu::Tolerance::absolute(0)));
+  EXPECT_FALSE(mu::equals(kInf, -kInf, mu::Tolerance::absolute(1e30)));
+}
+
+TYPED_TEST(TypeTraitsFixture, EqualsToleranceNaN) {
+  /** arrange */
+  const TypeParam kNaN = std::numeric_limits<TypeParam>::quiet_NaN();
+  const std::uint64_t kMaxUlps = std::numeric_limits<std::uint64_t>::max();
+  /** action & assert. NaN is never equal */
+  EXPECT_FALSE(mu::equals(kNaN, kNaN, mu::Tolerance::relative()));
+  EXPECT_FALSE(mu::equals(kNaN, kNaN, mu::Tolerance::ulp(kMaxUlps)));
+  EXPECT_FALSE(mu::equals(kNaN, TypeParam{1}, mu::Tolerance::ulp(kMaxUlps)));
+  EXPECT_FALSE(mu::equals(kNaN, kNaN, mu::Tolerance::absolute(1e30)));
+}
+
+TEST(TypeTraits, EqualsToleranceIntegral) {
+  /** action & assert. one ulp is a difference of one */
+  EXPECT_TRUE(mu::equals(3, 3, mu::Tolerance::relative()));
+  EXPECT_FALSE(mu::equals(3, 4, mu::Tolerance::relative()));
+  EXPECT_TRUE(mu::equals(3, 5, mu::Tolerance::ulp(2)));
+  EXPECT_FALSE(mu::equals(5, 3, mu::Tolerance::ulp(1)));
+  EXPECT_TRUE(mu::equals(3U, 5U, mu::Tolerance::absolute(2)));
+  EXPECT_FALSE(mu::equals(5U, 3U, mu::Tolerance::absolute(1.5)));
+  EXPECT_TRUE(mu::equals(std::numeric_limits<int>::min(),
+                         std::numeric_limits<int>::max(),
+                         mu::Tolerance::ulp(
+                             std::numeric_limits<std::uint32_t>::max())));
+}
@@ -1,5 +1,9 @@
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <initializer_list>
+#include <random>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -133,8 +137,200 @@ TYPED_TEST(UtilityFixture, sin) {
   }
 }
 
+TYPED_TEST(UtilityFixture, sincos) {
+  for (TypeParam v : this->pi_values) {
+    TypeParam sin;
+    TypeParam cos;
+    mu::sincos(v, sin, cos);
+    EXPECT_TRUE(mu::TypeTraits<TypeParam>::equals(sin, std::sin(v)));
+    EXPECT_TRUE(mu::TypeTraits<TypeParam>::equals(cos, std::cos(v)));
+  }
+}
+
 TYPED_TEST(UtilityFixture, tan) {
   for (TypeParam v : this->pi_values) {
     EXPECT_TRUE(mu::TypeTraits<TypeParam>::equals(mu::tan(v), std::tan(v)));
   }
 }
+
+/*******************************determinant************************************/
+
+/*
+ * integral and floating point types
+ */
+using DeterminantTypes = ::testing::Types<int, float, double>;
+
+template <typename T>
+class DeterminantFixture : public ::testing::Test {
+ public:
+  /* the determinant is exact for integral types. floating point types
+   * are compared by their relative epsilon */
+  static bool equals(T lhs, T rhs) {
+    return mu::TypeTraits<T>::equals(lhs, rhs);
+  }
+};
+
+TYPED_TEST_SUITE(DeterminantFixture, DeterminantTypes);
+
+TYPED_TEST(DeterminantFixture, Size1x1) {
+  std::array<std::array<TypeParam, 1>, 1> m = {{{-7}}};
+  EXPECT_TRUE(this->equals(mu::calc_det(m), -7));
+}
+
+TYPED_TEST(DeterminantFixture, Size2x2) {
+  std::array<std::array<TypeParam, 2>, 2> m = {{{3, 8}, {4, 6}}};
+  EXPECT_TRUE(this->equals(mu::calc_det(m), -14));
+}
+
+TYPED_TEST(DeterminantFixture, Size3x3) {
+  std::array<std::array<TypeParam, 3>, 3> m = {
+      {{2, -3, 1}, {2, 0, -1}, {1, 4, 5}}};
+  EXPECT_TRUE(this->equals(mu::calc_det(m), 49));
+}
+
+TYPED_TEST(DeterminantFixture, Size4x4) {
+  std::array<std::array<TypeParam, 4>, 4> m = {
+      {{1, 0, 2, -1}, {3, 0, 0, 5}, {2, 1, 4, -3}, {1, 0, 5, 0}}};
+  EXPECT_TRUE(this->equals(mu::calc_det(m), 30));
+}
+
+TYPED_TEST(DeterminantFixture, Size5x5Pivoting) {
+  /* the first pivot is zero */
+  std::array<std::array<TypeParam, 5>, 5> m = {{{0, 2, 1, 3, -1},
+                                                {4, 1, 0, 2, 2},
+                                                {1, -2, 3, 0, 1},
+                                                {2, 0, -1, 1, 3},
+                                                {3, 1, 2, -2, 0}}};
+  EXPECT_TRUE(this->equals(mu::calc_det(m), -234));
+}
+
+TYPED_TEST(DeterminantFixture, Size6x6Pivoting) {
+  std::array<std::array<TypeParam, 6>, 6> m = {{{0, 1, 2, 0, 1, -1},
+                                                {1, 0, 3, 1, 0, 2},
+                                                {2, -1, 0, 1, 3, 0},
+                                                {0, 2, 1, -2, 1, 1},
+                                                {1, 1, 0, 3, 0, 2},
+                                                {-1, 0, 2, 1, 1, 0}}};
+  EXPECT_TRUE(this->equals(mu::calc_det(m), 430));
+}
+
+TYPED_TEST(DeterminantFixture, Size6x6Singular) {
+  /* the last row is the sum of the first two rows */
+  std::array<std::array<TypeParam, 6>, 6> m = {{{1, 2, 0, 3, 1, 4},
+                                                {2, 1, 1, 0, 2, 1},
+                                                {0, 3, 1, 1, 2, 2},
+                                                {4, 0, 2, 1, 1, 3},
+                                                {1, 1, 3, 2, 0, 1},
+                                                {3, 3, 1, 3, 3, 5}}};
+  /* rounding errors of the factorization are absolute near zero */
+  EXPECT_NEAR(mu::calc_det(m), 0, 1e-3);
+}
+
+TYPED_TEST(DeterminantFixture, Size10x10) {
+  /* upper triangular matrix with the diagonal 1..10. the rows are reversed,
+   * which is an odd permutation (45 swaps) */
+  std::array<std::array<TypeParam, 10>, 10> m{};
+  for (std::size_t i = 0; i < 10; i++) {
+    for (std::size_t j = i; j < 10; j++) {
+      m[9 - i][j] = static_cast<TypeParam>(i == j ? i + 1 : (i + j) % 3);
+    }
+  }
+  EXPECT_TRUE(this->equals(mu::calc_det(m), -3628800));
+}
+
+TYPED_TEST(DeterminantFixture, DynamicSizeEqualsFixedSize) {
+  std::array<std::array<TypeParam, 5>, 5> m = {{{0, 2, 1, 3, -1},
+                                                {4, 1, 0, 2, 2},
+                                                {1, -2, 3, 0, 1},
+                                                {2, 0, -1, 1, 3},
+                                                {3, 1, 2, -2, 0}}};
+  std::vector<std::vector<TypeParam>> vv;
+  for (const auto& row : m) {
+    vv.emplace_back(row.begin(), row.end());
+  }
+  EXPECT_EQ(mu::calc_det(vv), mu::calc_det(m));
+}
+
+/*****************************sorting network**********************************/
+
+/*
+ * integral and floating point types
+ */
+using SortNetworkTypes = ::testing::Types<int, float, double>;
+
+template <typename T>
+class SortNetworkFixture : public ::testing::Test {
+ public:
+  /* a network sorts every input if it sorts every input of zeros and ones
+   * (0-1 principle). all of them are checked for small sizes, shuffled
+   * values for larger sizes */
+  template <std::size_t N>
+  static void check() {
+    std::array<T, N> res;
+    if (N <= 16) {
+      for (std::size_t bits = 0; bits < (std::size_t{1} << N); bits++) {
+        for (std::size_t i = 0; i < N; i++) {
+          res[i] = static_cast<T>((bits >> i) & 1U);
+        }
+        check<N>(res);
+      }
+    } else {
+      std::mt19937 gen(N);
+      for (std::size_t i = 0; i < N; i++) {
+        res[i] = static_cast<T>(i % 7);
+      }
+      for (int i = 0; i < 100; i++) {
+        std::shuffle(res.begin(), res.end(), gen);
+        check<N>(res);
+      }
+    }
+  }
+
+  template <std::size_t N>
+  static void check(std::array<T, N> res) {
+    std::array<T, N> comp = res;
+    /** action */
+    mu::sort_network<N>(res.data());
+    /** assert */
+    std::sort(comp.begin(), comp.end());
+    EXPECT_EQ(res, comp);
+  }
+
+  template <std::size_t... I>
+  static void check_all(std::index_sequence<I...> /*sizes*/) {
+    static_cast<void>(std::initializer_list<int>{(check<I>(), 0)...});
+  }
+};
+
+TYPED_TEST_SUITE(SortNetworkFixture, SortNetworkTypes);
+
+TYPED_TEST(SortNetworkFixture, AllSizes) {
+  TestFixture::check_all(std::make_index_sequence<mu::kSortNetworkMax + 1>{});
+}
+
+TYPED_TEST(SortNetworkFixture, SortFixedLargeSize) {
+  /** arrange */
+  std::array<TypeParam, 100> res;
+  for (std::size_t i = 0; i < res.size(); i++) {
+    res[i] = static_cast<TypeParam>((i * 37) % 100);
+  }
+  std::array<TypeParam, 100> comp = res;
+  /** action */
+  mu::sort_fixed<100>(res.data());
+  /** assert */
+  std::sort(comp.begin(), comp.end());
+  EXPECT_EQ(res, comp);
+}
+
+TEST(SortNetwork, SignedZero) {
+  /** arrange */
+  std::array<float, 4> res = {0.0F, -0.0F, -1.0F, 0.0F};
+  /** action */
+  mu::sort_network<4>(res.data());
+  /** assert */
+  EXPECT_EQ(res[0], -1.0F);
+  /* both zeros are kept, neither one is duplicated */
+  EXPECT_EQ(std::count_if(res.begin(), res.end(),
+                          [](float v) { return std::signbit(v) && v == 0; }),
+            1);
+}
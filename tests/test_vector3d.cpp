@@ -1,5 +1,9 @@
+#include <cmath>
+#include <cstddef>
+
 #include "gtest/gtest.h"
 #include "mu/vector.h"
+#include "mu/literals.h"
 #include "mu/vector3d.h"
 #include "vector_type.h"
 
@@ -110,3 +114,138 @@ TYPED_TEST(Vector3DTypeFixture, MemberVarZConst) {
   EXPECT_EQ(z, this->z);
   EXPECT_TRUE(noexcept(kObj.z()));
 }
+
+TYPED_TEST(Vector3DTypeFixture, MemberFuncCross) {
+  /** arrange */
+  using T = typename TypeParam::value_type;
+  const TypeParam kObj{this->x, this->y, this->z};
+  const TypeParam kOther{this->z, this->x, this->y};
+  /** action */
+  TypeParam res = kObj.cross(kOther);
+  TypeParam res_free = mu::cross(kObj, kOther);
+  /** assert */
+  EXPECT_EQ(res.x(), T(this->y * this->y - this->z * this->x));
+  EXPECT_EQ(res.y(), T(this->z * this->z - this->x * this->y));
+  EXPECT_EQ(res.z(), T(this->x * this->x - this->y * this->z));
+  EXPECT_EQ(res, res_free);
+  /* perpendicular to both */
+  EXPECT_EQ(res.dot(kObj), T{0});
+  EXPECT_EQ(res.dot(kOther), T{0});
+  /* anti-commutative */
+  EXPECT_EQ(kOther.cross(kObj), T{-1} * res);
+  EXPECT_EQ(kObj.cross(kObj), (mu::zeros<3, T>()));
+}
+
+TYPED_TEST(Vector3DTypeFixture, MemberFuncUnitCross) {
+  /** arrange */
+  const TypeParam kObj{this->x, this->y, this->z};
+  const TypeParam kOther{this->z, this->x, this->y};
+  /** action */
+  mu::Vector3D<double> res = kObj.template unit_cross<double>(kOther);
+  /** assert */
+  mu::Vector3D<double> comp = mu::Vector3D<double>(kObj.cross(kOther));
+  comp.normalize();
+  for (std::size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(res[i], comp[i], 1e-12);
+  }
+  EXPECT_NEAR(res.length(), 1.0, 1e-12);
+}
+
+TYPED_TEST(Vector3DTypeFixture, MemberFuncCosAngle) {
+  /** arrange */
+  const TypeParam kObj{this->x, this->y, this->z};
+  const TypeParam kOther{this->z, this->x, this->y};
+  /** action */
+  double res = kObj.template cos_angle<double>(kOther);
+  double res_self = kObj.template cos_angle<double>(kObj);
+  double res_opposite = kObj.template cos_angle<double>(
+      typename TypeParam::value_type{-1} * kObj);
+  /** assert */
+  const double kComp =
+      kObj.template dot<double>(kOther) /
+      (kObj.template length<double>() * kOther.template length<double>());
+  EXPECT_NEAR(res, kComp, 1e-6);
+  EXPECT_NEAR(res_self, 1.0, 1e-12);
+  EXPECT_NEAR(res_opposite, -1.0, 1e-12);
+}
+
+TYPED_TEST(Vector3DTypeFixture, MemberFuncProject) {
+  /** arrange */
+  using T = typename TypeParam::value_type;
+  TypeParam obj{this->x, this->y, this->z};
+  const TypeParam kOnto{T{0}, T{1}, T{0}};
+  /** action */
+  TypeParam res = obj.projected(kOnto);
+  obj.project(kOnto);
+  /** assert */
+  EXPECT_EQ(res, (TypeParam{T{0}, this->y, T{0}}));
+  EXPECT_EQ(obj, res);
+}
+
+TYPED_TEST(Vector3DTypeFixture, MemberFuncProjectNonUnit) {
+  /** arrange */
+  using T = typename TypeParam::value_type;
+  TypeParam obj{T{1}, T{1}, T{0}};
+  const TypeParam kNegative{T{-3}, T{1}, T{0}};
+  const TypeParam kOnto{T{2}, T{0}, T{0}};
+  /** action */
+  TypeParam res = obj.projected(kOnto);
+  TypeParam res_negative = kNegative.projected(kOnto);
+  obj.project(kOnto);
+  /** assert */
+  EXPECT_EQ(res, (TypeParam{T{1}, T{0}, T{0}}));
+  EXPECT_EQ(obj, res);
+  EXPECT_EQ(res_negative, (TypeParam{T{-3}, T{0}, T{0}}));
+}
+
+TYPED_TEST(Vector3DTypeFixture, MemberFuncReflect) {
+  /** arrange */
+  using T = typename TypeParam::value_type;
+  TypeParam obj{this->x, this->y, this->z};
+  const TypeParam kNormal{T{0}, T{0}, T{1}};
+  /** action */
+  TypeParam res = obj.reflected(kNormal);
+  obj.reflect(kNormal);
+  /** assert */
+  EXPECT_EQ(res, (TypeParam{this->x, this->y, T(-this->z)}));
+  EXPECT_EQ(obj, res);
+  /* reflecting twice is the identity */
+  EXPECT_EQ(res.reflected(kNormal), (TypeParam{this->x, this->y, this->z}));
+}
+
+TEST(Vector3D, MemberFuncRotate) {
+  /** arrange */
+  const mu::Vector3D<double> kAxis{1.0, 2.0, -2.0};
+  const mu::Vector3D<double> kOrig{0.5, -1.5, 3.0};
+  const double kAngle = 0.9;
+  mu::Vector3D<double> obj = kOrig;
+  /** action */
+  obj.rotate(kAxis, kAngle);
+  mu::Vector3D<double> res = kOrig.rotated(kAxis, -kAngle);
+  /** assert */
+  EXPECT_NEAR(obj.length(), kOrig.length(), 1e-12);
+  /* the component along the axis doesn't change */
+  EXPECT_NEAR(obj.dot(kAxis), kOrig.dot(kAxis), 1e-12);
+  /* the cosine of the angle in the plane perpendicular to the axis */
+  mu::Vector3D<double> orig_perp = kOrig - kOrig.projected(kAxis);
+  mu::Vector3D<double> obj_perp = obj - obj.projected(kAxis);
+  EXPECT_NEAR(orig_perp.cos_angle(obj_perp), std::cos(kAngle), 1e-12);
+  /* the right hand rule */
+  EXPECT_GT(orig_perp.cross(obj_perp).dot(kAxis), 0.0);
+  res.rotate(kAxis, kAngle);
+  for (std::size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(res[i], kOrig[i], 1e-12);
+  }
+}
+
+TEST(Vector3D, MemberFuncRotateAxes) {
+  /** arrange */
+  mu::Vector3D<float> obj{1.0F, 0.0F, 0.0F};
+  const mu::Vector3D<float> kZ{0.0F, 0.0F, 2.0F};
+  /** action */
+  obj.rotate(kZ, mu::pi2);
+  /** assert */
+  EXPECT_NEAR(obj.x(), 0.0F, 1e-6F);
+  EXPECT_NEAR(obj.y(), 1.0F, 1e-6F);
+  EXPECT_NEAR(obj.z(), 0.0F, 1e-6F);
+}
@@ -0,0 +1,304 @@
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mu/vector2d.h"
+#include "mu/vector3d.h"
+#include "mu/vectorbatch.h"
+
+/**
+ * every batch operation is compared to the same operation on the single
+ * Vectors. the batch sizes are smaller, equal and larger than the SIMD
+ * register sizes, so that full registers and the remaining values are both
+ * covered
+ */
+
+/*
+ * types with and without a SIMD implementation
+ */
+using VectorBatchTypes = ::testing::Types<float, double, int>;
+
+template <typename T>
+class VectorBatchFixture : public ::testing::Test {
+ public:
+  /* non-zero values, so that the division is defined */
+  template <std::size_t N, typename U = T>
+  static std::vector<mu::Vector<N, U>> values(std::size_t count, int seed) {
+    std::vector<mu::Vector<N, U>> ret(count);
+    for (std::size_t i = 0; i < count; i++) {
+      for (std::size_t c = 0; c < N; c++) {
+        ret[i][c] = static_cast<U>(1 + (i * 7 + c * 5 + seed * 3) % 11);
+      }
+    }
+    return ret;
+  }
+
+  /* a Vector of this type from integral values */
+  template <typename... TArgs>
+  static mu::Vector<sizeof...(TArgs), T> vec(TArgs... args) {
+    return {static_cast<T>(args)...};
+  }
+
+  static constexpr std::size_t kSizes[] = {0, 1, 3, 4, 7, 8, 16, 17, 35};
+};
+
+template <typename T>
+constexpr std::size_t VectorBatchFixture<T>::kSizes[];
+
+TYPED_TEST_SUITE(VectorBatchFixture, VectorBatchTypes);
+
+TYPED_TEST(VectorBatchFixture, ConstructorDefault) {
+  /** action */
+  mu::VectorBatch<3, TypeParam> batch;
+  /** assert */
+  EXPECT_EQ(batch.size(), 0);
+  EXPECT_TRUE(batch.empty());
+}
+
+TYPED_TEST(VectorBatchFixture, ConstructorCount) {
+  /** action */
+  mu::VectorBatch<3, TypeParam> batch(5);
+  /** assert */
+  EXPECT_EQ(batch.size(), 5);
+  for (std::size_t i = 0; i < 5; i++) {
+    EXPECT_EQ(batch.get(i), TestFixture::vec(0, 0, 0));
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, ConstructorCountValue) {
+  /** arrange */
+  const mu::Vector<3, TypeParam> kValue = TestFixture::vec(1, 2, 3);
+  /** action */
+  mu::VectorBatch<3, TypeParam> batch(5, kValue);
+  /** assert */
+  EXPECT_EQ(batch.size(), 5);
+  for (std::size_t i = 0; i < 5; i++) {
+    EXPECT_EQ(batch.get(i), kValue);
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, ConstructorInitializerList) {
+  /** action */
+  mu::VectorBatch<2, TypeParam> batch = {
+      TestFixture::vec(1, 2), TestFixture::vec(3, 4), TestFixture::vec(5, 6)};
+  /** assert */
+  EXPECT_EQ(batch.size(), 3);
+  EXPECT_EQ(batch.get(1), TestFixture::vec(3, 4));
+}
+
+TYPED_TEST(VectorBatchFixture, GatherScatter) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const std::vector<mu::Vector<3, TypeParam>> kVectors =
+        TestFixture::template values<3>(n, 0);
+    std::vector<mu::Vector<3, TypeParam>> res(n);
+    /** action */
+    mu::VectorBatch<3, TypeParam> batch(kVectors.begin(), kVectors.end());
+    auto last = batch.scatter(res.begin());
+    /** assert */
+    EXPECT_EQ(last, res.end());
+    EXPECT_EQ(res, kVectors);
+    for (std::size_t i = 0; i < n; i++) {
+      for (std::size_t c = 0; c < 3; c++) {
+        EXPECT_EQ(batch.lane(c)[i], kVectors[i][c]);
+      }
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, GatherScatterDerived) {
+  /** arrange */
+  const std::vector<mu::Vector3D<TypeParam>> kVectors = {
+      TestFixture::vec(1, 2, 3), TestFixture::vec(4, 5, 6)};
+  std::vector<mu::Vector3D<TypeParam>> res;
+  mu::VectorBatch<3, TypeParam> batch;
+  /** action */
+  batch.gather(kVectors.begin(), kVectors.end());
+  batch.scatter(std::back_inserter(res));
+  /** assert */
+  EXPECT_EQ(res, kVectors);
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncGetSetPushBack) {
+  /** arrange */
+  mu::VectorBatch<2, TypeParam> batch;
+  /** action */
+  batch.push_back(TestFixture::vec(1, 2));
+  batch.push_back(TestFixture::vec(3, 4));
+  batch.set(0, TestFixture::vec(5, 6));
+  /** assert */
+  EXPECT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch.get(0), TestFixture::vec(5, 6));
+  EXPECT_EQ(batch.get(1), TestFixture::vec(3, 4));
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncResizeReserveClear) {
+  /** arrange */
+  mu::VectorBatch<2, TypeParam> batch = {TestFixture::vec(1, 2)};
+  /** action */
+  batch.reserve(10);
+  batch.resize(3);
+  /** assert */
+  EXPECT_EQ(batch.size(), 3);
+  EXPECT_EQ(batch.get(0), TestFixture::vec(1, 2));
+  EXPECT_EQ(batch.get(2), TestFixture::vec(0, 0));
+  /** action */
+  batch.clear();
+  /** assert */
+  EXPECT_TRUE(batch.empty());
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncDot) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const auto kLhs = TestFixture::template values<3>(n, 0);
+    const auto kRhs = TestFixture::template values<3>(n, 1);
+    const mu::VectorBatch<3, TypeParam> kBatchLhs(kLhs.begin(), kLhs.end());
+    const mu::VectorBatch<3, TypeParam> kBatchRhs(kRhs.begin(), kRhs.end());
+    /** action */
+    std::vector<TypeParam> res = kBatchLhs.dot(kBatchRhs);
+    std::vector<double> res_double = kBatchLhs.template dot<double>(kBatchRhs);
+    /** assert */
+    ASSERT_EQ(res.size(), n);
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(res[i], kLhs[i].dot(kRhs[i]));
+      EXPECT_EQ(res_double[i], static_cast<double>(kLhs[i].dot(kRhs[i])));
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncDotDifferentTypes) {
+  /** arrange */
+  const auto kLhs = TestFixture::template values<3>(9, 0);
+  const auto kRhs = TestFixture::template values<3, short>(9, 1);
+  const mu::VectorBatch<3, TypeParam> kBatchLhs(kLhs.begin(), kLhs.end());
+  const mu::VectorBatch<3, short> kBatchRhs(kRhs.begin(), kRhs.end());
+  /** action */
+  std::vector<double> res = kBatchLhs.template dot<double>(kBatchRhs);
+  /** assert */
+  for (std::size_t i = 0; i < 9; i++) {
+    EXPECT_EQ(res[i], kLhs[i].template dot<double>(kRhs[i]));
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncLength) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const auto kVectors = TestFixture::template values<3>(n, 0);
+    const mu::VectorBatch<3, TypeParam> kBatch(kVectors.begin(),
+                                               kVectors.end());
+    /** action */
+    std::vector<TypeParam> res = kBatch.length();
+    std::vector<double> res_double = kBatch.template length<double>();
+    /** assert */
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(res[i], kVectors[i].length());
+      EXPECT_EQ(res_double[i], kVectors[i].template length<double>());
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncNormalize) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    auto vectors = TestFixture::template values<3>(n, 0);
+    mu::VectorBatch<3, TypeParam> batch(vectors.begin(), vectors.end());
+    /** action */
+    mu::VectorBatch<3, TypeParam> res = batch.normalized();
+    batch.normalize();
+    /** assert */
+    for (std::size_t i = 0; i < n; i++) {
+      vectors[i].normalize();
+      EXPECT_EQ(batch.get(i), vectors[i]);
+      EXPECT_EQ(res.get(i), vectors[i]);
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, MemberFuncRotate) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const auto kVectors = TestFixture::template values<2>(n, 0);
+    mu::VectorBatch<2, TypeParam> batch(kVectors.begin(), kVectors.end());
+    const TypeParam kAngle = static_cast<TypeParam>(2);
+    /** action */
+    mu::VectorBatch<2, TypeParam> res = batch.rotated(0.5);
+    batch.rotate(kAngle);
+    /** assert */
+    for (std::size_t i = 0; i < n; i++) {
+      mu::Vector2D<TypeParam> v = kVectors[i];
+      EXPECT_EQ(res.get(i), v.rotated(0.5));
+      v.rotate(kAngle);
+      EXPECT_EQ(batch.get(i), v);
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, OperatorsBatch) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const auto kLhs = TestFixture::template values<3>(n, 0);
+    const auto kRhs = TestFixture::template values<3>(n, 1);
+    const mu::VectorBatch<3, TypeParam> kBatchLhs(kLhs.begin(), kLhs.end());
+    const mu::VectorBatch<3, TypeParam> kBatchRhs(kRhs.begin(), kRhs.end());
+    /** action */
+    const auto kPlus = kBatchLhs + kBatchRhs;
+    const auto kMinus = kBatchLhs - kBatchRhs;
+    const auto kMultiply = kBatchLhs * kBatchRhs;
+    const auto kDivide = kBatchLhs / kBatchRhs;
+    /** assert */
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(kPlus.get(i), kLhs[i] + kRhs[i]);
+      EXPECT_EQ(kMinus.get(i), kLhs[i] - kRhs[i]);
+      EXPECT_EQ(kMultiply.get(i), kLhs[i] * kRhs[i]);
+      EXPECT_EQ(kDivide.get(i), kLhs[i] / kRhs[i]);
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, OperatorsVector) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const auto kLhs = TestFixture::template values<3>(n, 0);
+    const mu::Vector<3, TypeParam> kRhs = TestFixture::vec(2, 3, 4);
+    mu::VectorBatch<3, TypeParam> plus(kLhs.begin(), kLhs.end());
+    mu::VectorBatch<3, TypeParam> minus = plus;
+    mu::VectorBatch<3, TypeParam> multiply = plus;
+    mu::VectorBatch<3, TypeParam> divide = plus;
+    /** action */
+    plus += kRhs;
+    minus -= kRhs;
+    multiply *= kRhs;
+    divide /= kRhs;
+    /** assert */
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(plus.get(i), kLhs[i] + kRhs);
+      EXPECT_EQ(minus.get(i), kLhs[i] - kRhs);
+      EXPECT_EQ(multiply.get(i), kLhs[i] * kRhs);
+      EXPECT_EQ(divide.get(i), kLhs[i] / kRhs);
+    }
+  }
+}
+
+TYPED_TEST(VectorBatchFixture, OperatorsScalar) {
+  for (std::size_t n : TestFixture::kSizes) {
+    /** arrange */
+    const auto kLhs = TestFixture::template values<3>(n, 0);
+    const mu::VectorBatch<3, TypeParam> kBatch(kLhs.begin(), kLhs.end());
+    const TypeParam kScalar = 3;
+    /** action */
+    const auto kPlus = kBatch + kScalar;
+    const auto kMinus = kBatch - kScalar;
+    const auto kMultiply = kBatch * kScalar;
+    const auto kDivide = kBatch / kScalar;
+    const auto kDivideDouble = kBatch / 1.5;
+    /** assert */
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(kPlus.get(i), kLhs[i] + kScalar);
+      EXPECT_EQ(kMinus.get(i), kLhs[i] - kScalar);
+      EXPECT_EQ(kMultiply.get(i), kLhs[i] * kScalar);
+      EXPECT_EQ(kDivide.get(i), kLhs[i] / kScalar);
+      EXPECT_EQ(kDivideDouble.get(i), kLhs[i] / 1.5);
+    }
+  }
+}
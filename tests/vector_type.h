@@ -170,6 +170,30 @@ TYPED_TEST_P(VectorTypeFixture, MemberFuncAtConst) {
   EXPECT_THAT(res, ::testing::ContainerEq(kObj));
 }
 
+TYPED_TEST_P(VectorTypeFixture, MemberFuncData) {
+  /** arrange */
+  TypeParam obj{this->values};
+  /** action */
+  typename TestFixture::value_type* p = obj.data();
+  /** assert */
+  for (std::size_t i = 0; i < obj.size(); i++) {
+    EXPECT_EQ(p + i, &obj[i]);
+  }
+  EXPECT_TRUE(noexcept(obj.data()));
+}
+
+TYPED_TEST_P(VectorTypeFixture, MemberFuncDataConst) {
+  /** arrange */
+  const TypeParam kObj{this->values};
+  /** action */
+  const typename TestFixture::value_type* p = kObj.data();
+  /** assert */
+  for (std::size_t i = 0; i < kObj.size(); i++) {
+    EXPECT_EQ(p + i, &kObj[i]);
+  }
+  EXPECT_TRUE(noexcept(kObj.data()));
+}
+
 TYPED_TEST_P(VectorTypeFixture, MemberFuncSize) {
   /** arrange */
   TypeParam obj{this->values};
@@ -252,6 +276,22 @@ TYPED_TEST_P(VectorTypeFixture, MemberFuncSum) {
   EXPECT_FLOAT_EQ(sum, comp);
 }
 
+TYPED_TEST_P(VectorTypeFixture, MemberFuncEquals) {
+  using T = typename TypeParam::value_type;
+  /** arrange. one value is larger by one */
+  const TypeParam kA{this->values};
+  TypeParam b{this->values};
+  b[0] += T{1};
+  /** action & assert */
+  EXPECT_TRUE(kA.equals(kA, mu::Tolerance::relative()));
+  EXPECT_FALSE(kA.equals(b, mu::Tolerance::relative()));
+  EXPECT_TRUE(kA.equals(b, mu::Tolerance::absolute(1)));
+  EXPECT_FALSE(kA.equals(b, mu::Tolerance::absolute(0.5)));
+  EXPECT_FALSE(kA.equals(b, mu::Tolerance::ulp(0)));
+  EXPECT_EQ(kA.equals(b, mu::Tolerance::ulp(1)),
+            std::is_integral<T>::value);
+}
+
 TYPED_TEST_P(VectorTypeFixture, MemberFuncMean) {
   /** arrange */
   TypeParam obj{this->values};
@@ -318,6 +358,39 @@ TYPED_TEST_P(VectorTypeFixture, MemberFuncStdConvertedType) {
   EXPECT_FLOAT_EQ(std, comp);
 }
 
+TYPED_TEST_P(VectorTypeFixture, MemberFuncVariance) {
+  /** arrange */
+  TypeParam obj{this->values};
+  /** action */
+  typename TypeParam::value_type var = obj.variance();
+  /** assert */
+  typename TypeParam::value_type mean =
+      std::accumulate(this->values.begin(), this->values.end(),
+                      static_cast<typename TypeParam::value_type>(0));
+  mean /= this->values.size();
+  typename TypeParam::value_type sum{0};
+  for (const auto &item : this->values) {
+    sum += mu::pow(item - mean, 2);
+  }
+  typename TypeParam::value_type comp = sum / this->values.size();
+  EXPECT_FLOAT_EQ(var, comp);
+}
+
+TYPED_TEST_P(VectorTypeFixture, MemberFuncMeanAndStd) {
+  /** arrange */
+  TypeParam obj{this->values};
+  /** action */
+  auto res = obj.mean_and_std();
+  auto res2 = obj.template mean_and_std<typename TestFixture::ConvertedType>();
+  /** assert */
+  EXPECT_FLOAT_EQ(res.first, obj.mean());
+  EXPECT_FLOAT_EQ(res.second, obj.std());
+  EXPECT_FLOAT_EQ(res2.first,
+                  obj.template mean<typename TestFixture::ConvertedType>());
+  EXPECT_FLOAT_EQ(res2.second,
+                  obj.template std<typename TestFixture::ConvertedType>());
+}
+
 TYPED_TEST_P(VectorTypeFixture, MemberFuncLength) {
   /** arrange */
   TypeParam obj{this->values};
@@ -639,14 +712,16 @@ REGISTER_TYPED_TEST_SUITE_P(
     ConstructorVariadicTemplateAssignmentSize2, DestructorDefault,
     ConstructorCopy, ConstructorMove, OperatorCopyAssignment,
     OperatorMoveAssignment, OperatorBrackets, OperatorBracketsConst,
-    MemberFuncAt, MemberFuncAtConst, MemberFuncSize, MemberFuncBegin,
-    MemberFuncBeginConst, MemberFuncEnd, MemberFuncEndConst, MemberFuncMin,
-    MemberFuncMax, MemberFuncSum, MemberFuncMean, MemberFuncMeanConvertType,
-    MemberFuncStd, MemberFuncStdConvertedType, MemberFuncLength,
-    MemberFuncLengthConvertType, MemberFuncNormalize, MemberFuncNormalized,
-    MemberFuncFlip, MemberFuncFlipped, MemberFuncSort, MemberFuncSortLambda,
-    MemberFuncSorted, MemberFuncSortedLambda, OperatorStreamOut, UtilityFuncMin,
-    UtilityFuncMax, UtilityFuncSum, UtilityFuncMean, UtilityFuncMeanConvertType,
+    MemberFuncAt, MemberFuncAtConst, MemberFuncData, MemberFuncDataConst,
+    MemberFuncSize, MemberFuncBegin, MemberFuncBeginConst, MemberFuncEnd,
+    MemberFuncEndConst, MemberFuncMin, MemberFuncMax, MemberFuncSum,
+    MemberFuncEquals, MemberFuncMean, MemberFuncMeanConvertType, MemberFuncStd,
+    MemberFuncStdConvertedType, MemberFuncVariance, MemberFuncMeanAndStd,
+    MemberFuncLength, MemberFuncLengthConvertType,
+    MemberFuncNormalize, MemberFuncNormalized, MemberFuncFlip,
+    MemberFuncFlipped, MemberFuncSort, MemberFuncSortLambda, MemberFuncSorted,
+    MemberFuncSortedLambda, OperatorStreamOut, UtilityFuncMin, UtilityFuncMax,
+    UtilityFuncSum, UtilityFuncMean, UtilityFuncMeanConvertType,
     UtilityFuncFlip, UtilityFuncFlipped, UtilityFuncSort, UtilityFuncSortLambda,
     UtilityFuncSorted, UtilityFuncSortedLambda, UtilityFuncOnes,
     UtilityFuncZeros);